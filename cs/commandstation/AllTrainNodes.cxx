@@ -34,6 +34,8 @@
 
 #include "commandstation/AllTrainNodes.hxx"
 
+#include <algorithm>
+
 #include "commandstation/FdiXmlGenerator.hxx"
 #include "commandstation/FindProtocolServer.hxx"
 #include "commandstation/TrainDb.hxx"
@@ -152,21 +154,20 @@ openlcb::TrainImpl* AllTrainNodes::get_train_impl(int id) {
 }
 
 AllTrainNodes::Impl* AllTrainNodes::find_node(openlcb::Node* node) {
-  for (auto* i : trains_) {
-    if (i->node_ == node) {
-      return i;
-    }
-  }
-  return nullptr;
+  auto it = nodeIndex_.find(node);
+  if (it == nodeIndex_.end()) return nullptr;
+  return it->second;
 }
 
 AllTrainNodes::Impl* AllTrainNodes::find_node(openlcb::NodeID node_id) {
-  for (auto* i : trains_) {
-    if (i->node_->node_id() == node_id) {
-      return i;
-    }
-  }
-  return nullptr;
+  auto it = nodeIdIndex_.find(node_id);
+  if (it == nodeIdIndex_.end()) return nullptr;
+  return it->second;
+}
+
+void AllTrainNodes::unindex_impl(Impl* impl) {
+  nodeIndex_.erase(impl->node_);
+  nodeIdIndex_.erase(impl->node_->node_id());
 }
 
 /// Returns a traindb entry or nullptr if the id is too high.
@@ -322,6 +323,14 @@ class AllTrainNodes::TrainFDISpace : public openlcb::MemorySpace {
     return false;
   }
 
+  /// Drops the cached train if it is the given one (or unconditionally if
+  /// impl is nullptr). The next access will re-generate the FDI.
+  void invalidate(Impl* impl) {
+    if (!impl || impl_ == impl) {
+      impl_ = nullptr;
+    }
+  }
+
   address_t max_address() override {
     // We don't really know how long this space is; 16 MB is an upper bound.
     return 16 << 20;
@@ -348,7 +357,9 @@ class AllTrainNodes::TrainFDISpace : public openlcb::MemorySpace {
  private:
   void reset_file() {
     auto e = parent_->get_traindb_entry(impl_->id);
-    e->start_read_functions();
+    if (e) {
+      e->start_read_functions();
+    }
     gen_.reset(std::move(e));
   }
 
@@ -389,6 +400,13 @@ class AllTrainNodes::TrainConfigSpace : public openlcb::FileMemorySpace {
                                   again);
   }
 
+  /// Drops the cached train if it is the given one.
+  void invalidate(Impl* impl) {
+    if (impl_ == impl) {
+      impl_ = nullptr;
+    }
+  }
+
  private:
   unsigned offset_;
   AllTrainNodes* parent_;
@@ -433,6 +451,13 @@ class AllTrainNodes::TrainCDISpace : public openlcb::MemorySpace {
     return proxySpace_->read(source, dst, len, error, again);
   }
 
+  /// Drops the cached train if it is the given one.
+  void invalidate(Impl* impl) {
+    if (impl_ == impl) {
+      impl_ = nullptr;
+    }
+  }
+
   AllTrainNodes* parent_;
   // Train object structure.
   Impl* impl_{nullptr};
@@ -441,17 +466,23 @@ class AllTrainNodes::TrainCDISpace : public openlcb::MemorySpace {
   openlcb::ReadOnlyMemoryBlock tmpCdi_;
 };
 
-class AllTrainNodes::TrainNodesUpdater : private DefaultConfigUpdateListener {
+class AllTrainNodes::TrainNodesUpdater : private DefaultConfigUpdateListener,
+                                        private TrainDbListener {
  public:
-  TrainNodesUpdater(AllTrainNodes* parent) : parent_(parent) {}
+  TrainNodesUpdater(AllTrainNodes* parent) : parent_(parent) {
+    parent_->db_->add_listener(this);
+  }
+
+  ~TrainNodesUpdater() { parent_->db_->remove_listener(this); }
 
   // ConfigUpdate interface
   UpdateAction apply_configuration(int fd, bool initial_load,
                                    BarrierNotifiable* done) override {
     AutoNotify n(done);
     size_t file_end = parent_->db_->load_from_file(fd, initial_load);
-    parent_->update_config();
     if (initial_load) {
+      // Later loads notify us about the changed trains one by one.
+      parent_->update_config();
       parent_->configSpace_.reset(new TrainConfigSpace(fd, parent_, file_end));
       parent_->memoryConfigService_->registry()->insert(
           nullptr, openlcb::MemoryConfigDefs::SPACE_CONFIG,
@@ -462,6 +493,12 @@ class AllTrainNodes::TrainNodesUpdater : private DefaultConfigUpdateListener {
 
   void factory_reset(int fd) override {}
 
+  // TrainDbListener interface
+  void train_changed(unsigned train_id, openlcb::NodeID old_node,
+                     unsigned flags) override {
+    parent_->train_changed(train_id, old_node, flags);
+  }
+
  private:
   AllTrainNodes* parent_;
 };
@@ -499,17 +536,8 @@ void AllTrainNodes::update_config() {
     Impl* impl = trains_[id];
     auto entry = db_->find_entry(impl->node_->node_id(), impl->id);
     if (entry) continue;
-    // Delete current node.
-    trains_[id] = nullptr;
-    impl->node_->iface()->delete_local_node(impl->node_);
-    delete impl;
-    impl = trains_.back();
-    trains_.pop_back();
-    if (impl) {
-      trains_[id] = impl;
-      --id;  // to be incremented by the loop
-      continue;
-    }  // else we're at the end of the loop anyway
+    remove_impl(id);
+    --id;  // to be incremented by the loop
   }
   // Now create new implementations for all new trains.
   for (unsigned train_id = 0; train_id < db_->size(); ++train_id) {
@@ -526,6 +554,52 @@ void AllTrainNodes::update_config() {
   }
 }
 
+void AllTrainNodes::train_changed(unsigned train_id, openlcb::NodeID old_node,
+                                  unsigned flags) {
+  if (flags & TrainDbListener::REMOVED) {
+    Impl* impl = find_node(old_node);
+    if (impl) {
+      auto it = std::find(trains_.begin(), trains_.end(), impl);
+      HASSERT(it != trains_.end());
+      remove_impl(it - trains_.begin());
+    }
+  }
+  if (flags & TrainDbListener::ADDED) {
+    auto entry = db_->get_entry(train_id);
+    if (!entry) return;
+    Impl* impl = find_node(entry->get_traction_node());
+    if (impl) {
+      // Was allocated dynamically or exists from the compiled-in database.
+      impl->id = train_id;
+    } else {
+      create_impl(train_id, entry->get_legacy_drive_mode(),
+                  entry->get_legacy_address());
+    }
+  }
+  if (flags & TrainDbListener::FUNCTIONS_CHANGED) {
+    Impl* impl = find_node(old_node);
+    if (impl) {
+      fdiSpace_->invalidate(impl);
+    }
+  }
+  // RENAMED needs no action: SNIP and the find protocol read the name from
+  // the traindb entry at the time of the query.
+}
+
+void AllTrainNodes::remove_impl(unsigned index) {
+  Impl* impl = trains_[index];
+  unindex_impl(impl);
+  fdiSpace_->invalidate(impl);
+  if (configSpace_) {
+    configSpace_->invalidate(impl);
+  }
+  cdiSpace_->invalidate(impl);
+  impl->node_->iface()->delete_local_node(impl->node_);
+  delete impl;
+  trains_[index] = trains_.back();
+  trains_.pop_back();
+}
+
 AllTrainNodes::Impl* AllTrainNodes::create_impl(int train_id, DccMode mode,
                                                 int address) {
   Impl* impl = new Impl;
@@ -577,6 +651,8 @@ AllTrainNodes::Impl* AllTrainNodes::create_impl(int train_id, DccMode mode,
     trains_.push_back(impl);
     impl->node_ =
         new openlcb::TrainNodeForProxy(tractionService_, impl->train_);
+    nodeIndex_[impl->node_] = impl;
+    nodeIdIndex_[impl->node_->node_id()] = impl;
     impl->eventHandler_ =
         new openlcb::FixedEventProducer<openlcb::TractionDefs::IS_TRAIN_EVENT>(
             impl->node_);
@@ -35,6 +35,7 @@
 #ifndef _BRACZ_COMMANDSTATION_ALLTRAINNODES_HXX_
 #define _BRACZ_COMMANDSTATION_ALLTRAINNODES_HXX_
 
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -92,10 +93,22 @@ class AllTrainNodes {
   /// impl_.
   Impl* create_impl(int train_id, DccMode mode, int address);
 
+  /// Removes an Impl from the lookup maps before it gets deleted.
+  void unindex_impl(Impl* impl);
+
+  /// Removes trains_[index] and deletes the train node. The last train gets
+  /// moved into its place.
+  void remove_impl(unsigned index);
+
   /// Callback from the updater to notify that the traindb config should be
   /// consulted.
   void update_config();
 
+  /// Callback from the updater when a single traindb entry changed. See
+  /// TrainDbListener::train_changed.
+  void train_changed(unsigned train_id, openlcb::NodeID old_node,
+                     unsigned flags);
+
   // Externally owned.
   TrainDb* db_;
   openlcb::TrainService* tractionService_;
@@ -103,6 +116,12 @@ class AllTrainNodes {
 
   /// All train nodes that we know about.
   std::vector<Impl*> trains_;
+  /// Lookup index of trains_ by the virtual node. Kept in sync by
+  /// create_impl() and remove_impl().
+  std::map<openlcb::Node*, Impl*> nodeIndex_;
+  /// Lookup index of trains_ by node ID. Kept in sync by create_impl() and
+  /// remove_impl().
+  std::map<openlcb::NodeID, Impl*> nodeIdIndex_;
 
   friend class FindProtocolServer;
   std::unique_ptr<FindProtocolServer> findProtocolServer_;
@@ -0,0 +1,155 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file DccLatencyMonitor.cxx
+ *
+ * Measures how long DCC packets take from the train implementation to the
+ * track interface.
+ *
+ * @author Balazs Racz
+ * @date 18 Oct 2026
+ */
+
+#include "commandstation/DccLatencyMonitor.hxx"
+
+#include <endian.h>
+#include <string.h>
+
+#include "os/os.h"
+
+namespace commandstation {
+
+DccLatencyMonitor* DccLatencyMonitor::instance_ = nullptr;
+
+/// Read-only memory space with the histogram counters.
+class DccLatencyMonitor::Space : public openlcb::MemorySpace {
+ public:
+  Space(DccLatencyMonitor* parent, openlcb::MemoryConfigHandler* handler)
+      : parent_(parent), handler_(handler) {
+    handler_->registry()->insert(nullptr, SPACE_ID, this);
+  }
+
+  ~Space() { handler_->registry()->erase(nullptr, SPACE_ID, this); }
+
+  bool read_only() override { return true; }
+
+  address_t max_address() override { return SPACE_SIZE - 1; }
+
+  size_t write(address_t destination, const uint8_t* data, size_t len,
+               errorcode_t* error, Notifiable* again) override {
+    *error = openlcb::MemoryConfigDefs::ERROR_WRITE_TO_RO;
+    return 0;
+  }
+
+  size_t read(address_t source, uint8_t* dst, size_t len, errorcode_t* error,
+              Notifiable* again) override {
+    size_t result = parent_->serialize(source, dst, len);
+    *error = result ? 0 : openlcb::MemoryConfigDefs::ERROR_OUT_OF_BOUNDS;
+    return result;
+  }
+
+ private:
+  DccLatencyMonitor* parent_;
+  openlcb::MemoryConfigHandler* handler_;
+};
+
+DccLatencyMonitor::DccLatencyMonitor(
+    openlcb::MemoryConfigHandler* memory_config) {
+  HASSERT(!instance_);
+  if (memory_config) {
+    space_ = new Space(this, memory_config);
+  }
+  instance_ = this;
+}
+
+DccLatencyMonitor::~DccLatencyMonitor() {
+  instance_ = nullptr;
+  delete space_;
+}
+
+void DccLatencyMonitor::packet_filled(Buffer<dcc::Packet>* b,
+                                      long long enqueue_time,
+                                      long long dequeue_time) {
+  AtomicHolder h(this);
+  if (enqueue_time) {
+    histograms_[STAGE_QUEUE].add(dequeue_time - enqueue_time);
+  }
+  if (inFlightCount_ >= MAX_IN_FLIGHT) {
+    // The track interface did not report the oldest packets. Forgets them.
+    inFlightBegin_ = (inFlightBegin_ + 1) % MAX_IN_FLIGHT;
+    --inFlightCount_;
+  }
+  InFlight& e = inFlight_[(inFlightBegin_ + inFlightCount_) % MAX_IN_FLIGHT];
+  e.packet = b;
+  e.enqueueTime = enqueue_time;
+  e.dequeueTime = dequeue_time;
+  ++inFlightCount_;
+}
+
+void DccLatencyMonitor::packet_sent(Buffer<dcc::Packet>* b) {
+  long long now = os_get_time_monotonic();
+  AtomicHolder h(this);
+  // Packets are sent in the order they were filled. Entries before the
+  // matching one belong to packets that were dropped on the way.
+  while (inFlightCount_) {
+    InFlight& e = inFlight_[inFlightBegin_];
+    inFlightBegin_ = (inFlightBegin_ + 1) % MAX_IN_FLIGHT;
+    --inFlightCount_;
+    if (e.packet != b) continue;
+    histograms_[STAGE_SEND].add(now - e.dequeueTime);
+    if (e.enqueueTime) {
+      histograms_[STAGE_TOTAL].add(now - e.enqueueTime);
+    }
+    return;
+  }
+}
+
+void DccLatencyMonitor::reset() {
+  AtomicHolder h(this);
+  for (auto& hist : histograms_) {
+    hist = LatencyHistogram();
+  }
+}
+
+size_t DccLatencyMonitor::serialize(unsigned offset, uint8_t* dst,
+                                    size_t len) {
+  uint32_t data[NUM_STAGES * LatencyHistogram::NUM_BUCKETS];
+  {
+    AtomicHolder h(this);
+    for (unsigned s = 0; s < NUM_STAGES; ++s) {
+      for (unsigned i = 0; i < LatencyHistogram::NUM_BUCKETS; ++i) {
+        data[s * LatencyHistogram::NUM_BUCKETS + i] =
+            htobe32(histograms_[s].count[i]);
+      }
+    }
+  }
+  if (offset >= SPACE_SIZE) return 0;
+  if (len > SPACE_SIZE - offset) len = SPACE_SIZE - offset;
+  memcpy(dst, ((uint8_t*)data) + offset, len);
+  return len;
+}
+
+}  // namespace commandstation
@@ -0,0 +1,172 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file DccLatencyMonitor.hxx
+ *
+ * Measures how long DCC packets take from the train implementation to the
+ * track interface.
+ *
+ * @author Balazs Racz
+ * @date 18 Oct 2026
+ */
+
+#ifndef _COMMANDSTATION_DCCLATENCYMONITOR_HXX_
+#define _COMMANDSTATION_DCCLATENCYMONITOR_HXX_
+
+#include <stdint.h>
+
+#include "dcc/Packet.hxx"
+#include "executor/Executor.hxx"
+#include "openlcb/MemoryConfig.hxx"
+#include "utils/Atomic.hxx"
+#include "utils/Buffer.hxx"
+#include "utils/constants.hxx"
+
+/// Non-zero if the command station should create a DccLatencyMonitor.
+DECLARE_CONST(dcc_latency_monitor);
+
+namespace commandstation {
+
+/** Fixed-bucket histogram of latencies. Bucket 0 counts latencies below
+ * BASE_USEC; every further bucket doubles the upper bound; the last bucket
+ * counts everything that did not fit anywhere else. */
+struct LatencyHistogram {
+  static constexpr unsigned NUM_BUCKETS = 16;
+  static constexpr unsigned BASE_USEC = 128;
+
+  /// @returns the bucket a latency belongs to.
+  static unsigned bucket_for(long long nsec) {
+    long long usec = nsec / 1000;
+    unsigned idx = 0;
+    while (idx < NUM_BUCKETS - 1 && usec >= ((long long)BASE_USEC << idx)) {
+      ++idx;
+    }
+    return idx;
+  }
+
+  void add(long long nsec) { ++count[bucket_for(nsec)]; }
+
+  /// @returns the number of samples in all buckets.
+  uint32_t total() const {
+    uint32_t sum = 0;
+    for (unsigned i = 0; i < NUM_BUCKETS; ++i) {
+      sum += count[i];
+    }
+    return sum;
+  }
+
+  uint32_t count[NUM_BUCKETS] = {0};
+};
+
+/** Collects latency histograms of the DCC packet path. The hooks in
+ * UpdateProcessor and TrackIfSend call into the monitor only if one exists,
+ * so without an instance the cost is a single pointer check per packet.
+ *
+ * Each filled packet is timestamped when UpdateProcessor takes the update
+ * request (enqueue, only for urgent updates such as a speed change), when it
+ * fills the packet (dequeue) and when the track interface hands it off to
+ * the wire. */
+class DccLatencyMonitor : private Atomic {
+ public:
+  enum Stage {
+    /// From notify_update() until UpdateProcessor fills the packet.
+    STAGE_QUEUE = 0,
+    /// From filling the packet until the hand-off to the wire.
+    STAGE_SEND,
+    /// From notify_update() until the hand-off to the wire.
+    STAGE_TOTAL,
+    NUM_STAGES
+  };
+
+  /// Memory space exporting the histograms. Every stage has NUM_BUCKETS
+  /// big-endian 32-bit counters, in the order of the Stage enum.
+  static constexpr uint8_t SPACE_ID = 0xE0;
+
+  /// @param memory_config if not null, the histograms are exported there in
+  /// SPACE_ID.
+  DccLatencyMonitor(openlcb::MemoryConfigHandler* memory_config = nullptr);
+  ~DccLatencyMonitor();
+
+  /// @returns the active monitor, or nullptr if latency monitoring is
+  /// disabled.
+  static DccLatencyMonitor* active() { return instance_; }
+
+  /// Called when a packet was filled and is passed on to the track.
+  /// @param b the packet buffer
+  /// @param enqueue_time when the update was requested, or 0 for refresh
+  /// packets
+  /// @param dequeue_time when the packet was filled
+  void packet_filled(Buffer<dcc::Packet>* b, long long enqueue_time,
+                     long long dequeue_time);
+
+  /// Called when the track interface handed the packet off to the wire.
+  void packet_sent(Buffer<dcc::Packet>* b);
+
+  /// @returns a copy of the histogram of a given stage.
+  LatencyHistogram histogram(Stage stage) {
+    AtomicHolder h(this);
+    return histograms_[stage];
+  }
+
+  /// Clears all histograms.
+  void reset();
+
+  /// Number of bytes in the exported memory space.
+  static constexpr unsigned SPACE_SIZE =
+      NUM_STAGES * LatencyHistogram::NUM_BUCKETS * 4;
+
+  /// Copies bytes of the exported memory space.
+  /// @param offset first byte to copy
+  /// @param dst where to copy
+  /// @param len maximum number of bytes to copy
+  /// @returns the number of bytes copied; 0 if offset is beyond the end.
+  size_t serialize(unsigned offset, uint8_t* dst, size_t len);
+
+ private:
+  class Space;
+
+  /// Packets between filling and hand-off, in the order they were filled.
+  struct InFlight {
+    Buffer<dcc::Packet>* packet;
+    long long enqueueTime;
+    long long dequeueTime;
+  };
+  static constexpr unsigned MAX_IN_FLIGHT = 8;
+
+  static DccLatencyMonitor* instance_;
+
+  LatencyHistogram histograms_[NUM_STAGES];
+  InFlight inFlight_[MAX_IN_FLIGHT];
+  /// Index of the oldest entry in inFlight_.
+  unsigned inFlightBegin_{0};
+  /// Number of entries in inFlight_.
+  unsigned inFlightCount_{0};
+  Space* space_{nullptr};
+};
+
+}  // namespace commandstation
+
+#endif  // _COMMANDSTATION_DCCLATENCYMONITOR_HXX_
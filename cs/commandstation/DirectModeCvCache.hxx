@@ -0,0 +1,194 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file DirectModeCvCache.hxx
+ *
+ * Remembers CV values of decoders seen on the programming track.
+ *
+ * @author Balazs Racz
+ * @date 18 Oct 2026
+ */
+
+#ifndef _COMMANDSTATION_DIRECTMODECVCACHE_HXX_
+#define _COMMANDSTATION_DIRECTMODECVCACHE_HXX_
+
+#include <stdint.h>
+
+namespace commandstation {
+
+/** Cache of CV values confirmed by decoders on the programming track.
+ *
+ * Entries are keyed by the decoder identity, which is the manufacturer ID
+ * (CV8) and version (CV7) last read from or verified on the track. A cached
+ * value is only a guess: the programming track frontend checks it with a
+ * byte verify before using it, so a different decoder with the same
+ * identity costs one verify and nothing else. */
+class DirectModeCvCache {
+ public:
+  static constexpr unsigned NUM_ENTRIES = 64;
+  /// CV holding the decoder version.
+  static constexpr unsigned CV_VERSION = 7;
+  /// CV holding the manufacturer ID. Writing it resets most decoders.
+  static constexpr unsigned CV_MANUFACTURER = 8;
+
+  DirectModeCvCache() {
+    clear();
+  }
+
+  /// Forgets everything.
+  void clear() {
+    for (auto& e : entries_) {
+      e.cv = 0;
+    }
+    hasManufacturer_ = false;
+    hasVersion_ = false;
+  }
+
+  /// Looks up the value of a CV for the decoder on the programming track.
+  /// @param cv is the 1-based CV number.
+  /// @param value is where the cached value is stored.
+  /// @return true if there was a cached value.
+  bool lookup(unsigned cv, uint8_t* value) {
+    if (cv == CV_MANUFACTURER && hasManufacturer_) {
+      *value = manufacturer_;
+      return true;
+    }
+    if (cv == CV_VERSION && hasVersion_) {
+      *value = version_;
+      return true;
+    }
+    Entry* e = find(cv);
+    if (!e) {
+      return false;
+    }
+    *value = e->value;
+    return true;
+  }
+
+  /// Records a CV value that the decoder confirmed, after a read or a write.
+  /// @param cv is the 1-based CV number.
+  /// @param value is the value of the CV.
+  void store(unsigned cv, uint8_t value) {
+    if (cv == CV_MANUFACTURER) {
+      if (!hasManufacturer_ || manufacturer_ != value) {
+        // Another decoder. Its version is to be found out.
+        hasVersion_ = false;
+      }
+      manufacturer_ = value;
+      hasManufacturer_ = true;
+      return;
+    }
+    if (cv == CV_VERSION) {
+      version_ = value;
+      hasVersion_ = true;
+      return;
+    }
+    if (!hasManufacturer_ || !hasVersion_) {
+      // Unknown decoder.
+      return;
+    }
+    Entry* e = find(cv);
+    if (!e) {
+      e = &entries_[nextEntry_];
+      nextEntry_ = (nextEntry_ + 1) % NUM_ENTRIES;
+      e->cv = cv;
+      e->manufacturer = manufacturer_;
+      e->version = version_;
+    }
+    e->value = value;
+  }
+
+  /// Records a single bit written to the decoder.
+  /// @param cv is the 1-based CV number.
+  /// @param bit is 0..7
+  /// @param value is the new value of the bit.
+  void store_bit(unsigned cv, unsigned bit, bool value) {
+    uint8_t v;
+    if (!lookup(cv, &v)) {
+      return;
+    }
+    if (value) {
+      v |= (1 << bit);
+    } else {
+      v &= ~(1 << bit);
+    }
+    store(cv, v);
+  }
+
+  /// Called when a CV was written with a value that was not verified. Also
+  /// handles decoder resets caused by writing CV8.
+  /// @param cv is the 1-based CV number.
+  void invalidate(unsigned cv) {
+    if (cv == CV_MANUFACTURER && hasManufacturer_ && hasVersion_) {
+      // Decoder reset: all CVs of this decoder are back to defaults.
+      for (auto& e : entries_) {
+        if (e.manufacturer == manufacturer_ && e.version == version_) {
+          e.cv = 0;
+        }
+      }
+      return;
+    }
+    if (Entry* e = find(cv)) {
+      e->cv = 0;
+    }
+  }
+
+ private:
+  struct Entry {
+    /// 1-based CV number; 0 if the entry is free.
+    uint16_t cv;
+    uint8_t manufacturer;
+    uint8_t version;
+    uint8_t value;
+  };
+
+  /// @return the entry for a CV of the current decoder, or nullptr.
+  Entry* find(unsigned cv) {
+    if (!hasManufacturer_ || !hasVersion_) {
+      return nullptr;
+    }
+    for (auto& e : entries_) {
+      if (e.cv == cv && e.manufacturer == manufacturer_ &&
+          e.version == version_) {
+        return &e;
+      }
+    }
+    return nullptr;
+  }
+
+  Entry entries_[NUM_ENTRIES];
+  /// Which entry to replace next.
+  unsigned nextEntry_{0};
+  /// Identity of the decoder on the programming track.
+  uint8_t manufacturer_;
+  uint8_t version_;
+  bool hasManufacturer_;
+  bool hasVersion_;
+};
+
+}  // namespace commandstation
+
+#endif  // _COMMANDSTATION_DIRECTMODECVCACHE_HXX_
@@ -36,41 +36,117 @@
 #ifndef _BRACZ_COMMANDSTATION_FEEDBACKBASEDOCCUPANCY_HXX_
 #define _BRACZ_COMMANDSTATION_FEEDBACKBASEDOCCUPANCY_HXX_
 
+#include <algorithm>
+
+#include "commandstation/OccupancyBitmap.hxx"
 #include "openlcb/EventHandlerTemplates.hxx"
 #include "dcc/RailcomHub.hxx"
 
 namespace commandstation {
 
+/// Turns the occupancy bitmaps that a booster reports on the railcom hub
+/// into event reports. The bitmap is in the channel 0xff feedback packets,
+/// see OccupancyBitmap. Every channel has two events like in
+/// BitRangeEventPC: event_base + 2 * channel for occupied, one more for
+/// free.
 class FeedbackBasedOccupancy : public dcc::RailcomHubPort {
  public:
-    FeedbackBasedOccupancy(openlcb::Node* node, uint64_t event_base,
+  /// Largest number of channels supported.
+  static constexpr unsigned MAX_CHANNELS = 64;
+
+  FeedbackBasedOccupancy(openlcb::Node* node, uint64_t event_base,
                          unsigned channel_count)
       : dcc::RailcomHubPort(node->iface()),
-        currentValues_(0),
-        eventHandler_(node, event_base, &currentValues_, channel_count) {}
+        node_(node),
+        eventBase_(event_base),
+        channelCount_(channel_count),
+        eventHandler_(node, event_base, currentValues_, channel_count) {
+    HASSERT(channel_count <= MAX_CHANNELS);
+  }
 
   Action entry() override {
     if (message()->data()->channel != 0xff) return release_and_exit();
-    uint32_t new_values = message()->data()->ch1Data[0];
+    parse_bitmap(*message()->data());
     release();
-    if (new_values == currentValues_) return exit();
-    unsigned bit = 1;
-    unsigned ofs = 0;
-    uint32_t diff = new_values ^ currentValues_;
-    while (bit && ((diff & bit) == 0)) {
-      bit <<= 1;
-      ofs++;
+    bool changed = false;
+    for (unsigned i = 0; i < NUM_WORDS; ++i) {
+      changed |= (newValues_[i] != currentValues_[i]);
+    }
+    if (!changed) return exit();
+    nextChannel_ = 0;
+    n_.reset(this);
+    return call_immediately(STATE(find_next_change));
+  }
+
+  /// Looks for the next channel that changed, and sends an event report
+  /// for it. All changes of one feedback packet are sent out back to back.
+  Action find_next_change() {
+    while (nextChannel_ < channelCount_) {
+      unsigned word = nextChannel_ / 32;
+      uint32_t diff = currentValues_[word] ^ newValues_[word];
+      diff &= ~((1u << (nextChannel_ % 32)) - 1);
+      if (!diff) {
+        nextChannel_ = (word + 1) * 32;
+        continue;
+      }
+      nextChannel_ = word * 32 + __builtin_ctz(diff);
+      if (nextChannel_ >= channelCount_) break;
+      return allocate_and_call(node_->iface()->global_message_write_flow(),
+                               STATE(send_event));
     }
-    eventHandler_.Set(ofs, (new_values & bit), &h_, n_.reset(this));
+    n_.maybe_done();
     return wait_and_call(STATE(set_done));
   }
 
+  Action send_event() {
+    auto* b =
+        get_allocation_result(node_->iface()->global_message_write_flow());
+    unsigned word = nextChannel_ / 32;
+    uint32_t mask = 1u << (nextChannel_ % 32);
+    currentValues_[word] ^= mask;
+    uint64_t event = eventBase_ + nextChannel_ * 2;
+    if (!(currentValues_[word] & mask)) {
+      ++event;
+    }
+    b->data()->reset(openlcb::Defs::MTI_EVENT_REPORT, node_->node_id(),
+                     openlcb::eventid_to_buffer(event));
+    b->set_done(n_.new_child());
+    node_->iface()->global_message_write_flow()->send(b);
+    ++nextChannel_;
+    return call_immediately(STATE(find_next_change));
+  }
+
   Action set_done() { return exit(); }
 
  private:
-  uint32_t currentValues_;
+  static constexpr unsigned NUM_WORDS = (MAX_CHANNELS + 31) / 32;
+
+  /// Fills newValues_ from an occupancy feedback packet.
+  void parse_bitmap(const dcc::Feedback& f) {
+    OccupancyBitmap bitmap(f);
+    for (unsigned i = 0; i < NUM_WORDS; ++i) {
+      newValues_[i] = 0;
+    }
+    for (unsigned i = 0; i < bitmap.size() && i * 8 < channelCount_; ++i) {
+      newValues_[i / 4] |= uint32_t(bitmap.byte(i)) << (8 * (i % 4));
+    }
+    if (channelCount_ % 32) {
+      newValues_[channelCount_ / 32] &= (1u << (channelCount_ % 32)) - 1;
+    }
+  }
+
+  openlcb::Node* node_;
+  uint64_t eventBase_;
+  unsigned channelCount_;
+  /// Next channel to look at for changes.
+  unsigned nextChannel_;
+  /// Occupancy as reported on the bus. Backing store of eventHandler_.
+  uint32_t currentValues_[NUM_WORDS] = {0};
+  /// Occupancy from the last feedback packet.
+  uint32_t newValues_[NUM_WORDS];
+  /// Answers identify messages for our events.
   openlcb::BitRangeEventPC eventHandler_;
-  openlcb::WriteHelper h_;
+  /// Done when all event reports of a batch are sent.
   BarrierNotifiable n_;
 };
 
@@ -51,6 +51,10 @@ uint8_t FindProtocolDefs::DEFAULT_MARKLIN_DRIVE_MODE = MARKLIN_NEW;
 /// DCC_ANY.
 uint8_t FindProtocolDefs::DEFAULT_DCC_DRIVE_MODE = DCC_128;
 
+/// How long to wait for other nodes on the bus to answer an allocate request
+/// before we create a new train node locally.
+unsigned FindProtocolDefs::ALLOCATE_DELAY_MSEC = 200;
+
 namespace {
 /// @returns true for a character that is a digit.
 bool is_number(char c) { return ('0' <= c) && (c <= '9'); }
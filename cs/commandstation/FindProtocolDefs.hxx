@@ -164,6 +164,11 @@ struct FindProtocolDefs {
   /// DCC_ANY.
   static uint8_t DEFAULT_DCC_DRIVE_MODE;
 
+  /// How long to wait for other nodes on the bus (e.g. deadrail train nodes)
+  /// to answer an allocate request before we create a new train node
+  /// locally.
+  static unsigned ALLOCATE_DELAY_MSEC;
+
  private:
   /// Helper function for the input_to_* calls.
   static openlcb::EventId input_to_event(const string& input);
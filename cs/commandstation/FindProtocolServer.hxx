@@ -35,6 +35,9 @@
 #ifndef _COMMANDSTATION_FINDPROTOCOLSERVER_HXX_
 #define _COMMANDSTATION_FINDPROTOCOLSERVER_HXX_
 
+#include <algorithm>
+#include <deque>
+
 #include "commandstation/FindProtocolDefs.hxx"
 #include "commandstation/AllTrainNodes.hxx"
 #include "openlcb/EventHandlerTemplates.hxx"
@@ -108,8 +111,17 @@ class FindProtocolServer : public openlcb::SimpleEventHandler {
     flow_.send(b);
   };
 
+  void handle_producer_identified(const EventRegistryEntry &registry_entry,
+                                  EventReport *event,
+                                  BarrierNotifiable *done) override {
+    AutoNotify an(done);
+    // Someone answered a query. If we are holding back an allocation for it,
+    // that is not needed anymore.
+    allocateFlow_.remote_answer(event->event);
+  }
+
   // For testing.
-  bool is_idle() { return flow_.is_waiting(); }
+  bool is_idle() { return flow_.is_waiting() && allocateFlow_.is_idle(); }
 
  private:
   enum {
@@ -197,64 +209,210 @@ class FindProtocolServer : public openlcb::SimpleEventHandler {
 
     Action iteration_done() {
       if (!hasMatches_ && (eventId_ & FindProtocolDefs::ALLOCATE)) {
-        // TODO: we should wait some time, maybe 200 msec for any responses
-        // from other nodes, possibly a deadrail train node, before we actually
-        // allocate a new train node.
-        DccMode mode;
-        unsigned address = FindProtocolDefs::query_to_address(eventId_, &mode);
-        newNodeId_ = nodes()->allocate_node(mode, address);
-        if (!newNodeId_) {
-          LOG(WARNING, "Decided to allocate node but failed. type=%d addr=%d",
-              (int)mode, (int)address);
-          return exit();
-        }
-        return call_immediately(STATE(wait_for_new_node));
+        // The allocation flow will wait for responses from other nodes,
+        // possibly a deadrail train node, before it actually allocates a new
+        // train node.
+        parent_->allocateFlow_.enqueue(eventId_);
       }
       return exit();
     }
 
-    /// Yields until the new node is initiaqlized and we are allowed to send
+   private:
+    AllTrainNodes *nodes() { return parent_->parent_; }
+
+    openlcb::EventId eventId_;
+    unsigned nextTrainId_;
+    BarrierNotifiable bn_;
+    bool hasMatches_;
+    FindProtocolServer *parent_;
+  };
+
+  /// Holds back allocate requests for a while to see if some other node
+  /// answers them, then creates the train nodes one by one. Identical
+  /// requests arriving in the meantime are merged into one allocation.
+  class AllocateFlow : public StateFlowBase {
+   public:
+    AllocateFlow(FindProtocolServer *parent)
+        : StateFlowBase(parent->parent_->tractionService_), parent_(parent) {
+      iface()->dispatcher()->register_handler(
+          &initHandler_, openlcb::Defs::MTI_INITIALIZATION_COMPLETE,
+          openlcb::Defs::MTI_EXACT);
+    }
+
+    ~AllocateFlow() {
+      iface()->dispatcher()->unregister_handler(
+          &initHandler_, openlcb::Defs::MTI_INITIALIZATION_COMPLETE,
+          openlcb::Defs::MTI_EXACT);
+    }
+
+    /// Adds an allocate request to the queue. Must be called on the
+    /// traction service's executor.
+    /// @param event is the find protocol query with the ALLOCATE bit set.
+    void enqueue(openlcb::EventId event) {
+      DccMode mode;
+      unsigned address = FindProtocolDefs::query_to_address(event, &mode);
+      for (auto &p : pending_) {
+        if (p.mode_ == mode && p.address_ == address) {
+          // Same train requested again; answer it together with the pending
+          // one.
+          if (std::find(p.events_.begin(), p.events_.end(), event) ==
+              p.events_.end()) {
+            p.events_.push_back(event);
+          }
+          return;
+        }
+      }
+      pending_.emplace_back();
+      pending_.back().mode_ = mode;
+      pending_.back().address_ = address;
+      pending_.back().events_.push_back(event);
+      pending_.back().deadline_ =
+          os_get_time_monotonic() +
+          MSEC_TO_NSEC(FindProtocolDefs::ALLOCATE_DELAY_MSEC);
+      if (is_terminated()) {
+        start_flow(STATE(entry));
+      }
+    }
+
+    /// Called when a producer identified arrives for a find protocol event.
+    /// @param event is the event ID from the bus.
+    void remote_answer(openlcb::EventId event) {
+      for (auto &p : pending_) {
+        if (std::find(p.events_.begin(), p.events_.end(), event) !=
+            p.events_.end()) {
+          p.answered_ = true;
+        }
+      }
+    }
+
+    /// @return true if there is no allocation pending.
+    bool is_idle() { return is_terminated() && pending_.empty(); }
+
+   private:
+    Action entry() {
+      if (pending_.empty()) {
+        return exit();
+      }
+      // The window of each request runs from its arrival, so requests that
+      // queued up behind a slow allocation do not wait again.
+      long long remaining =
+          pending_.front().deadline_ - os_get_time_monotonic();
+      if (remaining <= 0) {
+        return call_immediately(STATE(window_done));
+      }
+      return sleep_and_call(&timer_, remaining, STATE(window_done));
+    }
+
+    Action window_done() {
+      auto &p = pending_.front();
+      if (p.answered_) {
+        LOG(INFO, "Allocate request for addr=%u answered by remote node.",
+            p.address_);
+        pending_.pop_front();
+        return call_immediately(STATE(entry));
+      }
+      // Maybe the train exists by now.
+      newNodeId_ = openlcb::TractionDefs::train_node_id_from_legacy(
+          dcc_mode_to_address_type(p.mode_, p.address_), p.address_);
+      if (!nodes()->find_node(newNodeId_)) {
+        newNodeId_ = nodes()->allocate_node(p.mode_, p.address_);
+      }
+      if (!newNodeId_) {
+        LOG(WARNING, "Decided to allocate node but failed. type=%d addr=%d",
+            (int)p.mode_, (int)p.address_);
+        pending_.pop_front();
+        return call_immediately(STATE(entry));
+      }
+      initSeen_ = false;
+      return call_immediately(STATE(wait_for_new_node));
+    }
+
+    /// Waits until the new node is initialized and we are allowed to send
     /// traffic out from it.
     Action wait_for_new_node() {
-      openlcb::Node *n =
-          nodes()->tractionService_->iface()->lookup_local_node(newNodeId_);
+      openlcb::Node *n = iface()->lookup_local_node(newNodeId_);
       HASSERT(n);
-      if (n->is_initialized()) {
+      // Once the initialization complete message came back on the loopback,
+      // it is ahead of anything we send on the global write flow, even if
+      // the node is not marked initialized yet.
+      if (n->is_initialized() || initSeen_) {
+        nextEvent_ = 0;
         return call_immediately(STATE(new_node_reply));
-      } else {
-        return sleep_and_call(&timer_, MSEC_TO_NSEC(1), STATE(wait_for_new_node));
       }
+      // Woken up by handle_init_complete. The timeout is only a safety net.
+      waitingForInit_ = true;
+      return sleep_and_call(&timer_, MSEC_TO_NSEC(500),
+                            STATE(init_wait_done));
+    }
+
+    Action init_wait_done() {
+      waitingForInit_ = false;
+      return call_immediately(STATE(wait_for_new_node));
     }
 
     Action new_node_reply() {
-      return allocate_and_call(
-          nodes()->tractionService_->iface()->global_message_write_flow(),
-          STATE(send_new_node_response));
+      if (nextEvent_ >= pending_.front().events_.size()) {
+        pending_.pop_front();
+        return call_immediately(STATE(entry));
+      }
+      return allocate_and_call(iface()->global_message_write_flow(),
+                               STATE(send_new_node_response));
     }
 
     Action send_new_node_response() {
-      auto *b = get_allocation_result(
-          nodes()->tractionService_->iface()->global_message_write_flow());
-      b->data()->reset(openlcb::Defs::MTI_PRODUCER_IDENTIFIED_VALID, newNodeId_,
-                       openlcb::eventid_to_buffer(eventId_));
-      parent_->parent_->tractionService_->iface()
-          ->global_message_write_flow()
-          ->send(b);
-      return exit();
+      auto *b = get_allocation_result(iface()->global_message_write_flow());
+      b->data()->reset(
+          openlcb::Defs::MTI_PRODUCER_IDENTIFIED_VALID, newNodeId_,
+          openlcb::eventid_to_buffer(pending_.front().events_[nextEvent_]));
+      iface()->global_message_write_flow()->send(b);
+      ++nextEvent_;
+      return call_immediately(STATE(new_node_reply));
+    }
+
+    /// Callback when an initialization complete message shows up.
+    void handle_init_complete(Buffer<openlcb::GenMessage> *b) {
+      auto bd = get_buffer_deleter(b);
+      if (b->data()->src.id != newNodeId_ || pending_.empty()) {
+        return;
+      }
+      initSeen_ = true;
+      if (waitingForInit_) {
+        waitingForInit_ = false;
+        timer_.trigger();
+      }
     }
 
-   private:
     AllTrainNodes *nodes() { return parent_->parent_; }
 
-    openlcb::EventId eventId_;
-    union {
-      unsigned nextTrainId_;
-      openlcb::NodeID newNodeId_;
+    openlcb::If *iface() { return nodes()->tractionService_->iface(); }
+
+    /// One train we are going to allocate.
+    struct PendingAllocation {
+      DccMode mode_;
+      unsigned address_;
+      /// Distinct query events that asked for this train. Each of them gets
+      /// a response when the node is ready.
+      std::vector<openlcb::EventId> events_;
+      /// Set to true if some other node answered one of the queries.
+      bool answered_{false};
+      /// When the allocation window of this train ends (monotonic nsec).
+      long long deadline_;
     };
-    BarrierNotifiable bn_;
-    bool hasMatches_;
+
+    /// Requests waiting to be allocated. The front is being processed.
+    std::deque<PendingAllocation> pending_;
+    /// Node ID of the train being allocated.
+    openlcb::NodeID newNodeId_{0};
+    /// Index into the events_ of the front pending entry when responding.
+    unsigned nextEvent_{0};
+    /// true if the initialization complete of newNodeId_ was seen.
+    bool initSeen_{false};
+    /// true if we are sleeping on timer_ for the initialization complete.
+    bool waitingForInit_{false};
     FindProtocolServer *parent_;
     StateFlowTimer timer_{this};
+    openlcb::MessageHandler::GenericHandler initHandler_{
+        this, &AllocateFlow::handle_init_complete};
   };
 
   AllTrainNodes *parent_;
@@ -266,6 +424,7 @@ class FindProtocolServer : public openlcb::SimpleEventHandler {
   bool pendingGlobalIdentify_{false};
 
   FindProtocolFlow flow_{this};
+  AllocateFlow allocateFlow_{this};
 };
 
 class SingleNodeFindProtocolServer : public openlcb::SimpleEventHandler {
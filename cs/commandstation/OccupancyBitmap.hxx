@@ -0,0 +1,89 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file OccupancyBitmap.hxx
+ *
+ * Decodes the occupancy bitmap that a booster reports on the railcom hub.
+ *
+ * @author Balazs Racz
+ * @date 18 Oct 2026
+ */
+
+#ifndef _BRACZ_COMMANDSTATION_OCCUPANCYBITMAP_HXX_
+#define _BRACZ_COMMANDSTATION_OCCUPANCYBITMAP_HXX_
+
+#include <algorithm>
+#include <string.h>
+
+#include "dcc/RailCom.hxx"
+
+namespace commandstation {
+
+/// The occupancy bitmap of a channel 0xff feedback packet. Bits 0..7 are in
+/// ch1Data[0], further bytes in ch1Data[1] and then in ch2Data, as far as
+/// ch1Size and ch2Size go. ch2Data only counts once ch1Data is full.
+/// Producers that only know about eight channels leave ch1Size at 0.
+class OccupancyBitmap {
+ public:
+  /// Largest number of bytes in a bitmap.
+  static constexpr unsigned MAX_BYTES =
+      sizeof(dcc::Feedback::ch1Data) + sizeof(dcc::Feedback::ch2Data);
+
+  /// @param f an occupancy feedback packet (channel 0xff).
+  explicit OccupancyBitmap(const dcc::Feedback& f) {
+    unsigned len = f.ch1Size ? f.ch1Size : 1;
+    len = std::min(len, (unsigned)sizeof(f.ch1Data));
+    memcpy(bytes_, f.ch1Data, len);
+    if (len == sizeof(f.ch1Data)) {
+      unsigned len2 =
+          std::min((unsigned)f.ch2Size, (unsigned)sizeof(f.ch2Data));
+      memcpy(bytes_ + len, f.ch2Data, len2);
+      len += len2;
+    }
+    size_ = len;
+  }
+
+  /// @returns the number of bytes in the bitmap.
+  unsigned size() const { return size_; }
+
+  /// @returns byte i of the bitmap, i < size().
+  uint8_t byte(unsigned i) const { return bytes_[i]; }
+
+  /// @returns true if the bitmap has the channel as occupied. Channels
+  /// beyond the bitmap are free.
+  bool is_occupied(unsigned channel) const {
+    unsigned ofs = channel / 8;
+    return ofs < size_ && (bytes_[ofs] & (1 << (channel & 7)));
+  }
+
+ private:
+  uint8_t bytes_[MAX_BYTES];
+  unsigned size_;
+};
+
+}  // namespace commandstation
+
+#endif  // _BRACZ_COMMANDSTATION_OCCUPANCYBITMAP_HXX_
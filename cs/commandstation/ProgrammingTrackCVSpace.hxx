@@ -40,7 +40,14 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
                                 public StateFlowBase {
  public:
   static constexpr unsigned MAX_CV = 1023;
-  
+  /// Largest number of CVs read or written by one bulk session.
+  static constexpr unsigned BULK_MAX_CV = 256;
+  /// A bulk read also reads this many CVs after the requested ones, for the
+  /// next chunk of a tool reading the block in consecutive chunks.
+  static constexpr unsigned BULK_READ_AHEAD = 16;
+  /// How long the values of a finished bulk read may answer further reads.
+  static constexpr long long BULK_CACHE_NSEC = SEC_TO_NSEC(2);
+
   ProgrammingTrackCVSpace(openlcb::MemoryConfigHandler* parent,
                           ProgrammingTrackFrontend* frontend,
                           openlcb::Node* node)
@@ -91,8 +98,15 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
 
   size_t write(address_t destination, const uint8_t *data, size_t len,
                errorcode_t *error, Notifiable *again) override {
+    if (destination <= MAX_CV && len > 1 && is_pom()) {
+      return bulk_write(destination, data, len, error, again);
+    }
     if (destination <= MAX_CV) {
       len = 1;
+      if (!bulkActive_) {
+        // The cached values may not be right anymore.
+        bulkCount_ = 0;
+      }
       if (pomAddressType_ == dcc::TrainAddressType::UNSPECIFIED) {
         store_.mode = htobe32(ProgrammingTrackSpaceConfig::DIRECT_MODE);
       } else if (pomAddressType_ == dcc::TrainAddressType::DCC_SHORT_ADDRESS ||
@@ -137,6 +151,9 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
   
   size_t read(address_t source, uint8_t *dst, size_t len, errorcode_t *error,
               Notifiable *again) override {
+    if (source <= MAX_CV && len > 1 && is_pom()) {
+      return bulk_read(source, dst, len, error, again);
+    }
     if (source <= MAX_CV) {
       len = 1;
       // saves the stored CV value to the caller buffer in case this is the
@@ -184,9 +201,205 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
     // will avoid reads causing spurious operations when the window is next
     // opened.
     memset(&store_, 0, sizeof(store_));
+    if (!bulkActive_) {
+      bulkCount_ = 0;
+    }
     return UPDATED;
   }
 
+  /// @returns true if the last addressed node is a locomotive, i.e. CV
+  /// accesses go to POM.
+  bool is_pom() {
+    return pomAddressType_ == dcc::TrainAddressType::DCC_SHORT_ADDRESS ||
+           pomAddressType_ == dcc::TrainAddressType::DCC_LONG_ADDRESS;
+  }
+
+  /// Reads multiple CVs in POM mode. A read that the current session does
+  /// not cover starts a bulk session for the requested CVs plus
+  /// BULK_READ_AHEAD, which puts the POM packets of all these CVs on the
+  /// track interleaved. Reads return as soon as the CVs they cover are
+  /// completed, so a tool reading the block in consecutive chunks gets the
+  /// data streamed while the session runs. Arguments are the same as for
+  /// read().
+  size_t bulk_read(address_t source, uint8_t *dst, size_t len,
+                   errorcode_t *error, Notifiable *again) {
+    if (!bulk_covers(source)) {
+      if (bulkActive_) {
+        // Another session is still running.
+        return bulk_wait(0, 0, error, again);
+      }
+      unsigned count = std::min(len + BULK_READ_AHEAD, (size_t)BULK_MAX_CV);
+      bulk_start(false, source, std::min(count, MAX_CV + 1 - source));
+    }
+    unsigned ofs = source - bulkFirst_;
+    len = std::min(len, (size_t)(bulkCount_ - ofs));
+    for (unsigned i = ofs; i < ofs + len; ++i) {
+      if (bulkStatus_[i] == ProgrammingTrackFrontendRequest::BULK_PENDING) {
+        return bulk_wait(ofs, ofs + len, error, again);
+      }
+    }
+    unsigned ret = 0;
+    while (ret < len && bulkStatus_[ofs + ret] ==
+                            ProgrammingTrackFrontendRequest::BULK_OK) {
+      dst[ret] = bulkValues_[ofs + ret];
+      ++ret;
+    }
+    if (!ret) {
+      *error = ProgrammingTrackFrontend::ERROR_NO_RAILCOM;
+      return 0;
+    }
+    if (ofs + ret >= bulkCount_ && !bulkActive_) {
+      // The block was read to the end. The next read goes to the decoder
+      // again.
+      bulkCount_ = 0;
+    }
+    return ret;
+  }
+
+  /// Writes multiple CVs in POM mode in one bulk session. Returns when all
+  /// CVs are written. Arguments are the same as for write().
+  size_t bulk_write(address_t destination, const uint8_t *data, size_t len,
+                    errorcode_t *error, Notifiable *again) {
+    if (bulkWritePending_ && !bulkActive_) {
+      // Second call after the session completed.
+      bulkWritePending_ = false;
+      if (bulkError_) {
+        *error = bulkError_;
+        return 0;
+      }
+      return bulkCount_;
+    }
+    if (!bulkActive_) {
+      len = std::min(len, (size_t)BULK_MAX_CV);
+      len = std::min(len, (size_t)(MAX_CV + 1 - destination));
+      memcpy(bulkValues_, data, len);
+      bulk_start(true, destination, len);
+      bulkWritePending_ = true;
+    }
+    return bulk_wait(0, 0, error, again);
+  }
+
+  /// @returns true if the data of the current bulk session can be used to
+  /// answer a read of the given CV.
+  bool bulk_covers(unsigned cv) {
+    if (bulkCount_ && !bulkActive_ &&
+        os_get_time_monotonic() - bulkDoneTime_ > BULK_CACHE_NSEC) {
+      // The decoder may have changed the values since.
+      bulkCount_ = 0;
+    }
+    return bulkCount_ && cv >= bulkFirst_ && cv < bulkFirst_ + bulkCount_ &&
+           bulkAddressType_ == pomAddressType_ &&
+           bulkAddress_ == pomAddress_;
+  }
+
+  /// Starts a bulk session.
+  /// @param write true for writing the CVs from bulkValues_, false for
+  /// reading.
+  /// @param first is the 0-based number of the first CV.
+  /// @param count is the number of CVs.
+  void bulk_start(bool write, unsigned first, unsigned count) {
+    bulkFirst_ = first;
+    bulkCount_ = count;
+    bulkAddressType_ = pomAddressType_;
+    bulkAddress_ = pomAddress_;
+    bulkError_ = 0;
+    memset(bulkStatus_, ProgrammingTrackFrontendRequest::BULK_PENDING,
+           count);
+    bulkActive_ = true;
+    bulkFlow_.start(write);
+  }
+
+  /// Makes a read or write wait for bulk session progress.
+  /// @param begin first index in bulkStatus_ that has to be completed.
+  /// @param end one after the last index. If begin == end, waits until the
+  /// session is over.
+  /// @return what needs to be returned from the read/write virtual function.
+  size_t bulk_wait(unsigned begin, unsigned end, errorcode_t *error,
+                   Notifiable *again) {
+    bulkWaitBegin_ = begin;
+    bulkWaitEnd_ = end;
+    bulkWaiter_ = again;
+    *error = ERROR_AGAIN;
+    return 0;
+  }
+
+  /// Called when a CV of the bulk session is completed, and when the
+  /// session is over. Wakes up the waiting read or write if it can proceed.
+  void bulk_progress() {
+    if (!bulkWaiter_) {
+      return;
+    }
+    if (bulkActive_) {
+      if (bulkWaitBegin_ == bulkWaitEnd_) {
+        return;
+      }
+      for (unsigned i = bulkWaitBegin_; i < bulkWaitEnd_; ++i) {
+        if (bulkStatus_[i] == ProgrammingTrackFrontendRequest::BULK_PENDING) {
+          return;
+        }
+      }
+    }
+    Notifiable* n = nullptr;
+    std::swap(n, bulkWaiter_);
+    n->notify();
+  }
+
+  /// Runs a bulk session on the frontend in the background.
+  class BulkFlow : public StateFlowBase {
+   public:
+    BulkFlow(ProgrammingTrackCVSpace *parent)
+        : StateFlowBase(parent->service()), parent_(parent) {}
+
+    /// Starts the session with the parameters stored in the parent.
+    void start(bool write) {
+      write_ = write;
+      start_flow(STATE(do_bulk));
+    }
+
+   private:
+    Action do_bulk() {
+      if (write_) {
+        return invoke_subflow_and_wait(
+            parent_->frontend_, STATE(bulk_done),
+            ProgrammingTrackFrontendRequest::POM_WRITE_BULK,
+            parent_->bulkAddressType_, parent_->bulkAddress_,
+            parent_->bulkFirst_ + 1, parent_->bulkCount_,
+            parent_->bulkValues_, parent_->bulkStatus_, &progress_);
+      }
+      return invoke_subflow_and_wait(
+          parent_->frontend_, STATE(bulk_done),
+          ProgrammingTrackFrontendRequest::POM_READ_BULK,
+          parent_->bulkAddressType_, parent_->bulkAddress_,
+          parent_->bulkFirst_ + 1, parent_->bulkCount_, parent_->bulkValues_,
+          parent_->bulkStatus_, &progress_);
+    }
+
+    Action bulk_done() {
+      auto b = get_buffer_deleter(full_allocation_result(parent_->frontend_));
+      parent_->bulkError_ = b->data()->resultCode;
+      parent_->bulkActive_ = false;
+      parent_->bulkDoneTime_ = os_get_time_monotonic();
+      parent_->bulk_progress();
+      return exit();
+    }
+
+    /// Forwards the per-CV notifications of the frontend.
+    class Progress : public Notifiable {
+     public:
+      Progress(ProgrammingTrackCVSpace *parent) : parent_(parent) {}
+      void notify() override {
+        parent_->bulk_progress();
+      }
+     private:
+      ProgrammingTrackCVSpace *parent_;
+    };
+
+    ProgrammingTrackCVSpace *parent_;
+    Progress progress_{parent_};
+    /// True if the session writes CVs.
+    bool write_;
+  };
+
   /// Helper function for calling async states from write() and read()
   /// commands.
   /// @param start_state is the state flow state to call to startthe async
@@ -379,6 +592,35 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
   openlcb::Node* node_;
   /// Which memory space we exported ourselves.
   uint8_t spaceId_;
+
+  /// 0-based number of the first CV of the bulk session.
+  unsigned bulkFirst_;
+  /// Number of CVs in the bulk session; 0 if there is no valid session.
+  unsigned bulkCount_{0};
+  /// Which locomotive the bulk session is talking to.
+  dcc::TrainAddressType bulkAddressType_;
+  /// DCC address of the locomotive of the bulk session.
+  uint32_t bulkAddress_;
+  /// Result code of the last finished bulk session.
+  unsigned bulkError_;
+  /// When the last bulk session finished (monotonic nsec).
+  long long bulkDoneTime_{0};
+  /// Range of bulkStatus_ that the waiting read needs; see bulk_wait().
+  unsigned bulkWaitBegin_;
+  unsigned bulkWaitEnd_;
+  /// Read or write waiting for the bulk session.
+  Notifiable* bulkWaiter_{nullptr};
+  /// True while the bulk session runs on the frontend.
+  bool bulkActive_{false};
+  /// True if a multi-byte write waits for its bulk session.
+  bool bulkWritePending_{false};
+  /// CV values of the bulk session.
+  uint8_t bulkValues_[BULK_MAX_CV];
+  /// ProgrammingTrackFrontendRequest::BulkStatus for every CV of the bulk
+  /// session.
+  uint8_t bulkStatus_[BULK_MAX_CV];
+  /// Runs the bulk session.
+  BulkFlow bulkFlow_{this};
 };
 
 }  // namespace commandstation
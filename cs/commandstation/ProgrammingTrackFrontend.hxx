@@ -28,6 +28,9 @@
 #ifndef _COMMANDSTATON_PROGRAMMINGTRACKFRONTEND_HXX_
 #define _COMMANDSTATON_PROGRAMMINGTRACKFRONTEND_HXX_
 
+#include <algorithm>
+
+#include "commandstation/DirectModeCvCache.hxx"
 #include "executor/CallableFlow.hxx"
 #include "dcc/ProgrammingTrackBackend.hxx"
 #include "dcc/Defs.hxx"
@@ -46,6 +49,18 @@ struct ProgrammingTrackFrontendRequest : public CallableFlowRequestBase {
   enum DirectReadBit { DIRECT_READ_BIT };
   enum PomWriteByte { POM_WRITE_BYTE };
   enum PomReadByte { POM_READ_BYTE };
+  enum PomReadBulk { POM_READ_BULK };
+  enum PomWriteBulk { POM_WRITE_BULK };
+
+  /// Per-CV result of a bulk POM request.
+  enum BulkStatus : uint8_t {
+    /// The CV has not been completed yet.
+    BULK_PENDING = 0,
+    /// The decoder confirmed the CV.
+    BULK_OK,
+    /// The decoder did not answer for this CV.
+    BULK_FAILED
+  };
 
   /// Request to write a byte sized CV in direct mode.
   /// @param cv_number is the 1-based CV number (as the user sees it).
@@ -93,6 +108,48 @@ struct ProgrammingTrackFrontendRequest : public CallableFlowRequestBase {
     value_ = 0;
   }
 
+  /// Request to read a range of CVs in POM using RailCom. The packets for
+  /// the different CVs are interleaved on the track.
+  /// @param addrtype defines whether short or long address.
+  /// @param dcc_address is the DCC address of the target locomotive.
+  /// @param cv_number is the 1-based number of the first CV.
+  /// @param count is the number of CVs to read.
+  /// @param values has count bytes, where the values read are stored.
+  /// @param status has count bytes, all BULK_PENDING. Every entry is set to
+  /// BULK_OK or BULK_FAILED when that CV is completed.
+  /// @param progress is notified every time a CV is completed. May be null.
+  void reset(PomReadBulk, dcc::TrainAddressType addrtype,
+             uint32_t dcc_address, unsigned cv_number, unsigned count,
+             uint8_t* values, uint8_t* status, Notifiable* progress) {
+    reset_base();
+    cmd_ = Type::POM_READ_BULK;
+    addrType_ = addrtype;
+    dccAddress_ = dcc_address;
+    cvOffset_ = cv_number - 1;
+    count_ = count;
+    bulkValues_ = values;
+    bulkStatus_ = status;
+    bulkProgress_ = progress;
+  }
+
+  /// Request to write a range of CVs in POM. The packets for the different
+  /// CVs are interleaved on the track.
+  /// @param addrtype defines whether short or long address.
+  /// @param dcc_address is the DCC address of the target locomotive.
+  /// @param cv_number is the 1-based number of the first CV.
+  /// @param count is the number of CVs to write.
+  /// @param values has count bytes with the values to write.
+  /// @param status has count bytes, all BULK_PENDING. Every entry is set to
+  /// BULK_OK or BULK_FAILED when that CV is completed.
+  /// @param progress is notified every time a CV is completed. May be null.
+  void reset(PomWriteBulk, dcc::TrainAddressType addrtype,
+             uint32_t dcc_address, unsigned cv_number, unsigned count,
+             uint8_t* values, uint8_t* status, Notifiable* progress) {
+    reset(POM_READ_BULK, addrtype, dcc_address, cv_number, count, values,
+          status, progress);
+    cmd_ = Type::POM_WRITE_BULK;
+  }
+
   /// Request to write a single bit in direct mode.
   /// @param cv_number is the 1-based CV number (as the user sees it).
   /// @param bit is 0..7 for the bit to set
@@ -112,7 +169,9 @@ struct ProgrammingTrackFrontendRequest : public CallableFlowRequestBase {
     DIRECT_READ_BYTE,
     DIRECT_READ_BIT,
     POM_WRITE_BYTE,
-    POM_READ_BYTE
+    POM_READ_BYTE,
+    POM_READ_BULK,
+    POM_WRITE_BULK
   };
 
   /// What is the instruction to do.
@@ -129,6 +188,14 @@ struct ProgrammingTrackFrontendRequest : public CallableFlowRequestBase {
   /// For POM commands holds the DCC address to talk to. Long vs short address
   /// is defined by addrType_.
   uint16_t dccAddress_;
+  /// For bulk commands: number of CVs.
+  unsigned count_;
+  /// For bulk commands: count_ CV values to write or read.
+  uint8_t* bulkValues_;
+  /// For bulk commands: count_ BulkStatus entries.
+  uint8_t* bulkStatus_;
+  /// For bulk commands: notified when a CV is completed.
+  Notifiable* bulkProgress_;
 };
 
 class ProgrammingTrackFrontend
@@ -140,7 +207,9 @@ class ProgrammingTrackFrontend
       : CallableFlow<ProgrammingTrackFrontendRequest>(backend->service()),
         backend_(backend),
         track_(track),
-        railcomHub_(railcom_hub) {}
+        railcomHub_(railcom_hub) {
+    bulkActive_ = 0;
+  }
 
   typedef ProgrammingTrackFrontendRequest::Type RequestType;
 
@@ -175,6 +244,11 @@ class ProgrammingTrackFrontend
     verifyCooldownReset_ = cnt;
   }
 
+  /// @return the cache of CV values read or written in direct mode.
+  DirectModeCvCache* cv_cache() {
+    return &cvCache_;
+  }
+
   Action entry() override {
     request()->resultCode = OPERATION_PENDING;
     switch (request()->cmd_) {
@@ -189,6 +263,9 @@ class ProgrammingTrackFrontend
       case RequestType::POM_WRITE_BYTE:
         numTry_ = 0;
         return call_immediately(STATE(pom_write_byte));
+      case RequestType::POM_READ_BULK:
+      case RequestType::POM_WRITE_BULK:
+        return call_immediately(STATE(pom_bulk));
     }
     return return_with_error(ERROR_UNIMPLEMENTED_CMD);
   }
@@ -294,6 +371,16 @@ class ProgrammingTrackFrontend
     if (b->data()->hasAck_) {
       foundAck_ = 1;
     }
+    unsigned cv = request()->cvOffset_ + 1;
+    if (foundAck_ && cv != DirectModeCvCache::CV_MANUFACTURER) {
+      if (request()->cmd_ == RequestType::DIRECT_WRITE_BYTE) {
+        cvCache_.store(cv, request()->value_);
+      } else {
+        cvCache_.store_bit(cv, request()->bitOffset_, request()->value_);
+      }
+    } else {
+      cvCache_.invalidate(cv);
+    }
     if (foundAck_) {
       if (!hasWriteAck_) {
         LOG(WARNING, "Direct write: write ack missing, but verify is okay.");
@@ -312,6 +399,52 @@ class ProgrammingTrackFrontend
 
   /// Root state of reading one byte using direct mode from the decoder.
   Action direct_read_byte() {
+    uint8_t value;
+    if (cvCache_.lookup(request()->cvOffset_ + 1, &value)) {
+      // Tries the value we have seen before with a single byte verify.
+      LOG(INFO, "read cached guess 0x%02x", value);
+      request()->value_ = value;
+      serviceModePacket_.set_dcc_svc_verify_byte(request()->cvOffset_,
+                                                 value);
+      return invoke_subflow_and_wait(
+          backend_, STATE(check_cached_byte),
+          ProgrammingTrackRequest::SEND_PROGRAMMING_PACKET, serviceModePacket_,
+          verifyRepeats_);
+    }
+    return call_immediately(STATE(direct_read_bits));
+  }
+
+  Action check_cached_byte() {
+    auto b = get_buffer_deleter(full_allocation_result(backend_));
+    LOG(INFO, "cached guess verify ack %u", b->data()->hasAck_);
+    if (b->data()->hasAck_) {
+      return call_immediately(STATE(cached_byte_ok));
+    }
+    return invoke_subflow_and_wait(backend_, STATE(cooldown_cached_byte),
+                                   ProgrammingTrackRequest::SEND_RESET,
+                                   verifyCooldownReset_);
+  }
+
+  Action cooldown_cached_byte() {
+    auto b = get_buffer_deleter(full_allocation_result(backend_));
+    if (b->data()->hasAck_) {
+      return call_immediately(STATE(cached_byte_ok));
+    }
+    // The decoder has a different value now. Searches for it bit by bit.
+    return call_immediately(STATE(direct_read_bits));
+  }
+
+  Action cached_byte_ok() {
+    // Refreshes the decoder identity if this was CV7 or CV8.
+    cvCache_.store(request()->cvOffset_ + 1, request()->value_);
+    request()->resultCode |= ERROR_CODE_OK;
+    return invoke_subflow_and_wait(
+        backend_, STATE(return_response),
+        ProgrammingTrackRequest::EXIT_SERVICE_MODE);
+  }
+
+  /// Reads one byte by verifying every bit separately.
+  Action direct_read_bits() {
     nextBitToRead_ = 0;
     confirmedOnes_ = 0;
     confirmedZeros_ = 0;
@@ -367,6 +500,7 @@ class ProgrammingTrackFrontend
     auto b = get_buffer_deleter(full_allocation_result(backend_)); 
     LOG(INFO, "read verify ack %u", b->data()->hasAck_);
     if (b->data()->hasAck_) {
+      cvCache_.store(request()->cvOffset_ + 1, request()->value_);
       request()->resultCode |= ERROR_CODE_OK;
     } else {
       // send some cooldown too
@@ -383,6 +517,7 @@ class ProgrammingTrackFrontend
     auto b = get_buffer_deleter(full_allocation_result(backend_)); 
     LOG(INFO, "read verify cooldown ack %u", b->data()->hasAck_);
     if (b->data()->hasAck_) {
+      cvCache_.store(request()->cvOffset_ + 1, request()->value_);
       request()->resultCode |= ERROR_CODE_OK;
     } else {
       request()->resultCode |= ERROR_FAILED_VERIFY;
@@ -417,36 +552,30 @@ class ProgrammingTrackFrontend
     // packets by the standard. We make 4 back to back packets and that
     // fulfills the requirement.
     b->data()->packet_header.rept_count = 3;
-    railcomHub_->register_port(&railcomHandler_);
-    seenRailcomBusy_ = 0;
-    seenRailcomGarbage_ = 0;
-    errorCode_ = ERROR_PENDING;
+    start_railcom_wait();
     track_->send(b.release());
-    return sleep_and_call(&timer_, MSEC_TO_NSEC(500), STATE(write_returned));
+    return wait_for_railcom(STATE(write_returned));
   }
 
   Action write_returned() {
     LOG(INFO, "railcom write returned status %d value %d", errorCode_,
         cvData_);
-    switch (errorCode_) {
-      case ERROR_PENDING:
-        railcomHub_->unregister_port(&railcomHandler_);
-        if (seenRailcomBusy_ &&
-            (++numTry_ < DEFAULT_POM_WRITE_RETRIES_ON_BUSY)) {
-          return sleep_and_call(&timer_, MSEC_TO_NSEC(100),
-                                STATE(pom_write_byte));
-        }
-        if (seenRailcomBusy_ || seenRailcomGarbage_) {
-          return return_with_error(ERROR_FAILED_VERIFY);
-        } else {
-          return return_with_error(ERROR_NO_RAILCOM);
-        }
-        break;
-      case ERROR_OK:
-        return return_with_error(ERROR_CODE_OK);
+    if (errorCode_ == ERROR_OK) {
+      pom_succeeded();
+      return return_with_error(ERROR_CODE_OK);
+    }
+    if (errorCode_ == ERROR_PENDING) {
+      railcomHub_->unregister_port(&railcomHandler_);
+    }
+    if (seenRailcomBusy_ && (++numTry_ < DEFAULT_POM_WRITE_RETRIES_ON_BUSY)) {
+      return sleep_and_call(&timer_, MSEC_TO_NSEC(next_busy_backoff_msec()),
+                            STATE(pom_write_byte));
+    }
+    if (seenRailcomBusy_ || seenRailcomGarbage_) {
+      return return_with_error(ERROR_FAILED_VERIFY);
+    } else {
+      return return_with_error(ERROR_NO_RAILCOM);
     }
-    // Should not get here.
-    return return_with_error(openlcb::Defs::ERROR_TEMPORARY);
   }
 
   Action pom_read_byte() {
@@ -466,18 +595,16 @@ class ProgrammingTrackFrontend
     b->data()->add_dcc_pom_read1(request()->cvOffset_);
     b->data()->feedback_key = reinterpret_cast<uintptr_t>(this);
     b->data()->packet_header.rept_count = 3;
-    railcomHub_->register_port(&railcomHandler_);
-    seenRailcomBusy_ = 0;
-    seenRailcomGarbage_ = 0;
-    errorCode_ = ERROR_PENDING;
+    start_railcom_wait();
     track_->send(b.release());
-    return sleep_and_call(&timer_, MSEC_TO_NSEC(500), STATE(read_returned));
+    return wait_for_railcom(STATE(read_returned));
   }
 
   Action read_returned() {
     LOG(WARNING, "railcom read returned status %d value %d", errorCode_,
         cvData_);
     if (errorCode_ == ERROR_OK) {
+      pom_succeeded();
       request()->value_ = cvData_;
       return return_with_error(ERROR_CODE_OK);
     }
@@ -485,6 +612,11 @@ class ProgrammingTrackFrontend
       railcomHub_->unregister_port(&railcomHandler_);
     }
     if (++numTry_ < DEFAULT_POM_READ_RETRIES) {
+      if (seenRailcomBusy_) {
+        return sleep_and_call(&timer_,
+                              MSEC_TO_NSEC(next_busy_backoff_msec()),
+                              STATE(pom_read_byte));
+      }
       return call_immediately(STATE(pom_read_byte));
     }
     if (seenRailcomBusy_ || seenRailcomGarbage_) {
@@ -494,6 +626,208 @@ class ProgrammingTrackFrontend
     }
   }
 
+  /// Root state of bulk POM requests. Keeps up to BULK_WINDOW POM packets
+  /// for different CVs on the track at the same time; each one has its own
+  /// feedback key, so that the railcom answers can be matched to the CVs.
+  Action pom_bulk() {
+    if (request()->addrType_ != dcc::TrainAddressType::DCC_SHORT_ADDRESS &&
+        request()->addrType_ != dcc::TrainAddressType::DCC_LONG_ADDRESS) {
+      return return_with_error(ERROR_INVALID_ARGS);
+    }
+    for (auto& s : bulkSlots_) {
+      s.index = BULK_SLOT_FREE;
+    }
+    bulkNext_ = 0;
+    bulkRemaining_ = request()->count_;
+    bulkFailed_ = 0;
+    bulkActive_ = 1;
+    railcomHub_->register_port(&railcomHandler_);
+    return call_immediately(STATE(bulk_fill_window));
+  }
+
+  /// Puts the next POM packet on the track, or waits until an answer or a
+  /// timeout frees up a slot in the window.
+  Action bulk_fill_window() {
+    if (!bulkRemaining_) {
+      railcomHub_->unregister_port(&railcomHandler_);
+      bulkActive_ = 0;
+      return return_with_error(bulkFailed_ ? ERROR_NO_RAILCOM : ERROR_CODE_OK);
+    }
+    long long now = os_get_time_monotonic();
+    long long wake = now + MSEC_TO_NSEC(POM_RESPONSE_TIMEOUT_MSEC);
+    for (unsigned i = 0; i < BULK_WINDOW; ++i) {
+      BulkSlot& s = bulkSlots_[i];
+      if (s.index == BULK_SLOT_FREE) {
+        if (bulkNext_ >= request()->count_) continue;
+        s.index = bulkNext_++;
+        s.tries = 0;
+        s.needSend = 1;
+      } else if (!s.needSend && s.deadline <= now) {
+        // No meaningful answer in time.
+        bulk_retry(i);
+        if (s.index == BULK_SLOT_FREE) {
+          return call_immediately(STATE(bulk_fill_window));
+        }
+      }
+      if (s.needSend) {
+        bulkSendSlot_ = i;
+        return allocate_and_call(track_, STATE(bulk_send_packet));
+      }
+      wake = std::min(wake, s.deadline);
+    }
+    return sleep_and_call(&timer_, wake - now, STATE(bulk_fill_window));
+  }
+
+  Action bulk_send_packet() {
+    auto b = get_buffer_deleter(get_allocation_result(track_));
+    BulkSlot& s = bulkSlots_[bulkSendSlot_];
+    unsigned cv = request()->cvOffset_ + s.index;
+    b->data()->start_dcc_packet();
+    if (request()->addrType_ == dcc::TrainAddressType::DCC_SHORT_ADDRESS) {
+      b->data()->add_dcc_address(dcc::DccShortAddress(request()->dccAddress_));
+    } else {
+      b->data()->add_dcc_address(dcc::DccLongAddress(request()->dccAddress_));
+    }
+    if (request()->cmd_ == RequestType::POM_WRITE_BULK) {
+      b->data()->add_dcc_pom_write1(cv, request()->bulkValues_[s.index]);
+      // Same as for single writes: four back to back packets.
+      b->data()->packet_header.rept_count = 3;
+    } else {
+      b->data()->add_dcc_pom_read1(cv);
+      b->data()->packet_header.rept_count = 1;
+    }
+    // A fresh key for every packet, so that late answers to an earlier
+    // packet of this slot are not taken for the current CV.
+    s.key = bulkNextKey_;
+    bulkNextKey_ = (bulkNextKey_ + 1) % BULK_KEYS;
+    b->data()->feedback_key = bulk_feedback_key(s.key);
+    s.needSend = 0;
+    ++s.tries;
+    s.deadline =
+        os_get_time_monotonic() + MSEC_TO_NSEC(POM_RESPONSE_TIMEOUT_MSEC);
+    track_->send(b.release());
+    return call_immediately(STATE(bulk_fill_window));
+  }
+
+  /// Sends the packet of a slot again, or gives up on its CV.
+  void bulk_retry(unsigned slot) {
+    if (bulkSlots_[slot].tries < DEFAULT_POM_READ_RETRIES) {
+      bulkSlots_[slot].needSend = 1;
+      return;
+    }
+    bulk_complete(slot, ProgrammingTrackFrontendRequest::BULK_FAILED);
+  }
+
+  /// Records the result of a CV and frees its slot.
+  void bulk_complete(unsigned slot, uint8_t status) {
+    request()->bulkStatus_[bulkSlots_[slot].index] = status;
+    if (status != ProgrammingTrackFrontendRequest::BULK_OK) {
+      ++bulkFailed_;
+    }
+    bulkSlots_[slot].index = BULK_SLOT_FREE;
+    --bulkRemaining_;
+    if (request()->bulkProgress_) {
+      request()->bulkProgress_->notify();
+    }
+  }
+
+  /// @returns the feedback key used for POM packets of a bulk request.
+  /// @param key is 0..BULK_KEYS-1. The keys point into this object, so they
+  /// do not collide with the keys of anybody else.
+  uintptr_t bulk_feedback_key(unsigned key) {
+    return reinterpret_cast<uintptr_t>(this) + 1 + key;
+  }
+
+  /// Railcom feedback callback during bulk requests.
+  void bulk_feedback(const dcc::Feedback& f) {
+    uintptr_t key = f.feedbackKey - bulk_feedback_key(0);
+    if (key >= BULK_KEYS || f.channel == 0xff || !f.ch2Size) {
+      return;
+    }
+    unsigned slot = 0;
+    while (slot < BULK_WINDOW &&
+           (bulkSlots_[slot].index == BULK_SLOT_FREE ||
+            bulkSlots_[slot].needSend || bulkSlots_[slot].key != key)) {
+      ++slot;
+    }
+    if (slot >= BULK_WINDOW) {
+      // Late answer to a packet that was already dealt with.
+      return;
+    }
+    dcc::parse_railcom_data(f, &interpretedResponse_);
+    bool busy = false;
+    for (const auto& e : interpretedResponse_) {
+      if (e.railcom_channel != 2) continue;
+      switch (e.type) {
+        case dcc::RailcomPacket::BUSY:
+          busy = true;
+          break;
+        case dcc::RailcomPacket::ACK:
+          if (request()->cmd_ == RequestType::POM_WRITE_BULK) {
+            bulk_complete(slot, ProgrammingTrackFrontendRequest::BULK_OK);
+            timer_.trigger();
+            return;
+          }
+          break;
+        case dcc::RailcomPacket::MOB_POM:
+          if (request()->cmd_ == RequestType::POM_READ_BULK) {
+            request()->bulkValues_[bulkSlots_[slot].index] = e.argument;
+          }
+          bulk_complete(slot, ProgrammingTrackFrontendRequest::BULK_OK);
+          timer_.trigger();
+          return;
+        default:
+          // Garbage, NACK and others: maybe the next repeat has a better
+          // answer; otherwise the slot times out.
+          break;
+      }
+    }
+    if (busy) {
+      // Other CVs in the window keep the track busy in the meantime, so
+      // there is no extra backoff.
+      bulk_retry(slot);
+      timer_.trigger();
+    }
+  }
+
+  /// Prepares for receiving the railcom answers to a POM packet.
+  void start_railcom_wait() {
+    seenRailcomBusy_ = 0;
+    seenRailcomGarbage_ = 0;
+    seenRailcomFeedback_ = 0;
+    errorCode_ = ERROR_PENDING;
+    railcomHub_->register_port(&railcomHandler_);
+  }
+
+  /// Waits until the railcom handler records a status for the POM packet
+  /// that was just sent, but at most POM_RESPONSE_TIMEOUT_MSEC.
+  /// @param c state to continue in.
+  Action wait_for_railcom(Callback c) {
+    if (errorCode_ != ERROR_PENDING) {
+      // The answer is already here.
+      return call_immediately(c);
+    }
+    return sleep_and_call(&timer_, MSEC_TO_NSEC(POM_RESPONSE_TIMEOUT_MSEC), c);
+  }
+
+  /// @returns how long to wait before repeating a POM packet that the
+  /// decoder answered with BUSY. Every consecutive busy answer doubles the
+  /// wait.
+  unsigned next_busy_backoff_msec() {
+    unsigned ret = busyBackoffMsec_;
+    busyBackoffMsec_ = std::min(2 * ret, (unsigned)POM_BUSY_BACKOFF_MAX_MSEC);
+    return ret;
+  }
+
+  /// Called when a POM operation completed. Decoders that answer right away
+  /// make the busy backoff shrink back.
+  void pom_succeeded() {
+    if (!seenRailcomBusy_) {
+      busyBackoffMsec_ = std::max(busyBackoffMsec_ / 2u,
+                                  (unsigned)POM_BUSY_BACKOFF_MIN_MSEC);
+    }
+  }
+
   /// Handler class for railcom feedback messages.
   class RailcomHandler : public dcc::RailcomHubPortInterface {
    public:
@@ -509,13 +843,23 @@ class ProgrammingTrackFrontend
   // Railcom feedback callback.
   void railcom_feedback(Buffer<dcc::RailcomHubData>* b, unsigned priority) {
     AutoReleaseBuffer<dcc::RailcomHubData> ar(b);
+    if (bulkActive_) {
+      return bulk_feedback(*b->data());
+    }
     if (errorCode_ != ERROR_PENDING) return;
     const dcc::Feedback& f = *b->data();
     if (f.feedbackKey != (reinterpret_cast<uintptr_t>(this))) {
       // not for me.
-      if (seenRailcomBusy_ && (errorCode_ == ERROR_PENDING)) {
-        // All repeats have returned busy.
-        return record_railcom_status(_ERROR_BUSY);
+      if (seenRailcomFeedback_) {
+        // All repeats of our packet are through without a meaningful
+        // answer. There is no point in waiting for the timeout.
+        if (seenRailcomBusy_) {
+          return record_railcom_status(_ERROR_BUSY);
+        } else if (seenRailcomGarbage_) {
+          return record_railcom_status(ERROR_GARBAGE);
+        } else {
+          return record_railcom_status(ERROR_NO_RAILCOM_CH2_DATA);
+        }
       }
       return;
     }
@@ -525,8 +869,10 @@ class ProgrammingTrackFrontend
     }
     LOG(INFO, "CV railcom feedback ch=%d: %s", f.channel,
         railcom_debug(f).c_str());
+    seenRailcomFeedback_ = 1;
     if (!f.ch2Size) {
-      return record_railcom_status(ERROR_NO_RAILCOM_CH2_DATA);
+      // Maybe a later repeat gets an answer.
+      return;
     }
     dcc::parse_railcom_data(f, &interpretedResponse_);
     unsigned new_status = ERROR_PENDING;
@@ -601,6 +947,34 @@ class ProgrammingTrackFrontend
   /// How many times to retry POM read commands if we don't get a POM response
   /// in railcom.
   static constexpr unsigned DEFAULT_POM_READ_RETRIES = 3;
+  /// How long to wait for the railcom answer to a POM packet.
+  static constexpr unsigned POM_RESPONSE_TIMEOUT_MSEC = 500;
+  /// Shortest wait before repeating a POM packet after a BUSY answer.
+  static constexpr unsigned POM_BUSY_BACKOFF_MIN_MSEC = 10;
+  /// Longest wait before repeating a POM packet after a BUSY answer.
+  static constexpr unsigned POM_BUSY_BACKOFF_MAX_MSEC = 160;
+  /// How many POM packets of a bulk request may be on the track at the same
+  /// time.
+  static constexpr unsigned BULK_WINDOW = 4;
+  /// Number of different feedback keys used by bulk requests. Must be
+  /// large enough that no answer comes back for a key after it was reused.
+  static constexpr unsigned BULK_KEYS = 16;
+  /// Marks a free entry in bulkSlots_.
+  static constexpr uint16_t BULK_SLOT_FREE = 0xFFFF;
+
+  /// A CV of a bulk request with a POM packet on the track.
+  struct BulkSlot {
+    /// Index of the CV in the request, or BULK_SLOT_FREE.
+    uint16_t index;
+    /// Feedback key of the last packet sent, 0..BULK_KEYS-1.
+    uint8_t key : 4;
+    /// How many packets were sent for this CV.
+    uint8_t tries : 3;
+    /// 1 if the packet has to be sent (again).
+    uint8_t needSend : 1;
+    /// When to give up waiting for the answer.
+    long long deadline;
+  };
 
   /// Error codes used by the POM railcom readout.
   enum {
@@ -644,7 +1018,27 @@ class ProgrammingTrackFrontend
   uint8_t seenRailcomBusy_ : 1;
   /// 1 if we have seen any unknown or garbage data from railcom.
   uint8_t seenRailcomGarbage_ : 1;
+  /// 1 if we have seen any railcom feedback for the current POM packet.
+  uint8_t seenRailcomFeedback_ : 1;
+  /// 1 while a bulk request is running.
+  uint8_t bulkActive_ : 1;
+  /// Wait before repeating a POM packet after a BUSY answer. Adapts to how
+  /// busy the decoders are.
+  uint8_t busyBackoffMsec_{POM_BUSY_BACKOFF_MIN_MSEC};
   
+  /// Slots of the CVs with packets on the track during a bulk request.
+  BulkSlot bulkSlots_[BULK_WINDOW];
+  /// Index of the next CV in the bulk request to put into a slot.
+  unsigned bulkNext_;
+  /// Number of CVs in the bulk request that are not completed yet.
+  unsigned bulkRemaining_;
+  /// Number of CVs in the bulk request that failed.
+  unsigned bulkFailed_;
+  /// Which slot bulk_send_packet() is sending.
+  uint8_t bulkSendSlot_;
+  /// Feedback key of the next bulk packet, 0..BULK_KEYS-1.
+  uint8_t bulkNextKey_{0};
+
   StateFlowTimer timer_{this};
   long long deadline_;  //< time when we should give up and return error.
   vector<dcc::RailcomPacket> interpretedResponse_;
@@ -657,6 +1051,8 @@ class ProgrammingTrackFrontend
   dcc::RailcomHubFlow *railcomHub_;
   /// Holding buffer for the next programming track packet to send.
   dcc::Packet serviceModePacket_;
+  /// CV values of decoders seen on the programming track.
+  DirectModeCvCache cvCache_;
 };
 
 }  // namespace commandstation
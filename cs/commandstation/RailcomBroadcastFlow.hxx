@@ -35,16 +35,34 @@
 #ifndef _BRACZ_CUSTOM_RAILCOMBROADCASTFLOW_HXX_
 #define _BRACZ_CUSTOM_RAILCOMBROADCASTFLOW_HXX_
 
+#include <algorithm>
+
+#include "commandstation/OccupancyBitmap.hxx"
 #include "dcc/RailcomHub.hxx"
 #include "dcc/RailcomBroadcastDecoder.hxx"
 
+/// Decodes the RailCom broadcast (channel 1) address of every detector
+/// channel and reports on the OpenLCB bus which locomotive is visible where.
+///
+/// An address is reported once it has been decoded in debounce_count
+/// consecutive packets of a channel, so that readings flickering between two
+/// addresses do not produce event churn. Occupancy changes are reported
+/// without debouncing. The event reports are sent by a separate emitter that
+/// batches the changes of all channels and keeps several messages in flight.
 class RailcomBroadcastFlow : public dcc::RailcomHubPort {
  public:
+  /// Maximum number of messages the emitter sends before waiting for them to
+  /// leave.
+  static constexpr unsigned MAX_IN_FLIGHT = 8;
+
+  /// @param debounce_count how many consecutive packets of a channel need to
+  /// decode to the same new address before it gets reported. 1 reports every
+  /// change right away.
   RailcomBroadcastFlow(dcc::RailcomHubFlow* parent, openlcb::Node* node,
                        dcc::RailcomHubPortInterface* occupancy_port,
                        dcc::RailcomHubPortInterface* overcurrent_port,
                        dcc::RailcomHubPortInterface* debug_port,
-                       unsigned channel_count)
+                       unsigned channel_count, unsigned debounce_count = 1)
       : dcc::RailcomHubPort(parent->service()),
         parent_(parent),
         node_(node),
@@ -52,29 +70,35 @@ class RailcomBroadcastFlow : public dcc::RailcomHubPort {
         overcurrentPort_(overcurrent_port),
         debugPort_(debug_port),
         size_(channel_count),
-        channels_(new dcc::RailcomBroadcastDecoder[channel_count]) {
+        channels_(new dcc::RailcomBroadcastDecoder[channel_count]),
+        state_(new ChannelState[channel_count]),
+        emitter_(this) {
+    set_debounce(debounce_count);
     parent_->register_port(this);
   }
 
   ~RailcomBroadcastFlow() {
     parent_->unregister_port(this);
+    delete[] state_;
     delete[] channels_;
   }
 
+  /// Changes the debounce count for all channels. Must be called on the
+  /// executor of the railcom hub.
+  void set_debounce(unsigned debounce_count) {
+    debounceCount_ = std::min(std::max(debounce_count, 1u), 255u);
+  }
+
   Action entry() {
     auto channel = message()->data()->channel;
     if (channel == 0xff) {
-      uint32_t new_values = message()->data()->ch1Data[0];
+      commandstation::OccupancyBitmap occupancy(*message()->data());
       for (unsigned i = 0; i < size_; ++i) {
-        channels_[i].set_occupancy(new_values & (1 << i));
         auto& decoder = channels_[i];
-        if (decoder.current_address() != decoder.lastAddress_) {
-          // We need to send a fake railcom packet to ourselves to allow the
-          // channel empty events to be generated.
-          auto* b = alloc();
-          b->data()->reset(0);
-          b->data()->channel = i;
-          send(b);
+        uint16_t before = decoder.current_address();
+        decoder.set_occupancy(occupancy.is_occupied(i));
+        if (decoder.current_address() != before) {
+          update_channel(i, true);
         }
       }
       if (occupancyPort_) {
@@ -101,54 +125,147 @@ class RailcomBroadcastFlow : public dcc::RailcomHubPort {
       }
       return exit();
     }
-    auto& decoder = channels_[channel];
-    if (decoder.current_address() == decoder.lastAddress_) {
-      return release_and_exit();
-    }
-    // Now: the visible address has changed. Send event reports.
-    return allocate_and_call(node_->iface()->global_message_write_flow(),
-                             STATE(send_invalid));
+    update_channel(channel, false);
+    return release_and_exit();
   }
 
-  Action send_invalid() {
-    auto channel = message()->data()->channel;
-    auto& decoder = channels_[channel];
-    auto* b =
-        get_allocation_result(node_->iface()->global_message_write_flow());
-    b->data()->reset(openlcb::Defs::MTI_PRODUCER_IDENTIFIED_INVALID,
-                     node_->node_id(),
-                     openlcb::eventid_to_buffer(
-                         address_to_eventid(channel, decoder.lastAddress_)));
-    b->set_done(n_.reset(this));
-    node_->iface()->global_message_write_flow()->send(b);
-    return wait_and_call(STATE(allocate_for_event));
-  }
+ private:
+  /// Debounce state of a channel.
+  struct ChannelState {
+    /// Address that differs from the last reported one.
+    uint16_t candidate{0};
+    /// How many packets in a row decoded to candidate.
+    uint8_t count{0};
+    /// True if candidate needs to be reported by the emitter.
+    bool pending{false};
+  };
 
-  Action allocate_for_event() {
-    return allocate_and_call(node_->iface()->global_message_write_flow(),
-                             STATE(send_event));
-  }
+  /// Sends the event reports for the channels that have a pending change.
+  class Emitter : public StateFlowBase {
+   public:
+    Emitter(RailcomBroadcastFlow* parent)
+        : StateFlowBase(parent->service()), parent_(parent) {}
 
-  Action send_event() {
-    auto channel = message()->data()->channel;
+    /// Called when a channel got a pending change.
+    void wake() {
+      if (is_terminated()) {
+        nextChannel_ = 0;
+        rescan_ = false;
+        start_flow(STATE(start_batch));
+      } else {
+        rescan_ = true;
+      }
+    }
+
+   private:
+    Action start_batch() {
+      numInFlight_ = 0;
+      n_.reset(this);
+      return call_immediately(STATE(next_channel));
+    }
+
+    Action next_channel() {
+      unsigned size = parent_->size_;
+      while (true) {
+        while (nextChannel_ < size && !parent_->state_[nextChannel_].pending) {
+          ++nextChannel_;
+        }
+        if (nextChannel_ < size || !rescan_) break;
+        // Something became pending behind our back.
+        rescan_ = false;
+        nextChannel_ = 0;
+      }
+      if (nextChannel_ >= size || numInFlight_ + 2 > MAX_IN_FLIGHT) {
+        n_.maybe_done();
+        return wait_and_call(STATE(batch_done));
+      }
+      channel_ = nextChannel_++;
+      auto& state = parent_->state_[channel_];
+      auto& decoder = parent_->channels_[channel_];
+      state.pending = false;
+      state.count = 0;
+      oldAddress_ = decoder.lastAddress_;
+      decoder.lastAddress_ = state.candidate;
+      return allocate_and_call(write_flow(), STATE(send_invalid));
+    }
+
+    Action send_invalid() {
+      auto* b = get_allocation_result(write_flow());
+      b->data()->reset(openlcb::Defs::MTI_PRODUCER_IDENTIFIED_INVALID,
+                       parent_->node_->node_id(),
+                       openlcb::eventid_to_buffer(
+                           address_to_eventid(channel_, oldAddress_)));
+      b->set_done(n_.new_child());
+      write_flow()->send(b);
+      ++numInFlight_;
+      return allocate_and_call(write_flow(), STATE(send_event));
+    }
+
+    Action send_event() {
+      auto* b = get_allocation_result(write_flow());
+      b->data()->reset(
+          openlcb::Defs::MTI_EVENT_REPORT, parent_->node_->node_id(),
+          openlcb::eventid_to_buffer(address_to_eventid(
+              channel_, parent_->channels_[channel_].lastAddress_)));
+      b->set_done(n_.new_child());
+      write_flow()->send(b);
+      ++numInFlight_;
+      return call_immediately(STATE(next_channel));
+    }
+
+    Action batch_done() {
+      if (nextChannel_ < parent_->size_ || rescan_) {
+        return call_immediately(STATE(start_batch));
+      }
+      return exit();
+    }
+
+    openlcb::MessageHandler* write_flow() {
+      return parent_->node_->iface()->global_message_write_flow();
+    }
+
+    RailcomBroadcastFlow* parent_;
+    /// Channel to look at next in the current scan.
+    unsigned nextChannel_{0};
+    /// Channel whose events are being sent.
+    unsigned channel_{0};
+    /// Messages sent in the current batch.
+    unsigned numInFlight_{0};
+    /// Previously reported address of channel_.
+    uint16_t oldAddress_{0};
+    /// True if a channel became pending while we were running.
+    bool rescan_{false};
+    /// Done when all messages of the current batch are out.
+    BarrierNotifiable n_;
+  };
+
+  /// Runs the debouncing after the decoder of a channel has been updated.
+  /// @param channel which channel
+  /// @param immediate if true, a new address is reported without debouncing.
+  void update_channel(unsigned channel, bool immediate) {
     auto& decoder = channels_[channel];
-    auto* b =
-        get_allocation_result(node_->iface()->global_message_write_flow());
-    b->data()->reset(openlcb::Defs::MTI_EVENT_REPORT, node_->node_id(),
-                     openlcb::eventid_to_buffer(address_to_eventid(
-                         channel, decoder.current_address())));
-    b->set_done(n_.reset(this));
-    node_->iface()->global_message_write_flow()->send(b);
-    decoder.lastAddress_ = decoder.current_address();
-    release();
-    return wait_and_call(STATE(finish));
+    auto& state = state_[channel];
+    uint16_t address = decoder.current_address();
+    if (address == decoder.lastAddress_) {
+      // Flickered back before it got reported.
+      state.count = 0;
+      state.pending = false;
+      return;
+    }
+    if (address != state.candidate) {
+      state.candidate = address;
+      state.count = 0;
+      state.pending = false;
+    }
+    if (state.count < 255) ++state.count;
+    if (!state.pending && (immediate || state.count >= debounceCount_)) {
+      state.pending = true;
+      emitter_.wake();
+    }
   }
 
-  Action finish() { return exit(); }
-
- private:
   static const uint64_t FEEDBACK_EVENTID_BASE;
-  uint64_t address_to_eventid(unsigned channel, uint16_t address) {
+  static uint64_t address_to_eventid(unsigned channel, uint16_t address) {
     uint64_t ret = FEEDBACK_EVENTID_BASE;
     ret |= uint64_t(channel & 0xff) << 48;
     ret |= address;
@@ -162,7 +279,10 @@ class RailcomBroadcastFlow : public dcc::RailcomHubPort {
   dcc::RailcomHubPortInterface* debugPort_;
   unsigned size_;
   dcc::RailcomBroadcastDecoder* channels_;
-  BarrierNotifiable n_;
+  ChannelState* state_;
+  /// Consecutive packets needed to report a new address.
+  uint8_t debounceCount_;
+  Emitter emitter_;
 };
 
 const uint64_t RailcomBroadcastFlow::FEEDBACK_EVENTID_BASE =
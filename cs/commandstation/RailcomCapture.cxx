@@ -0,0 +1,395 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file RailcomCapture.cxx
+ *
+ * Records RailCom hub traffic to a file and replays it for regression tests
+ * and benchmarks. Host-side only.
+ *
+ * @author Balazs Racz
+ * @date 18 Oct 2026
+ */
+
+#ifdef __linux__
+
+#include "commandstation/RailcomCapture.hxx"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+
+#include "os/os.h"
+#include "utils/logging.h"
+
+namespace commandstation {
+
+constexpr char RailcomCapture::MAGIC[];
+
+static void append_varint(std::string* out, uint32_t value) {
+  while (value >= 0x80) {
+    out->push_back((value & 0x7f) | 0x80);
+    value >>= 7;
+  }
+  out->push_back(value);
+}
+
+static bool read_varint(const std::string& data, size_t* ofs,
+                        uint32_t* value) {
+  *value = 0;
+  for (unsigned shift = 0; *ofs < data.size() && shift < 35; shift += 7) {
+    uint8_t c = data[(*ofs)++];
+    *value |= uint32_t(c & 0x7f) << shift;
+    if (!(c & 0x80)) return true;
+  }
+  return false;
+}
+
+void RailcomCapture::append(std::string* out, uint32_t delta_usec,
+                            const dcc::Feedback& f) {
+  append_varint(out, delta_usec);
+  out->push_back(f.channel);
+  out->push_back(f.ch1Size | (f.ch2Size << 4));
+  append_varint(out, (uint32_t)f.feedbackKey);
+  out->append((const char*)f.ch1Data, f.ch1Size);
+  out->append((const char*)f.ch2Data, f.ch2Size);
+}
+
+bool RailcomCapture::parse(const std::string& data,
+                           std::vector<RailcomCaptureRecord>* out) {
+  if (data.size() < MAGIC_LEN || data.compare(0, MAGIC_LEN, MAGIC) != 0) {
+    return false;
+  }
+  size_t ofs = MAGIC_LEN;
+  long long timestamp = 0;
+  while (ofs < data.size()) {
+    uint32_t delta, key;
+    if (!read_varint(data, &ofs, &delta) || ofs + 2 > data.size()) {
+      return false;
+    }
+    RailcomCaptureRecord r;
+    uint8_t channel = data[ofs++];
+    uint8_t sizes = data[ofs++];
+    unsigned ch1_size = sizes & 0xf;
+    unsigned ch2_size = sizes >> 4;
+    if (ch1_size > sizeof(r.feedback.ch1Data) ||
+        ch2_size > sizeof(r.feedback.ch2Data) ||
+        !read_varint(data, &ofs, &key) ||
+        ofs + ch1_size + ch2_size > data.size()) {
+      return false;
+    }
+    timestamp += delta;
+    r.timestampUsec = timestamp;
+    r.feedback.reset(key);
+    r.feedback.channel = channel;
+    for (unsigned i = 0; i < ch1_size; ++i) {
+      r.feedback.add_ch1_data(data[ofs++]);
+    }
+    for (unsigned i = 0; i < ch2_size; ++i) {
+      r.feedback.add_ch2_data(data[ofs++]);
+    }
+    out->push_back(r);
+  }
+  return true;
+}
+
+bool RailcomCapture::load(const std::string& filename,
+                          std::vector<RailcomCaptureRecord>* out) {
+  FILE* f = fopen(filename.c_str(), "rb");
+  if (!f) {
+    LOG_ERROR("railcom capture: cannot open %s: %s", filename.c_str(),
+              strerror(errno));
+    return false;
+  }
+  std::string data;
+  char buf[4096];
+  size_t len;
+  while ((len = fread(buf, 1, sizeof(buf), f)) > 0) {
+    data.append(buf, len);
+  }
+  fclose(f);
+  return parse(data, out);
+}
+
+RailcomCaptureWriter::RailcomCaptureWriter(dcc::RailcomHubFlow* hub,
+                                           const std::string& filename)
+    : dcc::RailcomHubPort(hub->service()),
+      hub_(hub),
+      flushFlow_(hub->service(), [this]() { flush(); }) {
+  fd_ = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd_ < 0) {
+    LOG_ERROR("railcom capture: cannot create %s: %s", filename.c_str(),
+              strerror(errno));
+  }
+  pending_.assign(RailcomCapture::MAGIC, RailcomCapture::MAGIC_LEN);
+  // Nobody else sees *this yet, so this is safe off the executor.
+  flush();
+  flushFlow_.set_delay_nsec(FLUSH_DELAY_NSEC);
+  hub_->register_port(this);
+}
+
+RailcomCaptureWriter::~RailcomCaptureWriter() {
+  hub_->unregister_port(this);
+  flushFlow_.shutdown();
+  hub_->service()->executor()->sync_run([this]() { flush(); });
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+}
+
+void RailcomCaptureWriter::flush() {
+  const char* data = pending_.data();
+  size_t len = pending_.size();
+  while (fd_ >= 0 && len) {
+    ssize_t ret = ::write(fd_, data, len);
+    if (ret < 0 && errno == EINTR) continue;
+    if (ret <= 0) {
+      LOG_ERROR("railcom capture: write failed: %s", strerror(errno));
+      ::close(fd_);
+      fd_ = -1;
+      break;
+    }
+    data += ret;
+    len -= ret;
+  }
+  pending_.clear();
+}
+
+StateFlowBase::Action RailcomCaptureWriter::entry() {
+  long long now_usec = os_get_time_monotonic() / 1000;
+  long long delta = lastUsec_ ? now_usec - lastUsec_ : 0;
+  lastUsec_ = now_usec;
+  RailcomCapture::append(&pending_, std::min(delta, (long long)UINT32_MAX),
+                         *message()->data());
+  ++numPackets_;
+  if (pending_.size() >= FLUSH_SIZE) {
+    flush();
+    flushFlow_.cancel();
+  } else {
+    flushFlow_.schedule();
+  }
+  return release_and_exit();
+}
+
+RailcomDebugReceiver::RailcomDebugReceiver(openlcb::If* iface,
+                                           dcc::RailcomHubFlow* hub)
+    : iface_(iface), hub_(hub) {
+  // One registration covers MTI_BASE + 0..7; handle_message picks ours.
+  iface_->dispatcher()->register_handler(
+      &handler_, static_cast<openlcb::Defs::MTI>(MTI_BASE),
+      openlcb::Defs::MTI_EXACT & ~7);
+}
+
+RailcomDebugReceiver::~RailcomDebugReceiver() {
+  iface_->dispatcher()->unregister_handler(
+      &handler_, static_cast<openlcb::Defs::MTI>(MTI_BASE),
+      openlcb::Defs::MTI_EXACT & ~7);
+}
+
+void RailcomDebugReceiver::handle_message(Buffer<openlcb::GenMessage>* b) {
+  auto bd = get_buffer_deleter(b);
+  unsigned kind = b->data()->mti - MTI_BASE;
+  const string& p = b->data()->payload;
+  if (kind < 1 || kind > 4 || p.empty()) {
+    return;
+  }
+  // 1 and 3 carry channel 1 data, 2 and 4 channel 2 data.
+  bool ch1 = kind & 1;
+  auto* f = hub_->alloc();
+  f->data()->reset(0);
+  f->data()->channel = p[0] & 0x0F;
+  for (unsigned i = 1; i < p.size(); ++i) {
+    if (ch1) {
+      f->data()->add_ch1_data(p[i]);
+    } else {
+      f->data()->add_ch2_data(p[i]);
+    }
+  }
+  hub_->send(f);
+}
+
+void RailcomReplayFlow::start(const std::vector<RailcomCaptureRecord>* records,
+                              unsigned speedup, Notifiable* done) {
+  records_ = records;
+  speedup_ = speedup;
+  done_ = done;
+  next_ = 0;
+  maxLag_ = 0;
+  startTime_ = os_get_time_monotonic();
+  start_flow(STATE(next_record));
+}
+
+StateFlowBase::Action RailcomReplayFlow::next_record() {
+  if (next_ >= records_->size()) {
+    endTime_ = os_get_time_monotonic();
+    if (done_) {
+      done_->notify();
+    }
+    return exit();
+  }
+  if (speedup_) {
+    long long due =
+        startTime_ + (*records_)[next_].timestampUsec * 1000 / speedup_;
+    long long now = os_get_time_monotonic();
+    if (due > now) {
+      return sleep_and_call(&timer_, due - now, STATE(allocate_record));
+    }
+  }
+  return call_immediately(STATE(allocate_record));
+}
+
+StateFlowBase::Action RailcomReplayFlow::allocate_record() {
+  return allocate_and_call(hub_, STATE(fill_record));
+}
+
+StateFlowBase::Action RailcomReplayFlow::fill_record() {
+  auto* b = get_allocation_result(hub_);
+  *b->data() = (*records_)[next_].feedback;
+  if (!speedup_) {
+    b->set_done(n_.reset(this));
+    hub_->send(b);
+    return wait_and_call(STATE(record_sent));
+  }
+  long long due =
+      startTime_ + (*records_)[next_].timestampUsec * 1000 / speedup_;
+  maxLag_ = std::max(maxLag_, os_get_time_monotonic() - due);
+  hub_->send(b);
+  return call_immediately(STATE(record_sent));
+}
+
+StateFlowBase::Action RailcomReplayFlow::record_sent() {
+  ++next_;
+  return call_immediately(STATE(next_record));
+}
+
+/// @returns the CPU time used by the calling thread.
+static long long thread_cpu_nsec() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/// Follows one packet from the hand-off to the consumer until it gets
+/// released.
+class RailcomConsumerMeter::Probe : public Notifiable {
+ public:
+  Probe(RailcomConsumerMeter* parent) : parent_(parent) {}
+
+  /// Starts measuring.
+  /// @returns the notifiable to set as the done of the packet.
+  BarrierNotifiable* start() {
+    startTime_ = os_get_time_monotonic();
+    startCpu_ = thread_cpu_nsec();
+    return done_.reset(this);
+  }
+
+  void notify() override {
+    parent_->done(this, os_get_time_monotonic() - startTime_,
+                  thread_cpu_nsec() - startCpu_);
+  }
+
+ private:
+  RailcomConsumerMeter* parent_;
+  long long startTime_{0};
+  long long startCpu_{0};
+  BarrierNotifiable done_;
+};
+
+RailcomConsumerMeter::RailcomConsumerMeter(
+    dcc::RailcomHubFlow* hub, dcc::RailcomHubPortInterface* consumer,
+    const char* name)
+    : dcc::RailcomHubPort(hub->service()),
+      hub_(hub),
+      consumer_(consumer),
+      name_(name) {
+  hub_->register_port(this);
+}
+
+RailcomConsumerMeter::~RailcomConsumerMeter() {
+  hub_->unregister_port(this);
+  for (Probe* p : allProbes_) {
+    delete p;
+  }
+}
+
+StateFlowBase::Action RailcomConsumerMeter::entry() {
+  Probe* probe;
+  {
+    AtomicHolder h(this);
+    if (freeProbes_.empty()) {
+      probe = new Probe(this);
+      allProbes_.push_back(probe);
+    } else {
+      probe = freeProbes_.back();
+      freeProbes_.pop_back();
+    }
+  }
+  auto* b = consumer_->alloc();
+  *b->data() = *message()->data();
+  release();
+  b->set_done(probe->start());
+  consumer_->send(b);
+  return exit();
+}
+
+void RailcomConsumerMeter::done(Probe* probe, long long latency_nsec,
+                                long long cpu_nsec) {
+  AtomicHolder h(this);
+  latency_.add(latency_nsec);
+  ++numPackets_;
+  totalLatencyNsec_ += latency_nsec;
+  maxLatencyNsec_ = std::max(maxLatencyNsec_, latency_nsec);
+  cpuNsec_ += cpu_nsec;
+  freeProbes_.push_back(probe);
+}
+
+void RailcomConsumerMeter::reset() {
+  AtomicHolder h(this);
+  latency_ = LatencyHistogram();
+  numPackets_ = 0;
+  totalLatencyNsec_ = 0;
+  maxLatencyNsec_ = 0;
+  cpuNsec_ = 0;
+}
+
+std::string RailcomConsumerMeter::report() {
+  AtomicHolder h(this);
+  unsigned n = std::max(numPackets_, 1u);
+  char buf[200];
+  snprintf(buf, sizeof(buf),
+           "%s: %u packets, latency avg %lld max %lld usec, cpu %lld "
+           "nsec/packet",
+           name_, numPackets_, totalLatencyNsec_ / n / 1000,
+           maxLatencyNsec_ / 1000, cpuNsec_ / n);
+  return buf;
+}
+
+}  // namespace commandstation
+
+#endif  // __linux__
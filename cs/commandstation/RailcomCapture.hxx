@@ -0,0 +1,270 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file RailcomCapture.hxx
+ *
+ * Records RailCom hub traffic to a file and replays it for regression tests
+ * and benchmarks. Host-side only.
+ *
+ * @author Balazs Racz
+ * @date 18 Oct 2026
+ */
+
+#ifndef _COMMANDSTATION_RAILCOMCAPTURE_HXX_
+#define _COMMANDSTATION_RAILCOMCAPTURE_HXX_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "commandstation/DccLatencyMonitor.hxx"
+#include "custom/DelayedFlushFlow.hxx"
+#include "dcc/RailcomHub.hxx"
+#include "executor/StateFlow.hxx"
+#include "openlcb/If.hxx"
+#include "utils/Atomic.hxx"
+
+namespace commandstation {
+
+/** One feedback packet of a capture.
+ *
+ * The file starts with the 5 bytes of RailcomCapture::MAGIC. Every packet is
+ * then stored as
+ *  - varint: microseconds since the previous packet,
+ *  - channel,
+ *  - ch1Size | (ch2Size << 4),
+ *  - varint: low 32 bits of the feedback key,
+ *  - ch1Size bytes of channel 1 data, ch2Size bytes of channel 2 data.
+ * Varints are little-endian base 128. A typical broadcast cutout takes 7
+ * bytes. */
+struct RailcomCaptureRecord {
+  /// Time since the beginning of the capture.
+  long long timestampUsec;
+  /// The packet. The feedback key holds the low 32 bits of the original key
+  /// only; keys pointing to objects of the capturing process will not match
+  /// anything during replay.
+  dcc::Feedback feedback;
+};
+
+/// Encoding and decoding of capture files.
+struct RailcomCapture {
+  /// File header, including the format version.
+  static constexpr char MAGIC[] = "RCAP\x01";
+  static constexpr unsigned MAGIC_LEN = 5;
+
+  /// Appends one packet to an encoded capture.
+  /// @param delta_usec time since the previous packet
+  static void append(std::string* out, uint32_t delta_usec,
+                     const dcc::Feedback& f);
+
+  /// Decodes a capture.
+  /// @param data file contents, including the header
+  /// @param out the packets get appended here
+  /// @returns false if the data is not a capture or is truncated. Packets
+  /// before the error are still returned.
+  static bool parse(const std::string& data,
+                    std::vector<RailcomCaptureRecord>* out);
+
+  /// Reads and decodes a capture file.
+  /// @returns false if the file cannot be read or is invalid.
+  static bool load(const std::string& filename,
+                   std::vector<RailcomCaptureRecord>* out);
+};
+
+/** Hub port that writes every feedback packet seen on a RailCom hub to a
+ * capture file. Packets reach the file at most FLUSH_DELAY_NSEC after they
+ * were seen, so a capture that is cut short loses only the last moment. */
+class RailcomCaptureWriter : public dcc::RailcomHubPort {
+ public:
+  /// Creates or truncates the file, writes the file header and starts
+  /// recording.
+  RailcomCaptureWriter(dcc::RailcomHubFlow* hub, const std::string& filename);
+  /// Stops recording and flushes the file. Must not be called on the
+  /// executor of the hub.
+  ~RailcomCaptureWriter();
+
+  /// Writes the buffered packets to the file. Must be called on the
+  /// executor of the hub.
+  void flush();
+
+  /// @returns the number of packets recorded.
+  unsigned num_packets() { return numPackets_; }
+
+  Action entry() override;
+
+ private:
+  /// How many bytes to collect before writing them out.
+  static constexpr unsigned FLUSH_SIZE = 4096;
+  /// How long a packet may wait in memory.
+  static constexpr long long FLUSH_DELAY_NSEC = SEC_TO_NSEC(1);
+
+  dcc::RailcomHubFlow* hub_;
+  int fd_;
+  /// Encoded packets not written yet.
+  std::string pending_;
+  /// Time of the previous packet in usec; 0 before the first.
+  long long lastUsec_{0};
+  unsigned numPackets_{0};
+  /// Writes out the packets that did not fill FLUSH_SIZE.
+  bracz_custom::DelayedFlushFlow flushFlow_;
+};
+
+/** Feeds the RailCom packets that the RailCom boards' debug proxies put on
+ * the OpenLCB bus into a local RailCom hub, so that a host can record the
+ * feedback of the layout. Understands both the OpenMRN
+ * RailcomToOpenLCBDebugProxy (MTI_XPRESSNET + 1 and + 2) and the one in
+ * acc.tiva.3 (MTI_XPRESSNET + 3 and + 4, channel number tagged with 0x10 or
+ * 0x20). The proxies send the channel 1 and channel 2 data of a cutout in
+ * separate messages; each becomes a packet of its own. The feedback keys of
+ * the board are lost. */
+class RailcomDebugReceiver {
+ public:
+  /// First MTI of the debug messages. The payload of each is the channel
+  /// number followed by the data bytes.
+  static constexpr uint16_t MTI_BASE = openlcb::Defs::MTI_XPRESSNET;
+
+  /// @param iface the bus to listen on
+  /// @param hub where to send the packets. Must use the executor of iface.
+  RailcomDebugReceiver(openlcb::If* iface, dcc::RailcomHubFlow* hub);
+  ~RailcomDebugReceiver();
+
+ private:
+  /// Called for every message with one of our MTIs.
+  void handle_message(Buffer<openlcb::GenMessage>* b);
+
+  openlcb::If* iface_;
+  dcc::RailcomHubFlow* hub_;
+  openlcb::MessageHandler::GenericHandler handler_{
+      this, &RailcomDebugReceiver::handle_message};
+};
+
+/** Plays back a capture into a RailCom hub. */
+class RailcomReplayFlow : public StateFlowBase {
+ public:
+  RailcomReplayFlow(dcc::RailcomHubFlow* hub)
+      : StateFlowBase(hub->service()), hub_(hub) {}
+
+  /** Starts the playback.
+   * @param records packets to play back. Must stay alive until done.
+   * @param speedup 1 for real time, N for N times faster. 0 sends every
+   * packet as soon as all consumers released the previous one.
+   * @param done notified when the last packet was sent. */
+  void start(const std::vector<RailcomCaptureRecord>* records,
+             unsigned speedup, Notifiable* done);
+
+  /// @returns how long the last playback took.
+  long long elapsed_nsec() { return endTime_ - startTime_; }
+
+  /// @returns the largest delay of a packet behind its scheduled time.
+  long long max_lag_nsec() { return maxLag_; }
+
+ private:
+  Action next_record();
+  Action allocate_record();
+  Action fill_record();
+  Action record_sent();
+
+  dcc::RailcomHubFlow* hub_;
+  const std::vector<RailcomCaptureRecord>* records_{nullptr};
+  Notifiable* done_{nullptr};
+  unsigned next_{0};
+  unsigned speedup_{0};
+  long long startTime_{0};
+  long long endTime_{0};
+  long long maxLag_{0};
+  StateFlowTimer timer_{this};
+  BarrierNotifiable n_;
+};
+
+/** Measures how long a consumer of a RailCom hub takes per packet.
+ *
+ * Registers on the hub in place of the consumer and hands every packet to
+ * it in a buffer of its own. Latency is the time from the hand-off until the
+ * consumer releases the buffer; CPU time is the CPU time of the handing-off
+ * thread over the same period. Work of other consumers running in between
+ * is counted too, so for exact CPU numbers meter one consumer at a time with
+ * RailcomReplayFlow's flow-controlled mode. The consumer has to release the
+ * packets on the executor of the hub. */
+class RailcomConsumerMeter : public dcc::RailcomHubPort, private Atomic {
+ public:
+  /// @param hub where to take packets from
+  /// @param consumer the measured consumer. Must not be registered on the
+  /// hub.
+  /// @param name used in the report
+  RailcomConsumerMeter(dcc::RailcomHubFlow* hub,
+                       dcc::RailcomHubPortInterface* consumer,
+                       const char* name);
+  ~RailcomConsumerMeter();
+
+  Action entry() override;
+
+  /// Clears the statistics.
+  void reset();
+
+  /// @returns the latency histogram.
+  LatencyHistogram latency() {
+    AtomicHolder h(this);
+    return latency_;
+  }
+
+  /// @returns number of packets the consumer released.
+  unsigned num_packets() {
+    AtomicHolder h(this);
+    return numPackets_;
+  }
+
+  /// @returns total CPU time spent on the packets.
+  long long cpu_nsec() {
+    AtomicHolder h(this);
+    return cpuNsec_;
+  }
+
+  /// @returns a one-line human readable summary.
+  std::string report();
+
+ private:
+  class Probe;
+
+  /// Called by a probe when the consumer released a packet.
+  void done(Probe* probe, long long latency_nsec, long long cpu_nsec);
+
+  dcc::RailcomHubFlow* hub_;
+  dcc::RailcomHubPortInterface* consumer_;
+  const char* name_;
+  /// Probes not in use.
+  std::vector<Probe*> freeProbes_;
+  /// All probes we ever allocated.
+  std::vector<Probe*> allProbes_;
+  LatencyHistogram latency_;
+  unsigned numPackets_{0};
+  long long totalLatencyNsec_{0};
+  long long maxLatencyNsec_{0};
+  long long cpuNsec_{0};
+};
+
+}  // namespace commandstation
+
+#endif  // _COMMANDSTATION_RAILCOMCAPTURE_HXX_
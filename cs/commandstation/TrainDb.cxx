@@ -1,5 +1,8 @@
 #include "commandstation/TrainDb.hxx"
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
 #include <vector>
 
 #include "commandstation/TrainDbCdi.hxx"
@@ -108,6 +111,12 @@ class FileTrainDbEntry : public TrainDbEntry {
     init();
   }
 
+  /// Use this constructor when the function table has already been parsed
+  /// from memory. Avoids reading every function slot from the file.
+  /// @param max_fn is the largest valid function ID + 1.
+  FileTrainDbEntry(int fd, unsigned offset, uint8_t max_fn)
+      : cdiEntry_(offset), fd_(fd), maxFn_(max_fn) {}
+
   /** Retrieves the NMRAnet NodeID for the virtual node that represents a
    * particular train known to the database.
    */
@@ -209,40 +218,300 @@ bool TrainDb::has_file() {
   return (cfg_.offset() != NONEX_OFFSET);
 }
 
+namespace {
+
+/// Magic value at the beginning of a TrainDb snapshot file. Change this when
+/// the snapshot format changes.
+static constexpr uint32_t SNAPSHOT_MAGIC = 0x54444204;  // "TDB" v4
+
+/// Header of the TrainDb snapshot file. It is stored as HEADER_SIZE bytes,
+/// every field little-endian, followed by SLOT_SIZE bytes for each
+/// TrainDb::SlotState.
+struct SnapshotHeader {
+  static constexpr unsigned HEADER_SIZE = 16;
+  static constexpr unsigned SLOT_SIZE = 12;
+
+  uint32_t magic;
+  /// How many slots follow.
+  uint32_t count;
+  /// Number of bytes of the config file covered by the snapshot.
+  uint32_t config_size;
+  /// checksum() of these bytes of the config file.
+  uint32_t config_checksum;
+
+  bool operator==(const SnapshotHeader &o) const {
+    return magic == o.magic && count == o.count &&
+           config_size == o.config_size &&
+           config_checksum == o.config_checksum;
+  }
+};
+
+/// Layout of a single entry, for computing field offsets relative to the
+/// beginning of the entry.
+static const TrainDbCdiEntry ENTRY_LAYOUT(0);
+
+/// Reads a block from the config file with as few syscalls as possible.
+/// @return true on success.
+bool read_block(int fd, unsigned offset, std::vector<uint8_t> *buf) {
+  if (lseek(fd, offset, SEEK_SET) != (off_t)offset) {
+    return false;
+  }
+  size_t done = 0;
+  while (done < buf->size()) {
+    ssize_t ret = ::read(fd, buf->data() + done, buf->size() - done);
+    if (ret <= 0) {
+      return false;
+    }
+    done += ret;
+  }
+  return true;
+}
+
+/// FNV-1a hash of a memory block. Used to detect changes to individual
+/// fields.
+uint32_t checksum(const uint8_t *data, size_t len) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= data[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+/// Appends a little-endian 32-bit value to a buffer.
+void put_u32(std::vector<uint8_t> *out, uint32_t v) {
+  for (unsigned i = 0; i < 4; ++i) {
+    out->push_back(v >> (8 * i));
+  }
+}
+
+/// @return the little-endian 32-bit value at p.
+uint32_t get_u32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/// Reads a whole file into a buffer.
+/// @return true on success.
+bool read_file(const char *path, std::vector<uint8_t> *buf) {
+  int sfd = ::open(path, O_RDONLY);
+  if (sfd < 0) {
+    return false;
+  }
+  uint8_t chunk[256];
+  ssize_t ret;
+  while ((ret = ::read(sfd, chunk, sizeof(chunk))) > 0) {
+    buf->insert(buf->end(), chunk, chunk + ret);
+  }
+  ::close(sfd);
+  return ret == 0;
+}
+
+/// Tries to load a snapshot file.
+/// @param expected is the header the snapshot must have.
+/// @return true if the snapshot exists and belongs to the config file.
+bool read_snapshot(const char *path, const SnapshotHeader &expected,
+                   std::vector<TrainDb::SlotState> *slots) {
+  std::vector<uint8_t> in;
+  if (!read_file(path, &in) || in.size() < SnapshotHeader::HEADER_SIZE) {
+    return false;
+  }
+  SnapshotHeader hdr;
+  hdr.magic = get_u32(&in[0]);
+  hdr.count = get_u32(&in[4]);
+  hdr.config_size = get_u32(&in[8]);
+  hdr.config_checksum = get_u32(&in[12]);
+  if (!(hdr == expected) ||
+      in.size() != SnapshotHeader::HEADER_SIZE +
+                       hdr.count * SnapshotHeader::SLOT_SIZE) {
+    return false;
+  }
+  slots->resize(hdr.count);
+  const uint8_t *p = &in[SnapshotHeader::HEADER_SIZE];
+  for (auto &s : *slots) {
+    s.name_hash = get_u32(p);
+    s.fn_hash = get_u32(p + 4);
+    s.address = p[8] | (p[9] << 8);
+    s.mode = p[10];
+    s.max_fn = p[11];
+    p += SnapshotHeader::SLOT_SIZE;
+  }
+  return true;
+}
+
+/// Writes a snapshot file. A snapshot that could not be written completely
+/// is removed; the next boot will just parse the config file again.
+void write_snapshot(const char *path, const SnapshotHeader &hdr,
+                    const std::vector<TrainDb::SlotState> &slots) {
+  int sfd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (sfd < 0) {
+    LOG(INFO, "Could not write traindb snapshot %s", path);
+    return;
+  }
+  std::vector<uint8_t> out;
+  out.reserve(SnapshotHeader::HEADER_SIZE +
+              slots.size() * SnapshotHeader::SLOT_SIZE);
+  put_u32(&out, hdr.magic);
+  put_u32(&out, hdr.count);
+  put_u32(&out, hdr.config_size);
+  put_u32(&out, hdr.config_checksum);
+  for (const auto &s : slots) {
+    put_u32(&out, s.name_hash);
+    put_u32(&out, s.fn_hash);
+    out.push_back(s.address & 0xff);
+    out.push_back(s.address >> 8);
+    out.push_back(s.mode);
+    out.push_back(s.max_fn);
+  }
+  size_t done = 0;
+  while (done < out.size()) {
+    ssize_t ret = ::write(sfd, out.data() + done, out.size() - done);
+    if (ret <= 0) {
+      break;
+    }
+    done += ret;
+  }
+  if (::close(sfd) != 0 || done < out.size()) {
+    LOG_ERROR("Failed to write traindb snapshot %s", path);
+    ::unlink(path);
+  }
+}
+
+}  // namespace
+
+/// Decodes one train entry from memory.
+/// @param entry points to the beginning of the entry's config data.
+/// @param s will be filled in with the data.
+void TrainDb::parse_slot(const uint8_t *entry, SlotState *s) {
+  const uint8_t *p = entry + ENTRY_LAYOUT.address().offset();
+  // Config entries are stored in network byte order.
+  s->address = (p[0] << 8) | p[1];
+  s->mode = entry[ENTRY_LAYOUT.mode().offset()];
+  s->max_fn = 1;  // F0 always valid
+  const auto &fns = ENTRY_LAYOUT.functions().all_functions();
+  for (unsigned j = 0; j < fns.num_repeats(); ++j) {
+    if (entry[fns.entry(j).icon().offset()] != FN_NONEXISTANT) {
+      // if entry j valid -> FN(j+1) exists -> max_fn == j+2
+      s->max_fn = j + 2;
+    }
+  }
+  s->name_hash = checksum(entry + ENTRY_LAYOUT.name().offset(),
+                          ENTRY_LAYOUT.name().size());
+  s->fn_hash = checksum(entry + ENTRY_LAYOUT.functions().offset(),
+                        ENTRY_LAYOUT.functions().size());
+}
+
 /** Loads the train database from the given file. The file must stay open so
  * long as *this is alive. */
 size_t TrainDb::load_from_file(int fd, bool initial_load) {
   if (cfg_.offset() == NONEX_OFFSET) {
     return 0;
   }
-  if (initial_load) {
-    for (unsigned i = 0; i < cfg_.num_repeats(); ++i) {
-      uint16_t address = cfg_.entry(i).address().read(fd);
-      unsigned mode = cfg_.entry(i).mode().read(fd);
-      if (address != 0 && address != 0xffffu && mode != 0) {
-        entries_.emplace_back(new FileTrainDbEntry(fd, cfg_.entry(i).offset()));
-      }
-    }
-  } else {
+  const unsigned entry_size = TrainDbCdiEntry::size();
+  std::vector<uint8_t> region(cfg_.end_offset() - cfg_.offset());
+  if (!read_block(fd, cfg_.offset(), &region)) {
+    LOG_ERROR("Failed to read the train database from the config file.");
+    return cfg_.end_offset();
+  }
+  if (!initial_load) {
+    // The config file may have been written through the train nodes' or the
+    // main node's config space, so every entry is compared to what we have.
+    // This takes the same single read as the initial load.
     for (unsigned i = 0; i < cfg_.num_repeats(); ++i) {
-      uint16_t address = cfg_.entry(i).address().read(fd);
-      if (address != 0 && address != 0xffffu) {
-        std::shared_ptr<FileTrainDbEntry> e(new FileTrainDbEntry(fd, cfg_.entry(i).offset()));
-        openlcb::NodeID traction_node = e->get_traction_node();
-        bool found = false;
-        for (unsigned i = 0; i < entries_.size(); ++i) {
-          if (entries_[i]->get_traction_node() == traction_node) {
-            entries_[i] = e;
-            found = true;
-          }
-        }
-        if (!found) {
-          entries_.emplace_back(std::move(e));
-        }
-      }
+      SlotState s;
+      parse_slot(region.data() + i * entry_size, &s);
+      apply_slot(fd, i, s);
     }
+    return cfg_.end_offset();
   }
+  // The snapshot is only trusted if it was made from the same bytes of the
+  // config file. Writes through the config space change neither the size
+  // nor, on many filesystems, the modification time of the file.
+  SnapshotHeader hdr;
+  hdr.magic = SNAPSHOT_MAGIC;
+  hdr.count = cfg_.num_repeats();
+  hdr.config_size = region.size();
+  hdr.config_checksum = checksum(region.data(), region.size());
+  if (snapshotFile_ && read_snapshot(snapshotFile_, hdr, &slotState_)) {
+    create_file_entries(fd);
+    return cfg_.end_offset();
+  }
+  slotState_.resize(cfg_.num_repeats());
+  for (unsigned i = 0; i < cfg_.num_repeats(); ++i) {
+    parse_slot(region.data() + i * entry_size, &slotState_[i]);
+  }
+  if (snapshotFile_) {
+    write_snapshot(snapshotFile_, hdr, slotState_);
+  }
+  create_file_entries(fd);
   return cfg_.end_offset();
 }
 
+void TrainDb::create_file_entries(int fd) {
+  slotTrainId_.assign(cfg_.num_repeats(), -1);
+  for (unsigned i = 0; i < cfg_.num_repeats(); ++i) {
+    if (slotState_[i].is_valid()) {
+      slotTrainId_[i] = entries_.size();
+      entries_.emplace_back(new FileTrainDbEntry(fd, cfg_.entry(i).offset(),
+                                                 slotState_[i].max_fn));
+    }
+  }
+}
+
+/// @return the traction node ID of a train stored in a given slot.
+static openlcb::NodeID slot_node_id(const TrainDb::SlotState &s) {
+  return openlcb::TractionDefs::train_node_id_from_legacy(
+      dcc_mode_to_address_type(static_cast<DccMode>(s.mode), s.address),
+      s.address);
+}
+
+void TrainDb::apply_slot(int fd, unsigned slot, const SlotState &s) {
+  const SlotState old = slotState_[slot];
+  int id = slotTrainId_[slot];
+  bool was_valid = id >= 0 && entries_[id];
+  bool is_valid = s.is_valid();
+  unsigned flags = 0;
+  if (was_valid &&
+      (!is_valid || old.address != s.address || old.mode != s.mode)) {
+    flags |= TrainDbListener::REMOVED;
+  }
+  if (is_valid && (!was_valid || (flags & TrainDbListener::REMOVED))) {
+    flags |= TrainDbListener::ADDED;
+  }
+  if (was_valid && is_valid && !flags) {
+    if (old.name_hash != s.name_hash) {
+      flags |= TrainDbListener::RENAMED;
+    }
+    if (old.fn_hash != s.fn_hash) {
+      flags |= TrainDbListener::FUNCTIONS_CHANGED;
+    }
+  }
+  slotState_[slot] = s;
+  if (!flags) {
+    return;
+  }
+  openlcb::NodeID old_node = was_valid ? slot_node_id(old) : 0;
+  if (is_valid) {
+    std::shared_ptr<TrainDbEntry> e(
+        new FileTrainDbEntry(fd, cfg_.entry(slot).offset(), s.max_fn));
+    if (id < 0) {
+      id = entries_.size();
+      slotTrainId_[slot] = id;
+      entries_.emplace_back(std::move(e));
+    } else {
+      entries_[id] = std::move(e);
+    }
+  } else {
+    // Keeps the train IDs of everyone else stable.
+    entries_[id].reset();
+  }
+  for (auto *l : listeners_) {
+    l->train_changed(id, old_node, flags);
+  }
+}
+
+void TrainDb::remove_listener(TrainDbListener *l) {
+  listeners_.erase(std::remove(listeners_.begin(), listeners_.end(), l),
+                   listeners_.end());
+}
+
 }  // namespace commandstation
@@ -99,6 +99,35 @@ public:
 std::shared_ptr<TrainDbEntry> create_lokdb_entry(
     const const_traindb_entry_t* e);
 
+/// Interface for receiving notifications when the file-based train database
+/// changes.
+class TrainDbListener {
+ public:
+  virtual ~TrainDbListener() {}
+
+  /// Bits of the flags argument of train_changed.
+  enum ChangeFlags {
+    /// A new train appeared. When set together with REMOVED, the train's
+    /// address or drive mode changed, i.e. it has a new traction node ID.
+    ADDED = 1,
+    /// The train is gone, and get_entry(train_id) returns nullptr.
+    REMOVED = 2,
+    /// The train's name changed.
+    RENAMED = 4,
+    /// The function labels of the train changed.
+    FUNCTIONS_CHANGED = 8,
+  };
+
+  /// Called by TrainDb::load_from_file on a reload for every train that has
+  /// changed.
+  /// @param train_id is the index of the train in the TrainDb.
+  /// @param old_node is the traction node ID the train had before the change
+  /// (0 if it did not exist).
+  /// @param flags is a bitmask of ChangeFlags.
+  virtual void train_changed(unsigned train_id, openlcb::NodeID old_node,
+                             unsigned flags) = 0;
+};
+
 class TrainDb {
  public:
   /** Use this constructor if there is no file-based train database. */
@@ -110,11 +139,31 @@ class TrainDb {
   /** @return true if this traindb is backed by a file. */
   bool has_file();
   /** Loads the train database from the given file. The file must stay open so
-   * long as *this is alive.
+   * long as *this is alive. On a reload all entries are compared to the file,
+   * but only the changed ones are updated and the listeners are notified
+   * about them.
    * @returns the size of the backing file (i.e. end of the traindb
    * configuration). */
   size_t load_from_file(int fd, bool initial_load);
 
+  /** Registers a listener for change notifications. */
+  void add_listener(TrainDbListener* l) {
+    listeners_.push_back(l);
+  }
+
+  /** Unregisters a listener for change notifications. */
+  void remove_listener(TrainDbListener* l);
+
+  /** Enables a compact snapshot of the parsed train database. On the initial
+   * load the snapshot is used instead of parsing the config file if it was
+   * made from a config file with the same contents, which is checked with a
+   * checksum; otherwise it is rewritten after parsing.
+   * @param path is the filename of the snapshot, or nullptr to disable. The
+   * string must stay alive so long as *this is alive. */
+  void set_snapshot_file(const char* path) {
+    snapshotFile_ = path;
+  }
+
   /** @returns the number of traindb entries. The valid train IDs will then be
    * 0 <= id < size(). */
   size_t size() {
@@ -140,12 +189,12 @@ class TrainDb {
    * found. @param hint is a train_id that might be a match. */
   std::shared_ptr<TrainDbEntry> find_entry(openlcb::NodeID traction_node_id,
                                            unsigned hint = 0) {
-    if (hint <= entries_.size() &&
+    if (hint < entries_.size() && entries_[hint] &&
         entries_[hint]->get_traction_node() == traction_node_id) {
       return entries_[hint];
     }
     for (const auto& e : entries_) {
-      if (e->get_traction_node() == traction_node_id) {
+      if (e && e->get_traction_node() == traction_node_id) {
         return e;
       }
     }
@@ -162,12 +211,51 @@ class TrainDb {
     return s;
   }
 
+  /** Parsed data of an entry of the file-based train database. This is what
+   * the snapshot stores for every entry. */
+  struct SlotState {
+    /// @return true if this slot holds a train.
+    bool is_valid() const {
+      return address != 0 && address != 0xffffu && mode != 0;
+    }
+    /// Hash of the name field.
+    uint32_t name_hash;
+    /// Hash of the function settings.
+    uint32_t fn_hash;
+    uint16_t address;
+    uint8_t mode;
+    /// Largest valid function ID + 1.
+    uint8_t max_fn;
+  };
+
 private:
   /** Creates all entries for the compiled-in train database. */
   void init_const_lokdb();
 
+  /** Decodes an entry of the file-based train database.
+   * @param entry is the raw config data of the entry.
+   * @param s will be filled in. */
+  static void parse_slot(const uint8_t* entry, SlotState* s);
+
+  /** Creates the entries for the valid slots in slotState_. */
+  void create_file_entries(int fd);
+
+  /** Compares a freshly read slot with the stored state. Updates entries_
+   * and notifies the listeners if something changed. */
+  void apply_slot(int fd, unsigned slot, const SlotState& s);
+
   TrainDbConfig cfg_;
   vector<std::shared_ptr<TrainDbEntry> > entries_;
+  /// Filename of the snapshot file, or nullptr if not used.
+  const char* snapshotFile_{nullptr};
+  /// State of each entry of the file-based train database as of the last
+  /// load.
+  vector<SlotState> slotState_;
+  /// For each entry of the file-based train database the train ID it was
+  /// assigned, or -1 if it never held a train.
+  vector<int> slotTrainId_;
+  /// Who to notify about changes.
+  vector<TrainDbListener*> listeners_;
 };
 
 class TrainDbFactoryResetHelper : public DefaultConfigUpdateListener {
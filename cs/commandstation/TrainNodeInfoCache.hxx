@@ -37,6 +37,7 @@
 
 #include <functional>
 #include <algorithm>
+#include <list>
 
 #include "commandstation/FindTrainNode.hxx"
 #include "openlcb/If.hxx"
@@ -56,10 +57,12 @@ class TrainNodeInfoCache : public StateFlowBase {
         node_(node),
         findClient_(find_client),
         output_(output),
+        waitingForSnip_(0),
         enablePartialScroll_(0),
         nodesToShow_(kNodesToShowDefault),
         cacheMaxSize_(kCacheMaxSizeDefault),
-        scrollPrefetchSize_(kScrollPrefetchSizeDefault)
+        scrollPrefetchSize_(kScrollPrefetchSizeDefault),
+        snipWindow_(kSnipWindowDefault)
   {
 
     node_->iface()->dispatcher()->register_handler(&snipResponseHandler_, openlcb::Defs::MTI_IDENT_INFO_REPLY, openlcb::Defs::MTI_EXACT);
@@ -86,8 +89,7 @@ class TrainNodeInfoCache : public StateFlowBase {
     resultsBeforeTarget_ = 0;
     resultsAfterTarget_ = nodesToShow_ - 1;
     uiNotifiable_ = ui_refresh;
-    // @TODO we need to clear stuff here.
-    previousCache_ = std::move(trainNodes_.nodes_);
+    // Node names are kept in nameCache_, so we can throw away the result set.
     trainNodes_.reset();
     
     invoke_search();
@@ -220,6 +222,19 @@ class TrainNodeInfoCache : public StateFlowBase {
     scrollPrefetchSize_ = prefetch;
   }
 
+  /// @param sz is the maximum number of node names to remember across
+  /// searches. Least recently used names are evicted first.
+  void set_name_cache_size(unsigned sz) {
+    nameCache_.set_max_size(sz);
+  }
+
+  /// @param window is the maximum number of SNIP requests that we keep
+  /// outstanding at the same time while looking up names for a page. Must be
+  /// at least 1.
+  void set_snip_window(uint8_t window) {
+    snipWindow_ = window ? window : 1;
+  }
+
   /// @param lines is the number of lines on the screen.
   void set_nodes_to_show(uint16_t lines) {
     nodesToShow_ = lines;
@@ -255,6 +270,87 @@ class TrainNodeInfoCache : public StateFlowBase {
   typedef std::map<openlcb::NodeID, std::shared_ptr<TrainNodeInfo> > NodeCacheMap;
   //typedef std::map<openlcb::NodeID, TrainNodeInfo> NodeCacheMap;
 
+  /// Long-lived storage for the node names, independent of the current
+  /// search. Bounded in size with least-recently-used eviction. Entries are
+  /// shared with the result list, so evicting a name that is currently
+  /// displayed does not invalidate the output pointers.
+  class NameCache {
+   public:
+    NameCache(unsigned max_size) : maxSize_(max_size) {}
+
+    /// Looks up a node, creating an empty entry if it is not known yet. Marks
+    /// the entry as most recently used.
+    /// @param id is the node ID to look up.
+    /// @return the (possibly new) cache entry.
+    std::shared_ptr<TrainNodeInfo> lookup_or_create(openlcb::NodeID id) {
+      auto it = entries_.find(id);
+      if (it != entries_.end()) {
+        touch(&it->second);
+        return it->second.info_;
+      }
+      lru_.push_front(id);
+      Entry& e = entries_[id];
+      e.info_.reset(new TrainNodeInfo);
+      e.lru_ = lru_.begin();
+      auto ret = e.info_;
+      evict();
+      return ret;
+    }
+
+    /// Looks up a node without creating an entry. Marks the entry as most
+    /// recently used.
+    /// @param id is the node ID to look up.
+    /// @return the cache entry or nullptr if the node is not known.
+    std::shared_ptr<TrainNodeInfo> find(openlcb::NodeID id) {
+      auto it = entries_.find(id);
+      if (it == entries_.end()) {
+        return nullptr;
+      }
+      touch(&it->second);
+      return it->second.info_;
+    }
+
+    /// @param sz is the new maximum number of entries to keep.
+    void set_max_size(unsigned sz) {
+      maxSize_ = sz;
+      evict();
+    }
+
+    /// @return the number of entries in the cache.
+    size_t size() const {
+      return entries_.size();
+    }
+
+   private:
+    typedef std::list<openlcb::NodeID> LruList;
+
+    struct Entry {
+      std::shared_ptr<TrainNodeInfo> info_;
+      /// Position in the LRU list.
+      LruList::iterator lru_;
+    };
+
+    /// Moves an entry to the front of the LRU list.
+    void touch(Entry* e) {
+      lru_.splice(lru_.begin(), lru_, e->lru_);
+    }
+
+    /// Drops least recently used entries until we are within the size limit.
+    void evict() {
+      while (entries_.size() > maxSize_ && !lru_.empty()) {
+        entries_.erase(lru_.back());
+        lru_.pop_back();
+      }
+    }
+
+    /// Cached entries.
+    std::map<openlcb::NodeID, Entry> entries_;
+    /// Node IDs in the order of usage. Front is the most recently used.
+    LruList lru_;
+    /// How many entries to keep at most.
+    unsigned maxSize_;
+  };
+
   struct ResultList {
     NodeCacheMap nodes_;
     /// @return the number of results we found in the last search.
@@ -328,6 +424,12 @@ class TrainNodeInfoCache : public StateFlowBase {
   /// How many filled cache entries we should keep ahead and behind before we
   /// redo the search with a different offset.
   static constexpr int kScrollPrefetchSizeDefault = 16;
+  /// How many node names we remember across searches.
+  static constexpr unsigned kNameCacheSizeDefault = 256;
+  /// How many SNIP requests we keep outstanding at the same time.
+  static constexpr unsigned kSnipWindowDefault = 4;
+  /// How long we wait for a SNIP reply before we consider the request lost.
+  static constexpr long long kSnipTimeoutNsec = MSEC_TO_NSEC(500);
 
   void invoke_search() {
     needSearch_ = 1;
@@ -383,15 +485,23 @@ class TrainNodeInfoCache : public StateFlowBase {
   Action iter_results() {
     auto it = trainNodes_.nodes_.lower_bound(lookupIt_);
     while (it != trainNodes_.nodes_.end()) {
-      if (it->second->hasNodeName_) {
+      if (it->second->hasNodeName_ || is_snip_pending(it->first)) {
         // Nothing to look up.
         ++it;
         continue;
-      } else {
-        lookupIt_ = it->first;
-        return allocate_and_call(node_->iface()->addressed_message_write_flow(),
-                                 STATE(send_query));
       }
+      lookupIt_ = it->first;
+      if (pendingSnip_.size() >= snipWindow_) {
+        // Window is full, wait for some reply to come back.
+        return wait_for_snip();
+      }
+      return allocate_and_call(node_->iface()->addressed_message_write_flow(),
+                               STATE(send_query));
+    }
+    lookupIt_ = kMaxNode;
+    if (!pendingSnip_.empty()) {
+      // Collects the stragglers before we refresh the UI.
+      return wait_for_snip();
     }
     return call_immediately(STATE(iter_done));
   }
@@ -401,16 +511,39 @@ class TrainNodeInfoCache : public StateFlowBase {
         get_allocation_result(node_->iface()->addressed_message_write_flow());
     b->data()->reset(openlcb::Defs::MTI_IDENT_INFO_REQUEST, node_->node_id(),
                      openlcb::NodeHandle(lookupIt_), openlcb::EMPTY_PAYLOAD);
-    b->set_done(bn_.reset(this));
     node_->iface()->addressed_message_write_flow()->send(b);
-    return wait_and_call(STATE(send_query_done));
+    // We do not wait for the reply here; up to snipWindow_ requests are in
+    // flight at the same time.
+    pendingSnip_.push_back(lookupIt_);
+    ++lookupIt_;
+    return call_immediately(STATE(iter_results));
   }
 
-  Action send_query_done() {
-    ++lookupIt_;
+  /// Sleeps until a SNIP reply arrives for one of the pending requests or
+  /// the timeout elapses.
+  Action wait_for_snip() {
+    waitingForSnip_ = 1;
+    return sleep_and_call(&timer_, kSnipTimeoutNsec, STATE(snip_wait_done));
+  }
+
+  Action snip_wait_done() {
+    waitingForSnip_ = 0;
+    if (!timer_.is_triggered()) {
+      LOG(INFO, "SNIP lookup timed out for %u nodes.",
+          (unsigned)pendingSnip_.size());
+      // The outstanding requests are considered lost. The nodes still do
+      // not have a name, so they will be retried on the next iteration.
+      pendingSnip_.clear();
+    }
     return call_immediately(STATE(iter_results));
   }
 
+  /// @return true if we have an outstanding SNIP request to a given node.
+  bool is_snip_pending(openlcb::NodeID id) {
+    return std::find(pendingSnip_.begin(), pendingSnip_.end(), id) !=
+           pendingSnip_.end();
+  }
+
   Action iter_done() {
     LOG(INFO, "iter done");
     find_selection_offset(&trainNodes_);
@@ -453,15 +586,8 @@ class TrainNodeInfoCache : public StateFlowBase {
     // We also add everything that's within the requested range.
     add_node |= (node >= minResult_ && node <= maxResult_);
     if (add_node) {
-      auto& node_state = list->nodes_[node];
-      // See if we have stored data
-      auto it = previousCache_.find(node);
-      if (it != previousCache_.end()) {
-        LOG(VERBOSE, "Found cached node name for %012" PRIx64, node);
-        node_state = it->second;
-      } else {
-        node_state.reset(new TrainNodeInfo);
-      }
+      // Shares the stored name if we have seen this node before.
+      list->nodes_[node] = nameCache_.lookup_or_create(node);
       if (node > list->previousMaxNode_) {
         list->resultsClippedAtBottom_--;
       }
@@ -564,37 +690,54 @@ class TrainNodeInfoCache : public StateFlowBase {
       LOG(INFO, "SNIP response coming in without source node ID");
       return;
     }
-    auto it = trainNodes_.nodes_.find(b->data()->src.id);
-    if (it == trainNodes_.nodes_.end()) {
-      LOG(INFO, "SNIP response for unknown node");
-      return;
+    openlcb::NodeID id = b->data()->src.id;
+    auto pit = std::find(pendingSnip_.begin(), pendingSnip_.end(), id);
+    if (pit != pendingSnip_.end()) {
+      pendingSnip_.erase(pit);
+      if (waitingForSnip_) {
+        waitingForSnip_ = 0;
+        timer_.trigger();
+      }
+    }
+    std::shared_ptr<TrainNodeInfo> info;
+    auto it = trainNodes_.nodes_.find(id);
+    if (it != trainNodes_.nodes_.end()) {
+      info = it->second;
+    } else {
+      // Not in the current result set, but we might still have a stale name
+      // cached from an earlier search. Refresh that one.
+      info = nameCache_.find(id);
     }
-    if (it->second->hasNodeName_) {
-      // we already have a name.
+    if (!info) {
+      LOG(INFO, "SNIP response for unknown node");
       return;
     }
     const auto& payload = b->data()->payload;
     openlcb::SnipDecodedData decoded_data;
     openlcb::decode_snip_response(payload, &decoded_data);
-    it->second->hasNodeName_ = 1;
+    string* new_name;
     if (!decoded_data.user_name.empty()) {
-      it->second->name_ = std::move(decoded_data.user_name);
+      new_name = &decoded_data.user_name;
     } else if (!decoded_data.user_description.empty()) {
-      it->second->name_ = std::move(decoded_data.user_description);
+      new_name = &decoded_data.user_description;
     } else if (!decoded_data.model_name.empty()) {
-      it->second->name_ = std::move(decoded_data.model_name);
+      new_name = &decoded_data.model_name;
     } else if (!decoded_data.manufacturer_name.empty()) {
-      it->second->name_ = std::move(decoded_data.manufacturer_name);
+      new_name = &decoded_data.manufacturer_name;
     } else {
-      it->second->hasNodeName_ = 0;
       LOG(VERBOSE, "Could not figure out node name from SNIP response. '%s'",
           payload.c_str());
+      return;
     }
-    if (it->second->hasNodeName_) {
-      if (std::find(output_->entry_names.begin(), output_->entry_names.end(),
-                    &it->second->name_) != output_->entry_names.end()) {
-        notify_ui();
-      }
+    if (info->hasNodeName_ && info->name_ == *new_name) {
+      // Nothing changed.
+      return;
+    }
+    info->hasNodeName_ = 1;
+    info->name_ = std::move(*new_name);
+    if (std::find(output_->entry_names.begin(), output_->entry_names.end(),
+                  &info->name_) != output_->entry_names.end()) {
+      notify_ui();
     }
   }
 
@@ -729,8 +872,8 @@ class TrainNodeInfoCache : public StateFlowBase {
   TrainNodeCacheOutput* output_;
   /// Arguments of the current search.
   BufferPtr<RemoteFindTrainNodeRequest> searchParams_;
-  /// Helper notifiable for sending messages' callback.
-  BarrierNotifiable bn_;
+  /// Helper for waiting for SNIP replies.
+  StateFlowTimer timer_{this};
 
   /// Constrains the results we accept to the cache.
   openlcb::NodeID minResult_;
@@ -751,6 +894,8 @@ class TrainNodeInfoCache : public StateFlowBase {
   uint16_t resultSetChanged_ : 1;
   /// 1 if we are waiting for refilling the cache
   uint16_t pendingSearch_ : 1;
+  /// 1 if the flow is sleeping on timer_ for a SNIP reply.
+  uint16_t waitingForSnip_ : 1;
   /// 1 if we are scrolling down.
   //uint16_t 
   /// 1 if scrolling down should allow leaving a partial screen output. Allows
@@ -768,6 +913,8 @@ class TrainNodeInfoCache : public StateFlowBase {
   uint16_t resultsBeforeTarget_ : 4;
   /// How many results should we render after the target node.
   uint16_t resultsAfterTarget_ : 4;
+  /// How many SNIP requests we keep outstanding at most.
+  uint8_t snipWindow_;
 
   /// A repeatable notifiable that will be called to refresh the UI.
   Notifiable* uiNotifiable_;
@@ -779,9 +926,12 @@ class TrainNodeInfoCache : public StateFlowBase {
 
   /// The currently displayed search results.
   ResultList trainNodes_;
-  /// When we start a new search, we pre-populate the trainNodes_ structure
-  /// from results of the previous search. This reduces network traffic.
-  NodeCacheMap previousCache_;
+  /// Node IDs for which we have sent a SNIP request but not seen the reply
+  /// yet. At most snipWindow_ entries.
+  std::vector<openlcb::NodeID> pendingSnip_;
+  /// Node names that we learned, kept across searches. New searches and
+  /// paginations take the names from here. This reduces network traffic.
+  NameCache nameCache_{kNameCacheSizeDefault};
 };
 }
 
@@ -36,6 +36,7 @@
 
 #include "commandstation/UpdateProcessor.hxx"
 
+#include "commandstation/DccLatencyMonitor.hxx"
 #include "utils/constants.hxx"
 #include "dcc/PacketSource.hxx"
 #include "dcc/PacketFlowInterface.hxx"
@@ -50,9 +51,13 @@ struct PriorityUpdate {
   void reset(dcc::PacketSource* source, unsigned code) {
     this->source = source;
     this->code = code;
+    this->enqueueTime =
+        DccLatencyMonitor::active() ? os_get_time_monotonic() : 0;
   }
   dcc::PacketSource* source;
   unsigned code;
+  /// When the update was requested; 0 if latency monitoring is disabled.
+  long long enqueueTime;
 };
 
 UpdateProcessor::UpdateProcessor(Service* service,
@@ -92,10 +97,12 @@ StateFlowBase::Action UpdateProcessor::entry() {
   }
   long long now = os_get_time_monotonic();
   unsigned code = 0;
+  long long enqueue_time = 0;
   if (b) {
     // found a priority entry.
     s = b->data()->source;
     code = b->data()->code;
+    enqueue_time = b->data()->enqueueTime;
     auto it = packetSourceStates_.find(s);
     if (it == packetSourceStates_.end()) {
       // This packet source has been removed. Do not call it!
@@ -125,6 +132,7 @@ StateFlowBase::Action UpdateProcessor::entry() {
         }
         s = refreshSources_[nextRefreshIndex_++];
         code = 0;
+        enqueue_time = 0;
       }
       if (packetSourceStates_[s].lastPacketTime_ <
           (now - MSEC_TO_NSEC(config_dcc_packet_min_refresh_delay_ms()))) {
@@ -143,6 +151,9 @@ StateFlowBase::Action UpdateProcessor::entry() {
     //bracz_custom::send_host_log_event(bracz_custom::HostLogEvent::TRACK_IDLE);
     message()->data()->set_dcc_idle();
   }
+  if (DccLatencyMonitor* m = DccLatencyMonitor::active()) {
+    m->packet_filled(message(), s ? enqueue_time : 0, now);
+  }
   // We pass on the filled packet to the track processor.
   trackSend_->send(transfer_message());
   return exit();
@@ -1,3 +1,5 @@
 #include "utils/constants.hxx"
 
 DEFAULT_CONST(dcc_packet_min_refresh_delay_ms, 10);
+/// Non-zero to instantiate a DccLatencyMonitor in the command station.
+DEFAULT_CONST(dcc_latency_monitor, 0);
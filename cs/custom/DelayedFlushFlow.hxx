@@ -0,0 +1,138 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file DelayedFlushFlow.hxx
+ *
+ * Flushes a write-behind buffer a given time after its first change.
+ *
+ * @author Balazs Racz
+ * @date 18 Oct 2026
+ */
+
+#ifndef _BRACZ_CUSTOM_DELAYEDFLUSHFLOW_HXX_
+#define _BRACZ_CUSTOM_DELAYEDFLUSHFLOW_HXX_
+
+#include <functional>
+
+#include "executor/StateFlow.hxx"
+
+namespace bracz_custom {
+
+/** Calls a flush function once a delay has elapsed since the first change
+ * that has not been flushed yet. The owner of the buffer calls schedule() for
+ * every change, and cancel() when it flushed the buffer by itself, so that the
+ * next change gets the full delay again.
+ *
+ * Everything except shutdown() must be called on the executor of the
+ * service. The flush function is called there too. */
+class DelayedFlushFlow : public StateFlowBase {
+ public:
+  /// @param service defines the executor to run on.
+  /// @param flush is called when the delay is over.
+  DelayedFlushFlow(Service* service, std::function<void()> flush)
+      : StateFlowBase(service), flush_(std::move(flush)) {}
+
+  /// Sets how long a change may wait for its flush. Applies from the next
+  /// schedule() that starts the delay.
+  void set_delay_nsec(long long nsec) { delayNsec_ = nsec; }
+
+  long long delay_nsec() { return delayNsec_; }
+
+  /// Called when the buffer changed. Starts the delay, unless it is already
+  /// running for an earlier change.
+  void schedule() {
+    if (is_terminated()) {
+      start_flow(STATE(wait_for_delay));
+    } else if (cancelled_) {
+      rescheduled_ = true;
+    }
+  }
+
+  /// Called when the owner flushed the buffer by itself. Stops the running
+  /// delay without calling the flush function.
+  void cancel() {
+    if (is_terminated()) return;
+    cancelled_ = true;
+    rescheduled_ = false;
+    timer_.ensure_triggered();
+  }
+
+  /// Stops the flow without calling the flush function. Blocks until the
+  /// flow has terminated. Must not be called on the executor.
+  void shutdown() {
+    SyncNotifiable n;
+    service()->executor()->sync_run([this, &n]() {
+      if (is_terminated()) {
+        n.notify();
+        return;
+      }
+      shutdownDone_ = &n;
+      cancel();
+    });
+    n.wait_for_notification();
+  }
+
+ private:
+  Action wait_for_delay() {
+    cancelled_ = false;
+    rescheduled_ = false;
+    return sleep_and_call(&timer_, delayNsec_, STATE(delay_done));
+  }
+
+  Action delay_done() {
+    if (shutdownDone_) {
+      // The owner may delete *this as soon as it is notified, so the
+      // notification goes out only after this state has returned.
+      Notifiable* done = shutdownDone_;
+      shutdownDone_ = nullptr;
+      service()->executor()->add(
+          new CallbackExecutable([done]() { done->notify(); }));
+      return exit();
+    }
+    if (cancelled_) {
+      if (rescheduled_) {
+        return call_immediately(STATE(wait_for_delay));
+      }
+      return exit();
+    }
+    flush_();
+    return exit();
+  }
+
+  std::function<void()> flush_;
+  long long delayNsec_{0};
+  /// True if the running delay must not end in a flush.
+  bool cancelled_{false};
+  /// True if there was a change after cancel().
+  bool rescheduled_{false};
+  /// Notified once the flow has terminated in shutdown().
+  Notifiable* shutdownDone_{nullptr};
+  StateFlowTimer timer_{this};
+};
+
+}  // namespace bracz_custom
+
+#endif  // _BRACZ_CUSTOM_DELAYEDFLUSHFLOW_HXX_
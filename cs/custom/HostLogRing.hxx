@@ -0,0 +1,203 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file HostLogRing.hxx
+ *
+ * Lock-free ring buffer collecting host log lines from many threads.
+ *
+ * @author Balazs Racz
+ * @date 18 Oct 2026
+ */
+
+#ifndef _BRACZ_CUSTOM_HOSTLOGRING_HXX_
+#define _BRACZ_CUSTOM_HOSTLOGRING_HXX_
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "utils/macros.h"
+
+namespace bracz_custom {
+
+/** Bounded multi-producer, single-consumer queue of log records of varying
+ * length, such as whole log lines.
+ *
+ * The ring is a byte buffer. Appending reserves room for the entire record
+ * with a compare-exchange on the write cursor, copies it, and then publishes
+ * it by writing its header. A record goes in whole or not at all: when there
+ * is not enough room, it is dropped and counted. So the consumer only ever
+ * sees complete records, and records of concurrent producers never
+ * interleave. Appending never blocks. The consumer zeroes the space it has
+ * taken, so the header of a record that is still being copied reads as
+ * zero. */
+class HostLogRing {
+ public:
+  /// Maximum number of bytes in a record.
+  static constexpr unsigned MAX_RECORD_SIZE = 64;
+
+  /// @param size_bytes capacity of the ring in bytes, including a 4-byte
+  /// header per record and padding to 4 bytes. Must be a power of two and
+  /// large enough for a record of MAX_RECORD_SIZE.
+  HostLogRing(unsigned size_bytes)
+      : mask_(size_bytes - 1), words_(new uint32_t[size_bytes / 4]()) {
+    HASSERT((size_bytes & mask_) == 0 &&
+            size_bytes >= record_size(MAX_RECORD_SIZE));
+  }
+
+  /** Adds a record to the ring. Thread-safe, does not block.
+   * @param data bytes to log
+   * @param len number of bytes, at most MAX_RECORD_SIZE
+   * @returns false if the record got dropped because the ring was full or
+   * the record too long. */
+  bool append(const void* data, unsigned len) {
+    if (!len) return true;
+    uint32_t need = record_size(len);
+    uint32_t pos = head_.load(std::memory_order_relaxed);
+    do {
+      if (len > MAX_RECORD_SIZE ||
+          pos + need - tail_.load(std::memory_order_acquire) > mask_ + 1) {
+        numDropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      // pos is reloaded by a failed exchange.
+    } while (!head_.compare_exchange_weak(pos, pos + need,
+                                          std::memory_order_relaxed));
+    copy_in(pos + HEADER_SIZE, (const uint8_t*)data, len);
+    __atomic_store_n(header(pos), len, __ATOMIC_RELEASE);
+    return true;
+  }
+
+  /** Adds a log line of any length. A line longer than MAX_RECORD_SIZE is
+   * split into several records, which the consumer sees one after the other,
+   * possibly with records of other producers in between. Thread-safe, does
+   * not block.
+   * @returns false if any part of the line got dropped because the ring was
+   * full. */
+  bool append_line(const void* data, unsigned len) {
+    if (len > MAX_RECORD_SIZE) {
+      numSplit_.fetch_add(1, std::memory_order_relaxed);
+    }
+    const uint8_t* p = (const uint8_t*)data;
+    bool ret = true;
+    while (len) {
+      unsigned n = std::min(len, MAX_RECORD_SIZE);
+      ret &= append(p, n);
+      p += n;
+      len -= n;
+    }
+    return ret;
+  }
+
+  /** Moves published records to the end of a buffer. Must be called by one
+   * thread at a time. Stops at the first record that is still being written,
+   * or that would not fit.
+   * @param out records are appended here
+   * @param max_size out will not grow beyond this size
+   * @returns the number of records taken. */
+  unsigned drain(std::string* out, unsigned max_size) {
+    unsigned count = 0;
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    while (true) {
+      uint32_t len = __atomic_load_n(header(tail), __ATOMIC_ACQUIRE);
+      if (!len || out->size() + len > max_size) break;
+      copy_out(tail + HEADER_SIZE, len, out);
+      tail += record_size(len);
+      tail_.store(tail, std::memory_order_release);
+      ++count;
+    }
+    return count;
+  }
+
+  /// @returns true if the consumer has nothing to take right now.
+  bool empty() {
+    return __atomic_load_n(header(tail_.load(std::memory_order_relaxed)),
+                           __ATOMIC_ACQUIRE) == 0;
+  }
+
+  /// @returns the number of records dropped due to the ring being full.
+  unsigned num_dropped() {
+    return numDropped_.load(std::memory_order_relaxed);
+  }
+
+  /// @returns the number of lines append_line had to split.
+  unsigned num_split() { return numSplit_.load(std::memory_order_relaxed); }
+
+ private:
+  static constexpr unsigned HEADER_SIZE = 4;
+
+  /// @returns how many bytes of the ring a record of len bytes takes.
+  static constexpr uint32_t record_size(unsigned len) {
+    return HEADER_SIZE + ((len + 3) & ~3u);
+  }
+
+  /// @returns the header word of the record at pos. Holds the length of the
+  /// record once it is published, zero before.
+  uint32_t* header(uint32_t pos) { return &words_[(pos & mask_) / 4]; }
+
+  uint8_t* bytes() { return (uint8_t*)words_.get(); }
+
+  /// Copies data into the ring at pos, wrapping around the end.
+  void copy_in(uint32_t pos, const uint8_t* data, unsigned len) {
+    unsigned ofs = pos & mask_;
+    unsigned first = std::min(len, mask_ + 1 - ofs);
+    memcpy(bytes() + ofs, data, first);
+    memcpy(bytes(), data + first, len - first);
+  }
+
+  /// Appends len bytes from pos in the ring to out, then zeroes the whole
+  /// record, header first.
+  void copy_out(uint32_t pos, unsigned len, std::string* out) {
+    unsigned ofs = pos & mask_;
+    unsigned first = std::min(len, mask_ + 1 - ofs);
+    out->append((const char*)bytes() + ofs, first);
+    out->append((const char*)bytes(), len - first);
+    *header(pos - HEADER_SIZE) = 0;
+    unsigned padded = record_size(len) - HEADER_SIZE;
+    first = std::min(padded, mask_ + 1 - ofs);
+    memset(bytes() + ofs, 0, first);
+    memset(bytes(), 0, padded - first);
+  }
+
+  /// Size of the ring - 1.
+  uint32_t mask_;
+  std::unique_ptr<uint32_t[]> words_;
+  /// Next position to write.
+  std::atomic<uint32_t> head_{0};
+  /// Next position to read. Only written by the consumer.
+  std::atomic<uint32_t> tail_{0};
+  std::atomic<unsigned> numDropped_{0};
+  std::atomic<unsigned> numSplit_{0};
+
+  DISALLOW_COPY_AND_ASSIGN(HostLogRing);
+};
+
+}  // namespace bracz_custom
+
+#endif  // _BRACZ_CUSTOM_HOSTLOGRING_HXX_
@@ -37,10 +37,13 @@
 #include "custom/HostPacketCanPort.hxx"
 #include "src/usb_proto.h"
 #include "custom/MCPCanFrameFormat.hxx"
+#include "utils/constants.hxx"
 
+DECLARE_CONST(host_bridge_latency_usec);
 
 using openlcb::Defs;
 using openlcb::DatagramClient;
+using openlcb::DatagramDefs;
 
 namespace bracz_custom {
 
@@ -59,13 +62,44 @@ StateFlowBase::Action HostClient::HostClientHandler::entry() {
     return respond_reject(Defs::ERROR_INVALID_ARGS_MESSAGE_TOO_SHORT);
   }
   response_payload_.clear();
-  uint8_t cmd = payload()[1];
+  cmdOfs_ = 1;
+  if (payload()[1] == CMD_SEQ) {
+    if (size() < 4) {
+      return respond_reject(Defs::ERROR_INVALID_ARGS_MESSAGE_TOO_SHORT);
+    }
+    int8_t ahead = (int8_t)(payload()[2] - expectedSeq_);
+    if (!seqSynced_ || ahead > HostProtocolDefs::MAX_SEQ_WINDOW ||
+        (ahead < 0 && (unsigned)-ahead > numExecuted_)) {
+      // We cannot place this sequence number, for example because we were
+      // reset since the host's last sync. The host has to sync again.
+      return respond_reject(HostProtocolDefs::ERROR_SEQUENCE);
+    }
+    if (ahead < 0) {
+      // We have executed this one already, but the host did not see the
+      // acknowledgement. The reply, if any, may have been lost too.
+      const string& reply = seq_reply(payload()[2]);
+      if (reply.empty()) {
+        return respond_ok(0);
+      }
+      response_payload_ = reply;
+      return respond_ok(DatagramClient::REPLY_PENDING);
+    }
+    if (ahead > 0) {
+      // A predecessor got lost. The host will send this again after it.
+      return respond_reject(Defs::ERROR_OUT_OF_ORDER);
+    }
+    // The sequence number is used up only once the command turned out to be
+    // valid; see seq_executed().
+    cmdOfs_ = 3;
+  }
+  uint8_t cmd = payload()[cmdOfs_];
   switch (cmd) {
     case CMD_PING: {
       response_payload_.reserve(3);
       response_payload_.push_back(HostProtocolDefs::SERVER_DATAGRAM_ID);
       response_payload_.push_back(CMD_PONG);
-      response_payload_.push_back(payload()[2] + 1);
+      response_payload_.push_back(payload()[cmdOfs_ + 1] + 1);
+      seq_executed();
       return respond_ok(DatagramClient::REPLY_PENDING);
     }
     case CMD_SYNC: {
@@ -75,28 +109,65 @@ StateFlowBase::Action HostClient::HostClientHandler::entry() {
       if (n) {
         n->notify();
       }
-      return respond_ok(0);
-      break;
+      // Hosts that decode aggregated CAN frames say so in an extra byte.
+      parent_->bridge()->set_host_packed(
+          size() > cmdOfs_ + 1 &&
+          (payload()[cmdOfs_ + 1] & HostProtocolDefs::HOST_CAP_PACKED));
+      if (cmdOfs_ != 1) {
+        seq_executed();
+        return respond_ok(0);
+      }
+      // A plain sync restarts the sequence. Tells the host that we
+      // understand CMD_SEQ.
+      expectedSeq_ = 0;
+      numExecuted_ = 0;
+      seqSynced_ = true;
+      response_payload_.reserve(3);
+      response_payload_.push_back(HostProtocolDefs::SERVER_DATAGRAM_ID);
+      response_payload_.push_back(CMD_CAPS);
+      response_payload_.push_back(HostProtocolDefs::CAP_SEQ);
+      return respond_ok(DatagramClient::REPLY_PENDING);
     }
     case CMD_CAN_PKT: {
-      return allocate_and_call(parent_->can_hub1(), STATE(translate_inbound_can));
-      /*handle_can_packet_from_host(payload() + 2, size() - 2);
-        return respond_ok(0);*/
-      break;
+      // The payload may carry any number of concatenated frames.
+      unsigned ofs = cmdOfs_ + 1;
+      if (size() < ofs + HostProtocolDefs::MCP_HEADER_LEN ||
+          !HostProtocolDefs::valid_mcp_frames(payload() + ofs, size() - ofs)) {
+        return respond_reject(Defs::ERROR_INVALID_ARGS);
+      }
+      seq_executed();
+      canOffset_ = ofs;
+      return call_immediately(STATE(translate_inbound_can));
     }
   }  // switch
   return respond_reject(Defs::ERROR_UNIMPLEMENTED_SUBCMD);
 }
 
+void HostClient::HostClientHandler::seq_executed() {
+  if (cmdOfs_ == 1) return;
+  seq_reply(expectedSeq_) = response_payload_;
+  ++expectedSeq_;
+  if (numExecuted_ < HostProtocolDefs::MAX_SEQ_WINDOW) {
+    ++numExecuted_;
+  }
+}
+
 StateFlowBase::Action HostClient::HostClientHandler::translate_inbound_can() {
+  if (canOffset_ >= size()) {
+    return respond_ok(0);
+  }
+  return allocate_and_call(parent_->can_hub1(), STATE(inbound_can_buf_ready));
+}
+
+StateFlowBase::Action HostClient::HostClientHandler::inbound_can_buf_ready() {
   auto* b = get_allocation_result(parent_->can_hub1());
   struct can_frame* f = b->data()->mutable_frame();
   memset(f, 0, sizeof(*f));
   b->data()->skipMember_ = HostClient::instance()->can1_bridge_port();
-  //message()->data()->payload[0] = size();
-  mcp_to_frame(payload() + 2, f);
+  mcp_to_frame(payload() + canOffset_, f);
+  canOffset_ += HostProtocolDefs::mcp_frame_len(payload() + canOffset_);
   parent_->can_hub1()->send(b);
-  return respond_ok(0);
+  return call_immediately(STATE(translate_inbound_can));
 }
 
 StateFlowBase::Action HostClient::HostClientHandler::ok_response_sent() {
@@ -132,8 +203,22 @@ StateFlowBase::Action HostClient::HostClientHandler::response_send_complete() {
   return exit();
 }
 
-StateFlowBase::Action HostClient::HostPacketBridge::format_send() {
-  auto* b = get_allocation_result(parent()->send_client());
+HostClient::HostPacketBridge::HostPacketBridge(HostClient* parent)
+    : CanHubPort(parent),
+      flushFlow_(new DelayedFlushFlow(parent, [this]() { flush(); })) {
+  flushFlow_->set_delay_nsec(USEC_TO_NSEC(config_host_bridge_latency_usec()));
+  device()->register_port(this);
+}
+
+HostClient::HostPacketBridge::~HostPacketBridge() {
+  device()->unregister_port(this);
+  flushFlow_->shutdown();
+  if (pending_) {
+    pending_->unref();
+  }
+}
+
+StateFlowBase::Action HostClient::HostPacketBridge::entry() {
   const struct can_frame& f = message()->data()->frame();
   uint32_t id_masked_eff = GET_CAN_FRAME_ID_EFF(f) & ~1;
   if (!IS_CAN_FRAME_EFF(f) || id_masked_eff == 0x0c000380 ||
@@ -141,29 +226,82 @@ StateFlowBase::Action HostClient::HostPacketBridge::format_send() {
     // Rudimentary filter to remove noise from keepalive and dcc packets.
     return release_and_exit();
   }
+  unsigned len = HostProtocolDefs::MCP_HEADER_LEN + f.can_dlc;
+  if (pending_ && pending_->data()->size() + len > DatagramDefs::MAX_SIZE) {
+    flush();
+    // The next frame starts a new datagram with a latency budget of its own.
+    flushFlow_->cancel();
+  }
+  if (!pending_) {
+    return allocate_and_call(parent()->send_client(), STATE(pending_ready));
+  }
+  return call_immediately(STATE(append_frame));
+}
 
-  b->data()->resize(f.can_dlc + 5 + 2);
-  frame_to_mcp(f, (uint8_t*) &b->data()->data()[2]);
-  b->data()->at(0) = HostProtocolDefs::SERVER_DATAGRAM_ID;
-  b->data()->at(1) = CMD_CAN_PKT;
-  parent()->send_client()->send(b);
+StateFlowBase::Action HostClient::HostPacketBridge::pending_ready() {
+  pending_ = get_allocation_result(parent()->send_client());
+  pending_->data()->reserve(DatagramDefs::MAX_SIZE);
+  pending_->data()->push_back(HostProtocolDefs::SERVER_DATAGRAM_ID);
+  pending_->data()->push_back(CMD_CAN_PKT);
+  if (aggregating()) {
+    flushFlow_->schedule();
+  }
+  return call_immediately(STATE(append_frame));
+}
+
+StateFlowBase::Action HostClient::HostPacketBridge::append_frame() {
+  const struct can_frame& f = message()->data()->frame();
+  string* d = pending_->data();
+  size_t ofs = d->size();
+  d->resize(ofs + HostProtocolDefs::MCP_HEADER_LEN + f.can_dlc);
+  frame_to_mcp(f, (uint8_t*)&(*d)[ofs]);
+  if (!aggregating() ||
+      d->size() + HostProtocolDefs::MCP_MAX_LEN > DatagramDefs::MAX_SIZE) {
+    // No time budget, or the next frame might not fit.
+    flush();
+    flushFlow_->cancel();
+  }
   return release_and_exit();
 }
 
+void HostClient::HostPacketBridge::set_host_packed(bool packed) {
+  hostPacked_ = packed;
+  if (!packed) {
+    // What is pending already goes out as it is; the next frames go out one
+    // by one.
+    flush();
+    flushFlow_->cancel();
+  }
+}
+
+void HostClient::HostPacketBridge::flush() {
+  if (!pending_) return;
+  auto* b = pending_;
+  pending_ = nullptr;
+  parent()->send_client()->send(b);
+}
+
 HostClient::HostClientSend::HostClientSend(HostClient* parent) : HubPort(parent) {} 
 HostClient::HostClientSend::~HostClientSend() {}
 
 void HostClient::log_output(char* buf, int size) {
-  while (size > 0) {
-    int actual_size = std::min(70, size);
-    auto* b = send_client()->alloc();
-    b->data()->reserve(actual_size + 2);
+  if (size <= 0) return;
+  logRing_.append_line(buf, size);
+  wake_log_drain();
+}
+
+void HostClient::LogDrain::run() {
+  // Cleared before looking at the ring, so a record appended after this
+  // point schedules another run.
+  parent_->drainPending_.store(false);
+  HubPort* sender = parent_->send_client();
+  while (!parent_->logRing_.empty()) {
+    auto* b = sender->alloc();
+    b->data()->reserve(DatagramDefs::MAX_SIZE);
     b->data()->push_back(HostProtocolDefs::SERVER_DATAGRAM_ID);
     b->data()->push_back(CMD_VCOM1);
-    b->data()->append(buf, actual_size);
-    send_client()->send(b);
-    buf += actual_size;
-    size -= actual_size;
+    parent_->logRing_.drain(b->data(), DatagramDefs::MAX_SIZE);
+    sender->send(b);
   }
 }
 
@@ -35,10 +35,18 @@
 #ifndef _BRACZ_CUSTOM_HOSTPROTOCOL_HXX_
 #define _BRACZ_CUSTOM_HOSTPROTOCOL_HXX_
 
+#include <atomic>
+#include <memory>
+
 #include "openlcb/DatagramHandlerDefault.hxx"
 #include "utils/Hub.hxx"
 #include "utils/Singleton.hxx"
+#include "utils/constants.hxx"
+#include "custom/DelayedFlushFlow.hxx"
 #include "custom/HostLogging.hxx"
+#include "custom/HostLogRing.hxx"
+
+DECLARE_CONST(host_log_ring_bytes);
 
 namespace bracz_custom {
 
@@ -47,6 +55,47 @@ struct HostProtocolDefs {
     CLIENT_DATAGRAM_ID = 0xF1,
     SERVER_DATAGRAM_ID = 0xF2,
   };
+  enum {
+    /// Bytes of an MCP frame before the data bytes.
+    MCP_HEADER_LEN = 5,
+    /// Offset of the data length byte in an MCP frame.
+    MCP_LEN_OFS = 4,
+    /// Size of the largest MCP frame.
+    MCP_MAX_LEN = MCP_HEADER_LEN + 8,
+  };
+  enum {
+    /// Most CMD_SEQ datagrams the host has in flight at a time.
+    MAX_SEQ_WINDOW = 16,
+    /// Reject code for a CMD_SEQ datagram whose sequence number the client
+    /// cannot place. The host restarts the sequence with a plain CMD_SYNC.
+    ERROR_SEQUENCE = openlcb::Defs::ERROR_PERMANENT | 0xF1,
+    /// Bit of the CMD_CAPS byte: the client understands CMD_SEQ.
+    CAP_SEQ = 1,
+    /// Bit of the capability byte the host may append to a CMD_SYNC: the
+    /// host decodes CMD_CAN_PKT datagrams with several frames.
+    HOST_CAP_PACKED = 1,
+  };
+
+  /** A CMD_CAN_PKT payload may carry several MCP frames back to back. Checks
+   * that a buffer is a concatenation of complete MCP frames.
+   * @param data first byte of the first frame
+   * @param len total number of bytes
+   * @returns true if the frames are well-formed and fill the buffer exactly. */
+  static bool valid_mcp_frames(const uint8_t* data, unsigned len) {
+    unsigned ofs = 0;
+    while (ofs < len) {
+      if (len - ofs < MCP_HEADER_LEN || data[ofs + MCP_LEN_OFS] > 8) {
+        return false;
+      }
+      ofs += MCP_HEADER_LEN + data[ofs + MCP_LEN_OFS];
+    }
+    return ofs == len;
+  }
+
+  /// @returns the number of bytes in the MCP frame starting at data.
+  static unsigned mcp_frame_len(const uint8_t* data) {
+    return MCP_HEADER_LEN + data[MCP_LEN_OFS];
+  }
 };
 
 class HostClientSend;
@@ -65,19 +114,35 @@ class HostClient : public Service, public Singleton<HostClient> {
         can_hub1_(can_hub1),
         client_handler_(this),
         bridge_port_(this),
-        sender_(this) {}
+        sender_(this),
+        logRing_(config_host_log_ring_bytes()),
+        logDrain_(this) {}
   ~HostClient();
 
   openlcb::DatagramService* dg_service() { return dg_service_; }
   openlcb::Node* node() { return node_; }
   CanHubFlow* can_hub1() { return can_hub1_; }
 
-  // These functions can be called from any thread.
-  void send_host_log_event(HostLogEvent e) { log_output((char*)&e, 1); }
+  // These functions can be called from any thread. They append to a ring
+  // buffer and return without blocking; the log is sent to the host in the
+  // background, packed into as few datagrams as possible. Every call is one
+  // record, which is either logged whole or dropped; only log lines longer
+  // than HostLogRing::MAX_RECORD_SIZE take several records.
+  void send_host_log_event(HostLogEvent e) {
+    uint8_t c = static_cast<uint8_t>(e);
+    logRing_.append(&c, 1);
+    wake_log_drain();
+  }
   void log_output(char* buf, int size);
 
+  /// @returns the number of log records lost because the ring was full.
+  unsigned num_log_dropped() { return logRing_.num_dropped(); }
+  /// @returns the number of log lines that were sent in several pieces.
+  unsigned num_log_split() { return logRing_.num_split(); }
+
   HubPort* send_client() { return &sender_; }
   CanHubPortInterface* can1_bridge_port() { return &bridge_port_; }
+  HostPacketBridge* bridge() { return &bridge_port_; }
 
   /** A datagram handler that allows transmitting the host protocol packets over
       OpenLCB bus with datagrams. */
@@ -99,35 +164,88 @@ class HostClient : public Service, public Singleton<HostClient> {
     Action ok_response_sent() override;
 
     Action translate_inbound_can();
+    Action inbound_can_buf_ready();
 
     Action dg_client_ready();
     Action response_buf_ready();
     Action response_send_complete();
 
    private:
+    /// Called when a valid command was accepted. For a CMD_SEQ datagram,
+    /// uses up the sequence number and remembers the reply in
+    /// response_payload_ in case the host repeats the datagram.
+    void seq_executed();
+
+    /// @returns the reply remembered for a sequence number; empty if the
+    /// command had no reply.
+    string& seq_reply(uint8_t seq) {
+      return seqReplies_[seq % HostProtocolDefs::MAX_SEQ_WINDOW];
+    }
+
     HostClient* parent_;
     openlcb::DatagramClient* dg_client_{nullptr};
     openlcb::DatagramPayload response_payload_;
     BarrierNotifiable n_;
+    /// Offset in the payload of the next inbound CAN frame to translate.
+    unsigned canOffset_;
+    /// Offset in the payload of the command byte: 1, or 3 after a CMD_SEQ
+    /// header.
+    unsigned cmdOfs_;
+    /// Sequence number of the next CMD_SEQ datagram to execute.
+    uint8_t expectedSeq_{0};
+    /// CMD_SEQ datagrams executed since the last plain CMD_SYNC, up to
+    /// MAX_SEQ_WINDOW. Only these can be acknowledged as repeats.
+    uint8_t numExecuted_{0};
+    /// True once a plain CMD_SYNC has arrived.
+    bool seqSynced_{false};
+    /// Replies to the last MAX_SEQ_WINDOW CMD_SEQ datagrams, indexed by the
+    /// sequence number modulo MAX_SEQ_WINDOW. MAX_SEQ_WINDOW divides 256, so
+    /// the index stays right when the sequence number wraps.
+    string seqReplies_[HostProtocolDefs::MAX_SEQ_WINDOW];
   };
 
+  /** Forwards the frames seen on the CAN hub to the host. Consecutive frames
+   * are aggregated into one datagram, which is sent when it cannot take any
+   * more frames, or when the latency budget has elapsed since the first frame
+   * was added. Frames are aggregated only if the host announced
+   * HOST_CAP_PACKED in its last CMD_SYNC; older hosts decode only the first
+   * frame of a datagram. */
   class HostPacketBridge : public CanHubPort {
   public:
-    HostPacketBridge(HostClient* parent) : CanHubPort(parent) {
-      device()->register_port(this);
-    }
+    HostPacketBridge(HostClient* parent);
 
-    ~HostPacketBridge() { device()->unregister_port(this); }
+    ~HostPacketBridge();
 
     HostClient* parent() { return static_cast<HostClient*>(service()); }
 
     CanHubFlow* device() { return parent()->can_hub1(); }
 
-    Action entry() OVERRIDE {
-      return allocate_and_call(parent()->send_client(), STATE(format_send));
-    };
+    /** Sets how long a frame may wait for further frames to share its
+     * datagram. Zero sends every frame in a datagram of its own. */
+    void set_latency_nsec(long long nsec) { flushFlow_->set_delay_nsec(nsec); }
+
+    /** Called for every CMD_SYNC from the host with whether the host can
+     * decode aggregated frames. Must be called on the executor. */
+    void set_host_packed(bool packed);
 
-    Action format_send();
+    Action entry() OVERRIDE;
+
+   private:
+    /// @returns true if frames may wait for further frames.
+    bool aggregating() { return hostPacked_ && flushFlow_->delay_nsec() > 0; }
+
+    Action pending_ready();
+    Action append_frame();
+
+    /// Sends the pending datagram to the host, if there is any. Must be
+    /// called on the executor.
+    void flush();
+
+    /// Datagram being filled, or nullptr.
+    Buffer<HubData>* pending_{nullptr};
+    std::unique_ptr<DelayedFlushFlow> flushFlow_;
+    /// True if the host announced HOST_CAP_PACKED.
+    bool hostPacked_{false};
   };  // class hostpacketcanbridge
 
   class HostClientSend : public Singleton<HostClientSend>, public HubPort {
@@ -149,14 +267,36 @@ class HostClient : public Service, public Singleton<HostClient> {
     BarrierNotifiable n_;
   };  // class hostclientsend
 
+  /** Moves the contents of the log ring into datagrams for the host. Runs on
+   * the executor of the host client. */
+  class LogDrain : public Executable {
+   public:
+    LogDrain(HostClient* parent) : parent_(parent) {}
+
+    void run() override;
+
+   private:
+    HostClient* parent_;
+  };
+
  private:
+  /// Schedules the log drain unless it is already scheduled.
+  void wake_log_drain() {
+    if (!drainPending_.exchange(true)) {
+      executor()->add(&logDrain_);
+    }
+  }
+
   openlcb::DatagramService* dg_service_;
   openlcb::Node* node_;
   CanHubFlow* can_hub1_;
   HostClientHandler client_handler_;
   HostPacketBridge bridge_port_;
   HostClientSend sender_;
-
+  HostLogRing logRing_;
+  /// True while logDrain_ is on the executor queue and has not yet started.
+  std::atomic<bool> drainPending_{false};
+  LogDrain logDrain_;
 };  // HostClient
 
 }  // namespce bracz_custom
@@ -35,11 +35,72 @@
  */
 
 #include "custom/MemorizingEventHandler.hxx"
+
+#include <unistd.h>
+#include <algorithm>
+
 #include "openlcb/WriteHelper.hxx"
 #include "openlcb/EventHandlerTemplates.hxx"
 
 namespace openlcb {
 
+/// Sends out the event reports for all known blocks in a range of blocks, one
+/// message at a time. Used for answering range identified messages, which may
+/// cover thousands of blocks.
+class MemorizingHandlerManager::RangeReportFlow : public StateFlowBase {
+ public:
+  RangeReportFlow(MemorizingHandlerManager* parent)
+      : StateFlowBase(parent->node()->iface()), parent_(parent) {}
+
+  /// Starts reporting the blocks [first_block, end_block).
+  /// @param done will be notified when all messages are sent.
+  void start(unsigned first_block, unsigned end_block,
+             BarrierNotifiable* done) {
+    HASSERT(is_terminated());
+    nextBlock_ = first_block;
+    endBlock_ = end_block;
+    done_ = done;
+    start_flow(STATE(find_next));
+  }
+
+ private:
+  Action find_next() {
+    const auto& state = parent_->blockState_;
+    while (nextBlock_ < endBlock_ && !state[nextBlock_]) {
+      ++nextBlock_;
+    }
+    if (nextBlock_ >= endBlock_) {
+      done_->notify();
+      done_ = nullptr;
+      return exit();
+    }
+    return allocate_and_call(
+        parent_->node()->iface()->global_message_write_flow(),
+        STATE(send_report));
+  }
+
+  Action send_report() {
+    auto* b = get_allocation_result(
+        parent_->node()->iface()->global_message_write_flow());
+    uint64_t eventid = parent_->event_base_ +
+                       nextBlock_ * parent_->block_size_ +
+                       parent_->blockState_[nextBlock_] - 1;
+    b->data()->reset(Defs::MTI_EVENT_REPORT, parent_->node()->node_id(),
+                     eventid_to_buffer(eventid));
+    parent_->node()->iface()->global_message_write_flow()->send(b);
+    ++nextBlock_;
+    return yield_and_call(STATE(find_next));
+  }
+
+  MemorizingHandlerManager* parent_;
+  /// Next block to look at.
+  unsigned nextBlock_;
+  /// One past the last block to report.
+  unsigned endBlock_;
+  /// Notified when we are done.
+  BarrierNotifiable* done_{nullptr};
+};
+
 MemorizingHandlerManager::MemorizingHandlerManager(Node* node,
                                                    uint64_t event_base,
                                                    unsigned num_total_events,
@@ -47,7 +108,11 @@ MemorizingHandlerManager::MemorizingHandlerManager(Node* node,
     : node_(node),
       event_base_(event_base),
       num_total_events_(num_total_events),
-      block_size_(block_size) {
+      block_size_(block_size),
+      blockState_(num_total_events / block_size, 0),
+      rangeFlow_(new RangeReportFlow(this)),
+      flushFlow_(new bracz_custom::DelayedFlushFlow(
+          node->iface(), [this]() { write_dirty(); })) {
   unsigned mask = EventRegistry::align_mask(&event_base, num_total_events);
   EventRegistry::instance()->register_handler(
       EventRegistryEntry(this, event_base), mask);
@@ -56,6 +121,59 @@ MemorizingHandlerManager::MemorizingHandlerManager(Node* node,
 
 MemorizingHandlerManager::~MemorizingHandlerManager() {
   EventRegistry::instance()->unregister_handler(this);
+  flushFlow_->shutdown();
+  flush();
+}
+
+void MemorizingHandlerManager::set_backing_file(int fd, unsigned file_offset,
+                                                long long flush_delay_nsec) {
+  fd_ = fd;
+  file_offset_ = file_offset;
+  flushFlow_->set_delay_nsec(flush_delay_nsec);
+  dirtyBegin_ = dirtyEnd_ = 0;
+  // Reads the entire state with one call. Whatever is beyond the end of the
+  // file is unknown state.
+  fileShadow_.assign(file_size(), 0);
+  size_t done = 0;
+  while (done < fileShadow_.size()) {
+    ssize_t ret = ::pread(fd_, fileShadow_.data() + done,
+                          fileShadow_.size() - done, file_offset_ + done);
+    ERRNOCHECK("pread", ret);
+    if (ret == 0) break;
+    done += ret;
+  }
+  for (unsigned block_num = 0; block_num < blockState_.size(); ++block_num) {
+    uint64_t eventid = GetBlockFromFile(block_num);
+    if (eventid) {
+      blockState_[block_num] = eventid - event_base_ -
+                               block_num * block_size_ + 1;
+    }
+  }
+}
+
+unsigned MemorizingHandlerManager::file_size() {
+  BlockOffsetInfo info;
+  GetBlockFileOffset(0, &info);
+  return (blockState_.size() * info.bits_used + 7) >> 3;
+}
+
+void MemorizingHandlerManager::flush() {
+  node_->iface()->executor()->sync_run([this]() {
+    write_dirty();
+    flushFlow_->cancel();
+  });
+}
+
+void MemorizingHandlerManager::write_dirty() {
+  if (fd_ < 0 || dirtyBegin_ >= dirtyEnd_) return;
+  size_t done = dirtyBegin_;
+  while (done < dirtyEnd_) {
+    ssize_t ret = ::pwrite(fd_, fileShadow_.data() + done, dirtyEnd_ - done,
+                           file_offset_ + done);
+    ERRNOCHECK("pwrite", ret);
+    done += ret;
+  }
+  dirtyBegin_ = dirtyEnd_ = 0;
 }
 
 void MemorizingHandlerManager::handle_event_report(
@@ -69,17 +187,19 @@ void MemorizingHandlerManager::handle_event_report(
 void MemorizingHandlerManager::handle_consumer_identified(
     const EventRegistryEntry& registry_entry, EventReport* event,
     BarrierNotifiable* done) {
-  AutoNotify n(done);
-  if (!is_mine(event->event) || event->state != EventState::VALID) return;
-  UpdateValidEvent(event->event);
+  if (is_mine(event->event) && event->state == EventState::VALID) {
+    UpdateValidEvent(event->event);
+  }
+  ReportSingle(event, done);
 }
 
 void MemorizingHandlerManager::handle_producer_identified(
     const EventRegistryEntry& registry_entry, EventReport* event,
     BarrierNotifiable* done) {
-  AutoNotify n(done);
-  if (!is_mine(event->event) || event->state != EventState::VALID) return;
-  UpdateValidEvent(event->event);
+  if (is_mine(event->event) && event->state == EventState::VALID) {
+    UpdateValidEvent(event->event);
+  }
+  ReportSingle(event, done);
 }
 
 void MemorizingHandlerManager::handle_identify_global(
@@ -96,20 +216,64 @@ void MemorizingHandlerManager::handle_identify_global(
 }
 
 void MemorizingHandlerManager::UpdateValidEvent(uint64_t eventid) {
-  unsigned block_num = (eventid - event_base_) / block_size_;
-  unsigned block_base = block_num * block_size_;
+  unsigned offset = eventid - event_base_;
+  unsigned block_num = offset / block_size_;
   // We don't need locking anywhere here because this will be run on the
   // executor that is responsible for event handling.
-  auto& p = blocks_[block_base];
-  if (!p) {
-    p.reset(new MemorizingHandlerBlock(this, event_base_ + block_base));
+  uint32_t state = offset - block_num * block_size_ + 1;
+  if (blockState_[block_num] == state) return;
+  blockState_[block_num] = state;
+  if (fd_ >= 0) {
+    SaveValidEventToFile(eventid);
+  }
+}
+
+void MemorizingHandlerManager::ReportSingle(EventReport* event,
+                                            BarrierNotifiable* done) {
+  AutoNotify n(done);
+  uint64_t current = current_event(event->event);
+  if (!current) return;
+  event->event_write_helper<1>()->WriteAsync(
+      node_, Defs::MTI_EVENT_REPORT, WriteHelper::global(),
+      eventid_to_buffer(current), done->new_child());
+}
+
+void MemorizingHandlerManager::ReportAndIdentify(EventReport* event,
+                                                 Defs::MTI mti,
+                                                 BarrierNotifiable* done) {
+  AutoNotify n(done);
+  auto eventid = event->event;
+  uint64_t current = current_event(eventid);
+  if (!current) return;
+  if (eventid != current) {
+    mti++;
   }
-  p->set_current_event(eventid);
+  event->event_write_helper<2>()->WriteAsync(
+      node_, mti, WriteHelper::global(), eventid_to_buffer(eventid),
+      done->new_child());
+  // The event report will happen by us listening to our own identified call.
+}
+
+void MemorizingHandlerManager::ReportRange(EventReport* event,
+                                           BarrierNotifiable* done) {
+  AutoNotify n(done);
+  // We don't respond to range queries from ourselves; this should prevent us
+  // from generating event reports on the global identify message.
+  if (event->src_node.id == node_->node_id()) return;
+  uint64_t first = event->event;
+  uint64_t last = event->event | event->mask;
+  uint64_t end = event_base_ + num_total_events_;
+  if (last < event_base_ || first >= end) return;
+  unsigned first_block =
+      first <= event_base_ ? 0 : (first - event_base_) / block_size_;
+  unsigned end_block = last >= end ? blockState_.size()
+                                   : (last - event_base_) / block_size_ + 1;
+  rangeFlow_->start(first_block, end_block, done->new_child());
 }
 
 struct MemorizingHandlerManager::BlockOffsetInfo {
-  // offset in the file
-  off_t file_offset;
+  // offset in the file shadow (relative to file_offset_)
+  unsigned file_offset;
   // how many bytes from that offset need to be read. Must be between 1 and
   // 64. The bytes are stored in host-endian byte order.
   uint8_t read_bytes;
@@ -132,56 +296,24 @@ void MemorizingHandlerManager::GetBlockFileOffset(unsigned block_num,
   }
   info->bits_used = bits_used;
   unsigned bit_offset = block_num * bits_used;
-  info->file_offset = file_offset_ + (bit_offset >> 3);
+  info->file_offset = bit_offset >> 3;
   info->shift_count = bit_offset & 7;
   info->read_bytes = (info->shift_count + bits_used + 7) >> 3;
   HASSERT(info->read_bytes <= 8);
 }
 
-size_t read_repeated(int fd, void* d, size_t bytes) {
-  uint8_t* data = (uint8_t*)d;
-  size_t rd = 0;
-  while (bytes) {
-    ssize_t ret = ::read(fd, data, bytes);
-    ERRNOCHECK("read", ret);
-    if (ret == 0) {
-      memset(data, 0, bytes);
-      return rd;
-    }
-    data += ret;
-    rd += ret;
-    bytes -= ret;
-  }
-  return rd;
-}
-
-void write_repeated(int fd, const void* d, size_t bytes) {
-  const uint8_t* data = (uint8_t*)d;
-  size_t rd = 0;
-  while (bytes) {
-    ssize_t ret = ::write(fd, data, bytes);
-    ERRNOCHECK("write", ret);
-    data += ret;
-    rd += ret;
-    bytes -= ret;
-  }
-}
-
 uint64_t MemorizingHandlerManager::GetBlockFromFile(unsigned block_num) {
   BlockOffsetInfo info;
   GetBlockFileOffset(block_num, &info);
-  off_t offset = lseek(fd_, info.file_offset, SEEK_SET);
-  if (offset < info.file_offset) {
-    // file does not have data about this
-    return 0;
-  }
   uint64_t data = 0;
-  read_repeated(fd_, &data, info.read_bytes);
+  memcpy(&data, fileShadow_.data() + info.file_offset, info.read_bytes);
   data >>= info.shift_count;
   data &= (1ULL << info.bits_used) - 1;
   // special marker of zeroes: state unknown
   if (!data) return 0;
   --data;
+  // garbage in the file
+  if (data >= block_size_) return 0;
   uint64_t event_id = event_base_ + block_num * block_size_ + data;
   return event_id;
 }
@@ -193,83 +325,30 @@ void MemorizingHandlerManager::SaveValidEventToFile(uint64_t eventid) {
 
   BlockOffsetInfo info;
   GetBlockFileOffset(block_num, &info);
-  off_t offset = lseek(fd_, info.file_offset, SEEK_SET);
-  ERRNOCHECK("lseek", offset);
-  HASSERT(offset == info.file_offset);
 
   ++block_value;  // zero is reserved for "unknown" so we shift everything else.
   uint64_t mask = ((1ULL << info.bits_used) - 1);
   HASSERT((block_value & mask) == block_value);
   uint64_t data = 0;
-  read_repeated(fd_, &data, info.read_bytes);
+  uint8_t* p = fileShadow_.data() + info.file_offset;
+  memcpy(&data, p, info.read_bytes);
   block_value <<= info.shift_count;
   mask <<= info.shift_count;
   data &= ~mask;
   data |= block_value;
+  memcpy(p, &data, info.read_bytes);
 
-  offset = lseek(fd_, info.file_offset, SEEK_SET);
-  ERRNOCHECK("lseek", offset);
-  HASSERT(offset == info.file_offset);
-  write_repeated(fd_, &data, info.read_bytes);
-}
-
-MemorizingHandlerBlock::MemorizingHandlerBlock(MemorizingHandlerManager* parent,
-                                               uint64_t event_base)
-    : parent_(parent), event_base_(event_base), current_event_(0) {
-  unsigned mask = EventRegistry::align_mask(&event_base, parent_->block_size());
-  EventRegistry::instance()->register_handler(
-      EventRegistryEntry(this, event_base), mask);
-}
-
-MemorizingHandlerBlock::~MemorizingHandlerBlock() {
-  EventRegistry::instance()->unregister_handler(this);
-}
-
-/** Checks if a single eventid is ours, and sends out a PCER for the valid
- * event. Notifies done. */
-void MemorizingHandlerBlock::ReportSingle(EventReport* event,
-                                          BarrierNotifiable* done) {
-  AutoNotify n(done);
-  auto eventid = event->event;
-  if (!is_mine(eventid)) return;
-  event->event_write_helper<1>()->WriteAsync(
-      parent_->node(), Defs::MTI_EVENT_REPORT, WriteHelper::global(),
-      eventid_to_buffer(current_event_), done->new_child());
-}
-
-/** Checks if the eventid is ours. Sends an event report with the currently
- * valid eventid, and an Identified_{producer/consumer}_{valid/invalid} for
- * the given eventid. */
-void MemorizingHandlerBlock::ReportAndIdentify(EventReport* event,
-                                               Defs::MTI mti,
-                                               BarrierNotifiable* done) {
-  AutoNotify n(done);
-  auto eventid = event->event;
-  if (!is_mine(eventid)) return;
-  if (eventid != current_event_) {
-    mti++;
+  // Extends the dirty range. Bursts of changes get coalesced into one write.
+  unsigned begin = info.file_offset;
+  unsigned end = info.file_offset + info.read_bytes;
+  if (dirtyBegin_ >= dirtyEnd_) {
+    dirtyBegin_ = begin;
+    dirtyEnd_ = end;
+    flushFlow_->schedule();
+  } else {
+    dirtyBegin_ = std::min(dirtyBegin_, begin);
+    dirtyEnd_ = std::max(dirtyEnd_, end);
   }
-  event->event_write_helper<2>()->WriteAsync(
-      parent_->node(), mti, WriteHelper::global(), eventid_to_buffer(eventid),
-      done->new_child());
-  // This will happen by us listening to our own identified call.
-  /*event_write_helper1.WriteAsync(
-      parent_->node(), Defs::MTI_EVENT_REPORT, WriteHelper::global(),
-      eventid_to_buffer(current_event_), done->new_child());*/
-}
-
-/** Checks if a range intersects with our range; if so, then produces the
- * valid event report. */
-void MemorizingHandlerBlock::ReportRange(EventReport* event,
-                                         BarrierNotifiable* done) {
-  AutoNotify n(done);
-  if (!is_mine_range(event)) return;
-  // We don't respond to range queries from ourselves; this should prevent us
-  // from generating event reports on the global identify message.
-  if (event->src_node.id == parent_->node()->node_id()) return;
-  event->event_write_helper<1>()->WriteAsync(
-      parent_->node(), Defs::MTI_EVENT_REPORT, WriteHelper::global(),
-      eventid_to_buffer(current_event_), done->new_child());
 }
 
 }  // namespace openlcb
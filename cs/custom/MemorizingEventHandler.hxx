@@ -38,41 +38,50 @@
 #define _BRACZ_CUSTOM_MEMORIZINGEVENTHANDLER_HXX_
 
 #include <memory>
-#include <map>
+#include <vector>
 
+#include "custom/DelayedFlushFlow.hxx"
+#include "executor/StateFlow.hxx"
 #include "openlcb/EventHandler.hxx"
 #include "openlcb/Defs.hxx"
 
 namespace openlcb {
 
-class MemorizingHandlerBlock;
-
-/** A memorizing handler manager is responsible for on-demand creating
- * memorizing event handler blocks covering a large event interval. Each
- * handler block will keep the state of an event-based variable. The variable
- * is represented as a block of K consecutive events, of which only one can
- * ever be valid, all others are invalid. The event handler block will remember
- * which was the last produced event. If a producer or consumer identified
- * message arrives for the any of the events in the block, the memorizing
- * handler will emit the last known state of the block as an event, in addition
- * to responding with valid/invalid.
+/** A memorizing handler manager is responsible for keeping the state of
+ * memorized event blocks covering a large event interval. Each block keeps
+ * the state of an event-based variable. The variable is represented as a
+ * block of K consecutive events, of which only one can ever be valid, all
+ * others are invalid. The manager will remember which was the last produced
+ * event of every block. If a producer or consumer identified message arrives
+ * for the any of the events in the block, the memorizing handler will emit the
+ * last known state of the block as an event, in addition to responding with
+ * valid/invalid.
  *
  * Example: block size of 2 represents the traditional on/off state of a single
  * bit variable. Say event base = 0x050101011422FF00, and we have bit variables
  * for a total size of 128 (0x80).
  *
- * When event 0x050101011422FF30 arrives, the manager will create the block for
- * {FF30, FF31}, and remember that the valid offset is FF30.
+ * When event 0x050101011422FF30 arrives, the manager will remember for block
+ * {FF30, FF31} that the valid offset is FF30.
  *
- * If at this point an IdentifyProducer for FF31 arrives, the block will
+ * If at this point an IdentifyProducer for FF31 arrives, the manager will
  * respond ProducerIdentified False, and Event Report FF30. This will ensure
  * that whoever was inquiring about the state of the variable will get the
  * proper state.
  *
+ * The state of all blocks is kept in a single flat array, and the manager is
+ * registered with the event registry as one range handler, independent of how
+ * many blocks are known.
+ *
+ * The state can optionally be persisted in a file (see set_backing_file). The
+ * file is read once at startup into an in-memory shadow; changes are written
+ * back by a background flow a while after the first change (write-behind),
+ * with one write call per flush. After a crash the file reflects the state as
+ * of the last completed flush.
  */
 class MemorizingHandlerManager : public EventHandler {
  public:
-  /** Creates a memorizing handler block. It will register itself with the
+  /** Creates a memorizing handler manager. It will register itself with the
    * global event registry.
    *
    * @param event_base is the first event of the first block.
@@ -82,154 +91,142 @@ class MemorizingHandlerManager : public EventHandler {
    */
   MemorizingHandlerManager(Node* node, uint64_t event_base,
                            unsigned num_total_events, unsigned block_size);
+  /// Flushes pending changes to the backing file. Must not be called on the
+  /// node's executor.
   ~MemorizingHandlerManager();
 
+  /// Default value of the flush_delay_nsec argument of set_backing_file.
+  static constexpr long long DEFAULT_FLUSH_DELAY_NSEC = SEC_TO_NSEC(2);
+
+  /** Makes the state persistent. Reads the state of all blocks from the file
+   * and from then on writes changes back to it.
+   *
+   * @param fd is the file descriptor of the backing file. Must stay open so
+   * long as *this is alive.
+   * @param file_offset is where the memorized state starts in the file. The
+   * state occupies file_size() bytes.
+   * @param flush_delay_nsec is how long changes may stay in memory before
+   * they are written to the file. */
+  void set_backing_file(int fd, unsigned file_offset,
+                        long long flush_delay_nsec = DEFAULT_FLUSH_DELAY_NSEC);
+
+  /// Writes all pending changes to the backing file now. The write runs on
+  /// the node's executor, like every other access to the state; this call
+  /// blocks until it is done, so it must not be made on that executor.
+  void flush();
+
+  /// @return how many bytes the state takes in the backing file.
+  unsigned file_size();
+
   void handle_event_report(const EventRegistryEntry& registry_entry,
                            EventReport* event, BarrierNotifiable* done) OVERRIDE;
   void handle_consumer_identified(const EventRegistryEntry& registry_entry,
                                 EventReport* event,
                                 BarrierNotifiable* done) OVERRIDE;
+  void handle_consumer_range_identified(const EventRegistryEntry& registry_entry,
+                                     EventReport* event,
+                                     BarrierNotifiable* done) OVERRIDE {
+    ReportRange(event, done);
+  }
   void handle_producer_identified(const EventRegistryEntry& registry_entry,
                                 EventReport* event,
                                 BarrierNotifiable* done) OVERRIDE;
+  void handle_producer_range_identified(const EventRegistryEntry& registry_entry,
+                                     EventReport* event,
+                                     BarrierNotifiable* done) OVERRIDE {
+    ReportRange(event, done);
+  }
   void handle_identify_global(const EventRegistryEntry& registry_entry,
                             EventReport* event,
                             BarrierNotifiable* done) OVERRIDE;
   void handle_identify_consumer(const EventRegistryEntry& registry_entry,
                               EventReport* event,
                               BarrierNotifiable* done) override {
-    // These are handled by individual blocks TODO: what if there is no block
-    return done->notify();
+    ReportAndIdentify(event, Defs::MTI_CONSUMER_IDENTIFIED_VALID, done);
   }
   void handle_identify_producer(const EventRegistryEntry& registry_entry,
                               EventReport* event,
                               BarrierNotifiable* done) override {
-    // These are handled by individual blocks TODO: what if there is no block
-    return done->notify();
+    ReportAndIdentify(event, Defs::MTI_PRODUCER_IDENTIFIED_VALID, done);
   }
 
   unsigned block_size() { return block_size_; }
 
   Node* node() { return node_; }
 
+  /// @return the currently valid event of the block containing eventid, or
+  /// 0 if the state of that block is not known.
+  uint64_t current_event(uint64_t eventid) {
+    if (!is_mine(eventid)) return 0;
+    unsigned block_num = (eventid - event_base_) / block_size_;
+    uint32_t state = blockState_[block_num];
+    if (!state) return 0;
+    return event_base_ + block_num * block_size_ + state - 1;
+  }
+
  private:
+  class RangeReportFlow;
+
   /** @returns true if the event report is in the range we are responsible
    * for. */
   bool is_mine(uint64_t event) {
     return event >= event_base_ && event < (event_base_ + num_total_events_);
   }
 
-  /// Reports that the given event ID is in the VALID state. Internally it
-  /// creates the handler block if it does not exist yet. This will be called
-  /// on both PCER, as well as Identify {Producer, Consumer} VALID messages.
+  /// Reports that the given event ID is in the VALID state. This will be
+  /// called on both PCER, as well as Identify {Producer, Consumer} VALID
+  /// messages.
   void UpdateValidEvent(uint64_t eventid);
 
+  /** If the eventid belongs to a known block, sends out a PCER for the valid
+   * event of that block. Notifies done. */
+  void ReportSingle(EventReport* event, BarrierNotifiable* done);
+
+  /** If the eventid belongs to a known block, sends an
+   * Identified_{producer/consumer}_{valid/invalid} for the given eventid. */
+  void ReportAndIdentify(EventReport* event, Defs::MTI mti,
+                         BarrierNotifiable* done);
+
+  /** Produces the valid event report for every known block that intersects
+   * the range. */
+  void ReportRange(EventReport* event, BarrierNotifiable* done);
+
   struct BlockOffsetInfo;
   inline void GetBlockFileOffset(unsigned block_num, BlockOffsetInfo* info);
 
-  /// Checks the backing file whether the given block has information saved or
+  /// Checks the file shadow whether the given block has information saved or
   /// not. If it has info, returns the valid event for that block. Otherwise
   /// returns 0.
-  uint64_t GetBlockFromFile(unsigned block_offset);
+  uint64_t GetBlockFromFile(unsigned block_num);
 
-  /// Sets a block in the backing file to a given valid event id.
+  /// Sets a block in the file shadow to a given valid event id, and schedules
+  /// the flush.
   void SaveValidEventToFile(uint64_t eventid);
 
+  /// Writes the dirty part of the file shadow to the backing file. Must be
+  /// called on the node's executor.
+  void write_dirty();
+
   Node* node_;
   uint64_t event_base_;
   unsigned num_total_events_;
   unsigned block_size_;
   int fd_{-1};  /// If >= 0, then our block is backed by a file.
   unsigned file_offset_;
-
-  // All the event blocks we own. Keyed by (first_event_of_block - event_base_).
-  std::map<unsigned, std::unique_ptr<MemorizingHandlerBlock> > blocks_;
-};
-
-class MemorizingHandlerBlock : public EventHandler {
- public:
-  // Creates an event handler block, and registers it.
-  MemorizingHandlerBlock(MemorizingHandlerManager* parent, uint64_t event_base);
-  ~MemorizingHandlerBlock();
-
-  // Event reports are handled by the manager.
-  void handle_event_report(const EventRegistryEntry& registry_entry,
-                           EventReport* event, BarrierNotifiable* done) OVERRIDE {
-    done->notify();
-  }
-
-  void handle_consumer_identified(const EventRegistryEntry& registry_entry,
-                                EventReport* event,
-                                BarrierNotifiable* done) OVERRIDE {
-    ReportSingle(event, done);
-  }
-  void handle_consumer_range_identified(const EventRegistryEntry& registry_entry,
-                                     EventReport* event,
-                                     BarrierNotifiable* done) OVERRIDE {
-    ReportRange(event, done);
-  }
-  void handle_producer_identified(const EventRegistryEntry& registry_entry,
-                                EventReport* event,
-                                BarrierNotifiable* done) OVERRIDE {
-    ReportSingle(event, done);
-  }
-  void handle_producer_range_identified(const EventRegistryEntry& registry_entry,
-                                     EventReport* event,
-                                     BarrierNotifiable* done) OVERRIDE {
-    ReportRange(event, done);
-  }
-  void handle_identify_producer(const EventRegistryEntry& registry_entry,
-                              EventReport* event,
-                              BarrierNotifiable* done) OVERRIDE {
-    ReportAndIdentify(event, Defs::MTI_PRODUCER_IDENTIFIED_VALID, done);
-  }
-  void handle_identify_consumer(const EventRegistryEntry& registry_entry,
-                              EventReport* event,
-                              BarrierNotifiable* done) OVERRIDE {
-    ReportAndIdentify(event, Defs::MTI_CONSUMER_IDENTIFIED_VALID, done);
-  }
-
-  void handle_identify_global(const EventRegistryEntry& registry_entry,
-                            EventReport* event,
-                            BarrierNotifiable* done) OVERRIDE {
-    // Global identify is handler by the block manager.
-    return done->notify();
-  }
-
-  void set_current_event(uint64_t e) { current_event_ = e; }
-
-  uint64_t current_event() { return current_event_; }
-
- private:
-  /** Checks if a single eventid is ours, and sends out a PCER for the valid
-   * event. Notifies done. */
-  void ReportSingle(EventReport* event, BarrierNotifiable* done);
-
-  /** Checks if the eventid is ours. Sends an event report with the currently
-   * valid eventid, and an Identified_{producer/consumer}_{valid/invalid} for
-   * the given eventid. */
-  void ReportAndIdentify(EventReport* event, Defs::MTI mti,
-                         BarrierNotifiable* done);
-
-  /** Checks if a range intersects with our range; if so, then produces the
-   * valid event report. */
-  void ReportRange(EventReport* event, BarrierNotifiable* done);
-
-  /** @returns true if the eventid is in my range. */
-  bool is_mine(uint64_t eventid) {
-    return eventid >= event_base_ &&
-           eventid < (event_base_ + parent_->block_size());
-  }
-
-  /** @returns true if a range intersects my range. */
-  bool is_mine_range(EventReport* event) {
-    return event->event < (event_base_ + parent_->block_size()) &&
-           (event->event | event->mask) >= event_base_;
-  }
-
-  MemorizingHandlerManager* parent_;
-  uint64_t event_base_;
-  uint64_t current_event_;
+  /// In-memory copy of the state area of the backing file.
+  std::vector<uint8_t> fileShadow_;
+  /// Byte range of fileShadow_ that differs from the file. Empty if
+  /// dirtyBegin_ >= dirtyEnd_.
+  unsigned dirtyBegin_{0};
+  unsigned dirtyEnd_{0};
+
+  /// State of every block, indexed by block number. 0 means unknown,
+  /// otherwise the offset of the valid event within the block plus one.
+  std::vector<uint32_t> blockState_;
+  /// Emits the event reports for range identified messages.
+  std::unique_ptr<RangeReportFlow> rangeFlow_;
+  /// Writes the dirty part of the shadow to the file after a delay.
+  std::unique_ptr<bracz_custom::DelayedFlushFlow> flushFlow_;
 };
 
 }  // namespace openlcb
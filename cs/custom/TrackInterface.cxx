@@ -34,13 +34,32 @@
 
 #include "custom/TrackInterface.hxx"
 
+#include "commandstation/DccLatencyMonitor.hxx"
 #include "custom/HostLogging.hxx"
 #include "utils/constants.hxx"
 
 namespace bracz_custom {
 
 StateFlowBase::Action TrackIfSend::entry() {
-  return allocate_and_call(device_, STATE(fill_packet));
+  dcc::Packet* packet = message()->data();
+  if (!streamFraming_) {
+    if (packet->dlc >= 8) {
+      // Does not fit into a frame, and the track processor has not told us
+      // that it understands the stream framing.
+      LOG_ERROR("Dropping DCC packet of %u bytes: no stream framing.",
+                packet->dlc);
+      return release_and_exit();
+    }
+    return allocate_and_call(device_, STATE(fill_packet));
+  }
+  record_[0] = packet->header_raw_data;
+  record_[1] = packet->dlc;
+  memcpy(record_ + 2, packet->payload, packet->dlc);
+  recordLen_ = packet->dlc + 2;
+  recordOfs_ = 0;
+  // Kept until the frame with the last byte of the record is sent.
+  current_ = transfer_message();
+  return call_immediately(STATE(copy_record));
 }
 
 StateFlowBase::Action TrackIfSend::fill_packet() {
@@ -54,11 +73,61 @@ StateFlowBase::Action TrackIfSend::fill_packet() {
   f->can_dlc = packet->dlc + 1;
   HASSERT(f->can_dlc <= 8);
   memcpy(f->data + 1, packet->payload, packet->dlc);
-  send_host_log_event(HostLogEvent::TRACK_SENT);
   device_->send(b);
+  packet_sent(message());
   return release_and_exit();
 }
 
+StateFlowBase::Action TrackIfSend::copy_record() {
+  while (recordOfs_ < recordLen_) {
+    if (!frameLen_) {
+      frame_[0] = STREAM_NO_RECORD_START;
+    }
+    if (!recordOfs_ && frame_[0] == STREAM_NO_RECORD_START) {
+      frame_[0] = frameLen_;
+    }
+    frame_[1 + frameLen_++] = record_[recordOfs_++];
+    if (recordOfs_ == recordLen_) {
+      HASSERT(numFramePackets_ < MAX_FRAME_PACKETS);
+      framePackets_[numFramePackets_++] = current_;
+      current_ = nullptr;
+    }
+    if (frameLen_ >= STREAM_BYTES_PER_FRAME) {
+      return allocate_and_call(device_, STATE(send_stream_frame));
+    }
+  }
+  // A partially filled frame waits for the next packet only if that is
+  // already queued.
+  if (frameLen_ && queue_empty()) {
+    return allocate_and_call(device_, STATE(send_stream_frame));
+  }
+  return exit();
+}
+
+StateFlowBase::Action TrackIfSend::send_stream_frame() {
+  auto* b = get_allocation_result(device_);
+  auto* f = b->data()->mutable_frame();
+  CLR_CAN_FRAME_EFF(*f);
+  SET_CAN_FRAME_ID(*f, CAN_ID_TRACKPROCESSOR_STREAM);
+  f->can_dlc = 1 + frameLen_;
+  memcpy(f->data, frame_, f->can_dlc);
+  frameLen_ = 0;
+  device_->send(b);
+  for (unsigned i = 0; i < numFramePackets_; ++i) {
+    packet_sent(framePackets_[i]);
+    framePackets_[i]->unref();
+  }
+  numFramePackets_ = 0;
+  return call_immediately(STATE(copy_record));
+}
+
+void TrackIfSend::packet_sent(Buffer<dcc::Packet>* b) {
+  send_host_log_event(HostLogEvent::TRACK_SENT);
+  if (auto* m = commandstation::DccLatencyMonitor::active()) {
+    m->packet_sent(b);
+  }
+}
+
 enum {
   CS_CAN_FILTER = CanMessageData::CAN_STD_FRAME_FILTER | CAN_ID_COMMANDSTATION,
   CS_CAN_MASK = CanMessageData::CAN_STD_FRAME_MASK | 0x7FF,
@@ -70,12 +139,15 @@ enum {
  * of urgent packets will be high. */
 DECLARE_CONST(track_processor_packet_buffer_count);
 
-TrackIfReceive::TrackIfReceive(CanIf* interface, dcc::PacketFlowInterface* packet_q)
+TrackIfReceive::TrackIfReceive(CanIf* interface,
+                               dcc::PacketFlowInterface* packet_q,
+                               TrackIfSend* sender)
     : IncomingFrameFlow(interface->service()),
       pool_(sizeof(Buffer<dcc::Packet>),
             config_track_processor_packet_buffer_count()),
       interface_(interface),
-      packetQueue_(packet_q) {
+      packetQueue_(packet_q),
+      sender_(sender) {
   interface_->frame_dispatcher()->register_handler(this, CS_CAN_FILTER,
                                                   CS_CAN_MASK);
 }
@@ -93,6 +165,9 @@ StateFlowBase::Action TrackIfReceive::entry() {
     case TRACKCMD_KEEPALIVE: {
       return call_immediately(STATE(handle_keepalive));
     }
+    case TRACKCMD_CREDIT: {
+      return call_immediately(STATE(handle_credit));
+    }
     default:
       return release_and_exit();
   }
@@ -107,7 +182,7 @@ StateFlowBase::Action TrackIfReceive::handle_keepalive() {
       send_host_log_event(HostLogEvent::TRACK_ALIVE);
     }
   }
-  if (f->can_dlc > 1) {
+  if (f->can_dlc > 1 && !creditMode_) {
     int free_packet_count = f->data[1];
     while (is_alive && free_packet_count--) {
       Buffer<dcc::Packet>* b;
@@ -133,4 +208,42 @@ StateFlowBase::Action TrackIfReceive::respond_keepalive() {
   return exit();
 }
 
+StateFlowBase::Action TrackIfReceive::handle_credit() {
+  auto* f = &message()->data()->frame();
+  if (!creditMode_) {
+    creditMode_ = true;
+    if (sender_) {
+      sender_->enable_stream_framing();
+    }
+  }
+  if (f->can_dlc > 1) {
+    creditFlow_.add(f->data[1]);
+  }
+  return release_and_exit();
+}
+
+void TrackIfReceive::CreditFlow::add(unsigned count) {
+  pendingCredits_ += count;
+  if (is_terminated() && pendingCredits_) {
+    start_flow(STATE(grant_credit));
+  }
+}
+
+StateFlowBase::Action TrackIfReceive::CreditFlow::grant_credit() {
+  if (!pendingCredits_) {
+    return exit();
+  }
+  // Unlike with the keepalive, credits are never lost: when the pool is
+  // empty, we wait until the send flow returns a buffer.
+  return allocate_and_call(parent_->packetQueue_, STATE(credit_buffer_ready),
+                           &parent_->pool_);
+}
+
+StateFlowBase::Action TrackIfReceive::CreditFlow::credit_buffer_ready() {
+  auto* b = get_allocation_result(parent_->packetQueue_);
+  --pendingCredits_;
+  parent_->packetQueue_->send(b);
+  return call_immediately(STATE(grant_credit));
+}
+
 }  // namespace bracz_custom
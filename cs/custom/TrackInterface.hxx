@@ -52,6 +52,20 @@ namespace bracz_custom {
 enum {
   CAN_ID_TRACKPROCESSOR = 0b11100000001,  // 0x701
   CAN_ID_COMMANDSTATION = 0b11100000000,  // 0x700
+  /// Packets to the track processor in the stream framing. The packets are
+  /// serialized as records of {header_raw_data, dlc, payload[dlc]}, and the
+  /// record stream is cut into frames. data[0] of each frame is the offset
+  /// of the first record starting in that frame (counted from data[1]), or
+  /// STREAM_NO_RECORD_START; data[1..] is the next slice of the stream. Short
+  /// packets thus share frames, and long packets span several frames.
+  CAN_ID_TRACKPROCESSOR_STREAM = 0b11100000010,  // 0x702
+};
+
+enum {
+  /// Marks a stream frame in which no record starts.
+  STREAM_NO_RECORD_START = 0xFF,
+  /// Number of stream bytes in a full stream frame.
+  STREAM_BYTES_PER_FRAME = 7,
 };
 
 enum {
@@ -66,6 +80,10 @@ enum {
   TRACKCMD_BREAK = 17,
   TRACKCMD_DISABLE = 19,
   TRACKCMD_ENABLE = 21,
+  /// Sent by the track processor as {TRACKCMD_CREDIT, count} whenever count
+  /// packet buffers became free. Once the track processor used this, the
+  /// free packet count in its keepalives is ignored.
+  TRACKCMD_CREDIT = 23,
 };
 
 class TrackPowerOnOffBit : public openlcb::BitEventInterface {
@@ -98,18 +116,53 @@ class TrackPowerOnOffBit : public openlcb::BitEventInterface {
 
 /** This state flow will take every incoming packet and send it out on a CANbus
  * interface to the "track processor slave" address. That will go in a standard
- * packet so as not to disturb OpenLCB communication. */
+ * packet so as not to disturb OpenLCB communication.
+ *
+ * By default every packet goes in a frame of its own. Once the track
+ * processor announced that it understands the stream framing (see
+ * CAN_ID_TRACKPROCESSOR_STREAM), packets queued back to back are packed into
+ * shared frames. Packets that do not fit into a single frame can only be
+ * sent in the stream framing; before that they are dropped. */
 class TrackIfSend : public StateFlow<Buffer<dcc::Packet>, QList<1> > {
  public:
   TrackIfSend(CanHubFlow* can_hub)
       : StateFlow<Buffer<dcc::Packet>, QList<1> >(can_hub->service()),
         device_(can_hub) {}
 
+  /// Switches all packets to the stream framing.
+  void enable_stream_framing() { streamFraming_ = true; }
+
  private:
   Action entry() OVERRIDE;
   Action fill_packet();
 
+  /// Copies the current record into frames, sending each frame when full.
+  Action copy_record();
+  Action send_stream_frame();
+
+  /// Reports that a packet went out to the track processor.
+  void packet_sent(Buffer<dcc::Packet>* b);
+
+  /// Most records that can end in one stream frame: a record has at least
+  /// two bytes.
+  static constexpr unsigned MAX_FRAME_PACKETS = STREAM_BYTES_PER_FRAME / 2 + 1;
+
   CanHubFlow* device_;
+  /// True if short packets should be packed in the stream framing as well.
+  bool streamFraming_{false};
+  /// Serialized packet being copied into frames.
+  uint8_t record_[2 + sizeof(dcc::Packet::payload)];
+  uint8_t recordLen_;
+  uint8_t recordOfs_;
+  /// Packet of the record being copied.
+  Buffer<dcc::Packet>* current_{nullptr};
+  /// Packets whose record ends in frame_. Released when frame_ is sent.
+  Buffer<dcc::Packet>* framePackets_[MAX_FRAME_PACKETS];
+  unsigned numFramePackets_{0};
+  /// Stream frame being filled. frame_[0] is the record start offset.
+  uint8_t frame_[1 + STREAM_BYTES_PER_FRAME];
+  /// Number of stream bytes in frame_.
+  uint8_t frameLen_{0};
 };
 
 class TrackIfReceive : public IncomingFrameFlow {
@@ -117,20 +170,50 @@ class TrackIfReceive : public IncomingFrameFlow {
   /** Creates a port to listen on the feedback from the track processor.
    * @param interface is the CAN bus port to listen on
    * @param packet_q is a flow that will get an empty packet whenever the
-   * track processor is ready to receive the next outgoing packet. */
-  TrackIfReceive(CanIf* interface, dcc::PacketFlowInterface* packet_q);
+   * track processor is ready to receive the next outgoing packet.
+   * @param sender if not null, will be switched to the stream framing when
+   * the track processor starts sending credits. */
+  TrackIfReceive(CanIf* interface, dcc::PacketFlowInterface* packet_q,
+                 TrackIfSend* sender = nullptr);
   ~TrackIfReceive();
 
   Action entry() OVERRIDE;
   Action handle_keepalive();
   Action respond_keepalive();
 
+  Action handle_credit();
+
  private:
+  /** Hands out one empty packet per credit. When the pool is empty, it waits
+   * for the send flow to return a buffer; the receive flow meanwhile goes on
+   * with the next frame. */
+  class CreditFlow : public StateFlowBase {
+   public:
+    CreditFlow(TrackIfReceive* parent)
+        : StateFlowBase(parent->service()), parent_(parent) {}
+
+    /// Adds credits from the track processor. Must be called on the
+    /// executor.
+    void add(unsigned count);
+
+   private:
+    Action grant_credit();
+    Action credit_buffer_ready();
+
+    TrackIfReceive* parent_;
+    /// Credits received but not yet turned into empty packets.
+    unsigned pendingCredits_{0};
+  };
+
   /** This pool will be the source of outgoing packet buffers. */
   FixedPool pool_;
   /** @TODO(balazs.racz) replace this with a service keeping all objects. */
   CanIf* interface_;
   dcc::PacketFlowInterface* packetQueue_;
+  TrackIfSend* sender_;
+  CreditFlow creditFlow_{this};
+  /// True once the track processor sent a credit frame.
+  bool creditMode_{false};
 };
 
 }  // namespace bracz_custom
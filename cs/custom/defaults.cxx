@@ -1,3 +1,5 @@
 #include "utils/constants.hxx"
 
 DEFAULT_CONST(track_processor_packet_buffer_count, 2);
+DEFAULT_CONST(host_bridge_latency_usec, 0);
+DEFAULT_CONST(host_log_ring_bytes, 512);
@@ -0,0 +1,138 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file HostPacketIndex.hxx
+ *
+ * Finds the handlers interested in a packet coming from the host client.
+ *
+ * @author Balazs Racz
+ * @date 18 Oct 2026
+ */
+
+#ifndef _SERVER_HOSTPACKETINDEX_HXX_
+#define _SERVER_HOSTPACKETINDEX_HXX_
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/Atomic.hxx"
+#include "utils/Buffer.hxx"
+#include "src/usb_proto.h"
+
+namespace server {
+
+class HostPacketHandlerInterface {
+ public:
+  virtual void packet_arrived(Buffer<string>* b) = 0;
+};
+
+/** Handlers of the packets coming from the host client, indexed by the
+ * packets they want to see. A handler registers either for every packet with
+ * a given command byte, or for the CAN packets with a given MCP header. A
+ * packet is only shown to the handlers registered for one of its keys, which
+ * still have to check the rest of the packet themselves.
+ *
+ * Handlers can be added and removed from any thread, including from
+ * packet_arrived(). */
+class HostPacketIndex {
+ public:
+  /// @returns the key under which a handler sees every packet with the
+  /// command byte cmd.
+  static uint64_t type_key(uint8_t cmd) { return cmd; }
+
+  /// @returns the key under which a handler sees the CAN packets that have
+  /// the same MCP header as packet. As in the response filters, the lowest
+  /// bit of the EID does not count.
+  /// @param packet a CMD_CAN_PKT with at least 5 bytes.
+  static uint64_t can_key(const string& packet) {
+    const uint8_t* p = (const uint8_t*)packet.data();
+    return (1ULL << 32) | ((uint64_t)p[1] << 24) | (p[2] << 16) |
+           (p[3] << 8) | (p[4] & 0xfe);
+  }
+
+  void add(HostPacketHandlerInterface* handler, uint64_t key) {
+    AtomicHolder l(&lock_);
+    handlers_.emplace(key, handler);
+  }
+
+  /// Removes a handler. Does nothing if it is not registered under key.
+  void remove(HostPacketHandlerInterface* handler, uint64_t key) {
+    AtomicHolder l(&lock_);
+    auto range = handlers_.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == handler) {
+        handlers_.erase(it);
+        return;
+      }
+    }
+  }
+
+  /// Hands a packet to the handlers registered for it. Only the matching
+  /// handlers are copied, because a handler may remove itself when called.
+  /// Must not be called concurrently with itself.
+  /// @param b packet without the datagram ID. Ownership is transferred.
+  void dispatch(Buffer<string>* b) {
+    const string& packet = *b->data();
+    if (!packet.empty()) {
+      AtomicHolder l(&lock_);
+      add_candidates(type_key(packet[0]));
+      if (packet[0] == CMD_CAN_PKT && packet.size() >= 5) {
+        add_candidates(can_key(packet));
+      }
+    }
+    for (auto* h : candidates_) {
+      h->packet_arrived(b->ref());
+    }
+    candidates_.clear();
+    b->unref();
+  }
+
+  /// @returns the number of registered handlers.
+  size_t size() {
+    AtomicHolder l(&lock_);
+    return handlers_.size();
+  }
+
+ private:
+  /// Appends the handlers registered under key to candidates_. Called with
+  /// the lock held.
+  void add_candidates(uint64_t key) {
+    auto range = handlers_.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+      candidates_.push_back(it->second);
+    }
+  }
+
+  std::unordered_multimap<uint64_t, HostPacketHandlerInterface*> handlers_;
+  /// Handlers of the packet being dispatched.
+  std::vector<HostPacketHandlerInterface*> candidates_;
+  Atomic lock_;
+};
+
+}  // namespace server
+
+#endif  // _SERVER_HOSTPACKETINDEX_HXX_
@@ -36,7 +36,12 @@
 #define _SERVER_PACKETSTREAMSENDER_HXX_
 
 #include <arpa/inet.h>
+#include <errno.h>
 #include <fcntl.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <vector>
+
 #include "executor/StateFlow.hxx"
 
 namespace server {
@@ -46,8 +51,16 @@ typedef StateFlow<Buffer<string>, QList<1> > PacketFlow;
 
 static constexpr uint32_t kStreamMagic = 0x3d82c6e2;
 
+/// Writes packets to an fd, each prefixed with its length in network byte
+/// order. Packets that queue up while a write is in progress are sent
+/// together with a single writev().
 class PacketStreamSender : public PacketFlow {
  public:
+  /// Maximum number of packets sent in one writev().
+  static constexpr unsigned MAX_BATCH = 32;
+  /// No more packets are added to a batch once it is this long.
+  static constexpr unsigned MAX_BATCH_BYTES = 65536;
+
   PacketStreamSender(Service* s, int fd) : PacketFlow(s), fd_(fd) {
     ::fcntl(fd_, F_SETFL, O_NONBLOCK);
     // We have to do something before we start pending on the queue.
@@ -55,37 +68,120 @@ class PacketStreamSender : public PacketFlow {
     LOG(INFO, "started sender");
   }
 
+  /// @returns the number of packets written.
+  unsigned num_packets() { return numPackets_; }
+
+  /// @returns the number of write syscalls issued for the packets.
+  unsigned num_syscalls() { return numSyscalls_; }
+
  private:
   Action send_magic() {
-    length_ = htonl(kStreamMagic);
-    return this->write_repeated(&selectHelper_, fd_, &length_, 4,
+    magic_ = htonl(kStreamMagic);
+    return this->write_repeated(&selectHelper_, fd_, &magic_, 4,
                                 exit().next_state());
   }
 
   Action entry() OVERRIDE {
-    length_ = htonl(message()->data()->size());
-    return this->write_repeated(&selectHelper_, fd_, &length_, 4,
-                                STATE(length_done));
+    batchSize_ = 0;
+    iovCount_ = 0;
+    iovPos_ = 0;
+    add_to_batch(message());
+    size_t bytes = message()->data()->size();
+    while (batchSize_ < MAX_BATCH && bytes < MAX_BATCH_BYTES) {
+      Buffer<string>* b;
+      {
+        AtomicHolder h(this);
+        if (queue_empty()) break;
+        unsigned priority;
+        b = static_cast<Buffer<string>*>(queue_next(&priority));
+      }
+      add_to_batch(b);
+      bytes += b->data()->size();
+    }
+    return call_immediately(STATE(write_batch));
   }
 
-  Action length_done() {
-    return this->write_repeated(&selectHelper_, fd_, message()->data()->data(),
-                                message()->data()->size(), STATE(all_done));
+  /// Appends the length and payload of a packet to the iovecs.
+  void add_to_batch(Buffer<string>* b) {
+    lengths_[batchSize_] = htonl(b->data()->size());
+    iov_[iovCount_].iov_base = &lengths_[batchSize_];
+    iov_[iovCount_].iov_len = 4;
+    ++iovCount_;
+    if (!b->data()->empty()) {
+      iov_[iovCount_].iov_base = &(*b->data())[0];
+      iov_[iovCount_].iov_len = b->data()->size();
+      ++iovCount_;
+    }
+    batch_[batchSize_++] = b;
   }
 
-  Action all_done() { return release_and_exit(); }
+  Action write_batch() {
+    while (iovPos_ < iovCount_) {
+      ssize_t ret = ::writev(fd_, &iov_[iovPos_], iovCount_ - iovPos_);
+      ++numSyscalls_;
+      if (ret < 0 && errno == EINTR) continue;
+      if (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        LOG(WARNING, "packet stream: write failed: %s", strerror(errno));
+        break;
+      }
+      size_t written = ret > 0 ? ret : 0;
+      while (iovPos_ < iovCount_ && written >= iov_[iovPos_].iov_len) {
+        written -= iov_[iovPos_].iov_len;
+        ++iovPos_;
+      }
+      if (iovPos_ < iovCount_) {
+        // The fd is full. Waits until it drains to send the rest of the
+        // current iovec, then continues with writev.
+        auto& v = iov_[iovPos_++];
+        v.iov_base = static_cast<uint8_t*>(v.iov_base) + written;
+        v.iov_len -= written;
+        ++numSyscalls_;
+        return this->write_repeated(&selectHelper_, fd_, v.iov_base,
+                                    v.iov_len, STATE(write_batch));
+      }
+    }
+    return call_immediately(STATE(all_done));
+  }
+
+  Action all_done() {
+    numPackets_ += batchSize_;
+    // Entry 0 is the current message.
+    for (unsigned i = 1; i < batchSize_; ++i) {
+      batch_[i]->unref();
+    }
+    batchSize_ = 0;
+    return release_and_exit();
+  }
 
   int fd_;
-  uint32_t length_;
+  uint32_t magic_;
+  /// Packets being sent; the first one is message().
+  Buffer<string>* batch_[MAX_BATCH];
+  /// Length prefixes of the packets in network byte order.
+  uint32_t lengths_[MAX_BATCH];
+  struct iovec iov_[MAX_BATCH * 2];
+  unsigned batchSize_{0};
+  unsigned iovCount_{0};
+  /// First iovec not completely written yet.
+  unsigned iovPos_{0};
+  unsigned numPackets_{0};
+  unsigned numSyscalls_{0};
   StateFlowSelectHelper selectHelper_{this};
 };
 
+/// Reads a stream written by PacketStreamSender and hands the packets to a
+/// handler. Reads as much as is available into a buffer and parses every
+/// complete frame out of it; packets larger than the buffer are read
+/// directly into their own buffer.
 class PacketStreamReceiver : public StateFlowBase {
  public:
+  /// Bytes read with one syscall at most.
+  static constexpr unsigned READ_BUFFER_SIZE = 16384;
+
   PacketStreamReceiver(Service* s, PacketFlowInterface* handler, int fd)
-      : StateFlowBase(s), fd_(fd), handler_(handler) {
+      : StateFlowBase(s), fd_(fd), handler_(handler), buf_(READ_BUFFER_SIZE) {
     ::fcntl(fd_, F_SETFL, O_NONBLOCK);
-    start_flow(STATE(read_length));
+    start_flow(STATE(read_more));
   }
 
   ~PacketStreamReceiver() {
@@ -94,38 +190,95 @@ class PacketStreamReceiver : public StateFlowBase {
 
   void shutdown() { this->service()->executor()->unselect(&selectHelper_); }
 
+  /// @returns the number of packets received.
+  unsigned num_packets() { return numPackets_; }
+
+  /// @returns the number of read syscalls issued.
+  unsigned num_syscalls() { return numSyscalls_; }
+
  private:
-  Action read_length() {
-    length_ = 0;
-    return read_repeated(&selectHelper_, fd_, &length_, 4, STATE(length_done));
+  Action read_more() {
+    // Moves the partial frame to the beginning of the buffer.
+    if (begin_ > 0) {
+      memmove(&buf_[0], &buf_[begin_], end_ - begin_);
+      end_ -= begin_;
+      begin_ = 0;
+    }
+    return read_single(&selectHelper_, fd_, &buf_[end_], buf_.size() - end_,
+                       STATE(data_arrived));
+  }
+
+  Action data_arrived() {
+    ++numSyscalls_;
+    size_t count = buf_.size() - end_ - selectHelper_.remaining_;
+    if (selectHelper_.hasError_ && !count) {
+      LOG(WARNING, "packet stream: read failed or EOF");
+      return exit();
+    }
+    end_ += count;
+    return call_immediately(STATE(parse_frame));
   }
 
-  Action length_done() {
-    length_ = ntohl(length_);
+  Action parse_frame() {
+    if (end_ - begin_ < 4) {
+      return call_immediately(STATE(read_more));
+    }
+    uint32_t length;
+    memcpy(&length, &buf_[begin_], 4);
+    length_ = ntohl(length);
     if (length_ == kStreamMagic) {
       // Ignores the magic bytes.
-      return call_immediately(STATE(read_length));
+      begin_ += 4;
+      return call_immediately(STATE(parse_frame));
+    }
+    if (end_ - begin_ - 4 >= length_) {
+      return allocate_and_call(handler_, STATE(deliver_frame));
+    }
+    if (length_ + 4 > buf_.size()) {
+      return allocate_and_call(handler_, STATE(alloc_large));
     }
-    return allocate_and_call(handler_, STATE(alloc_done));
+    return call_immediately(STATE(read_more));
   }
 
-  Action alloc_done() {
+  Action deliver_frame() {
+    auto* b = get_allocation_result(handler_);
+    b->data()->assign((const char*)&buf_[begin_ + 4], length_);
+    begin_ += 4 + length_;
+    ++numPackets_;
+    handler_->send(b);
+    return call_immediately(STATE(parse_frame));
+  }
+
+  /// Starts receiving a packet that does not fit into the buffer.
+  Action alloc_large() {
     msg_ = get_allocation_result(handler_);
+    size_t have = end_ - begin_ - 4;
     msg_->data()->resize(length_);
-    return read_repeated(&selectHelper_, fd_, &(*msg_->data())[0], length_,
-                         STATE(all_done));
+    memcpy(&(*msg_->data())[0], &buf_[begin_ + 4], have);
+    begin_ = end_ = 0;
+    ++numSyscalls_;
+    return read_repeated(&selectHelper_, fd_, &(*msg_->data())[have],
+                         length_ - have, STATE(large_done));
   }
 
-  Action all_done() {
+  Action large_done() {
+    ++numPackets_;
     handler_->send(msg_);
     msg_ = nullptr;
-    return call_immediately(STATE(read_length));
+    return call_immediately(STATE(read_more));
   }
 
   int fd_;
+  /// Payload length of the frame being parsed.
   uint32_t length_;
   PacketFlowInterface* handler_;
   PacketFlow::message_type* msg_ = nullptr;
+  /// Data read from the fd; the unparsed bytes are in [begin_, end_).
+  std::vector<uint8_t> buf_;
+  size_t begin_{0};
+  size_t end_{0};
+  unsigned numPackets_{0};
+  unsigned numSyscalls_{0};
   StateFlowSelectHelper selectHelper_{this};
 };
 
@@ -43,6 +43,10 @@ namespace server {
 struct TinyRpc {
   TinyRpcRequest request;
   TinyRpcResponse response;
+  /// os_get_time_monotonic() when the request was parsed.
+  long long startTime{0};
+  /// Which request type this is, see RpcMetrics::method_of.
+  int method{-1};
 };
 
 typedef FlowInterface<Buffer<TinyRpc> > RpcServiceInterface;
@@ -0,0 +1,140 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file RpcMetrics.hxx
+ *
+ * Per-method call counters and latency histograms of the RPC server.
+ *
+ * @author Balazs Racz
+ * @date 18 Oct 2026
+ */
+
+#ifndef _SERVER_RPCMETRICS_HXX_
+#define _SERVER_RPCMETRICS_HXX_
+
+#include <vector>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+
+#include "commandstation/DccLatencyMonitor.hxx"
+#include "server/train_control.pb.h"
+
+namespace server {
+
+/** Collects statistics about the RPC calls, separately for every request
+ * type. A request type is the field set in the TrainControlRequest. Must be
+ * used from the executor of the RPC service only. */
+class RpcMetrics {
+ public:
+  RpcMetrics()
+      : methods_(TrainControlRequest::descriptor()->field_count() + 1) {}
+
+  /// @returns the method index to pass to record() for a request.
+  static int method_of(const TrainControlRequest& request) {
+    std::vector<const ::google::protobuf::FieldDescriptor*> fields;
+    request.GetReflection()->ListFields(request, &fields);
+    if (fields.empty()) {
+      // Empty request; counted separately.
+      return TrainControlRequest::descriptor()->field_count();
+    }
+    return fields[0]->index();
+  }
+
+  /// Accounts for a finished call.
+  /// @param method return value of method_of
+  /// @param latency_nsec time from parsing the request to the reply
+  /// @param failed true if the call returned an error
+  void record(int method, long long latency_nsec, bool failed) {
+    if (method < 0 || method >= (int)methods_.size()) return;
+    MethodStats& m = methods_[method];
+    ++m.count;
+    if (failed) ++m.errors;
+    m.totalNsec += latency_nsec;
+    if (latency_nsec > m.maxNsec) m.maxNsec = latency_nsec;
+    m.latency.add(latency_nsec);
+    ++numCalls_;
+  }
+
+  /// Fills in the response of a DoGetRpcStats request.
+  /// @param reset if true, clears the counters afterwards.
+  void fill(TrainControlResponse::RpcStats* out, bool reset) {
+    out->set_bucket_base_usec(commandstation::LatencyHistogram::BASE_USEC);
+    out->set_num_calls(numCalls_);
+    for (unsigned i = 0; i < methods_.size(); ++i) {
+      const MethodStats& m = methods_[i];
+      if (!m.count) continue;
+      auto* o = out->add_method();
+      o->set_name(method_name(i));
+      o->set_count(m.count);
+      o->set_errors(m.errors);
+      o->set_total_usec(m.totalNsec / 1000);
+      o->set_max_usec(m.maxNsec / 1000);
+      for (unsigned b = 0; b < commandstation::LatencyHistogram::NUM_BUCKETS;
+           ++b) {
+        o->add_latency_bucket(m.latency.count[b]);
+      }
+    }
+    if (reset) {
+      methods_.assign(methods_.size(), MethodStats());
+      numCalls_ = 0;
+    }
+  }
+
+  /// @returns the number of calls seen for a method.
+  unsigned count(int method) { return methods_[method].count; }
+
+  /// @returns the number of calls recorded since the last reset.
+  unsigned num_calls() { return numCalls_; }
+
+  /// @returns the human readable name of a method index.
+  static string method_name(unsigned method) {
+    auto* d = TrainControlRequest::descriptor();
+    if ((int)method >= d->field_count()) return "empty";
+    auto* f = d->field(method);
+    if (f->type() == ::google::protobuf::FieldDescriptor::TYPE_GROUP) {
+      return f->message_type()->name();
+    }
+    return f->name();
+  }
+
+ private:
+  struct MethodStats {
+    uint32_t count{0};
+    uint32_t errors{0};
+    long long totalNsec{0};
+    long long maxNsec{0};
+    commandstation::LatencyHistogram latency;
+  };
+
+  /// Indexed by the field index in TrainControlRequest; the last entry is
+  /// for requests without any field set.
+  std::vector<MethodStats> methods_;
+  unsigned numCalls_{0};
+};
+
+}  // namespace server
+
+#endif  // _SERVER_RPCMETRICS_HXX_
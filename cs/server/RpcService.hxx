@@ -38,7 +38,9 @@
 #include <memory>
 #include <google/protobuf/text_format.h>
 
+#include "os/os.h"
 #include "server/RpcDefs.hxx"
+#include "server/RpcMetrics.hxx"
 #include "server/PacketStreamSender.hxx"
 
 namespace server {
@@ -56,6 +58,21 @@ class RpcService : public Service {
 
   RpcServiceInterface* impl() { return impl_; }
   PacketFlowInterface* reply_target() { return sender_.get(); }
+  RpcMetrics* metrics() { return &metrics_; }
+
+  /** Sets which calls get their request and response logged in text form.
+   * Failed calls are always logged.
+   * @param sample_every log every Nth call. 0 to disable sampling.
+   * @param slow_call_msec log calls taking at least this long. 0 to
+   * disable. */
+  void set_logging(unsigned sample_every, unsigned slow_call_msec) {
+    logSampleEvery_ = sample_every;
+    logSampleCount_ = 0;
+    slowCallNsec_ = MSEC_TO_NSEC(slow_call_msec);
+  }
+
+  /// @returns the number of calls that were logged in text form.
+  unsigned num_logged() { return numLogged_; }
 
   bool is_busy() {
     return !sender_->is_waiting() ||
@@ -82,10 +99,7 @@ class RpcService : public Service {
     /** Sends back the response to the caller, and then deletes *this. */
     Action reply() {
       message()->data()->response.set_id(message()->data()->request.id());
-      string debug_resp;
-      ::google::protobuf::TextFormat::PrintToString(message()->data()->response, &debug_resp);
-      LOG(INFO, "response: %s", debug_resp.c_str());
-
+      service()->call_done(message()->data());
       return allocate_and_call(service()->reply_target(), STATE(render_reply));
     }
 
@@ -102,6 +116,19 @@ class RpcService : public Service {
   };
 
  private:
+  /// Answers DoGetRpcStats.
+  class StatsFlow : public ImplFlowBase {
+   public:
+    StatsFlow(Service* s, Buffer<TinyRpc>* b) : ImplFlowBase(s, b) {}
+
+    Action entry() OVERRIDE {
+      service()->fill_stats(
+          message()->data()->response.mutable_response()->mutable_rpcstats(),
+          message()->data()->request.request().dogetrpcstats().reset());
+      return reply();
+    }
+  };
+
   class ParserFlow : public PacketFlow {
    public:
     ParserFlow(RpcService* s) : PacketFlow(s) {}
@@ -117,7 +144,13 @@ class RpcService : public Service {
       b->data()->request.ParseFromString(*message()->data());
       b->data()->response.set_failed(false);
       b->data()->response.clear_error_detail();
-      service()->impl()->send(b);
+      b->data()->startTime = os_get_time_monotonic();
+      b->data()->method = RpcMetrics::method_of(b->data()->request.request());
+      if (b->data()->request.request().has_dogetrpcstats()) {
+        new StatsFlow(service(), b);
+      } else {
+        service()->impl()->send(b);
+      }
       return release_and_exit();
     }
 
@@ -127,8 +160,45 @@ class RpcService : public Service {
     }
   };
 
+  /// Accounts for a call whose response is about to be sent, and logs it if
+  /// it is selected for logging.
+  void call_done(TinyRpc* rpc) {
+    long long latency = os_get_time_monotonic() - rpc->startTime;
+    bool failed = rpc->response.failed();
+    metrics_.record(rpc->method, latency, failed);
+    bool log = failed || (slowCallNsec_ && latency >= slowCallNsec_);
+    if (logSampleEvery_ && ++logSampleCount_ >= logSampleEvery_) {
+      logSampleCount_ = 0;
+      log = true;
+    }
+    if (!log) return;
+    ++numLogged_;
+    // The text formatting is expensive; only done for the selected calls.
+    string debug_req;
+    string debug_resp;
+    ::google::protobuf::TextFormat::PrintToString(rpc->request, &debug_req);
+    ::google::protobuf::TextFormat::PrintToString(rpc->response, &debug_resp);
+    LOG(INFO, "request: %s response: %s (%lld usec)", debug_req.c_str(),
+        debug_resp.c_str(), latency / 1000);
+  }
+
+  void fill_stats(TrainControlResponse::RpcStats* out, bool reset) {
+    out->set_num_logged(numLogged_);
+    metrics_.fill(out, reset);
+    if (reset) {
+      numLogged_ = 0;
+    }
+  }
+
   RpcServiceInterface* impl_;
   ParserFlow parser_;
+  RpcMetrics metrics_;
+  /// Every this many calls one gets logged; 0 = no sampling.
+  unsigned logSampleEvery_{64};
+  unsigned logSampleCount_{0};
+  /// Calls taking at least this long get logged; 0 = off.
+  long long slowCallNsec_{SEC_TO_NSEC(1)};
+  unsigned numLogged_{0};
   std::unique_ptr<PacketStreamSender> sender_;
   std::unique_ptr<PacketStreamReceiver> receiver_;
 };
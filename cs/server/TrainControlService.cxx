@@ -34,10 +34,11 @@
 
 #include "server/TrainControlService.hxx"
 
-#include <set>
+#include <algorithm>
 #include <functional>
 #include <google/protobuf/text_format.h>
 
+#include "server/HostPacketIndex.hxx"
 #include "server/LayoutState.hxx"
 #include "custom/HostProtocol.hxx"
 #include "openlcb/Datagram.hxx"
@@ -65,13 +66,9 @@ TrainControlService::TrainControlService(ExecutorBase* e)
 TrainControlService::~TrainControlService() {}
 
 class HostServer;
+class HostPacketQueue;
 typedef StateFlow<Buffer<string>, QList<1> > PacketQueueFlow;
 
-class HostPacketHandlerInterface {
- public:
-  virtual void packet_arrived(Buffer<string>* b) = 0;
-};
-
 static bool PacketMatch(const Packet& packet, int sid, int eid, unsigned len) {
   if (packet.size() != len + 6) return false;
   if (packet[5] != (char)len) return false;
@@ -175,7 +172,7 @@ struct TrainControlService::Impl {
   DatagramService* dg_service() { return dg_service_; }
   Node* node() { return node_; }
   HostServer* datagram_handler() { return datagram_handler_.get(); }
-  PacketQueueFlow* host_queue() { return host_queue_.get(); }
+  HostPacketQueue* host_queue() { return host_queue_.get(); }
 
   // Takes ownership of the injected clock.
   void set_clock(Clock* new_clock) {
@@ -192,7 +189,7 @@ struct TrainControlService::Impl {
   DatagramService* dg_service_;
   Node* node_;
   std::unique_ptr<HostServer> datagram_handler_;
-  std::unique_ptr<PacketQueueFlow> host_queue_;
+  std::unique_ptr<HostPacketQueue> host_queue_;
 };
 
 void TrainControlService::TEST_inject_clock(Clock* clock) {
@@ -217,113 +214,401 @@ class HostServer : public DefaultDatagramHandler {
 
   TrainControlService::Impl* impl() { return service_->impl(); }
 
-  void add_handler(HostPacketHandlerInterface* handler) {
-    AtomicHolder l(&lock_);
-    packet_handlers_.insert(handler);
+  /// Registers a handler for the packets with a key from HostPacketIndex.
+  void add_handler(HostPacketHandlerInterface* handler, uint64_t key) {
+    handlers_.add(handler, key);
   }
 
-  void remove_handler(HostPacketHandlerInterface* handler) {
-    AtomicHolder l(&lock_);
-    packet_handlers_.erase(handler);
+  void remove_handler(HostPacketHandlerInterface* handler, uint64_t key) {
+    handlers_.remove(handler, key);
   }
 
  private:
   Action entry() OVERRIDE {
-    Buffer<string>* b;
-    pool()->alloc(&b);
-    b->data()->assign((const char*)(payload() + 1), size() - 1);
-    std::set<HostPacketHandlerInterface*> packet_handlers;
-    {
-      AtomicHolder l(&lock_);
-      packet_handlers = packet_handlers_;
-    }
-    for (auto* h : packet_handlers) {
-      h->packet_arrived(b->ref());
+    if (size() >= 2 && payload()[1] == CMD_CAN_PKT) {
+      // The client bridge aggregates CAN frames. The handlers see them one
+      // by one, each with its own command byte.
+      const uint8_t* frames = payload() + 2;
+      unsigned len = size() - 2;
+      if (!HostProtocolDefs::valid_mcp_frames(frames, len)) {
+        return respond_reject(openlcb::Defs::ERROR_INVALID_ARGS);
+      }
+      unsigned ofs = 0;
+      while (ofs < len) {
+        unsigned flen = HostProtocolDefs::mcp_frame_len(frames + ofs);
+        string pkt(1, CMD_CAN_PKT);
+        pkt.append((const char*)(frames + ofs), flen);
+        dispatch(std::move(pkt));
+        ofs += flen;
+      }
+    } else {
+      dispatch(string((const char*)(payload() + 1), size() - 1));
     }
-    b->unref();
     return respond_ok(0);
   }
 
+  /// Hands one host packet (without the datagram ID) to the handlers
+  /// registered for it.
+  void dispatch(string&& pkt) {
+    Buffer<string>* b;
+    pool()->alloc(&b);
+    b->data()->swap(pkt);
+    handlers_.dispatch(b);
+  }
+
   TrainControlService* service_;
-  std::set<HostPacketHandlerInterface*> packet_handlers_;
-  Atomic lock_;
+  HostPacketIndex handlers_;
 };
 
 typedef StateFlow<Buffer<string>, QList<1> > PacketQueueFlow;
 
-/** This flow will serialize the datagrams to be sent to the host client,
- *  ensuring that there is only one datagram pending at any time. */
-class HostPacketQueue : public PacketQueueFlow {
+/** This flow serializes the packets to the host client into datagrams.
+ *
+ *  A plain CMD_SYNC goes out first. It carries HOST_CAP_PACKED, so that the
+ *  client may pack the CAN frames it sends to us. Clients that understand
+ *  CMD_SEQ answer it with CMD_CAPS; until then, and with a window of one and no packing,
+ *  every packet is sent alone in the plain format, one datagram at a time,
+ *  and a failed one is dropped.
+ *
+ *  Once sequencing is on, up to window_ datagrams are handed to the datagram
+ *  layer at a time. Each carries a sequence number (CMD_SEQ), which lets the
+ *  client execute them in order and recognize the ones it got twice, so that
+ *  a failed datagram can be sent again without breaking the order of the
+ *  packets. Consecutive CAN packets are packed into one datagram if packing
+ *  is enabled.
+ *
+ *  When a datagram failed too many times, or the client cannot place its
+ *  sequence number (e.g. because it was reset), a plain CMD_SYNC restarts
+ *  the sequence at zero on both sides. The packets of the failed datagram
+ *  are dropped, and so are the ones in flight behind it.
+ *
+ *  The CMD_CAPS reply is handled on the datagram service's executor, which
+ *  has to be the same as this flow's. */
+class HostPacketQueue : public PacketQueueFlow,
+                        private HostPacketHandlerInterface {
  public:
+  /// Number of datagrams that can be in flight at most.
+  static constexpr unsigned MAX_WINDOW = HostProtocolDefs::MAX_SEQ_WINDOW;
+  /// Window used unless configured otherwise.
+  static constexpr unsigned DEFAULT_WINDOW = 4;
+  /// A sequenced datagram is given up upon after this many resends.
+  static constexpr unsigned MAX_RETRIES = 8;
+  /// Delay before the first resend. Doubles with every further attempt.
+  static constexpr unsigned RETRY_DELAY_MSEC = 2;
+  /// A sequenced datagram that keeps being rejected as out of order is
+  /// given up upon after this many resends.
+  static constexpr unsigned MAX_OUT_OF_ORDER = 200;
+  /// How long to wait for the CMD_CAPS reply to a sync.
+  static constexpr unsigned CAPS_TIMEOUT_MSEC = 500;
+
   HostPacketQueue(TrainControlService* service) : PacketQueueFlow(service) {
-    start_flow_at_init(STATE(inject_sync_packet));
+    for (unsigned i = 0; i < MAX_WINDOW; ++i) {
+      transmissions_.emplace_back(new Transmission(this));
+    }
+    impl()->datagram_handler()->add_handler(
+        this, HostPacketIndex::type_key(CMD_CAPS));
+    start_flow_at_init(STATE(wait_for_window));
+  }
+
+  ~HostPacketQueue() {
+    impl()->datagram_handler()->remove_handler(
+        this, HostPacketIndex::type_key(CMD_CAPS));
   }
 
   TrainControlService* service() {
     return static_cast<TrainControlService*>(PacketQueueFlow::service());
   }
 
+  /// Changes the window and packing. Restarts the sequence. Must be called
+  /// on the executor.
+  void configure(unsigned window, bool pack) {
+    HASSERT(window >= 1 && window <= MAX_WINDOW);
+    window_ = window;
+    pack_ = pack;
+    need_resync();
+  }
+
+  /// @returns the number of datagrams sent, not counting resends.
+  unsigned num_datagrams() { return numDatagrams_; }
+
+  /// @returns the number of times a datagram was sent again.
+  unsigned num_resends() { return numResends_; }
+
+  /// @returns true if the datagrams carry sequence numbers.
+  bool sequenced() { return peerSeq_ && (window_ > 1 || pack_); }
+
  private:
+  /// Sends one datagram and resends it as long as it makes sense.
+  class Transmission : public StateFlowBase {
+   public:
+    Transmission(HostPacketQueue* parent)
+        : StateFlowBase(parent->service()), parent_(parent) {}
+
+    bool busy() { return !is_terminated(); }
+
+    /// Sends the datagram in payload_.
+    /// @param seq sequence number, or -1 for a plain datagram.
+    /// @param forever if true, resends until the datagram gets through.
+    void start(int seq, bool forever) {
+      seq_ = seq;
+      forever_ = forever;
+      epoch_ = parent_->epoch_;
+      retries_ = 0;
+      outOfOrder_ = 0;
+      start_flow(STATE(send));
+    }
+
+    /// Ends the wait for the CMD_CAPS reply early.
+    void caps_arrived() { timer_.ensure_triggered(); }
+
+    /// Datagram payload, starting with the datagram ID.
+    string payload_;
+
+   private:
+    DatagramService* dg_service() { return parent_->dg_service(); }
+
+    Action send() {
+      return allocate_and_call(STATE(dg_client_ready),
+                               dg_service()->client_allocator());
+    }
+
+    Action dg_client_ready() {
+      dg_client_ = full_allocation_result(dg_service()->client_allocator());
+      return allocate_and_call(
+          dg_service()->iface()->addressed_message_write_flow(),
+          STATE(buf_ready));
+    }
+
+    Action buf_ready() {
+      auto* b = get_allocation_result(
+          dg_service()->iface()->addressed_message_write_flow());
+      b->data()->reset(openlcb::Defs::MTI_DATAGRAM,
+                       parent_->impl()->node()->node_id(),
+                       parent_->impl()->client_dst_, payload_);
+      b->set_done(n_.reset(this));
+      dg_client_->write_datagram(b);
+      return wait_and_call(STATE(send_complete));
+    }
+
+    Action send_complete() {
+      unsigned result = dg_client_->result();
+      dg_service()->client_allocator()->typed_insert(dg_client_);
+      dg_client_ = nullptr;
+      if ((result & DatagramClient::RESPONSE_CODE_MASK) ==
+          DatagramClient::OPERATION_SUCCESS) {
+        uint8_t flags = result >> DatagramClient::RESPONSE_FLAGS_SHIFT;
+        if (forever_ && (flags & DatagramClient::REPLY_PENDING) &&
+            !parent_->peerSeq_) {
+          // The sync is answered with the client's capabilities.
+          parent_->capsWaiter_ = this;
+          return sleep_and_call(&timer_, MSEC_TO_NSEC(CAPS_TIMEOUT_MSEC),
+                                STATE(caps_done));
+        }
+        parent_->transmission_done(true);
+        return exit();
+      }
+      unsigned code = result & DatagramClient::RESPONSE_CODE_MASK;
+      if (!forever_ && (seq_ < 0 || epoch_ != parent_->epoch_)) {
+        // Plain datagrams are not resent. Sequenced ones behind a datagram
+        // that was given up upon would be rejected forever.
+        LOG_ERROR("Failed to send datagram via host channel. Error 0x%x",
+                  result);
+        parent_->transmission_done(false);
+        return exit();
+      }
+      if (code == HostProtocolDefs::ERROR_SEQUENCE) {
+        LOG_ERROR("Host client lost the sequence; resyncing.");
+        parent_->need_resync();
+        parent_->transmission_done(false);
+        return exit();
+      }
+      long long delay = MSEC_TO_NSEC(RETRY_DELAY_MSEC);
+      if (code == openlcb::Defs::ERROR_OUT_OF_ORDER &&
+          ++outOfOrder_ <= MAX_OUT_OF_ORDER) {
+        // Waits for a predecessor that is being resent. This is not this
+        // datagram's fault, so it has a separate, larger limit.
+      } else if (code != openlcb::Defs::ERROR_OUT_OF_ORDER &&
+                 (forever_ || ++retries_ <= MAX_RETRIES)) {
+        delay <<= std::min(retries_, 9u);
+      } else {
+        LOG_ERROR("Giving up on datagram %d via host channel. Error 0x%x",
+                  seq_, result);
+        parent_->need_resync();
+        parent_->transmission_done(false);
+        return exit();
+      }
+      return sleep_and_call(&timer_, delay, STATE(resend));
+    }
+
+    Action caps_done() {
+      parent_->capsWaiter_ = nullptr;
+      parent_->transmission_done(true);
+      return exit();
+    }
+
+    Action resend() {
+      if (!forever_ && epoch_ != parent_->epoch_) {
+        parent_->transmission_done(false);
+        return exit();
+      }
+      ++parent_->numResends_;
+      return call_immediately(STATE(send));
+    }
+
+    HostPacketQueue* parent_;
+    DatagramClient* dg_client_{nullptr};
+    BarrierNotifiable n_;
+    StateFlowTimer timer_{this};
+    int seq_;
+    /// Value of the parent's epoch_ when this was started.
+    unsigned epoch_;
+    unsigned retries_;
+    /// Number of ERROR_OUT_OF_ORDER rejects.
+    unsigned outOfOrder_;
+    bool forever_;
+  };
+
   TrainControlService::Impl* impl() { return service()->impl(); }
   DatagramService* dg_service() { return impl()->dg_service(); }
 
-  Action entry() OVERRIDE {
-    return allocate_and_call(STATE(dg_client_ready),
-                             dg_service()->client_allocator());
-  }
-
-  Action dg_client_ready() {
-    dg_client_ = full_allocation_result(dg_service()->client_allocator());
-    return allocate_and_call(
-        dg_service()->iface()->addressed_message_write_flow(),
-        STATE(buf_ready));
-  }
-
-  Action buf_ready() {
-    auto* b = get_allocation_result(
-        dg_service()->iface()->addressed_message_write_flow());
-    b->data()->reset(openlcb::Defs::MTI_DATAGRAM, impl()->node()->node_id(),
-                     impl()->client_dst_, Payload());
-    b->data()->payload.reserve(1 + message()->data()->size());
-    b->data()->payload.push_back(HostProtocolDefs::CLIENT_DATAGRAM_ID);
-    b->data()->payload.append(*message()->data());
-    release();
-    b->set_done(n_.reset(this));
-    dg_client_->write_datagram(b);
-    return wait_and_call(STATE(send_complete));
-  }
-
-  Action send_complete() {
-    if ((dg_client_->result() & DatagramClient::RESPONSE_CODE_MASK) !=
-        DatagramClient::OPERATION_SUCCESS) {
-      LOG_ERROR("Failed to send datagram via host channel. Error 0x%x",
-          dg_client_->result());
-    } else {
-      is_synced_ = true;
+  /// @returns how many datagrams may be in flight.
+  unsigned window() { return sequenced() ? window_ : 1; }
+
+  /// Receives the CMD_CAPS reply to a plain sync.
+  void packet_arrived(Buffer<string>* b) OVERRIDE {
+    const string& p = *b->data();
+    if (p.size() >= 2) {
+      peerSeq_ = p[1] & HostProtocolDefs::CAP_SEQ;
     }
-    dg_service()->client_allocator()->typed_insert(dg_client_);
-    dg_client_ = nullptr;
-    if (!is_synced_) {
-      return call_immediately(STATE(inject_sync_packet));
-    } else {
-      return exit();
+    b->unref();
+    if (capsWaiter_) {
+      capsWaiter_->caps_arrived();
     }
   }
 
-  Action inject_sync_packet() {
-    return allocate_and_call(this, STATE(sync_packet_allocated));
+  /// @returns true if the packet may share a datagram with other CAN
+  /// packets.
+  static bool packable(const string& p) {
+    return p.size() > 1 && p[0] == CMD_CAN_PKT &&
+           HostProtocolDefs::valid_mcp_frames((const uint8_t*)p.data() + 1,
+                                              p.size() - 1);
   }
 
-  Action sync_packet_allocated() {
-    auto* b = get_allocation_result(this);
-    b->data()->push_back(CMD_SYNC);
-    reset_message(b, -1);
-    return call_immediately(STATE(entry));
+  /// Makes the next datagram go out after a plain CMD_SYNC.
+  void need_resync() {
+    ++epoch_;
+    needSync_ = true;
+    wake();
   }
 
-  bool is_synced_{false};
-  DatagramClient* dg_client_;
-  BarrierNotifiable n_;
+  void transmission_done(bool success) {
+    --numInFlight_;
+    if (success && !isSynced_) {
+      isSynced_ = true;
+    }
+    wake();
+  }
+
+  void wake() {
+    if (waiting_) {
+      waiting_ = false;
+      notify();
+    }
+  }
+
+  Action entry() OVERRIDE {
+    next_ = transfer_message();
+    return call_immediately(STATE(wait_for_window));
+  }
+
+  Action wait_for_window() {
+    bool exclusive = needSync_ || !isSynced_;
+    if (numInFlight_ >= window() || (exclusive && numInFlight_ > 0)) {
+      waiting_ = true;
+      return wait_and_call(STATE(wait_for_window));
+    }
+    if (needSync_) {
+      needSync_ = false;
+      isSynced_ = false;
+      peerSeq_ = false;
+      nextSeq_ = 0;
+      Transmission* t = free_transmission();
+      t->payload_.clear();
+      t->payload_.push_back(HostProtocolDefs::CLIENT_DATAGRAM_ID);
+      t->payload_.push_back(CMD_SYNC);
+      t->payload_.push_back(HostProtocolDefs::HOST_CAP_PACKED);
+      ++numInFlight_;
+      t->start(-1, true);
+      return call_immediately(STATE(wait_for_window));
+    }
+    if (!next_) {
+      return exit();
+    }
+    Transmission* t = free_transmission();
+    string* d = &t->payload_;
+    d->clear();
+    d->push_back(HostProtocolDefs::CLIENT_DATAGRAM_ID);
+    int seq = -1;
+    if (sequenced()) {
+      seq = nextSeq_++;
+      d->push_back(CMD_SEQ);
+      d->push_back(seq);
+    }
+    d->append(*next_->data());
+    bool pack = pack_ && sequenced() && packable(*next_->data());
+    next_->unref();
+    next_ = nullptr;
+    while (true) {
+      {
+        AtomicHolder h(this);
+        if (queue_empty()) break;
+        unsigned priority;
+        next_ = static_cast<Buffer<string>*>(queue_next(&priority));
+      }
+      const string& p = *next_->data();
+      if (!pack || !packable(p) ||
+          d->size() + p.size() - 1 > openlcb::DatagramDefs::MAX_SIZE) {
+        break;
+      }
+      // The frames are appended without their command byte.
+      d->append(p, 1, string::npos);
+      next_->unref();
+      next_ = nullptr;
+    }
+    ++numInFlight_;
+    ++numDatagrams_;
+    t->start(seq, false);
+    return call_immediately(STATE(wait_for_window));
+  }
+
+  Transmission* free_transmission() {
+    for (auto& t : transmissions_) {
+      if (!t->busy()) return t.get();
+    }
+    DIE("no free host transmission");
+  }
+
+  std::vector<std::unique_ptr<Transmission>> transmissions_;
+  /// Packet taken off the queue that did not fit into the last datagram.
+  Buffer<string>* next_{nullptr};
+  unsigned window_{DEFAULT_WINDOW};
+  bool pack_{true};
+  /// A plain CMD_SYNC has to go out before the next datagram.
+  bool needSync_{true};
+  /// The last CMD_SYNC was acknowledged.
+  bool isSynced_{false};
+  /// The flow is waiting for a transmission to finish.
+  bool waiting_{false};
+  /// The client announced CMD_SEQ support after the last sync.
+  bool peerSeq_{false};
+  /// Sync transmission waiting for the CMD_CAPS reply, or nullptr.
+  Transmission* capsWaiter_{nullptr};
+  uint8_t nextSeq_{0};
+  /// Incremented when the sequence restarts.
+  unsigned epoch_{0};
+  unsigned numInFlight_{0};
+  unsigned numDatagrams_{0};
+  unsigned numResends_{0};
 };
 
 class PingResponseFn {
@@ -404,7 +689,8 @@ class ServerFlow : public RpcService::ImplFlowBase,
   void packet_arrived(Buffer<string>* b) OVERRIDE {
     if (packet_filter_(*b->data())) {
       response_packet_ = b;
-      service()->impl()->datagram_handler()->remove_handler(this);
+      service()->impl()->datagram_handler()->remove_handler(this,
+                                                           handlerKey_);
       this->notify();
     } else {
       b->unref();
@@ -429,7 +715,8 @@ class ServerFlow : public RpcService::ImplFlowBase,
     fill_response_ = std::bind(&C::FillResponse, &impl()->layout_state_,
                                std::placeholders::_1, std::placeholders::_2);
     response_packet_ = nullptr;
-    service()->impl()->datagram_handler()->add_handler(this);
+    handlerKey_ = HostPacketIndex::type_key(C::accept_response_type::value);
+    service()->impl()->datagram_handler()->add_handler(this, handlerKey_);
   }
 
   static bool CanPacketFilter(Packet sent, int match_len,
@@ -455,7 +742,8 @@ class ServerFlow : public RpcService::ImplFlowBase,
     fill_response_ = std::bind(&C::FillResponse, &impl()->layout_state_,
                                std::placeholders::_1, std::placeholders::_2);
     response_packet_ = nullptr;
-    service()->impl()->datagram_handler()->add_handler(this);
+    handlerKey_ = HostPacketIndex::can_key(sent_packet);
+    service()->impl()->datagram_handler()->add_handler(this, handlerKey_);
   }
 
   Action response_arrived() {
@@ -488,10 +776,6 @@ class ServerFlow : public RpcService::ImplFlowBase,
 
   Action entry() OVERRIDE {
     const TrainControlRequest* request = &message()->data()->request.request();
-    string debug_req;
-    ::google::protobuf::TextFormat::PrintToString(message()->data()->request,
-                                                  &debug_req);
-    LOG(INFO, "request come: %s", debug_req.c_str());
     TrainControlResponse* response =
         message()->data()->response.mutable_response();
     if (request->has_doping()) {
@@ -682,6 +966,8 @@ class ServerFlow : public RpcService::ImplFlowBase,
   std::function<void(const string&, TrainControlResponse*)> fill_response_;
   string request_packet_;
   Buffer<string>* response_packet_;
+  /// Key under which this flow waits for the response in HostServer.
+  uint64_t handlerKey_;
   DatagramClient* dg_client_;
 };
 
@@ -715,8 +1001,10 @@ void TrainControlService::initialize(openlcb::DatagramService* dg_service,
   impl_->dg_service_ = dg_service;
   impl_->node_ = node;
   impl_->datagram_handler_.reset(new HostServer(this));
-  impl_->datagram_handler_->add_handler(&impl_->state_listener_);
-  impl_->datagram_handler_->add_handler(&impl_->log_output_);
+  impl_->datagram_handler_->add_handler(
+      &impl_->state_listener_, HostPacketIndex::type_key(CMD_CAN_PKT));
+  impl_->datagram_handler_->add_handler(&impl_->log_output_,
+                                        HostPacketIndex::type_key(CMD_VCOM1));
   impl_->host_queue_.reset(new HostPacketQueue(this));
 
   // Parse lokdb.
@@ -727,6 +1015,8 @@ void TrainControlService::initialize(openlcb::DatagramService* dg_service,
   // Login
   auto* b = impl()->host_queue()->alloc();
   b->data()->push_back(CMD_SYNC);
+  // We decode CMD_CAN_PKT datagrams with several frames.
+  b->data()->push_back(HostProtocolDefs::HOST_CAP_PACKED);
   impl()->host_queue()->send(b);
 
   if (query_state) {
@@ -734,6 +1024,33 @@ void TrainControlService::initialize(openlcb::DatagramService* dg_service,
   }
 }
 
+void TrainControlService::set_host_window(unsigned window, bool pack) {
+  executor()->sync_run([this, window, pack]() {
+    impl()->host_queue()->configure(window, pack);
+  });
+}
+
+bool TrainControlService::host_sequenced() {
+  bool ret;
+  executor()->sync_run(
+      [this, &ret]() { ret = impl()->host_queue()->sequenced(); });
+  return ret;
+}
+
+unsigned TrainControlService::num_host_datagrams() {
+  return impl()->host_queue()->num_datagrams();
+}
+
+unsigned TrainControlService::num_host_resends() {
+  return impl()->host_queue()->num_resends();
+}
+
+void TrainControlService::TEST_send_host_packet(const string& packet) {
+  auto* b = impl()->host_queue()->alloc();
+  b->data()->assign(packet);
+  impl()->host_queue()->send(b);
+}
+
 RpcServiceInterface* TrainControlService::create_handler_factory() {
   return new RpcServiceFlowFactory<ServerFlow>(this);
 }
@@ -54,9 +54,30 @@ class TrainControlService : public RpcService {
                   openlcb::NodeHandle client, const string& lokdb_ascii,
                   bool query_state);
 
+  /// Configures how the packets to the MCU are sent. At most window
+  /// datagrams are in flight, each with a sequence number; if pack is true,
+  /// consecutive CAN packets share a datagram. A window of 1 without packing
+  /// sends each packet in a plain datagram of its own. Either way the
+  /// sequenced format is only used once the MCU announced that it
+  /// understands it; older firmware keeps getting plain datagrams, one at a
+  /// time. Call after initialize().
+  void set_host_window(unsigned window, bool pack);
+
+  /// @returns true if the datagrams to the MCU carry sequence numbers.
+  bool host_sequenced();
+
+  /// @returns the number of datagrams sent to the MCU, without resends.
+  unsigned num_host_datagrams();
+
+  /// @returns the number of datagrams that were sent to the MCU again.
+  unsigned num_host_resends();
+
   // Takes ownership of the injected object.
   void TEST_inject_clock(Clock* clock);
 
+  // Queues a packet to the MCU the same way the request handlers do.
+  void TEST_send_host_packet(const string& packet);
+
  private:
   // Initializes handler_factory_ and returns the resulting pointer. This is a
   // trick to hide the actual implementation class in the .cc file.
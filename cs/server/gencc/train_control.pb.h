@@ -1,258 +1,534 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: train_control.proto
 
-#ifndef PROTOBUF_train_5fcontrol_2eproto__INCLUDED
-#define PROTOBUF_train_5fcontrol_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_train_5fcontrol_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_train_5fcontrol_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3000000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3000000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_train_5fcontrol_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_train_5fcontrol_2eproto;
 namespace server {
-
-// Internal implementation detail -- do not call these.
-void protobuf_AddDesc_train_5fcontrol_2eproto();
-void protobuf_AssignDesc_train_5fcontrol_2eproto();
-void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
 class LokStateProto;
+struct LokStateProtoDefaultTypeInternal;
+extern LokStateProtoDefaultTypeInternal _LokStateProto_default_instance_;
 class LokStateProto_Function;
+struct LokStateProto_FunctionDefaultTypeInternal;
+extern LokStateProto_FunctionDefaultTypeInternal _LokStateProto_Function_default_instance_;
 class TinyRpcRequest;
+struct TinyRpcRequestDefaultTypeInternal;
+extern TinyRpcRequestDefaultTypeInternal _TinyRpcRequest_default_instance_;
 class TinyRpcResponse;
+struct TinyRpcResponseDefaultTypeInternal;
+extern TinyRpcResponseDefaultTypeInternal _TinyRpcResponse_default_instance_;
 class TrainControlRequest;
+struct TrainControlRequestDefaultTypeInternal;
+extern TrainControlRequestDefaultTypeInternal _TrainControlRequest_default_instance_;
 class TrainControlRequest_DoChangeSavedState;
+struct TrainControlRequest_DoChangeSavedStateDefaultTypeInternal;
+extern TrainControlRequest_DoChangeSavedStateDefaultTypeInternal _TrainControlRequest_DoChangeSavedState_default_instance_;
 class TrainControlRequest_DoDropState;
+struct TrainControlRequest_DoDropStateDefaultTypeInternal;
+extern TrainControlRequest_DoDropStateDefaultTypeInternal _TrainControlRequest_DoDropState_default_instance_;
 class TrainControlRequest_DoEStopLoco;
+struct TrainControlRequest_DoEStopLocoDefaultTypeInternal;
+extern TrainControlRequest_DoEStopLocoDefaultTypeInternal _TrainControlRequest_DoEStopLoco_default_instance_;
 class TrainControlRequest_DoGetLokDb;
+struct TrainControlRequest_DoGetLokDbDefaultTypeInternal;
+extern TrainControlRequest_DoGetLokDbDefaultTypeInternal _TrainControlRequest_DoGetLokDb_default_instance_;
 class TrainControlRequest_DoGetLokState;
+struct TrainControlRequest_DoGetLokStateDefaultTypeInternal;
+extern TrainControlRequest_DoGetLokStateDefaultTypeInternal _TrainControlRequest_DoGetLokState_default_instance_;
 class TrainControlRequest_DoGetOrSetAddress;
+struct TrainControlRequest_DoGetOrSetAddressDefaultTypeInternal;
+extern TrainControlRequest_DoGetOrSetAddressDefaultTypeInternal _TrainControlRequest_DoGetOrSetAddress_default_instance_;
 class TrainControlRequest_DoGetOrSetCV;
+struct TrainControlRequest_DoGetOrSetCVDefaultTypeInternal;
+extern TrainControlRequest_DoGetOrSetCVDefaultTypeInternal _TrainControlRequest_DoGetOrSetCV_default_instance_;
+class TrainControlRequest_DoGetRpcStats;
+struct TrainControlRequest_DoGetRpcStatsDefaultTypeInternal;
+extern TrainControlRequest_DoGetRpcStatsDefaultTypeInternal _TrainControlRequest_DoGetRpcStats_default_instance_;
 class TrainControlRequest_DoPicMisc;
+struct TrainControlRequest_DoPicMiscDefaultTypeInternal;
+extern TrainControlRequest_DoPicMiscDefaultTypeInternal _TrainControlRequest_DoPicMisc_default_instance_;
 class TrainControlRequest_DoPing;
+struct TrainControlRequest_DoPingDefaultTypeInternal;
+extern TrainControlRequest_DoPingDefaultTypeInternal _TrainControlRequest_DoPing_default_instance_;
 class TrainControlRequest_DoReflashAutomata;
+struct TrainControlRequest_DoReflashAutomataDefaultTypeInternal;
+extern TrainControlRequest_DoReflashAutomataDefaultTypeInternal _TrainControlRequest_DoReflashAutomata_default_instance_;
 class TrainControlRequest_DoReflashPic;
+struct TrainControlRequest_DoReflashPicDefaultTypeInternal;
+extern TrainControlRequest_DoReflashPicDefaultTypeInternal _TrainControlRequest_DoReflashPic_default_instance_;
 class TrainControlRequest_DoRpc;
+struct TrainControlRequest_DoRpcDefaultTypeInternal;
+extern TrainControlRequest_DoRpcDefaultTypeInternal _TrainControlRequest_DoRpc_default_instance_;
 class TrainControlRequest_DoSendRawCanPacket;
+struct TrainControlRequest_DoSendRawCanPacketDefaultTypeInternal;
+extern TrainControlRequest_DoSendRawCanPacketDefaultTypeInternal _TrainControlRequest_DoSendRawCanPacket_default_instance_;
 class TrainControlRequest_DoSetAccessory;
+struct TrainControlRequest_DoSetAccessoryDefaultTypeInternal;
+extern TrainControlRequest_DoSetAccessoryDefaultTypeInternal _TrainControlRequest_DoSetAccessory_default_instance_;
 class TrainControlRequest_DoSetEmergencyStop;
+struct TrainControlRequest_DoSetEmergencyStopDefaultTypeInternal;
+extern TrainControlRequest_DoSetEmergencyStopDefaultTypeInternal _TrainControlRequest_DoSetEmergencyStop_default_instance_;
 class TrainControlRequest_DoSetSpeed;
+struct TrainControlRequest_DoSetSpeedDefaultTypeInternal;
+extern TrainControlRequest_DoSetSpeedDefaultTypeInternal _TrainControlRequest_DoSetSpeed_default_instance_;
 class TrainControlRequest_DoWaitForChange;
+struct TrainControlRequest_DoWaitForChangeDefaultTypeInternal;
+extern TrainControlRequest_DoWaitForChangeDefaultTypeInternal _TrainControlRequest_DoWaitForChange_default_instance_;
 class TrainControlResponse;
+struct TrainControlResponseDefaultTypeInternal;
+extern TrainControlResponseDefaultTypeInternal _TrainControlResponse_default_instance_;
 class TrainControlResponse_Accessory;
+struct TrainControlResponse_AccessoryDefaultTypeInternal;
+extern TrainControlResponse_AccessoryDefaultTypeInternal _TrainControlResponse_Accessory_default_instance_;
 class TrainControlResponse_CurrentAddress;
+struct TrainControlResponse_CurrentAddressDefaultTypeInternal;
+extern TrainControlResponse_CurrentAddressDefaultTypeInternal _TrainControlResponse_CurrentAddress_default_instance_;
 class TrainControlResponse_Cv;
+struct TrainControlResponse_CvDefaultTypeInternal;
+extern TrainControlResponse_CvDefaultTypeInternal _TrainControlResponse_Cv_default_instance_;
 class TrainControlResponse_EmergencyStop;
+struct TrainControlResponse_EmergencyStopDefaultTypeInternal;
+extern TrainControlResponse_EmergencyStopDefaultTypeInternal _TrainControlResponse_EmergencyStop_default_instance_;
 class TrainControlResponse_LokDb;
+struct TrainControlResponse_LokDbDefaultTypeInternal;
+extern TrainControlResponse_LokDbDefaultTypeInternal _TrainControlResponse_LokDb_default_instance_;
 class TrainControlResponse_LokDb_Lok;
+struct TrainControlResponse_LokDb_LokDefaultTypeInternal;
+extern TrainControlResponse_LokDb_LokDefaultTypeInternal _TrainControlResponse_LokDb_Lok_default_instance_;
 class TrainControlResponse_LokDb_Lok_Function;
+struct TrainControlResponse_LokDb_Lok_FunctionDefaultTypeInternal;
+extern TrainControlResponse_LokDb_Lok_FunctionDefaultTypeInternal _TrainControlResponse_LokDb_Lok_Function_default_instance_;
 class TrainControlResponse_PicMisc;
+struct TrainControlResponse_PicMiscDefaultTypeInternal;
+extern TrainControlResponse_PicMiscDefaultTypeInternal _TrainControlResponse_PicMisc_default_instance_;
 class TrainControlResponse_Pong;
+struct TrainControlResponse_PongDefaultTypeInternal;
+extern TrainControlResponse_PongDefaultTypeInternal _TrainControlResponse_Pong_default_instance_;
 class TrainControlResponse_RawCanPacket;
+struct TrainControlResponse_RawCanPacketDefaultTypeInternal;
+extern TrainControlResponse_RawCanPacketDefaultTypeInternal _TrainControlResponse_RawCanPacket_default_instance_;
 class TrainControlResponse_ReflashAutomata;
+struct TrainControlResponse_ReflashAutomataDefaultTypeInternal;
+extern TrainControlResponse_ReflashAutomataDefaultTypeInternal _TrainControlResponse_ReflashAutomata_default_instance_;
 class TrainControlResponse_ReflashPic;
+struct TrainControlResponse_ReflashPicDefaultTypeInternal;
+extern TrainControlResponse_ReflashPicDefaultTypeInternal _TrainControlResponse_ReflashPic_default_instance_;
 class TrainControlResponse_RpcResponse;
+struct TrainControlResponse_RpcResponseDefaultTypeInternal;
+extern TrainControlResponse_RpcResponseDefaultTypeInternal _TrainControlResponse_RpcResponse_default_instance_;
+class TrainControlResponse_RpcStats;
+struct TrainControlResponse_RpcStatsDefaultTypeInternal;
+extern TrainControlResponse_RpcStatsDefaultTypeInternal _TrainControlResponse_RpcStats_default_instance_;
+class TrainControlResponse_RpcStats_Method;
+struct TrainControlResponse_RpcStats_MethodDefaultTypeInternal;
+extern TrainControlResponse_RpcStats_MethodDefaultTypeInternal _TrainControlResponse_RpcStats_Method_default_instance_;
 class TrainControlResponse_Speed;
+struct TrainControlResponse_SpeedDefaultTypeInternal;
+extern TrainControlResponse_SpeedDefaultTypeInternal _TrainControlResponse_Speed_default_instance_;
 class TrainControlResponse_WaitForChangeResponse;
+struct TrainControlResponse_WaitForChangeResponseDefaultTypeInternal;
+extern TrainControlResponse_WaitForChangeResponseDefaultTypeInternal _TrainControlResponse_WaitForChangeResponse_default_instance_;
+}  // namespace server
+PROTOBUF_NAMESPACE_OPEN
+template<> ::server::LokStateProto* Arena::CreateMaybeMessage<::server::LokStateProto>(Arena*);
+template<> ::server::LokStateProto_Function* Arena::CreateMaybeMessage<::server::LokStateProto_Function>(Arena*);
+template<> ::server::TinyRpcRequest* Arena::CreateMaybeMessage<::server::TinyRpcRequest>(Arena*);
+template<> ::server::TinyRpcResponse* Arena::CreateMaybeMessage<::server::TinyRpcResponse>(Arena*);
+template<> ::server::TrainControlRequest* Arena::CreateMaybeMessage<::server::TrainControlRequest>(Arena*);
+template<> ::server::TrainControlRequest_DoChangeSavedState* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoChangeSavedState>(Arena*);
+template<> ::server::TrainControlRequest_DoDropState* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoDropState>(Arena*);
+template<> ::server::TrainControlRequest_DoEStopLoco* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoEStopLoco>(Arena*);
+template<> ::server::TrainControlRequest_DoGetLokDb* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoGetLokDb>(Arena*);
+template<> ::server::TrainControlRequest_DoGetLokState* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoGetLokState>(Arena*);
+template<> ::server::TrainControlRequest_DoGetOrSetAddress* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoGetOrSetAddress>(Arena*);
+template<> ::server::TrainControlRequest_DoGetOrSetCV* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoGetOrSetCV>(Arena*);
+template<> ::server::TrainControlRequest_DoGetRpcStats* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoGetRpcStats>(Arena*);
+template<> ::server::TrainControlRequest_DoPicMisc* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoPicMisc>(Arena*);
+template<> ::server::TrainControlRequest_DoPing* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoPing>(Arena*);
+template<> ::server::TrainControlRequest_DoReflashAutomata* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoReflashAutomata>(Arena*);
+template<> ::server::TrainControlRequest_DoReflashPic* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoReflashPic>(Arena*);
+template<> ::server::TrainControlRequest_DoRpc* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoRpc>(Arena*);
+template<> ::server::TrainControlRequest_DoSendRawCanPacket* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoSendRawCanPacket>(Arena*);
+template<> ::server::TrainControlRequest_DoSetAccessory* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoSetAccessory>(Arena*);
+template<> ::server::TrainControlRequest_DoSetEmergencyStop* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoSetEmergencyStop>(Arena*);
+template<> ::server::TrainControlRequest_DoSetSpeed* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoSetSpeed>(Arena*);
+template<> ::server::TrainControlRequest_DoWaitForChange* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoWaitForChange>(Arena*);
+template<> ::server::TrainControlResponse* Arena::CreateMaybeMessage<::server::TrainControlResponse>(Arena*);
+template<> ::server::TrainControlResponse_Accessory* Arena::CreateMaybeMessage<::server::TrainControlResponse_Accessory>(Arena*);
+template<> ::server::TrainControlResponse_CurrentAddress* Arena::CreateMaybeMessage<::server::TrainControlResponse_CurrentAddress>(Arena*);
+template<> ::server::TrainControlResponse_Cv* Arena::CreateMaybeMessage<::server::TrainControlResponse_Cv>(Arena*);
+template<> ::server::TrainControlResponse_EmergencyStop* Arena::CreateMaybeMessage<::server::TrainControlResponse_EmergencyStop>(Arena*);
+template<> ::server::TrainControlResponse_LokDb* Arena::CreateMaybeMessage<::server::TrainControlResponse_LokDb>(Arena*);
+template<> ::server::TrainControlResponse_LokDb_Lok* Arena::CreateMaybeMessage<::server::TrainControlResponse_LokDb_Lok>(Arena*);
+template<> ::server::TrainControlResponse_LokDb_Lok_Function* Arena::CreateMaybeMessage<::server::TrainControlResponse_LokDb_Lok_Function>(Arena*);
+template<> ::server::TrainControlResponse_PicMisc* Arena::CreateMaybeMessage<::server::TrainControlResponse_PicMisc>(Arena*);
+template<> ::server::TrainControlResponse_Pong* Arena::CreateMaybeMessage<::server::TrainControlResponse_Pong>(Arena*);
+template<> ::server::TrainControlResponse_RawCanPacket* Arena::CreateMaybeMessage<::server::TrainControlResponse_RawCanPacket>(Arena*);
+template<> ::server::TrainControlResponse_ReflashAutomata* Arena::CreateMaybeMessage<::server::TrainControlResponse_ReflashAutomata>(Arena*);
+template<> ::server::TrainControlResponse_ReflashPic* Arena::CreateMaybeMessage<::server::TrainControlResponse_ReflashPic>(Arena*);
+template<> ::server::TrainControlResponse_RpcResponse* Arena::CreateMaybeMessage<::server::TrainControlResponse_RpcResponse>(Arena*);
+template<> ::server::TrainControlResponse_RpcStats* Arena::CreateMaybeMessage<::server::TrainControlResponse_RpcStats>(Arena*);
+template<> ::server::TrainControlResponse_RpcStats_Method* Arena::CreateMaybeMessage<::server::TrainControlResponse_RpcStats_Method>(Arena*);
+template<> ::server::TrainControlResponse_Speed* Arena::CreateMaybeMessage<::server::TrainControlResponse_Speed>(Arena*);
+template<> ::server::TrainControlResponse_WaitForChangeResponse* Arena::CreateMaybeMessage<::server::TrainControlResponse_WaitForChangeResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace server {
 
 // ===================================================================
 
-class LokStateProto_Function : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.LokStateProto.Function) */ {
+class LokStateProto_Function final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.LokStateProto.Function) */ {
  public:
-  LokStateProto_Function();
-  virtual ~LokStateProto_Function();
+  inline LokStateProto_Function() : LokStateProto_Function(nullptr) {}
+  ~LokStateProto_Function() override;
+  explicit PROTOBUF_CONSTEXPR LokStateProto_Function(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LokStateProto_Function(const LokStateProto_Function& from);
+  LokStateProto_Function(LokStateProto_Function&& from) noexcept
+    : LokStateProto_Function() {
+    *this = ::std::move(from);
+  }
 
   inline LokStateProto_Function& operator=(const LokStateProto_Function& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline LokStateProto_Function& operator=(LokStateProto_Function&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LokStateProto_Function& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LokStateProto_Function& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LokStateProto_Function* internal_default_instance() {
+    return reinterpret_cast<const LokStateProto_Function*>(
+               &_LokStateProto_Function_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(LokStateProto_Function* other);
+  friend void swap(LokStateProto_Function& a, LokStateProto_Function& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LokStateProto_Function* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LokStateProto_Function* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LokStateProto_Function* New() const { return New(NULL); }
-
-  LokStateProto_Function* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  LokStateProto_Function* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LokStateProto_Function>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LokStateProto_Function& from);
-  void MergeFrom(const LokStateProto_Function& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LokStateProto_Function& from) {
+    LokStateProto_Function::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(LokStateProto_Function* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.LokStateProto.Function";
   }
+  protected:
+  explicit LokStateProto_Function(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kIdFieldNumber = 5,
+    kValueFieldNumber = 6,
+    kTsFieldNumber = 8,
+  };
   // required int32 id = 5;
   bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
   void clear_id();
-  static const int kIdFieldNumber = 5;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // optional int32 value = 6;
   bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
   void clear_value();
-  static const int kValueFieldNumber = 6;
-  ::google::protobuf::int32 value() const;
-  void set_value(::google::protobuf::int32 value);
+  int32_t value() const;
+  void set_value(int32_t value);
+  private:
+  int32_t _internal_value() const;
+  void _internal_set_value(int32_t value);
+  public:
 
   // optional int64 ts = 8;
   bool has_ts() const;
+  private:
+  bool _internal_has_ts() const;
+  public:
   void clear_ts();
-  static const int kTsFieldNumber = 8;
-  ::google::protobuf::int64 ts() const;
-  void set_ts(::google::protobuf::int64 value);
+  int64_t ts() const;
+  void set_ts(int64_t value);
+  private:
+  int64_t _internal_ts() const;
+  void _internal_set_ts(int64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.LokStateProto.Function)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_value();
-  inline void clear_has_value();
-  inline void set_has_ts();
-  inline void clear_has_ts();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 id_;
-  ::google::protobuf::int32 value_;
-  ::google::protobuf::int64 ts_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static LokStateProto_Function* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t id_;
+    int32_t value_;
+    int64_t ts_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LokStateProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.LokStateProto) */ {
+class LokStateProto final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.LokStateProto) */ {
  public:
-  LokStateProto();
-  virtual ~LokStateProto();
+  inline LokStateProto() : LokStateProto(nullptr) {}
+  ~LokStateProto() override;
+  explicit PROTOBUF_CONSTEXPR LokStateProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LokStateProto(const LokStateProto& from);
+  LokStateProto(LokStateProto&& from) noexcept
+    : LokStateProto() {
+    *this = ::std::move(from);
+  }
 
   inline LokStateProto& operator=(const LokStateProto& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline LokStateProto& operator=(LokStateProto&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LokStateProto& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LokStateProto& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LokStateProto* internal_default_instance() {
+    return reinterpret_cast<const LokStateProto*>(
+               &_LokStateProto_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(LokStateProto* other);
+  friend void swap(LokStateProto& a, LokStateProto& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LokStateProto* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LokStateProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LokStateProto* New() const { return New(NULL); }
-
-  LokStateProto* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  LokStateProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LokStateProto>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LokStateProto& from);
-  void MergeFrom(const LokStateProto& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LokStateProto& from) {
+    LokStateProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(LokStateProto* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.LokStateProto";
   }
+  protected:
+  explicit LokStateProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -260,794 +536,1321 @@ class LokStateProto : public ::google::protobuf::Message /* @@protoc_insertion_p
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kFunctionFieldNumber = 4,
+    kIdFieldNumber = 1,
+    kSpeedFieldNumber = 3,
+    kTsFieldNumber = 7,
+    kSpeedTsFieldNumber = 9,
+    kDirFieldNumber = 2,
+  };
+  // repeated group Function = 4 { ... };
+  int function_size() const;
+  private:
+  int _internal_function_size() const;
+  public:
+  void clear_function();
+  ::server::LokStateProto_Function* mutable_function(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto_Function >*
+      mutable_function();
+  private:
+  const ::server::LokStateProto_Function& _internal_function(int index) const;
+  ::server::LokStateProto_Function* _internal_add_function();
+  public:
+  const ::server::LokStateProto_Function& function(int index) const;
+  ::server::LokStateProto_Function* add_function();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto_Function >&
+      function() const;
+
   // required int32 id = 1;
   bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
   void clear_id();
-  static const int kIdFieldNumber = 1;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
-
-  // optional int32 dir = 2 [default = 1];
-  bool has_dir() const;
-  void clear_dir();
-  static const int kDirFieldNumber = 2;
-  ::google::protobuf::int32 dir() const;
-  void set_dir(::google::protobuf::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // optional int32 speed = 3;
   bool has_speed() const;
+  private:
+  bool _internal_has_speed() const;
+  public:
   void clear_speed();
-  static const int kSpeedFieldNumber = 3;
-  ::google::protobuf::int32 speed() const;
-  void set_speed(::google::protobuf::int32 value);
+  int32_t speed() const;
+  void set_speed(int32_t value);
+  private:
+  int32_t _internal_speed() const;
+  void _internal_set_speed(int32_t value);
+  public:
+
+  // optional int64 ts = 7;
+  bool has_ts() const;
+  private:
+  bool _internal_has_ts() const;
+  public:
+  void clear_ts();
+  int64_t ts() const;
+  void set_ts(int64_t value);
+  private:
+  int64_t _internal_ts() const;
+  void _internal_set_ts(int64_t value);
+  public:
 
   // optional int64 speed_ts = 9;
   bool has_speed_ts() const;
+  private:
+  bool _internal_has_speed_ts() const;
+  public:
   void clear_speed_ts();
-  static const int kSpeedTsFieldNumber = 9;
-  ::google::protobuf::int64 speed_ts() const;
-  void set_speed_ts(::google::protobuf::int64 value);
-
-  // repeated group Function = 4 { ... };
-  int function_size() const;
-  void clear_function();
-  static const int kFunctionFieldNumber = 4;
-  const ::server::LokStateProto_Function& function(int index) const;
-  ::server::LokStateProto_Function* mutable_function(int index);
-  ::server::LokStateProto_Function* add_function();
-  ::google::protobuf::RepeatedPtrField< ::server::LokStateProto_Function >*
-      mutable_function();
-  const ::google::protobuf::RepeatedPtrField< ::server::LokStateProto_Function >&
-      function() const;
+  int64_t speed_ts() const;
+  void set_speed_ts(int64_t value);
+  private:
+  int64_t _internal_speed_ts() const;
+  void _internal_set_speed_ts(int64_t value);
+  public:
 
-  // optional int64 ts = 7;
-  bool has_ts() const;
-  void clear_ts();
-  static const int kTsFieldNumber = 7;
-  ::google::protobuf::int64 ts() const;
-  void set_ts(::google::protobuf::int64 value);
+  // optional int32 dir = 2 [default = 1];
+  bool has_dir() const;
+  private:
+  bool _internal_has_dir() const;
+  public:
+  void clear_dir();
+  int32_t dir() const;
+  void set_dir(int32_t value);
+  private:
+  int32_t _internal_dir() const;
+  void _internal_set_dir(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.LokStateProto)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_dir();
-  inline void clear_has_dir();
-  inline void set_has_speed();
-  inline void clear_has_speed();
-  inline void set_has_speed_ts();
-  inline void clear_has_speed_ts();
-  inline void set_has_ts();
-  inline void clear_has_ts();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 id_;
-  ::google::protobuf::int32 dir_;
-  ::google::protobuf::int64 speed_ts_;
-  ::google::protobuf::RepeatedPtrField< ::server::LokStateProto_Function > function_;
-  ::google::protobuf::int64 ts_;
-  ::google::protobuf::int32 speed_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static LokStateProto* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto_Function > function_;
+    int32_t id_;
+    int32_t speed_;
+    int64_t ts_;
+    int64_t speed_ts_;
+    int32_t dir_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoSetSpeed : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoSetSpeed) */ {
+class TrainControlRequest_DoSetSpeed final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoSetSpeed) */ {
  public:
-  TrainControlRequest_DoSetSpeed();
-  virtual ~TrainControlRequest_DoSetSpeed();
+  inline TrainControlRequest_DoSetSpeed() : TrainControlRequest_DoSetSpeed(nullptr) {}
+  ~TrainControlRequest_DoSetSpeed() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoSetSpeed(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoSetSpeed(const TrainControlRequest_DoSetSpeed& from);
+  TrainControlRequest_DoSetSpeed(TrainControlRequest_DoSetSpeed&& from) noexcept
+    : TrainControlRequest_DoSetSpeed() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoSetSpeed& operator=(const TrainControlRequest_DoSetSpeed& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoSetSpeed& operator=(TrainControlRequest_DoSetSpeed&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoSetSpeed& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoSetSpeed& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoSetSpeed* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoSetSpeed*>(
+               &_TrainControlRequest_DoSetSpeed_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(TrainControlRequest_DoSetSpeed* other);
+  friend void swap(TrainControlRequest_DoSetSpeed& a, TrainControlRequest_DoSetSpeed& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoSetSpeed* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoSetSpeed* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoSetSpeed* New() const { return New(NULL); }
-
-  TrainControlRequest_DoSetSpeed* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoSetSpeed* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoSetSpeed>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoSetSpeed& from);
-  void MergeFrom(const TrainControlRequest_DoSetSpeed& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoSetSpeed& from) {
+    TrainControlRequest_DoSetSpeed::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoSetSpeed* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoSetSpeed";
   }
+  protected:
+  explicit TrainControlRequest_DoSetSpeed(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kIdFieldNumber = 2,
+    kSpeedFieldNumber = 3,
+    kDirFieldNumber = 36,
+  };
   // required int32 id = 2;
   bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
   void clear_id();
-  static const int kIdFieldNumber = 2;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
-
-  // optional int32 dir = 36 [default = 1];
-  bool has_dir() const;
-  void clear_dir();
-  static const int kDirFieldNumber = 36;
-  ::google::protobuf::int32 dir() const;
-  void set_dir(::google::protobuf::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // optional int32 speed = 3;
   bool has_speed() const;
+  private:
+  bool _internal_has_speed() const;
+  public:
   void clear_speed();
-  static const int kSpeedFieldNumber = 3;
-  ::google::protobuf::int32 speed() const;
-  void set_speed(::google::protobuf::int32 value);
+  int32_t speed() const;
+  void set_speed(int32_t value);
+  private:
+  int32_t _internal_speed() const;
+  void _internal_set_speed(int32_t value);
+  public:
+
+  // optional int32 dir = 36 [default = 1];
+  bool has_dir() const;
+  private:
+  bool _internal_has_dir() const;
+  public:
+  void clear_dir();
+  int32_t dir() const;
+  void set_dir(int32_t value);
+  private:
+  int32_t _internal_dir() const;
+  void _internal_set_dir(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoSetSpeed)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_dir();
-  inline void clear_has_dir();
-  inline void set_has_speed();
-  inline void clear_has_speed();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 id_;
-  ::google::protobuf::int32 dir_;
-  ::google::protobuf::int32 speed_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoSetSpeed* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t id_;
+    int32_t speed_;
+    int32_t dir_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoSetAccessory : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoSetAccessory) */ {
+class TrainControlRequest_DoSetAccessory final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoSetAccessory) */ {
  public:
-  TrainControlRequest_DoSetAccessory();
-  virtual ~TrainControlRequest_DoSetAccessory();
+  inline TrainControlRequest_DoSetAccessory() : TrainControlRequest_DoSetAccessory(nullptr) {}
+  ~TrainControlRequest_DoSetAccessory() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoSetAccessory(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoSetAccessory(const TrainControlRequest_DoSetAccessory& from);
+  TrainControlRequest_DoSetAccessory(TrainControlRequest_DoSetAccessory&& from) noexcept
+    : TrainControlRequest_DoSetAccessory() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoSetAccessory& operator=(const TrainControlRequest_DoSetAccessory& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoSetAccessory& operator=(TrainControlRequest_DoSetAccessory&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoSetAccessory& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoSetAccessory& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoSetAccessory* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoSetAccessory*>(
+               &_TrainControlRequest_DoSetAccessory_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(TrainControlRequest_DoSetAccessory* other);
+  friend void swap(TrainControlRequest_DoSetAccessory& a, TrainControlRequest_DoSetAccessory& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoSetAccessory* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoSetAccessory* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoSetAccessory* New() const { return New(NULL); }
-
-  TrainControlRequest_DoSetAccessory* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoSetAccessory* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoSetAccessory>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoSetAccessory& from);
-  void MergeFrom(const TrainControlRequest_DoSetAccessory& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoSetAccessory& from) {
+    TrainControlRequest_DoSetAccessory::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoSetAccessory* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoSetAccessory";
   }
+  protected:
+  explicit TrainControlRequest_DoSetAccessory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTrainIdFieldNumber = 5,
+    kAccessoryIdFieldNumber = 6,
+    kValueFieldNumber = 7,
+  };
   // required int32 train_id = 5;
   bool has_train_id() const;
+  private:
+  bool _internal_has_train_id() const;
+  public:
   void clear_train_id();
-  static const int kTrainIdFieldNumber = 5;
-  ::google::protobuf::int32 train_id() const;
-  void set_train_id(::google::protobuf::int32 value);
+  int32_t train_id() const;
+  void set_train_id(int32_t value);
+  private:
+  int32_t _internal_train_id() const;
+  void _internal_set_train_id(int32_t value);
+  public:
 
   // required int32 accessory_id = 6;
   bool has_accessory_id() const;
+  private:
+  bool _internal_has_accessory_id() const;
+  public:
   void clear_accessory_id();
-  static const int kAccessoryIdFieldNumber = 6;
-  ::google::protobuf::int32 accessory_id() const;
-  void set_accessory_id(::google::protobuf::int32 value);
+  int32_t accessory_id() const;
+  void set_accessory_id(int32_t value);
+  private:
+  int32_t _internal_accessory_id() const;
+  void _internal_set_accessory_id(int32_t value);
+  public:
 
   // optional int32 value = 7;
   bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
   void clear_value();
-  static const int kValueFieldNumber = 7;
-  ::google::protobuf::int32 value() const;
-  void set_value(::google::protobuf::int32 value);
+  int32_t value() const;
+  void set_value(int32_t value);
+  private:
+  int32_t _internal_value() const;
+  void _internal_set_value(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoSetAccessory)
  private:
-  inline void set_has_train_id();
-  inline void clear_has_train_id();
-  inline void set_has_accessory_id();
-  inline void clear_has_accessory_id();
-  inline void set_has_value();
-  inline void clear_has_value();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 train_id_;
-  ::google::protobuf::int32 accessory_id_;
-  ::google::protobuf::int32 value_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoSetAccessory* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t train_id_;
+    int32_t accessory_id_;
+    int32_t value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoSetEmergencyStop : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoSetEmergencyStop) */ {
+class TrainControlRequest_DoSetEmergencyStop final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoSetEmergencyStop) */ {
  public:
-  TrainControlRequest_DoSetEmergencyStop();
-  virtual ~TrainControlRequest_DoSetEmergencyStop();
+  inline TrainControlRequest_DoSetEmergencyStop() : TrainControlRequest_DoSetEmergencyStop(nullptr) {}
+  ~TrainControlRequest_DoSetEmergencyStop() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoSetEmergencyStop(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoSetEmergencyStop(const TrainControlRequest_DoSetEmergencyStop& from);
+  TrainControlRequest_DoSetEmergencyStop(TrainControlRequest_DoSetEmergencyStop&& from) noexcept
+    : TrainControlRequest_DoSetEmergencyStop() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoSetEmergencyStop& operator=(const TrainControlRequest_DoSetEmergencyStop& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoSetEmergencyStop& operator=(TrainControlRequest_DoSetEmergencyStop&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoSetEmergencyStop& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoSetEmergencyStop& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoSetEmergencyStop* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoSetEmergencyStop*>(
+               &_TrainControlRequest_DoSetEmergencyStop_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(TrainControlRequest_DoSetEmergencyStop* other);
+  friend void swap(TrainControlRequest_DoSetEmergencyStop& a, TrainControlRequest_DoSetEmergencyStop& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoSetEmergencyStop* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoSetEmergencyStop* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoSetEmergencyStop* New() const { return New(NULL); }
-
-  TrainControlRequest_DoSetEmergencyStop* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoSetEmergencyStop* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoSetEmergencyStop>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoSetEmergencyStop& from);
-  void MergeFrom(const TrainControlRequest_DoSetEmergencyStop& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoSetEmergencyStop& from) {
+    TrainControlRequest_DoSetEmergencyStop::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoSetEmergencyStop* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoSetEmergencyStop";
   }
+  protected:
+  explicit TrainControlRequest_DoSetEmergencyStop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kStopFieldNumber = 9,
+  };
   // optional bool stop = 9;
   bool has_stop() const;
+  private:
+  bool _internal_has_stop() const;
+  public:
   void clear_stop();
-  static const int kStopFieldNumber = 9;
   bool stop() const;
   void set_stop(bool value);
+  private:
+  bool _internal_stop() const;
+  void _internal_set_stop(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoSetEmergencyStop)
  private:
-  inline void set_has_stop();
-  inline void clear_has_stop();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  bool stop_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoSetEmergencyStop* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool stop_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoRpc : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoRpc) */ {
+class TrainControlRequest_DoRpc final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoRpc) */ {
  public:
-  TrainControlRequest_DoRpc();
-  virtual ~TrainControlRequest_DoRpc();
+  inline TrainControlRequest_DoRpc() : TrainControlRequest_DoRpc(nullptr) {}
+  ~TrainControlRequest_DoRpc() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoRpc(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoRpc(const TrainControlRequest_DoRpc& from);
+  TrainControlRequest_DoRpc(TrainControlRequest_DoRpc&& from) noexcept
+    : TrainControlRequest_DoRpc() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoRpc& operator=(const TrainControlRequest_DoRpc& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoRpc& operator=(TrainControlRequest_DoRpc&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoRpc& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoRpc& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoRpc* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoRpc*>(
+               &_TrainControlRequest_DoRpc_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(TrainControlRequest_DoRpc* other);
+  friend void swap(TrainControlRequest_DoRpc& a, TrainControlRequest_DoRpc& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoRpc* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoRpc* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoRpc* New() const { return New(NULL); }
-
-  TrainControlRequest_DoRpc* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoRpc* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoRpc>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoRpc& from);
-  void MergeFrom(const TrainControlRequest_DoRpc& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoRpc& from) {
+    TrainControlRequest_DoRpc::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoRpc* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoRpc";
   }
+  protected:
+  explicit TrainControlRequest_DoRpc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 destination_address = 17;
-  bool has_destination_address() const;
-  void clear_destination_address();
-  static const int kDestinationAddressFieldNumber = 17;
-  ::google::protobuf::int32 destination_address() const;
-  void set_destination_address(::google::protobuf::int32 value);
-
-  // required int32 command = 18;
-  bool has_command() const;
-  void clear_command();
-  static const int kCommandFieldNumber = 18;
-  ::google::protobuf::int32 command() const;
-  void set_command(::google::protobuf::int32 value);
+  enum : int {
+    kPayloadFieldNumber = 60,
+    kDestinationAddressFieldNumber = 17,
+    kCommandFieldNumber = 18,
+    kArg1FieldNumber = 19,
+    kArg2FieldNumber = 20,
+  };
+  // repeated int32 payload = 60;
+  int payload_size() const;
+  private:
+  int _internal_payload_size() const;
+  public:
+  void clear_payload();
+  private:
+  int32_t _internal_payload(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_payload() const;
+  void _internal_add_payload(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_payload();
+  public:
+  int32_t payload(int index) const;
+  void set_payload(int index, int32_t value);
+  void add_payload(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      payload() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_payload();
+
+  // required int32 destination_address = 17;
+  bool has_destination_address() const;
+  private:
+  bool _internal_has_destination_address() const;
+  public:
+  void clear_destination_address();
+  int32_t destination_address() const;
+  void set_destination_address(int32_t value);
+  private:
+  int32_t _internal_destination_address() const;
+  void _internal_set_destination_address(int32_t value);
+  public:
+
+  // required int32 command = 18;
+  bool has_command() const;
+  private:
+  bool _internal_has_command() const;
+  public:
+  void clear_command();
+  int32_t command() const;
+  void set_command(int32_t value);
+  private:
+  int32_t _internal_command() const;
+  void _internal_set_command(int32_t value);
+  public:
 
   // required int32 arg1 = 19;
   bool has_arg1() const;
+  private:
+  bool _internal_has_arg1() const;
+  public:
   void clear_arg1();
-  static const int kArg1FieldNumber = 19;
-  ::google::protobuf::int32 arg1() const;
-  void set_arg1(::google::protobuf::int32 value);
+  int32_t arg1() const;
+  void set_arg1(int32_t value);
+  private:
+  int32_t _internal_arg1() const;
+  void _internal_set_arg1(int32_t value);
+  public:
 
   // required int32 arg2 = 20;
   bool has_arg2() const;
+  private:
+  bool _internal_has_arg2() const;
+  public:
   void clear_arg2();
-  static const int kArg2FieldNumber = 20;
-  ::google::protobuf::int32 arg2() const;
-  void set_arg2(::google::protobuf::int32 value);
-
-  // repeated int32 payload = 60;
-  int payload_size() const;
-  void clear_payload();
-  static const int kPayloadFieldNumber = 60;
-  ::google::protobuf::int32 payload(int index) const;
-  void set_payload(int index, ::google::protobuf::int32 value);
-  void add_payload(::google::protobuf::int32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-      payload() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-      mutable_payload();
+  int32_t arg2() const;
+  void set_arg2(int32_t value);
+  private:
+  int32_t _internal_arg2() const;
+  void _internal_set_arg2(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoRpc)
  private:
-  inline void set_has_destination_address();
-  inline void clear_has_destination_address();
-  inline void set_has_command();
-  inline void clear_has_command();
-  inline void set_has_arg1();
-  inline void clear_has_arg1();
-  inline void set_has_arg2();
-  inline void clear_has_arg2();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 destination_address_;
-  ::google::protobuf::int32 command_;
-  ::google::protobuf::int32 arg1_;
-  ::google::protobuf::int32 arg2_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > payload_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoRpc* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > payload_;
+    int32_t destination_address_;
+    int32_t command_;
+    int32_t arg1_;
+    int32_t arg2_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoPing : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoPing) */ {
+class TrainControlRequest_DoPing final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoPing) */ {
  public:
-  TrainControlRequest_DoPing();
-  virtual ~TrainControlRequest_DoPing();
+  inline TrainControlRequest_DoPing() : TrainControlRequest_DoPing(nullptr) {}
+  ~TrainControlRequest_DoPing() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoPing(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoPing(const TrainControlRequest_DoPing& from);
+  TrainControlRequest_DoPing(TrainControlRequest_DoPing&& from) noexcept
+    : TrainControlRequest_DoPing() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoPing& operator=(const TrainControlRequest_DoPing& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoPing& operator=(TrainControlRequest_DoPing&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoPing& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoPing& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoPing* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoPing*>(
+               &_TrainControlRequest_DoPing_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(TrainControlRequest_DoPing* other);
+  friend void swap(TrainControlRequest_DoPing& a, TrainControlRequest_DoPing& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoPing* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoPing* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoPing* New() const { return New(NULL); }
-
-  TrainControlRequest_DoPing* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoPing* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoPing>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoPing& from);
-  void MergeFrom(const TrainControlRequest_DoPing& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoPing& from) {
+    TrainControlRequest_DoPing::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoPing* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoPing";
   }
+  protected:
+  explicit TrainControlRequest_DoPing(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kValueFieldNumber = 22,
+  };
   // optional int32 value = 22 [default = 0];
   bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
   void clear_value();
-  static const int kValueFieldNumber = 22;
-  ::google::protobuf::int32 value() const;
-  void set_value(::google::protobuf::int32 value);
+  int32_t value() const;
+  void set_value(int32_t value);
+  private:
+  int32_t _internal_value() const;
+  void _internal_set_value(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoPing)
  private:
-  inline void set_has_value();
-  inline void clear_has_value();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 value_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoPing* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoGetOrSetAddress : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoGetOrSetAddress) */ {
+class TrainControlRequest_DoGetOrSetAddress final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoGetOrSetAddress) */ {
  public:
-  TrainControlRequest_DoGetOrSetAddress();
-  virtual ~TrainControlRequest_DoGetOrSetAddress();
+  inline TrainControlRequest_DoGetOrSetAddress() : TrainControlRequest_DoGetOrSetAddress(nullptr) {}
+  ~TrainControlRequest_DoGetOrSetAddress() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoGetOrSetAddress(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoGetOrSetAddress(const TrainControlRequest_DoGetOrSetAddress& from);
+  TrainControlRequest_DoGetOrSetAddress(TrainControlRequest_DoGetOrSetAddress&& from) noexcept
+    : TrainControlRequest_DoGetOrSetAddress() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoGetOrSetAddress& operator=(const TrainControlRequest_DoGetOrSetAddress& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoGetOrSetAddress& operator=(TrainControlRequest_DoGetOrSetAddress&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoGetOrSetAddress& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoGetOrSetAddress& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoGetOrSetAddress* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoGetOrSetAddress*>(
+               &_TrainControlRequest_DoGetOrSetAddress_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(TrainControlRequest_DoGetOrSetAddress* other);
+  friend void swap(TrainControlRequest_DoGetOrSetAddress& a, TrainControlRequest_DoGetOrSetAddress& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoGetOrSetAddress* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoGetOrSetAddress* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoGetOrSetAddress* New() const { return New(NULL); }
-
-  TrainControlRequest_DoGetOrSetAddress* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoGetOrSetAddress* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoGetOrSetAddress>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoGetOrSetAddress& from);
-  void MergeFrom(const TrainControlRequest_DoGetOrSetAddress& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoGetOrSetAddress& from) {
+    TrainControlRequest_DoGetOrSetAddress::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoGetOrSetAddress* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoGetOrSetAddress";
   }
+  protected:
+  explicit TrainControlRequest_DoGetOrSetAddress(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNewAddressFieldNumber = 24,
+  };
   // optional int32 new_address = 24;
   bool has_new_address() const;
+  private:
+  bool _internal_has_new_address() const;
+  public:
   void clear_new_address();
-  static const int kNewAddressFieldNumber = 24;
-  ::google::protobuf::int32 new_address() const;
-  void set_new_address(::google::protobuf::int32 value);
+  int32_t new_address() const;
+  void set_new_address(int32_t value);
+  private:
+  int32_t _internal_new_address() const;
+  void _internal_set_new_address(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoGetOrSetAddress)
  private:
-  inline void set_has_new_address();
-  inline void clear_has_new_address();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 new_address_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoGetOrSetAddress* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t new_address_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoDropState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoDropState) */ {
+class TrainControlRequest_DoDropState final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoDropState) */ {
  public:
-  TrainControlRequest_DoDropState();
-  virtual ~TrainControlRequest_DoDropState();
+  inline TrainControlRequest_DoDropState() : TrainControlRequest_DoDropState(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoDropState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoDropState(const TrainControlRequest_DoDropState& from);
+  TrainControlRequest_DoDropState(TrainControlRequest_DoDropState&& from) noexcept
+    : TrainControlRequest_DoDropState() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoDropState& operator=(const TrainControlRequest_DoDropState& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoDropState& operator=(TrainControlRequest_DoDropState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoDropState& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoDropState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoDropState* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoDropState*>(
+               &_TrainControlRequest_DoDropState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void Swap(TrainControlRequest_DoDropState* other);
+  friend void swap(TrainControlRequest_DoDropState& a, TrainControlRequest_DoDropState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoDropState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoDropState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoDropState* New() const { return New(NULL); }
-
-  TrainControlRequest_DoDropState* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const TrainControlRequest_DoDropState& from);
-  void MergeFrom(const TrainControlRequest_DoDropState& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(TrainControlRequest_DoDropState* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
+  TrainControlRequest_DoDropState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoDropState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const TrainControlRequest_DoDropState& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
   }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const TrainControlRequest_DoDropState& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoDropState";
   }
+  protected:
+  explicit TrainControlRequest_DoDropState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1055,465 +1858,765 @@ class TrainControlRequest_DoDropState : public ::google::protobuf::Message /* @@
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoDropState)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoDropState* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoChangeSavedState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoChangeSavedState) */ {
+class TrainControlRequest_DoChangeSavedState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoChangeSavedState) */ {
  public:
-  TrainControlRequest_DoChangeSavedState();
-  virtual ~TrainControlRequest_DoChangeSavedState();
+  inline TrainControlRequest_DoChangeSavedState() : TrainControlRequest_DoChangeSavedState(nullptr) {}
+  ~TrainControlRequest_DoChangeSavedState() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoChangeSavedState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoChangeSavedState(const TrainControlRequest_DoChangeSavedState& from);
+  TrainControlRequest_DoChangeSavedState(TrainControlRequest_DoChangeSavedState&& from) noexcept
+    : TrainControlRequest_DoChangeSavedState() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoChangeSavedState& operator=(const TrainControlRequest_DoChangeSavedState& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoChangeSavedState& operator=(TrainControlRequest_DoChangeSavedState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoChangeSavedState& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoChangeSavedState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoChangeSavedState* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoChangeSavedState*>(
+               &_TrainControlRequest_DoChangeSavedState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  void Swap(TrainControlRequest_DoChangeSavedState* other);
+  friend void swap(TrainControlRequest_DoChangeSavedState& a, TrainControlRequest_DoChangeSavedState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoChangeSavedState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoChangeSavedState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoChangeSavedState* New() const { return New(NULL); }
-
-  TrainControlRequest_DoChangeSavedState* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoChangeSavedState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoChangeSavedState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoChangeSavedState& from);
-  void MergeFrom(const TrainControlRequest_DoChangeSavedState& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoChangeSavedState& from) {
+    TrainControlRequest_DoChangeSavedState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoChangeSavedState* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoChangeSavedState";
   }
+  protected:
+  explicit TrainControlRequest_DoChangeSavedState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kClientIdFieldNumber = 27,
+    kOffsetFieldNumber = 28,
+    kNewValueFieldNumber = 29,
+    kBitsToSetFieldNumber = 30,
+    kBitsToClearFieldNumber = 31,
+  };
   // required int32 client_id = 27;
   bool has_client_id() const;
+  private:
+  bool _internal_has_client_id() const;
+  public:
   void clear_client_id();
-  static const int kClientIdFieldNumber = 27;
-  ::google::protobuf::int32 client_id() const;
-  void set_client_id(::google::protobuf::int32 value);
+  int32_t client_id() const;
+  void set_client_id(int32_t value);
+  private:
+  int32_t _internal_client_id() const;
+  void _internal_set_client_id(int32_t value);
+  public:
 
   // required int32 offset = 28;
   bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
   void clear_offset();
-  static const int kOffsetFieldNumber = 28;
-  ::google::protobuf::int32 offset() const;
-  void set_offset(::google::protobuf::int32 value);
+  int32_t offset() const;
+  void set_offset(int32_t value);
+  private:
+  int32_t _internal_offset() const;
+  void _internal_set_offset(int32_t value);
+  public:
 
   // optional int32 new_value = 29;
   bool has_new_value() const;
+  private:
+  bool _internal_has_new_value() const;
+  public:
   void clear_new_value();
-  static const int kNewValueFieldNumber = 29;
-  ::google::protobuf::int32 new_value() const;
-  void set_new_value(::google::protobuf::int32 value);
+  int32_t new_value() const;
+  void set_new_value(int32_t value);
+  private:
+  int32_t _internal_new_value() const;
+  void _internal_set_new_value(int32_t value);
+  public:
 
   // optional int32 bits_to_set = 30 [default = 0];
   bool has_bits_to_set() const;
+  private:
+  bool _internal_has_bits_to_set() const;
+  public:
   void clear_bits_to_set();
-  static const int kBitsToSetFieldNumber = 30;
-  ::google::protobuf::int32 bits_to_set() const;
-  void set_bits_to_set(::google::protobuf::int32 value);
+  int32_t bits_to_set() const;
+  void set_bits_to_set(int32_t value);
+  private:
+  int32_t _internal_bits_to_set() const;
+  void _internal_set_bits_to_set(int32_t value);
+  public:
 
   // optional int32 bits_to_clear = 31 [default = 0];
   bool has_bits_to_clear() const;
+  private:
+  bool _internal_has_bits_to_clear() const;
+  public:
   void clear_bits_to_clear();
-  static const int kBitsToClearFieldNumber = 31;
-  ::google::protobuf::int32 bits_to_clear() const;
-  void set_bits_to_clear(::google::protobuf::int32 value);
+  int32_t bits_to_clear() const;
+  void set_bits_to_clear(int32_t value);
+  private:
+  int32_t _internal_bits_to_clear() const;
+  void _internal_set_bits_to_clear(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoChangeSavedState)
  private:
-  inline void set_has_client_id();
-  inline void clear_has_client_id();
-  inline void set_has_offset();
-  inline void clear_has_offset();
-  inline void set_has_new_value();
-  inline void clear_has_new_value();
-  inline void set_has_bits_to_set();
-  inline void clear_has_bits_to_set();
-  inline void set_has_bits_to_clear();
-  inline void clear_has_bits_to_clear();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 client_id_;
-  ::google::protobuf::int32 offset_;
-  ::google::protobuf::int32 new_value_;
-  ::google::protobuf::int32 bits_to_set_;
-  ::google::protobuf::int32 bits_to_clear_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoChangeSavedState* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t client_id_;
+    int32_t offset_;
+    int32_t new_value_;
+    int32_t bits_to_set_;
+    int32_t bits_to_clear_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoSendRawCanPacket : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoSendRawCanPacket) */ {
+class TrainControlRequest_DoSendRawCanPacket final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoSendRawCanPacket) */ {
  public:
-  TrainControlRequest_DoSendRawCanPacket();
-  virtual ~TrainControlRequest_DoSendRawCanPacket();
+  inline TrainControlRequest_DoSendRawCanPacket() : TrainControlRequest_DoSendRawCanPacket(nullptr) {}
+  ~TrainControlRequest_DoSendRawCanPacket() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoSendRawCanPacket(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoSendRawCanPacket(const TrainControlRequest_DoSendRawCanPacket& from);
+  TrainControlRequest_DoSendRawCanPacket(TrainControlRequest_DoSendRawCanPacket&& from) noexcept
+    : TrainControlRequest_DoSendRawCanPacket() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoSendRawCanPacket& operator=(const TrainControlRequest_DoSendRawCanPacket& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoSendRawCanPacket& operator=(TrainControlRequest_DoSendRawCanPacket&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoSendRawCanPacket& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoSendRawCanPacket& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoSendRawCanPacket* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoSendRawCanPacket*>(
+               &_TrainControlRequest_DoSendRawCanPacket_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
 
-  void Swap(TrainControlRequest_DoSendRawCanPacket* other);
+  friend void swap(TrainControlRequest_DoSendRawCanPacket& a, TrainControlRequest_DoSendRawCanPacket& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoSendRawCanPacket* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoSendRawCanPacket* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoSendRawCanPacket* New() const { return New(NULL); }
-
-  TrainControlRequest_DoSendRawCanPacket* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoSendRawCanPacket* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoSendRawCanPacket>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoSendRawCanPacket& from);
-  void MergeFrom(const TrainControlRequest_DoSendRawCanPacket& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoSendRawCanPacket& from) {
+    TrainControlRequest_DoSendRawCanPacket::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoSendRawCanPacket* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoSendRawCanPacket";
   }
+  protected:
+  explicit TrainControlRequest_DoSendRawCanPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional bool wait = 33 [default = false];
-  bool has_wait() const;
-  void clear_wait();
-  static const int kWaitFieldNumber = 33;
-  bool wait() const;
-  void set_wait(bool value);
-
+  enum : int {
+    kDFieldNumber = 34,
+    kDataFieldNumber = 35,
+    kWaitFieldNumber = 33,
+  };
   // repeated int32 d = 34;
   int d_size() const;
+  private:
+  int _internal_d_size() const;
+  public:
   void clear_d();
-  static const int kDFieldNumber = 34;
-  ::google::protobuf::int32 d(int index) const;
-  void set_d(int index, ::google::protobuf::int32 value);
-  void add_d(::google::protobuf::int32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+  private:
+  int32_t _internal_d(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_d() const;
+  void _internal_add_d(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_d();
+  public:
+  int32_t d(int index) const;
+  void set_d(int index, int32_t value);
+  void add_d(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
       d() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_d();
 
   // optional string data = 35;
   bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
   void clear_data();
-  static const int kDataFieldNumber = 35;
-  const ::std::string& data() const;
-  void set_data(const ::std::string& value);
-  void set_data(const char* value);
-  void set_data(const char* value, size_t size);
-  ::std::string* mutable_data();
-  ::std::string* release_data();
-  void set_allocated_data(::std::string* data);
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // optional bool wait = 33 [default = false];
+  bool has_wait() const;
+  private:
+  bool _internal_has_wait() const;
+  public:
+  void clear_wait();
+  bool wait() const;
+  void set_wait(bool value);
+  private:
+  bool _internal_wait() const;
+  void _internal_set_wait(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoSendRawCanPacket)
  private:
-  inline void set_has_wait();
-  inline void clear_has_wait();
-  inline void set_has_data();
-  inline void clear_has_data();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > d_;
-  ::google::protobuf::internal::ArenaStringPtr data_;
-  bool wait_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoSendRawCanPacket* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > d_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    bool wait_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoReflashAutomata : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoReflashAutomata) */ {
+class TrainControlRequest_DoReflashAutomata final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoReflashAutomata) */ {
  public:
-  TrainControlRequest_DoReflashAutomata();
-  virtual ~TrainControlRequest_DoReflashAutomata();
+  inline TrainControlRequest_DoReflashAutomata() : TrainControlRequest_DoReflashAutomata(nullptr) {}
+  ~TrainControlRequest_DoReflashAutomata() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoReflashAutomata(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoReflashAutomata(const TrainControlRequest_DoReflashAutomata& from);
+  TrainControlRequest_DoReflashAutomata(TrainControlRequest_DoReflashAutomata&& from) noexcept
+    : TrainControlRequest_DoReflashAutomata() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoReflashAutomata& operator=(const TrainControlRequest_DoReflashAutomata& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoReflashAutomata& operator=(TrainControlRequest_DoReflashAutomata&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoReflashAutomata& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoReflashAutomata& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoReflashAutomata* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoReflashAutomata*>(
+               &_TrainControlRequest_DoReflashAutomata_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
 
-  void Swap(TrainControlRequest_DoReflashAutomata* other);
+  friend void swap(TrainControlRequest_DoReflashAutomata& a, TrainControlRequest_DoReflashAutomata& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoReflashAutomata* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoReflashAutomata* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoReflashAutomata* New() const { return New(NULL); }
-
-  TrainControlRequest_DoReflashAutomata* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoReflashAutomata* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoReflashAutomata>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoReflashAutomata& from);
-  void MergeFrom(const TrainControlRequest_DoReflashAutomata& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoReflashAutomata& from) {
+    TrainControlRequest_DoReflashAutomata::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoReflashAutomata* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoReflashAutomata";
   }
+  protected:
+  explicit TrainControlRequest_DoReflashAutomata(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDataFieldNumber = 39,
+    kDestinationAddressFieldNumber = 37,
+    kSignalAddressFieldNumber = 61,
+    kOffsetFieldNumber = 38,
+  };
+  // repeated int32 data = 39;
+  int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
+  void clear_data();
+  private:
+  int32_t _internal_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_data() const;
+  void _internal_add_data(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_data();
+  public:
+  int32_t data(int index) const;
+  void set_data(int index, int32_t value);
+  void add_data(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_data();
+
   // required int32 destination_address = 37;
   bool has_destination_address() const;
+  private:
+  bool _internal_has_destination_address() const;
+  public:
   void clear_destination_address();
-  static const int kDestinationAddressFieldNumber = 37;
-  ::google::protobuf::int32 destination_address() const;
-  void set_destination_address(::google::protobuf::int32 value);
+  int32_t destination_address() const;
+  void set_destination_address(int32_t value);
+  private:
+  int32_t _internal_destination_address() const;
+  void _internal_set_destination_address(int32_t value);
+  public:
 
   // optional int32 signal_address = 61;
   bool has_signal_address() const;
+  private:
+  bool _internal_has_signal_address() const;
+  public:
   void clear_signal_address();
-  static const int kSignalAddressFieldNumber = 61;
-  ::google::protobuf::int32 signal_address() const;
-  void set_signal_address(::google::protobuf::int32 value);
+  int32_t signal_address() const;
+  void set_signal_address(int32_t value);
+  private:
+  int32_t _internal_signal_address() const;
+  void _internal_set_signal_address(int32_t value);
+  public:
 
   // optional int32 offset = 38 [default = 3328];
   bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
   void clear_offset();
-  static const int kOffsetFieldNumber = 38;
-  ::google::protobuf::int32 offset() const;
-  void set_offset(::google::protobuf::int32 value);
-
-  // repeated int32 data = 39;
-  int data_size() const;
-  void clear_data();
-  static const int kDataFieldNumber = 39;
-  ::google::protobuf::int32 data(int index) const;
-  void set_data(int index, ::google::protobuf::int32 value);
-  void add_data(::google::protobuf::int32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-      data() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-      mutable_data();
+  int32_t offset() const;
+  void set_offset(int32_t value);
+  private:
+  int32_t _internal_offset() const;
+  void _internal_set_offset(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoReflashAutomata)
  private:
-  inline void set_has_destination_address();
-  inline void clear_has_destination_address();
-  inline void set_has_signal_address();
-  inline void clear_has_signal_address();
-  inline void set_has_offset();
-  inline void clear_has_offset();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 destination_address_;
-  ::google::protobuf::int32 signal_address_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > data_;
-  ::google::protobuf::int32 offset_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoReflashAutomata* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > data_;
+    int32_t destination_address_;
+    int32_t signal_address_;
+    int32_t offset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoGetLokDb : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoGetLokDb) */ {
+class TrainControlRequest_DoGetLokDb final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoGetLokDb) */ {
  public:
-  TrainControlRequest_DoGetLokDb();
-  virtual ~TrainControlRequest_DoGetLokDb();
+  inline TrainControlRequest_DoGetLokDb() : TrainControlRequest_DoGetLokDb(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoGetLokDb(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoGetLokDb(const TrainControlRequest_DoGetLokDb& from);
+  TrainControlRequest_DoGetLokDb(TrainControlRequest_DoGetLokDb&& from) noexcept
+    : TrainControlRequest_DoGetLokDb() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoGetLokDb& operator=(const TrainControlRequest_DoGetLokDb& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoGetLokDb& operator=(TrainControlRequest_DoGetLokDb&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoGetLokDb& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoGetLokDb& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoGetLokDb* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoGetLokDb*>(
+               &_TrainControlRequest_DoGetLokDb_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
 
-  void Swap(TrainControlRequest_DoGetLokDb* other);
+  friend void swap(TrainControlRequest_DoGetLokDb& a, TrainControlRequest_DoGetLokDb& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoGetLokDb* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoGetLokDb* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoGetLokDb* New() const { return New(NULL); }
-
-  TrainControlRequest_DoGetLokDb* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const TrainControlRequest_DoGetLokDb& from);
-  void MergeFrom(const TrainControlRequest_DoGetLokDb& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(TrainControlRequest_DoGetLokDb* other);
-  private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
+  TrainControlRequest_DoGetLokDb* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoGetLokDb>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const TrainControlRequest_DoGetLokDb& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const TrainControlRequest_DoGetLokDb& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoGetLokDb";
   }
+  protected:
+  explicit TrainControlRequest_DoGetLokDb(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1521,1937 +2624,3462 @@ class TrainControlRequest_DoGetLokDb : public ::google::protobuf::Message /* @@p
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoGetLokDb)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoGetLokDb* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoGetLokState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoGetLokState) */ {
+class TrainControlRequest_DoGetLokState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoGetLokState) */ {
  public:
-  TrainControlRequest_DoGetLokState();
-  virtual ~TrainControlRequest_DoGetLokState();
+  inline TrainControlRequest_DoGetLokState() : TrainControlRequest_DoGetLokState(nullptr) {}
+  ~TrainControlRequest_DoGetLokState() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoGetLokState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoGetLokState(const TrainControlRequest_DoGetLokState& from);
+  TrainControlRequest_DoGetLokState(TrainControlRequest_DoGetLokState&& from) noexcept
+    : TrainControlRequest_DoGetLokState() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoGetLokState& operator=(const TrainControlRequest_DoGetLokState& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoGetLokState& operator=(TrainControlRequest_DoGetLokState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoGetLokState& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoGetLokState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoGetLokState* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoGetLokState*>(
+               &_TrainControlRequest_DoGetLokState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
 
-  void Swap(TrainControlRequest_DoGetLokState* other);
+  friend void swap(TrainControlRequest_DoGetLokState& a, TrainControlRequest_DoGetLokState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoGetLokState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoGetLokState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoGetLokState* New() const { return New(NULL); }
-
-  TrainControlRequest_DoGetLokState* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoGetLokState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoGetLokState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoGetLokState& from);
-  void MergeFrom(const TrainControlRequest_DoGetLokState& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoGetLokState& from) {
+    TrainControlRequest_DoGetLokState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoGetLokState* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoGetLokState";
   }
+  protected:
+  explicit TrainControlRequest_DoGetLokState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kIdFieldNumber = 43,
+  };
   // optional int32 id = 43;
   bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
   void clear_id();
-  static const int kIdFieldNumber = 43;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoGetLokState)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 id_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoGetLokState* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoEStopLoco : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoEStopLoco) */ {
+class TrainControlRequest_DoEStopLoco final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoEStopLoco) */ {
  public:
-  TrainControlRequest_DoEStopLoco();
-  virtual ~TrainControlRequest_DoEStopLoco();
+  inline TrainControlRequest_DoEStopLoco() : TrainControlRequest_DoEStopLoco(nullptr) {}
+  ~TrainControlRequest_DoEStopLoco() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoEStopLoco(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoEStopLoco(const TrainControlRequest_DoEStopLoco& from);
+  TrainControlRequest_DoEStopLoco(TrainControlRequest_DoEStopLoco&& from) noexcept
+    : TrainControlRequest_DoEStopLoco() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoEStopLoco& operator=(const TrainControlRequest_DoEStopLoco& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoEStopLoco& operator=(TrainControlRequest_DoEStopLoco&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoEStopLoco& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoEStopLoco& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoEStopLoco* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoEStopLoco*>(
+               &_TrainControlRequest_DoEStopLoco_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
 
-  void Swap(TrainControlRequest_DoEStopLoco* other);
+  friend void swap(TrainControlRequest_DoEStopLoco& a, TrainControlRequest_DoEStopLoco& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoEStopLoco* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoEStopLoco* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoEStopLoco* New() const { return New(NULL); }
-
-  TrainControlRequest_DoEStopLoco* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoEStopLoco* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoEStopLoco>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoEStopLoco& from);
-  void MergeFrom(const TrainControlRequest_DoEStopLoco& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoEStopLoco& from) {
+    TrainControlRequest_DoEStopLoco::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoEStopLoco* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoEStopLoco";
   }
+  protected:
+  explicit TrainControlRequest_DoEStopLoco(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kIdFieldNumber = 46,
+  };
   // required int32 id = 46;
   bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
   void clear_id();
-  static const int kIdFieldNumber = 46;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoEStopLoco)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 id_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoEStopLoco* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoPicMisc : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoPicMisc) */ {
+class TrainControlRequest_DoPicMisc final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoPicMisc) */ {
  public:
-  TrainControlRequest_DoPicMisc();
-  virtual ~TrainControlRequest_DoPicMisc();
+  inline TrainControlRequest_DoPicMisc() : TrainControlRequest_DoPicMisc(nullptr) {}
+  ~TrainControlRequest_DoPicMisc() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoPicMisc(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoPicMisc(const TrainControlRequest_DoPicMisc& from);
+  TrainControlRequest_DoPicMisc(TrainControlRequest_DoPicMisc&& from) noexcept
+    : TrainControlRequest_DoPicMisc() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoPicMisc& operator=(const TrainControlRequest_DoPicMisc& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoPicMisc& operator=(TrainControlRequest_DoPicMisc&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoPicMisc& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoPicMisc& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoPicMisc* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoPicMisc*>(
+               &_TrainControlRequest_DoPicMisc_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
 
-  void Swap(TrainControlRequest_DoPicMisc* other);
+  friend void swap(TrainControlRequest_DoPicMisc& a, TrainControlRequest_DoPicMisc& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoPicMisc* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoPicMisc* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoPicMisc* New() const { return New(NULL); }
-
-  TrainControlRequest_DoPicMisc* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoPicMisc* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoPicMisc>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoPicMisc& from);
-  void MergeFrom(const TrainControlRequest_DoPicMisc& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoPicMisc& from) {
+    TrainControlRequest_DoPicMisc::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoPicMisc* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoPicMisc";
   }
+  protected:
+  explicit TrainControlRequest_DoPicMisc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 cmd = 48;
-  bool has_cmd() const;
-  void clear_cmd();
-  static const int kCmdFieldNumber = 48;
-  ::google::protobuf::int32 cmd() const;
-  void set_cmd(::google::protobuf::int32 value);
-
+  enum : int {
+    kArgFieldNumber = 49,
+    kCmdFieldNumber = 48,
+  };
   // repeated int32 arg = 49;
   int arg_size() const;
+  private:
+  int _internal_arg_size() const;
+  public:
   void clear_arg();
-  static const int kArgFieldNumber = 49;
-  ::google::protobuf::int32 arg(int index) const;
-  void set_arg(int index, ::google::protobuf::int32 value);
-  void add_arg(::google::protobuf::int32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+  private:
+  int32_t _internal_arg(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_arg() const;
+  void _internal_add_arg(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_arg();
+  public:
+  int32_t arg(int index) const;
+  void set_arg(int index, int32_t value);
+  void add_arg(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
       arg() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_arg();
 
+  // required int32 cmd = 48;
+  bool has_cmd() const;
+  private:
+  bool _internal_has_cmd() const;
+  public:
+  void clear_cmd();
+  int32_t cmd() const;
+  void set_cmd(int32_t value);
+  private:
+  int32_t _internal_cmd() const;
+  void _internal_set_cmd(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoPicMisc)
  private:
-  inline void set_has_cmd();
-  inline void clear_has_cmd();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > arg_;
-  ::google::protobuf::int32 cmd_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoPicMisc* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > arg_;
+    int32_t cmd_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoReflashPic : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoReflashPic) */ {
+class TrainControlRequest_DoReflashPic final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoReflashPic) */ {
  public:
-  TrainControlRequest_DoReflashPic();
-  virtual ~TrainControlRequest_DoReflashPic();
+  inline TrainControlRequest_DoReflashPic() : TrainControlRequest_DoReflashPic(nullptr) {}
+  ~TrainControlRequest_DoReflashPic() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoReflashPic(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoReflashPic(const TrainControlRequest_DoReflashPic& from);
+  TrainControlRequest_DoReflashPic(TrainControlRequest_DoReflashPic&& from) noexcept
+    : TrainControlRequest_DoReflashPic() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoReflashPic& operator=(const TrainControlRequest_DoReflashPic& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoReflashPic& operator=(TrainControlRequest_DoReflashPic&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoReflashPic& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoReflashPic& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoReflashPic* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoReflashPic*>(
+               &_TrainControlRequest_DoReflashPic_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
 
-  void Swap(TrainControlRequest_DoReflashPic* other);
+  friend void swap(TrainControlRequest_DoReflashPic& a, TrainControlRequest_DoReflashPic& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoReflashPic* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoReflashPic* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoReflashPic* New() const { return New(NULL); }
-
-  TrainControlRequest_DoReflashPic* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoReflashPic* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoReflashPic>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoReflashPic& from);
-  void MergeFrom(const TrainControlRequest_DoReflashPic& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoReflashPic& from) {
+    TrainControlRequest_DoReflashPic::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoReflashPic* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoReflashPic";
   }
+  protected:
+  explicit TrainControlRequest_DoReflashPic(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDataFieldNumber = 51,
+  };
   // repeated int32 data = 51;
   int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
   void clear_data();
-  static const int kDataFieldNumber = 51;
-  ::google::protobuf::int32 data(int index) const;
-  void set_data(int index, ::google::protobuf::int32 value);
-  void add_data(::google::protobuf::int32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+  private:
+  int32_t _internal_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_data() const;
+  void _internal_add_data(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_data();
+  public:
+  int32_t data(int index) const;
+  void set_data(int index, int32_t value);
+  void add_data(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
       data() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_data();
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoReflashPic)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > data_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoReflashPic* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoGetOrSetCV : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoGetOrSetCV) */ {
+class TrainControlRequest_DoGetOrSetCV final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoGetOrSetCV) */ {
  public:
-  TrainControlRequest_DoGetOrSetCV();
-  virtual ~TrainControlRequest_DoGetOrSetCV();
+  inline TrainControlRequest_DoGetOrSetCV() : TrainControlRequest_DoGetOrSetCV(nullptr) {}
+  ~TrainControlRequest_DoGetOrSetCV() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoGetOrSetCV(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoGetOrSetCV(const TrainControlRequest_DoGetOrSetCV& from);
+  TrainControlRequest_DoGetOrSetCV(TrainControlRequest_DoGetOrSetCV&& from) noexcept
+    : TrainControlRequest_DoGetOrSetCV() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoGetOrSetCV& operator=(const TrainControlRequest_DoGetOrSetCV& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoGetOrSetCV& operator=(TrainControlRequest_DoGetOrSetCV&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoGetOrSetCV& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoGetOrSetCV& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoGetOrSetCV* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoGetOrSetCV*>(
+               &_TrainControlRequest_DoGetOrSetCV_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
 
-  void Swap(TrainControlRequest_DoGetOrSetCV* other);
+  friend void swap(TrainControlRequest_DoGetOrSetCV& a, TrainControlRequest_DoGetOrSetCV& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoGetOrSetCV* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoGetOrSetCV* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoGetOrSetCV* New() const { return New(NULL); }
-
-  TrainControlRequest_DoGetOrSetCV* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoGetOrSetCV* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoGetOrSetCV>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoGetOrSetCV& from);
-  void MergeFrom(const TrainControlRequest_DoGetOrSetCV& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoGetOrSetCV& from) {
+    TrainControlRequest_DoGetOrSetCV::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoGetOrSetCV* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoGetOrSetCV";
   }
+  protected:
+  explicit TrainControlRequest_DoGetOrSetCV(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // optional int32 train_id = 53 [default = 63];
-  bool has_train_id() const;
-  void clear_train_id();
-  static const int kTrainIdFieldNumber = 53;
-  ::google::protobuf::int32 train_id() const;
-  void set_train_id(::google::protobuf::int32 value);
-
+  enum : int {
+    kCvFieldNumber = 54,
+    kValueFieldNumber = 55,
+    kTrainIdFieldNumber = 53,
+  };
   // required int32 cv = 54;
   bool has_cv() const;
+  private:
+  bool _internal_has_cv() const;
+  public:
   void clear_cv();
-  static const int kCvFieldNumber = 54;
-  ::google::protobuf::int32 cv() const;
-  void set_cv(::google::protobuf::int32 value);
+  int32_t cv() const;
+  void set_cv(int32_t value);
+  private:
+  int32_t _internal_cv() const;
+  void _internal_set_cv(int32_t value);
+  public:
 
   // optional int32 value = 55;
   bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
   void clear_value();
-  static const int kValueFieldNumber = 55;
-  ::google::protobuf::int32 value() const;
-  void set_value(::google::protobuf::int32 value);
+  int32_t value() const;
+  void set_value(int32_t value);
+  private:
+  int32_t _internal_value() const;
+  void _internal_set_value(int32_t value);
+  public:
+
+  // optional int32 train_id = 53 [default = 63];
+  bool has_train_id() const;
+  private:
+  bool _internal_has_train_id() const;
+  public:
+  void clear_train_id();
+  int32_t train_id() const;
+  void set_train_id(int32_t value);
+  private:
+  int32_t _internal_train_id() const;
+  void _internal_set_train_id(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoGetOrSetCV)
  private:
-  inline void set_has_train_id();
-  inline void clear_has_train_id();
-  inline void set_has_cv();
-  inline void clear_has_cv();
-  inline void set_has_value();
-  inline void clear_has_value();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 train_id_;
-  ::google::protobuf::int32 cv_;
-  ::google::protobuf::int32 value_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoGetOrSetCV* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t cv_;
+    int32_t value_;
+    int32_t train_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest_DoWaitForChange : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoWaitForChange) */ {
+class TrainControlRequest_DoWaitForChange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoWaitForChange) */ {
  public:
-  TrainControlRequest_DoWaitForChange();
-  virtual ~TrainControlRequest_DoWaitForChange();
+  inline TrainControlRequest_DoWaitForChange() : TrainControlRequest_DoWaitForChange(nullptr) {}
+  ~TrainControlRequest_DoWaitForChange() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoWaitForChange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlRequest_DoWaitForChange(const TrainControlRequest_DoWaitForChange& from);
+  TrainControlRequest_DoWaitForChange(TrainControlRequest_DoWaitForChange&& from) noexcept
+    : TrainControlRequest_DoWaitForChange() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlRequest_DoWaitForChange& operator=(const TrainControlRequest_DoWaitForChange& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoWaitForChange& operator=(TrainControlRequest_DoWaitForChange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest_DoWaitForChange& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoWaitForChange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoWaitForChange* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoWaitForChange*>(
+               &_TrainControlRequest_DoWaitForChange_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
 
-  void Swap(TrainControlRequest_DoWaitForChange* other);
+  friend void swap(TrainControlRequest_DoWaitForChange& a, TrainControlRequest_DoWaitForChange& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoWaitForChange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoWaitForChange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest_DoWaitForChange* New() const { return New(NULL); }
-
-  TrainControlRequest_DoWaitForChange* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlRequest_DoWaitForChange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoWaitForChange>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlRequest_DoWaitForChange& from);
-  void MergeFrom(const TrainControlRequest_DoWaitForChange& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoWaitForChange& from) {
+    TrainControlRequest_DoWaitForChange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlRequest_DoWaitForChange* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoWaitForChange";
   }
+  protected:
+  explicit TrainControlRequest_DoWaitForChange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTimestampFieldNumber = 57,
+    kIdFieldNumber = 58,
+  };
   // required uint64 timestamp = 57;
   bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
   void clear_timestamp();
-  static const int kTimestampFieldNumber = 57;
-  ::google::protobuf::uint64 timestamp() const;
-  void set_timestamp(::google::protobuf::uint64 value);
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
 
   // optional int32 id = 58;
   bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
   void clear_id();
-  static const int kIdFieldNumber = 58;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoWaitForChange)
  private:
-  inline void set_has_timestamp();
-  inline void clear_has_timestamp();
-  inline void set_has_id();
-  inline void clear_has_id();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::uint64 timestamp_;
-  ::google::protobuf::int32 id_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest_DoWaitForChange* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t timestamp_;
+    int32_t id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest) */ {
+class TrainControlRequest_DoGetRpcStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoGetRpcStats) */ {
  public:
-  TrainControlRequest();
-  virtual ~TrainControlRequest();
+  inline TrainControlRequest_DoGetRpcStats() : TrainControlRequest_DoGetRpcStats(nullptr) {}
+  ~TrainControlRequest_DoGetRpcStats() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest_DoGetRpcStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TrainControlRequest(const TrainControlRequest& from);
+  TrainControlRequest_DoGetRpcStats(const TrainControlRequest_DoGetRpcStats& from);
+  TrainControlRequest_DoGetRpcStats(TrainControlRequest_DoGetRpcStats&& from) noexcept
+    : TrainControlRequest_DoGetRpcStats() {
+    *this = ::std::move(from);
+  }
 
-  inline TrainControlRequest& operator=(const TrainControlRequest& from) {
+  inline TrainControlRequest_DoGetRpcStats& operator=(const TrainControlRequest_DoGetRpcStats& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlRequest_DoGetRpcStats& operator=(TrainControlRequest_DoGetRpcStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest_DoGetRpcStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest_DoGetRpcStats* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoGetRpcStats*>(
+               &_TrainControlRequest_DoGetRpcStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
 
-  void Swap(TrainControlRequest* other);
+  friend void swap(TrainControlRequest_DoGetRpcStats& a, TrainControlRequest_DoGetRpcStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoGetRpcStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoGetRpcStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlRequest* New() const { return New(NULL); }
+  TrainControlRequest_DoGetRpcStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoGetRpcStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TrainControlRequest_DoGetRpcStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest_DoGetRpcStats& from) {
+    TrainControlRequest_DoGetRpcStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  TrainControlRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const TrainControlRequest& from);
-  void MergeFrom(const TrainControlRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
-  void InternalSwap(TrainControlRequest* other);
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrainControlRequest_DoGetRpcStats* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoGetRpcStats";
   }
+  protected:
+  explicit TrainControlRequest_DoGetRpcStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
-  typedef TrainControlRequest_DoSetSpeed DoSetSpeed;
-  typedef TrainControlRequest_DoSetAccessory DoSetAccessory;
-  typedef TrainControlRequest_DoSetEmergencyStop DoSetEmergencyStop;
-  typedef TrainControlRequest_DoRpc DoRpc;
-  typedef TrainControlRequest_DoPing DoPing;
-  typedef TrainControlRequest_DoGetOrSetAddress DoGetOrSetAddress;
-  typedef TrainControlRequest_DoDropState DoDropState;
-  typedef TrainControlRequest_DoChangeSavedState DoChangeSavedState;
-  typedef TrainControlRequest_DoSendRawCanPacket DoSendRawCanPacket;
-  typedef TrainControlRequest_DoReflashAutomata DoReflashAutomata;
-  typedef TrainControlRequest_DoGetLokDb DoGetLokDb;
-  typedef TrainControlRequest_DoGetLokState DoGetLokState;
-  typedef TrainControlRequest_DoEStopLoco DoEStopLoco;
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResetFieldNumber = 63,
+  };
+  // optional bool reset = 63 [default = false];
+  bool has_reset() const;
+  private:
+  bool _internal_has_reset() const;
+  public:
+  void clear_reset();
+  bool reset() const;
+  void set_reset(bool value);
+  private:
+  bool _internal_reset() const;
+  void _internal_set_reset(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoGetRpcStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool reset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TrainControlRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest) */ {
+ public:
+  inline TrainControlRequest() : TrainControlRequest(nullptr) {}
+  ~TrainControlRequest() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TrainControlRequest(const TrainControlRequest& from);
+  TrainControlRequest(TrainControlRequest&& from) noexcept
+    : TrainControlRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline TrainControlRequest& operator=(const TrainControlRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TrainControlRequest& operator=(TrainControlRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlRequest* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest*>(
+               &_TrainControlRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(TrainControlRequest& a, TrainControlRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TrainControlRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TrainControlRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlRequest& from) {
+    TrainControlRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrainControlRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest";
+  }
+  protected:
+  explicit TrainControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TrainControlRequest_DoSetSpeed DoSetSpeed;
+  typedef TrainControlRequest_DoSetAccessory DoSetAccessory;
+  typedef TrainControlRequest_DoSetEmergencyStop DoSetEmergencyStop;
+  typedef TrainControlRequest_DoRpc DoRpc;
+  typedef TrainControlRequest_DoPing DoPing;
+  typedef TrainControlRequest_DoGetOrSetAddress DoGetOrSetAddress;
+  typedef TrainControlRequest_DoDropState DoDropState;
+  typedef TrainControlRequest_DoChangeSavedState DoChangeSavedState;
+  typedef TrainControlRequest_DoSendRawCanPacket DoSendRawCanPacket;
+  typedef TrainControlRequest_DoReflashAutomata DoReflashAutomata;
+  typedef TrainControlRequest_DoGetLokDb DoGetLokDb;
+  typedef TrainControlRequest_DoGetLokState DoGetLokState;
+  typedef TrainControlRequest_DoEStopLoco DoEStopLoco;
   typedef TrainControlRequest_DoPicMisc DoPicMisc;
   typedef TrainControlRequest_DoReflashPic DoReflashPic;
   typedef TrainControlRequest_DoGetOrSetCV DoGetOrSetCV;
   typedef TrainControlRequest_DoWaitForChange DoWaitForChange;
+  typedef TrainControlRequest_DoGetRpcStats DoGetRpcStats;
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDosetspeedFieldNumber = 1,
+    kDosetaccessoryFieldNumber = 4,
+    kDosetemergencystopFieldNumber = 8,
+    kDorpcFieldNumber = 16,
+    kDopingFieldNumber = 21,
+    kDogetorsetaddressFieldNumber = 23,
+    kDodropstateFieldNumber = 25,
+    kDochangesavedstateFieldNumber = 26,
+    kDosendrawcanpacketFieldNumber = 32,
+    kDoreflashautomataFieldNumber = 40,
+    kDogetlokdbFieldNumber = 41,
+    kDogetlokstateFieldNumber = 42,
+    kDoSetLokStateFieldNumber = 44,
+    kDoestoplocoFieldNumber = 45,
+    kDopicmiscFieldNumber = 47,
+    kDoreflashpicFieldNumber = 50,
+    kDogetorsetcvFieldNumber = 52,
+    kDowaitforchangeFieldNumber = 56,
+    kDogetrpcstatsFieldNumber = 62,
+  };
   // optional group DoSetSpeed = 1 { ... };
   bool has_dosetspeed() const;
+  private:
+  bool _internal_has_dosetspeed() const;
+  public:
   void clear_dosetspeed();
-  static const int kDosetspeedFieldNumber = 1;
   const ::server::TrainControlRequest_DoSetSpeed& dosetspeed() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoSetSpeed* release_dosetspeed();
   ::server::TrainControlRequest_DoSetSpeed* mutable_dosetspeed();
-  ::server::TrainControlRequest_DoSetSpeed* release_dosetspeed();
   void set_allocated_dosetspeed(::server::TrainControlRequest_DoSetSpeed* dosetspeed);
+  private:
+  const ::server::TrainControlRequest_DoSetSpeed& _internal_dosetspeed() const;
+  ::server::TrainControlRequest_DoSetSpeed* _internal_mutable_dosetspeed();
+  public:
+  void unsafe_arena_set_allocated_dosetspeed(
+      ::server::TrainControlRequest_DoSetSpeed* dosetspeed);
+  ::server::TrainControlRequest_DoSetSpeed* unsafe_arena_release_dosetspeed();
 
   // optional group DoSetAccessory = 4 { ... };
   bool has_dosetaccessory() const;
+  private:
+  bool _internal_has_dosetaccessory() const;
+  public:
   void clear_dosetaccessory();
-  static const int kDosetaccessoryFieldNumber = 4;
   const ::server::TrainControlRequest_DoSetAccessory& dosetaccessory() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoSetAccessory* release_dosetaccessory();
   ::server::TrainControlRequest_DoSetAccessory* mutable_dosetaccessory();
-  ::server::TrainControlRequest_DoSetAccessory* release_dosetaccessory();
   void set_allocated_dosetaccessory(::server::TrainControlRequest_DoSetAccessory* dosetaccessory);
+  private:
+  const ::server::TrainControlRequest_DoSetAccessory& _internal_dosetaccessory() const;
+  ::server::TrainControlRequest_DoSetAccessory* _internal_mutable_dosetaccessory();
+  public:
+  void unsafe_arena_set_allocated_dosetaccessory(
+      ::server::TrainControlRequest_DoSetAccessory* dosetaccessory);
+  ::server::TrainControlRequest_DoSetAccessory* unsafe_arena_release_dosetaccessory();
 
   // optional group DoSetEmergencyStop = 8 { ... };
   bool has_dosetemergencystop() const;
+  private:
+  bool _internal_has_dosetemergencystop() const;
+  public:
   void clear_dosetemergencystop();
-  static const int kDosetemergencystopFieldNumber = 8;
   const ::server::TrainControlRequest_DoSetEmergencyStop& dosetemergencystop() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoSetEmergencyStop* release_dosetemergencystop();
   ::server::TrainControlRequest_DoSetEmergencyStop* mutable_dosetemergencystop();
-  ::server::TrainControlRequest_DoSetEmergencyStop* release_dosetemergencystop();
   void set_allocated_dosetemergencystop(::server::TrainControlRequest_DoSetEmergencyStop* dosetemergencystop);
+  private:
+  const ::server::TrainControlRequest_DoSetEmergencyStop& _internal_dosetemergencystop() const;
+  ::server::TrainControlRequest_DoSetEmergencyStop* _internal_mutable_dosetemergencystop();
+  public:
+  void unsafe_arena_set_allocated_dosetemergencystop(
+      ::server::TrainControlRequest_DoSetEmergencyStop* dosetemergencystop);
+  ::server::TrainControlRequest_DoSetEmergencyStop* unsafe_arena_release_dosetemergencystop();
 
   // optional group DoRpc = 16 { ... };
   bool has_dorpc() const;
+  private:
+  bool _internal_has_dorpc() const;
+  public:
   void clear_dorpc();
-  static const int kDorpcFieldNumber = 16;
   const ::server::TrainControlRequest_DoRpc& dorpc() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoRpc* release_dorpc();
   ::server::TrainControlRequest_DoRpc* mutable_dorpc();
-  ::server::TrainControlRequest_DoRpc* release_dorpc();
   void set_allocated_dorpc(::server::TrainControlRequest_DoRpc* dorpc);
+  private:
+  const ::server::TrainControlRequest_DoRpc& _internal_dorpc() const;
+  ::server::TrainControlRequest_DoRpc* _internal_mutable_dorpc();
+  public:
+  void unsafe_arena_set_allocated_dorpc(
+      ::server::TrainControlRequest_DoRpc* dorpc);
+  ::server::TrainControlRequest_DoRpc* unsafe_arena_release_dorpc();
 
   // optional group DoPing = 21 { ... };
   bool has_doping() const;
+  private:
+  bool _internal_has_doping() const;
+  public:
   void clear_doping();
-  static const int kDopingFieldNumber = 21;
   const ::server::TrainControlRequest_DoPing& doping() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoPing* release_doping();
   ::server::TrainControlRequest_DoPing* mutable_doping();
-  ::server::TrainControlRequest_DoPing* release_doping();
   void set_allocated_doping(::server::TrainControlRequest_DoPing* doping);
+  private:
+  const ::server::TrainControlRequest_DoPing& _internal_doping() const;
+  ::server::TrainControlRequest_DoPing* _internal_mutable_doping();
+  public:
+  void unsafe_arena_set_allocated_doping(
+      ::server::TrainControlRequest_DoPing* doping);
+  ::server::TrainControlRequest_DoPing* unsafe_arena_release_doping();
 
   // optional group DoGetOrSetAddress = 23 { ... };
   bool has_dogetorsetaddress() const;
+  private:
+  bool _internal_has_dogetorsetaddress() const;
+  public:
   void clear_dogetorsetaddress();
-  static const int kDogetorsetaddressFieldNumber = 23;
   const ::server::TrainControlRequest_DoGetOrSetAddress& dogetorsetaddress() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoGetOrSetAddress* release_dogetorsetaddress();
   ::server::TrainControlRequest_DoGetOrSetAddress* mutable_dogetorsetaddress();
-  ::server::TrainControlRequest_DoGetOrSetAddress* release_dogetorsetaddress();
   void set_allocated_dogetorsetaddress(::server::TrainControlRequest_DoGetOrSetAddress* dogetorsetaddress);
+  private:
+  const ::server::TrainControlRequest_DoGetOrSetAddress& _internal_dogetorsetaddress() const;
+  ::server::TrainControlRequest_DoGetOrSetAddress* _internal_mutable_dogetorsetaddress();
+  public:
+  void unsafe_arena_set_allocated_dogetorsetaddress(
+      ::server::TrainControlRequest_DoGetOrSetAddress* dogetorsetaddress);
+  ::server::TrainControlRequest_DoGetOrSetAddress* unsafe_arena_release_dogetorsetaddress();
 
   // optional group DoDropState = 25 { ... };
   bool has_dodropstate() const;
+  private:
+  bool _internal_has_dodropstate() const;
+  public:
   void clear_dodropstate();
-  static const int kDodropstateFieldNumber = 25;
   const ::server::TrainControlRequest_DoDropState& dodropstate() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoDropState* release_dodropstate();
   ::server::TrainControlRequest_DoDropState* mutable_dodropstate();
-  ::server::TrainControlRequest_DoDropState* release_dodropstate();
   void set_allocated_dodropstate(::server::TrainControlRequest_DoDropState* dodropstate);
+  private:
+  const ::server::TrainControlRequest_DoDropState& _internal_dodropstate() const;
+  ::server::TrainControlRequest_DoDropState* _internal_mutable_dodropstate();
+  public:
+  void unsafe_arena_set_allocated_dodropstate(
+      ::server::TrainControlRequest_DoDropState* dodropstate);
+  ::server::TrainControlRequest_DoDropState* unsafe_arena_release_dodropstate();
 
   // optional group DoChangeSavedState = 26 { ... };
   bool has_dochangesavedstate() const;
+  private:
+  bool _internal_has_dochangesavedstate() const;
+  public:
   void clear_dochangesavedstate();
-  static const int kDochangesavedstateFieldNumber = 26;
   const ::server::TrainControlRequest_DoChangeSavedState& dochangesavedstate() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoChangeSavedState* release_dochangesavedstate();
   ::server::TrainControlRequest_DoChangeSavedState* mutable_dochangesavedstate();
-  ::server::TrainControlRequest_DoChangeSavedState* release_dochangesavedstate();
   void set_allocated_dochangesavedstate(::server::TrainControlRequest_DoChangeSavedState* dochangesavedstate);
+  private:
+  const ::server::TrainControlRequest_DoChangeSavedState& _internal_dochangesavedstate() const;
+  ::server::TrainControlRequest_DoChangeSavedState* _internal_mutable_dochangesavedstate();
+  public:
+  void unsafe_arena_set_allocated_dochangesavedstate(
+      ::server::TrainControlRequest_DoChangeSavedState* dochangesavedstate);
+  ::server::TrainControlRequest_DoChangeSavedState* unsafe_arena_release_dochangesavedstate();
 
   // optional group DoSendRawCanPacket = 32 { ... };
   bool has_dosendrawcanpacket() const;
+  private:
+  bool _internal_has_dosendrawcanpacket() const;
+  public:
   void clear_dosendrawcanpacket();
-  static const int kDosendrawcanpacketFieldNumber = 32;
   const ::server::TrainControlRequest_DoSendRawCanPacket& dosendrawcanpacket() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoSendRawCanPacket* release_dosendrawcanpacket();
   ::server::TrainControlRequest_DoSendRawCanPacket* mutable_dosendrawcanpacket();
-  ::server::TrainControlRequest_DoSendRawCanPacket* release_dosendrawcanpacket();
   void set_allocated_dosendrawcanpacket(::server::TrainControlRequest_DoSendRawCanPacket* dosendrawcanpacket);
+  private:
+  const ::server::TrainControlRequest_DoSendRawCanPacket& _internal_dosendrawcanpacket() const;
+  ::server::TrainControlRequest_DoSendRawCanPacket* _internal_mutable_dosendrawcanpacket();
+  public:
+  void unsafe_arena_set_allocated_dosendrawcanpacket(
+      ::server::TrainControlRequest_DoSendRawCanPacket* dosendrawcanpacket);
+  ::server::TrainControlRequest_DoSendRawCanPacket* unsafe_arena_release_dosendrawcanpacket();
 
   // optional group DoReflashAutomata = 40 { ... };
   bool has_doreflashautomata() const;
+  private:
+  bool _internal_has_doreflashautomata() const;
+  public:
   void clear_doreflashautomata();
-  static const int kDoreflashautomataFieldNumber = 40;
   const ::server::TrainControlRequest_DoReflashAutomata& doreflashautomata() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoReflashAutomata* release_doreflashautomata();
   ::server::TrainControlRequest_DoReflashAutomata* mutable_doreflashautomata();
-  ::server::TrainControlRequest_DoReflashAutomata* release_doreflashautomata();
   void set_allocated_doreflashautomata(::server::TrainControlRequest_DoReflashAutomata* doreflashautomata);
+  private:
+  const ::server::TrainControlRequest_DoReflashAutomata& _internal_doreflashautomata() const;
+  ::server::TrainControlRequest_DoReflashAutomata* _internal_mutable_doreflashautomata();
+  public:
+  void unsafe_arena_set_allocated_doreflashautomata(
+      ::server::TrainControlRequest_DoReflashAutomata* doreflashautomata);
+  ::server::TrainControlRequest_DoReflashAutomata* unsafe_arena_release_doreflashautomata();
 
   // optional group DoGetLokDb = 41 { ... };
   bool has_dogetlokdb() const;
+  private:
+  bool _internal_has_dogetlokdb() const;
+  public:
   void clear_dogetlokdb();
-  static const int kDogetlokdbFieldNumber = 41;
   const ::server::TrainControlRequest_DoGetLokDb& dogetlokdb() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoGetLokDb* release_dogetlokdb();
   ::server::TrainControlRequest_DoGetLokDb* mutable_dogetlokdb();
-  ::server::TrainControlRequest_DoGetLokDb* release_dogetlokdb();
   void set_allocated_dogetlokdb(::server::TrainControlRequest_DoGetLokDb* dogetlokdb);
+  private:
+  const ::server::TrainControlRequest_DoGetLokDb& _internal_dogetlokdb() const;
+  ::server::TrainControlRequest_DoGetLokDb* _internal_mutable_dogetlokdb();
+  public:
+  void unsafe_arena_set_allocated_dogetlokdb(
+      ::server::TrainControlRequest_DoGetLokDb* dogetlokdb);
+  ::server::TrainControlRequest_DoGetLokDb* unsafe_arena_release_dogetlokdb();
 
   // optional group DoGetLokState = 42 { ... };
   bool has_dogetlokstate() const;
+  private:
+  bool _internal_has_dogetlokstate() const;
+  public:
   void clear_dogetlokstate();
-  static const int kDogetlokstateFieldNumber = 42;
   const ::server::TrainControlRequest_DoGetLokState& dogetlokstate() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoGetLokState* release_dogetlokstate();
   ::server::TrainControlRequest_DoGetLokState* mutable_dogetlokstate();
-  ::server::TrainControlRequest_DoGetLokState* release_dogetlokstate();
   void set_allocated_dogetlokstate(::server::TrainControlRequest_DoGetLokState* dogetlokstate);
+  private:
+  const ::server::TrainControlRequest_DoGetLokState& _internal_dogetlokstate() const;
+  ::server::TrainControlRequest_DoGetLokState* _internal_mutable_dogetlokstate();
+  public:
+  void unsafe_arena_set_allocated_dogetlokstate(
+      ::server::TrainControlRequest_DoGetLokState* dogetlokstate);
+  ::server::TrainControlRequest_DoGetLokState* unsafe_arena_release_dogetlokstate();
 
   // optional .server.LokStateProto DoSetLokState = 44;
   bool has_dosetlokstate() const;
+  private:
+  bool _internal_has_dosetlokstate() const;
+  public:
   void clear_dosetlokstate();
-  static const int kDoSetLokStateFieldNumber = 44;
   const ::server::LokStateProto& dosetlokstate() const;
+  PROTOBUF_NODISCARD ::server::LokStateProto* release_dosetlokstate();
   ::server::LokStateProto* mutable_dosetlokstate();
-  ::server::LokStateProto* release_dosetlokstate();
   void set_allocated_dosetlokstate(::server::LokStateProto* dosetlokstate);
+  private:
+  const ::server::LokStateProto& _internal_dosetlokstate() const;
+  ::server::LokStateProto* _internal_mutable_dosetlokstate();
+  public:
+  void unsafe_arena_set_allocated_dosetlokstate(
+      ::server::LokStateProto* dosetlokstate);
+  ::server::LokStateProto* unsafe_arena_release_dosetlokstate();
 
   // optional group DoEStopLoco = 45 { ... };
   bool has_doestoploco() const;
+  private:
+  bool _internal_has_doestoploco() const;
+  public:
   void clear_doestoploco();
-  static const int kDoestoplocoFieldNumber = 45;
   const ::server::TrainControlRequest_DoEStopLoco& doestoploco() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoEStopLoco* release_doestoploco();
   ::server::TrainControlRequest_DoEStopLoco* mutable_doestoploco();
-  ::server::TrainControlRequest_DoEStopLoco* release_doestoploco();
   void set_allocated_doestoploco(::server::TrainControlRequest_DoEStopLoco* doestoploco);
+  private:
+  const ::server::TrainControlRequest_DoEStopLoco& _internal_doestoploco() const;
+  ::server::TrainControlRequest_DoEStopLoco* _internal_mutable_doestoploco();
+  public:
+  void unsafe_arena_set_allocated_doestoploco(
+      ::server::TrainControlRequest_DoEStopLoco* doestoploco);
+  ::server::TrainControlRequest_DoEStopLoco* unsafe_arena_release_doestoploco();
 
   // optional group DoPicMisc = 47 { ... };
   bool has_dopicmisc() const;
+  private:
+  bool _internal_has_dopicmisc() const;
+  public:
   void clear_dopicmisc();
-  static const int kDopicmiscFieldNumber = 47;
   const ::server::TrainControlRequest_DoPicMisc& dopicmisc() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoPicMisc* release_dopicmisc();
   ::server::TrainControlRequest_DoPicMisc* mutable_dopicmisc();
-  ::server::TrainControlRequest_DoPicMisc* release_dopicmisc();
   void set_allocated_dopicmisc(::server::TrainControlRequest_DoPicMisc* dopicmisc);
+  private:
+  const ::server::TrainControlRequest_DoPicMisc& _internal_dopicmisc() const;
+  ::server::TrainControlRequest_DoPicMisc* _internal_mutable_dopicmisc();
+  public:
+  void unsafe_arena_set_allocated_dopicmisc(
+      ::server::TrainControlRequest_DoPicMisc* dopicmisc);
+  ::server::TrainControlRequest_DoPicMisc* unsafe_arena_release_dopicmisc();
 
   // optional group DoReflashPic = 50 { ... };
   bool has_doreflashpic() const;
+  private:
+  bool _internal_has_doreflashpic() const;
+  public:
   void clear_doreflashpic();
-  static const int kDoreflashpicFieldNumber = 50;
   const ::server::TrainControlRequest_DoReflashPic& doreflashpic() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoReflashPic* release_doreflashpic();
   ::server::TrainControlRequest_DoReflashPic* mutable_doreflashpic();
-  ::server::TrainControlRequest_DoReflashPic* release_doreflashpic();
   void set_allocated_doreflashpic(::server::TrainControlRequest_DoReflashPic* doreflashpic);
+  private:
+  const ::server::TrainControlRequest_DoReflashPic& _internal_doreflashpic() const;
+  ::server::TrainControlRequest_DoReflashPic* _internal_mutable_doreflashpic();
+  public:
+  void unsafe_arena_set_allocated_doreflashpic(
+      ::server::TrainControlRequest_DoReflashPic* doreflashpic);
+  ::server::TrainControlRequest_DoReflashPic* unsafe_arena_release_doreflashpic();
 
   // optional group DoGetOrSetCV = 52 { ... };
   bool has_dogetorsetcv() const;
+  private:
+  bool _internal_has_dogetorsetcv() const;
+  public:
   void clear_dogetorsetcv();
-  static const int kDogetorsetcvFieldNumber = 52;
   const ::server::TrainControlRequest_DoGetOrSetCV& dogetorsetcv() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoGetOrSetCV* release_dogetorsetcv();
   ::server::TrainControlRequest_DoGetOrSetCV* mutable_dogetorsetcv();
-  ::server::TrainControlRequest_DoGetOrSetCV* release_dogetorsetcv();
   void set_allocated_dogetorsetcv(::server::TrainControlRequest_DoGetOrSetCV* dogetorsetcv);
+  private:
+  const ::server::TrainControlRequest_DoGetOrSetCV& _internal_dogetorsetcv() const;
+  ::server::TrainControlRequest_DoGetOrSetCV* _internal_mutable_dogetorsetcv();
+  public:
+  void unsafe_arena_set_allocated_dogetorsetcv(
+      ::server::TrainControlRequest_DoGetOrSetCV* dogetorsetcv);
+  ::server::TrainControlRequest_DoGetOrSetCV* unsafe_arena_release_dogetorsetcv();
 
   // optional group DoWaitForChange = 56 { ... };
   bool has_dowaitforchange() const;
+  private:
+  bool _internal_has_dowaitforchange() const;
+  public:
   void clear_dowaitforchange();
-  static const int kDowaitforchangeFieldNumber = 56;
   const ::server::TrainControlRequest_DoWaitForChange& dowaitforchange() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoWaitForChange* release_dowaitforchange();
   ::server::TrainControlRequest_DoWaitForChange* mutable_dowaitforchange();
-  ::server::TrainControlRequest_DoWaitForChange* release_dowaitforchange();
   void set_allocated_dowaitforchange(::server::TrainControlRequest_DoWaitForChange* dowaitforchange);
+  private:
+  const ::server::TrainControlRequest_DoWaitForChange& _internal_dowaitforchange() const;
+  ::server::TrainControlRequest_DoWaitForChange* _internal_mutable_dowaitforchange();
+  public:
+  void unsafe_arena_set_allocated_dowaitforchange(
+      ::server::TrainControlRequest_DoWaitForChange* dowaitforchange);
+  ::server::TrainControlRequest_DoWaitForChange* unsafe_arena_release_dowaitforchange();
+
+  // optional group DoGetRpcStats = 62 { ... };
+  bool has_dogetrpcstats() const;
+  private:
+  bool _internal_has_dogetrpcstats() const;
+  public:
+  void clear_dogetrpcstats();
+  const ::server::TrainControlRequest_DoGetRpcStats& dogetrpcstats() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest_DoGetRpcStats* release_dogetrpcstats();
+  ::server::TrainControlRequest_DoGetRpcStats* mutable_dogetrpcstats();
+  void set_allocated_dogetrpcstats(::server::TrainControlRequest_DoGetRpcStats* dogetrpcstats);
+  private:
+  const ::server::TrainControlRequest_DoGetRpcStats& _internal_dogetrpcstats() const;
+  ::server::TrainControlRequest_DoGetRpcStats* _internal_mutable_dogetrpcstats();
+  public:
+  void unsafe_arena_set_allocated_dogetrpcstats(
+      ::server::TrainControlRequest_DoGetRpcStats* dogetrpcstats);
+  ::server::TrainControlRequest_DoGetRpcStats* unsafe_arena_release_dogetrpcstats();
 
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest)
  private:
-  inline void set_has_dosetspeed();
-  inline void clear_has_dosetspeed();
-  inline void set_has_dosetaccessory();
-  inline void clear_has_dosetaccessory();
-  inline void set_has_dosetemergencystop();
-  inline void clear_has_dosetemergencystop();
-  inline void set_has_dorpc();
-  inline void clear_has_dorpc();
-  inline void set_has_doping();
-  inline void clear_has_doping();
-  inline void set_has_dogetorsetaddress();
-  inline void clear_has_dogetorsetaddress();
-  inline void set_has_dodropstate();
-  inline void clear_has_dodropstate();
-  inline void set_has_dochangesavedstate();
-  inline void clear_has_dochangesavedstate();
-  inline void set_has_dosendrawcanpacket();
-  inline void clear_has_dosendrawcanpacket();
-  inline void set_has_doreflashautomata();
-  inline void clear_has_doreflashautomata();
-  inline void set_has_dogetlokdb();
-  inline void clear_has_dogetlokdb();
-  inline void set_has_dogetlokstate();
-  inline void clear_has_dogetlokstate();
-  inline void set_has_dosetlokstate();
-  inline void clear_has_dosetlokstate();
-  inline void set_has_doestoploco();
-  inline void clear_has_doestoploco();
-  inline void set_has_dopicmisc();
-  inline void clear_has_dopicmisc();
-  inline void set_has_doreflashpic();
-  inline void clear_has_doreflashpic();
-  inline void set_has_dogetorsetcv();
-  inline void clear_has_dogetorsetcv();
-  inline void set_has_dowaitforchange();
-  inline void clear_has_dowaitforchange();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::server::TrainControlRequest_DoSetSpeed* dosetspeed_;
-  ::server::TrainControlRequest_DoSetAccessory* dosetaccessory_;
-  ::server::TrainControlRequest_DoSetEmergencyStop* dosetemergencystop_;
-  ::server::TrainControlRequest_DoRpc* dorpc_;
-  ::server::TrainControlRequest_DoPing* doping_;
-  ::server::TrainControlRequest_DoGetOrSetAddress* dogetorsetaddress_;
-  ::server::TrainControlRequest_DoDropState* dodropstate_;
-  ::server::TrainControlRequest_DoChangeSavedState* dochangesavedstate_;
-  ::server::TrainControlRequest_DoSendRawCanPacket* dosendrawcanpacket_;
-  ::server::TrainControlRequest_DoReflashAutomata* doreflashautomata_;
-  ::server::TrainControlRequest_DoGetLokDb* dogetlokdb_;
-  ::server::TrainControlRequest_DoGetLokState* dogetlokstate_;
-  ::server::LokStateProto* dosetlokstate_;
-  ::server::TrainControlRequest_DoEStopLoco* doestoploco_;
-  ::server::TrainControlRequest_DoPicMisc* dopicmisc_;
-  ::server::TrainControlRequest_DoReflashPic* doreflashpic_;
-  ::server::TrainControlRequest_DoGetOrSetCV* dogetorsetcv_;
-  ::server::TrainControlRequest_DoWaitForChange* dowaitforchange_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlRequest* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::server::TrainControlRequest_DoSetSpeed* dosetspeed_;
+    ::server::TrainControlRequest_DoSetAccessory* dosetaccessory_;
+    ::server::TrainControlRequest_DoSetEmergencyStop* dosetemergencystop_;
+    ::server::TrainControlRequest_DoRpc* dorpc_;
+    ::server::TrainControlRequest_DoPing* doping_;
+    ::server::TrainControlRequest_DoGetOrSetAddress* dogetorsetaddress_;
+    ::server::TrainControlRequest_DoDropState* dodropstate_;
+    ::server::TrainControlRequest_DoChangeSavedState* dochangesavedstate_;
+    ::server::TrainControlRequest_DoSendRawCanPacket* dosendrawcanpacket_;
+    ::server::TrainControlRequest_DoReflashAutomata* doreflashautomata_;
+    ::server::TrainControlRequest_DoGetLokDb* dogetlokdb_;
+    ::server::TrainControlRequest_DoGetLokState* dogetlokstate_;
+    ::server::LokStateProto* dosetlokstate_;
+    ::server::TrainControlRequest_DoEStopLoco* doestoploco_;
+    ::server::TrainControlRequest_DoPicMisc* dopicmisc_;
+    ::server::TrainControlRequest_DoReflashPic* doreflashpic_;
+    ::server::TrainControlRequest_DoGetOrSetCV* dogetorsetcv_;
+    ::server::TrainControlRequest_DoWaitForChange* dowaitforchange_;
+    ::server::TrainControlRequest_DoGetRpcStats* dogetrpcstats_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_Speed : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.Speed) */ {
+class TrainControlResponse_Speed final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.Speed) */ {
  public:
-  TrainControlResponse_Speed();
-  virtual ~TrainControlResponse_Speed();
+  inline TrainControlResponse_Speed() : TrainControlResponse_Speed(nullptr) {}
+  ~TrainControlResponse_Speed() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_Speed(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_Speed(const TrainControlResponse_Speed& from);
+  TrainControlResponse_Speed(TrainControlResponse_Speed&& from) noexcept
+    : TrainControlResponse_Speed() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_Speed& operator=(const TrainControlResponse_Speed& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_Speed& operator=(TrainControlResponse_Speed&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_Speed& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_Speed& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_Speed* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_Speed*>(
+               &_TrainControlResponse_Speed_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
 
-  void Swap(TrainControlResponse_Speed* other);
+  friend void swap(TrainControlResponse_Speed& a, TrainControlResponse_Speed& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_Speed* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_Speed* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_Speed* New() const { return New(NULL); }
-
-  TrainControlResponse_Speed* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_Speed* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_Speed>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_Speed& from);
-  void MergeFrom(const TrainControlResponse_Speed& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_Speed& from) {
+    TrainControlResponse_Speed::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_Speed* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.Speed";
   }
+  protected:
+  explicit TrainControlResponse_Speed(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kIdFieldNumber = 2,
+    kSpeedFieldNumber = 3,
+    kTimestampFieldNumber = 50,
+    kDirFieldNumber = 25,
+  };
   // required int32 id = 2;
   bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
   void clear_id();
-  static const int kIdFieldNumber = 2;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
-
-  // optional int32 dir = 25 [default = 1];
-  bool has_dir() const;
-  void clear_dir();
-  static const int kDirFieldNumber = 25;
-  ::google::protobuf::int32 dir() const;
-  void set_dir(::google::protobuf::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // required int32 speed = 3;
   bool has_speed() const;
+  private:
+  bool _internal_has_speed() const;
+  public:
   void clear_speed();
-  static const int kSpeedFieldNumber = 3;
-  ::google::protobuf::int32 speed() const;
-  void set_speed(::google::protobuf::int32 value);
+  int32_t speed() const;
+  void set_speed(int32_t value);
+  private:
+  int32_t _internal_speed() const;
+  void _internal_set_speed(int32_t value);
+  public:
 
   // optional uint64 timestamp = 50;
   bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
   void clear_timestamp();
-  static const int kTimestampFieldNumber = 50;
-  ::google::protobuf::uint64 timestamp() const;
-  void set_timestamp(::google::protobuf::uint64 value);
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // optional int32 dir = 25 [default = 1];
+  bool has_dir() const;
+  private:
+  bool _internal_has_dir() const;
+  public:
+  void clear_dir();
+  int32_t dir() const;
+  void set_dir(int32_t value);
+  private:
+  int32_t _internal_dir() const;
+  void _internal_set_dir(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.Speed)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_dir();
-  inline void clear_has_dir();
-  inline void set_has_speed();
-  inline void clear_has_speed();
-  inline void set_has_timestamp();
-  inline void clear_has_timestamp();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 id_;
-  ::google::protobuf::int32 dir_;
-  ::google::protobuf::uint64 timestamp_;
-  ::google::protobuf::int32 speed_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_Speed* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t id_;
+    int32_t speed_;
+    uint64_t timestamp_;
+    int32_t dir_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_Accessory : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.Accessory) */ {
+class TrainControlResponse_Accessory final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.Accessory) */ {
  public:
-  TrainControlResponse_Accessory();
-  virtual ~TrainControlResponse_Accessory();
+  inline TrainControlResponse_Accessory() : TrainControlResponse_Accessory(nullptr) {}
+  ~TrainControlResponse_Accessory() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_Accessory(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_Accessory(const TrainControlResponse_Accessory& from);
+  TrainControlResponse_Accessory(TrainControlResponse_Accessory&& from) noexcept
+    : TrainControlResponse_Accessory() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_Accessory& operator=(const TrainControlResponse_Accessory& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_Accessory& operator=(TrainControlResponse_Accessory&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_Accessory& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_Accessory& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_Accessory* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_Accessory*>(
+               &_TrainControlResponse_Accessory_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
 
-  void Swap(TrainControlResponse_Accessory* other);
+  friend void swap(TrainControlResponse_Accessory& a, TrainControlResponse_Accessory& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_Accessory* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_Accessory* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_Accessory* New() const { return New(NULL); }
-
-  TrainControlResponse_Accessory* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_Accessory* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_Accessory>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_Accessory& from);
-  void MergeFrom(const TrainControlResponse_Accessory& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_Accessory& from) {
+    TrainControlResponse_Accessory::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_Accessory* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.Accessory";
   }
+  protected:
+  explicit TrainControlResponse_Accessory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTrainIdFieldNumber = 5,
+    kAccessoryIdFieldNumber = 6,
+    kTimestampFieldNumber = 51,
+    kValueFieldNumber = 7,
+  };
   // required int32 train_id = 5;
   bool has_train_id() const;
+  private:
+  bool _internal_has_train_id() const;
+  public:
   void clear_train_id();
-  static const int kTrainIdFieldNumber = 5;
-  ::google::protobuf::int32 train_id() const;
-  void set_train_id(::google::protobuf::int32 value);
+  int32_t train_id() const;
+  void set_train_id(int32_t value);
+  private:
+  int32_t _internal_train_id() const;
+  void _internal_set_train_id(int32_t value);
+  public:
 
   // required int32 accessory_id = 6;
   bool has_accessory_id() const;
+  private:
+  bool _internal_has_accessory_id() const;
+  public:
   void clear_accessory_id();
-  static const int kAccessoryIdFieldNumber = 6;
-  ::google::protobuf::int32 accessory_id() const;
-  void set_accessory_id(::google::protobuf::int32 value);
-
-  // required int32 value = 7;
-  bool has_value() const;
-  void clear_value();
-  static const int kValueFieldNumber = 7;
-  ::google::protobuf::int32 value() const;
-  void set_value(::google::protobuf::int32 value);
+  int32_t accessory_id() const;
+  void set_accessory_id(int32_t value);
+  private:
+  int32_t _internal_accessory_id() const;
+  void _internal_set_accessory_id(int32_t value);
+  public:
 
   // optional uint64 timestamp = 51;
   bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
   void clear_timestamp();
-  static const int kTimestampFieldNumber = 51;
-  ::google::protobuf::uint64 timestamp() const;
-  void set_timestamp(::google::protobuf::uint64 value);
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
+
+  // required int32 value = 7;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  int32_t value() const;
+  void set_value(int32_t value);
+  private:
+  int32_t _internal_value() const;
+  void _internal_set_value(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.Accessory)
  private:
-  inline void set_has_train_id();
-  inline void clear_has_train_id();
-  inline void set_has_accessory_id();
-  inline void clear_has_accessory_id();
-  inline void set_has_value();
-  inline void clear_has_value();
-  inline void set_has_timestamp();
-  inline void clear_has_timestamp();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 train_id_;
-  ::google::protobuf::int32 accessory_id_;
-  ::google::protobuf::uint64 timestamp_;
-  ::google::protobuf::int32 value_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_Accessory* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t train_id_;
+    int32_t accessory_id_;
+    uint64_t timestamp_;
+    int32_t value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_EmergencyStop : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.EmergencyStop) */ {
+class TrainControlResponse_EmergencyStop final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.EmergencyStop) */ {
  public:
-  TrainControlResponse_EmergencyStop();
-  virtual ~TrainControlResponse_EmergencyStop();
+  inline TrainControlResponse_EmergencyStop() : TrainControlResponse_EmergencyStop(nullptr) {}
+  ~TrainControlResponse_EmergencyStop() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_EmergencyStop(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_EmergencyStop(const TrainControlResponse_EmergencyStop& from);
+  TrainControlResponse_EmergencyStop(TrainControlResponse_EmergencyStop&& from) noexcept
+    : TrainControlResponse_EmergencyStop() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_EmergencyStop& operator=(const TrainControlResponse_EmergencyStop& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_EmergencyStop& operator=(TrainControlResponse_EmergencyStop&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_EmergencyStop& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_EmergencyStop& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_EmergencyStop* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_EmergencyStop*>(
+               &_TrainControlResponse_EmergencyStop_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
 
-  void Swap(TrainControlResponse_EmergencyStop* other);
+  friend void swap(TrainControlResponse_EmergencyStop& a, TrainControlResponse_EmergencyStop& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_EmergencyStop* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_EmergencyStop* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_EmergencyStop* New() const { return New(NULL); }
-
-  TrainControlResponse_EmergencyStop* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_EmergencyStop* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_EmergencyStop>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_EmergencyStop& from);
-  void MergeFrom(const TrainControlResponse_EmergencyStop& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_EmergencyStop& from) {
+    TrainControlResponse_EmergencyStop::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_EmergencyStop* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.EmergencyStop";
   }
+  protected:
+  explicit TrainControlResponse_EmergencyStop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kStopFieldNumber = 9,
+  };
   // required bool stop = 9;
   bool has_stop() const;
+  private:
+  bool _internal_has_stop() const;
+  public:
   void clear_stop();
-  static const int kStopFieldNumber = 9;
   bool stop() const;
   void set_stop(bool value);
+  private:
+  bool _internal_stop() const;
+  void _internal_set_stop(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.EmergencyStop)
  private:
-  inline void set_has_stop();
-  inline void clear_has_stop();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  bool stop_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_EmergencyStop* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool stop_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_RpcResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.RpcResponse) */ {
+class TrainControlResponse_RpcResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.RpcResponse) */ {
  public:
-  TrainControlResponse_RpcResponse();
-  virtual ~TrainControlResponse_RpcResponse();
+  inline TrainControlResponse_RpcResponse() : TrainControlResponse_RpcResponse(nullptr) {}
+  ~TrainControlResponse_RpcResponse() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_RpcResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_RpcResponse(const TrainControlResponse_RpcResponse& from);
+  TrainControlResponse_RpcResponse(TrainControlResponse_RpcResponse&& from) noexcept
+    : TrainControlResponse_RpcResponse() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_RpcResponse& operator=(const TrainControlResponse_RpcResponse& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_RpcResponse& operator=(TrainControlResponse_RpcResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_RpcResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_RpcResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_RpcResponse* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_RpcResponse*>(
+               &_TrainControlResponse_RpcResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
 
-  void Swap(TrainControlResponse_RpcResponse* other);
+  friend void swap(TrainControlResponse_RpcResponse& a, TrainControlResponse_RpcResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_RpcResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_RpcResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_RpcResponse* New() const { return New(NULL); }
-
-  TrainControlResponse_RpcResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_RpcResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_RpcResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_RpcResponse& from);
-  void MergeFrom(const TrainControlResponse_RpcResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_RpcResponse& from) {
+    TrainControlResponse_RpcResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_RpcResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.RpcResponse";
   }
+  protected:
+  explicit TrainControlResponse_RpcResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kSuccessFieldNumber = 17,
+    kResponseFieldNumber = 18,
+  };
   // required bool success = 17;
   bool has_success() const;
+  private:
+  bool _internal_has_success() const;
+  public:
   void clear_success();
-  static const int kSuccessFieldNumber = 17;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // required int32 response = 18;
   bool has_response() const;
+  private:
+  bool _internal_has_response() const;
+  public:
   void clear_response();
-  static const int kResponseFieldNumber = 18;
-  ::google::protobuf::int32 response() const;
-  void set_response(::google::protobuf::int32 value);
+  int32_t response() const;
+  void set_response(int32_t value);
+  private:
+  int32_t _internal_response() const;
+  void _internal_set_response(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.RpcResponse)
  private:
-  inline void set_has_success();
-  inline void clear_has_success();
-  inline void set_has_response();
-  inline void clear_has_response();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  bool success_;
-  ::google::protobuf::int32 response_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_RpcResponse* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool success_;
+    int32_t response_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_Pong : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.Pong) */ {
+class TrainControlResponse_Pong final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.Pong) */ {
  public:
-  TrainControlResponse_Pong();
-  virtual ~TrainControlResponse_Pong();
+  inline TrainControlResponse_Pong() : TrainControlResponse_Pong(nullptr) {}
+  ~TrainControlResponse_Pong() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_Pong(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_Pong(const TrainControlResponse_Pong& from);
+  TrainControlResponse_Pong(TrainControlResponse_Pong&& from) noexcept
+    : TrainControlResponse_Pong() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_Pong& operator=(const TrainControlResponse_Pong& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_Pong& operator=(TrainControlResponse_Pong&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_Pong& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_Pong& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_Pong* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_Pong*>(
+               &_TrainControlResponse_Pong_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
 
-  void Swap(TrainControlResponse_Pong* other);
+  friend void swap(TrainControlResponse_Pong& a, TrainControlResponse_Pong& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_Pong* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_Pong* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_Pong* New() const { return New(NULL); }
-
-  TrainControlResponse_Pong* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_Pong* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_Pong>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_Pong& from);
-  void MergeFrom(const TrainControlResponse_Pong& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_Pong& from) {
+    TrainControlResponse_Pong::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_Pong* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.Pong";
   }
+  protected:
+  explicit TrainControlResponse_Pong(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kValueFieldNumber = 20,
+  };
   // required int32 value = 20;
   bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
   void clear_value();
-  static const int kValueFieldNumber = 20;
-  ::google::protobuf::int32 value() const;
-  void set_value(::google::protobuf::int32 value);
+  int32_t value() const;
+  void set_value(int32_t value);
+  private:
+  int32_t _internal_value() const;
+  void _internal_set_value(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.Pong)
  private:
-  inline void set_has_value();
-  inline void clear_has_value();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 value_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_Pong* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_CurrentAddress : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.CurrentAddress) */ {
+class TrainControlResponse_CurrentAddress final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.CurrentAddress) */ {
  public:
-  TrainControlResponse_CurrentAddress();
-  virtual ~TrainControlResponse_CurrentAddress();
+  inline TrainControlResponse_CurrentAddress() : TrainControlResponse_CurrentAddress(nullptr) {}
+  ~TrainControlResponse_CurrentAddress() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_CurrentAddress(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_CurrentAddress(const TrainControlResponse_CurrentAddress& from);
+  TrainControlResponse_CurrentAddress(TrainControlResponse_CurrentAddress&& from) noexcept
+    : TrainControlResponse_CurrentAddress() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_CurrentAddress& operator=(const TrainControlResponse_CurrentAddress& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_CurrentAddress& operator=(TrainControlResponse_CurrentAddress&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_CurrentAddress& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_CurrentAddress& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_CurrentAddress* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_CurrentAddress*>(
+               &_TrainControlResponse_CurrentAddress_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
 
-  void Swap(TrainControlResponse_CurrentAddress* other);
+  friend void swap(TrainControlResponse_CurrentAddress& a, TrainControlResponse_CurrentAddress& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_CurrentAddress* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_CurrentAddress* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_CurrentAddress* New() const { return New(NULL); }
-
-  TrainControlResponse_CurrentAddress* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_CurrentAddress* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_CurrentAddress>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_CurrentAddress& from);
-  void MergeFrom(const TrainControlResponse_CurrentAddress& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_CurrentAddress& from) {
+    TrainControlResponse_CurrentAddress::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_CurrentAddress* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.CurrentAddress";
   }
+  protected:
+  explicit TrainControlResponse_CurrentAddress(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kAddressFieldNumber = 22,
+  };
   // required int32 address = 22;
   bool has_address() const;
+  private:
+  bool _internal_has_address() const;
+  public:
   void clear_address();
-  static const int kAddressFieldNumber = 22;
-  ::google::protobuf::int32 address() const;
-  void set_address(::google::protobuf::int32 value);
+  int32_t address() const;
+  void set_address(int32_t value);
+  private:
+  int32_t _internal_address() const;
+  void _internal_set_address(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.CurrentAddress)
  private:
-  inline void set_has_address();
-  inline void clear_has_address();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 address_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_CurrentAddress* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t address_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_RawCanPacket : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.RawCanPacket) */ {
+class TrainControlResponse_RawCanPacket final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.RawCanPacket) */ {
  public:
-  TrainControlResponse_RawCanPacket();
-  virtual ~TrainControlResponse_RawCanPacket();
+  inline TrainControlResponse_RawCanPacket() : TrainControlResponse_RawCanPacket(nullptr) {}
+  ~TrainControlResponse_RawCanPacket() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_RawCanPacket(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_RawCanPacket(const TrainControlResponse_RawCanPacket& from);
+  TrainControlResponse_RawCanPacket(TrainControlResponse_RawCanPacket&& from) noexcept
+    : TrainControlResponse_RawCanPacket() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_RawCanPacket& operator=(const TrainControlResponse_RawCanPacket& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_RawCanPacket& operator=(TrainControlResponse_RawCanPacket&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_RawCanPacket& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_RawCanPacket& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_RawCanPacket* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_RawCanPacket*>(
+               &_TrainControlResponse_RawCanPacket_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
 
-  void Swap(TrainControlResponse_RawCanPacket* other);
+  friend void swap(TrainControlResponse_RawCanPacket& a, TrainControlResponse_RawCanPacket& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_RawCanPacket* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_RawCanPacket* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_RawCanPacket* New() const { return New(NULL); }
-
-  TrainControlResponse_RawCanPacket* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_RawCanPacket* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_RawCanPacket>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_RawCanPacket& from);
-  void MergeFrom(const TrainControlResponse_RawCanPacket& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_RawCanPacket& from) {
+    TrainControlResponse_RawCanPacket::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_RawCanPacket* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.RawCanPacket";
   }
+  protected:
+  explicit TrainControlResponse_RawCanPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDataFieldNumber = 24,
+  };
   // repeated int32 data = 24;
   int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
   void clear_data();
-  static const int kDataFieldNumber = 24;
-  ::google::protobuf::int32 data(int index) const;
-  void set_data(int index, ::google::protobuf::int32 value);
-  void add_data(::google::protobuf::int32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+  private:
+  int32_t _internal_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_data() const;
+  void _internal_add_data(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_data();
+  public:
+  int32_t data(int index) const;
+  void set_data(int index, int32_t value);
+  void add_data(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
       data() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_data();
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.RawCanPacket)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > data_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_RawCanPacket* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_ReflashAutomata : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.ReflashAutomata) */ {
+class TrainControlResponse_ReflashAutomata final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.ReflashAutomata) */ {
  public:
-  TrainControlResponse_ReflashAutomata();
-  virtual ~TrainControlResponse_ReflashAutomata();
+  inline TrainControlResponse_ReflashAutomata() : TrainControlResponse_ReflashAutomata(nullptr) {}
+  ~TrainControlResponse_ReflashAutomata() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_ReflashAutomata(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_ReflashAutomata(const TrainControlResponse_ReflashAutomata& from);
+  TrainControlResponse_ReflashAutomata(TrainControlResponse_ReflashAutomata&& from) noexcept
+    : TrainControlResponse_ReflashAutomata() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_ReflashAutomata& operator=(const TrainControlResponse_ReflashAutomata& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_ReflashAutomata& operator=(TrainControlResponse_ReflashAutomata&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_ReflashAutomata& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_ReflashAutomata& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_ReflashAutomata* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_ReflashAutomata*>(
+               &_TrainControlResponse_ReflashAutomata_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
 
-  void Swap(TrainControlResponse_ReflashAutomata* other);
+  friend void swap(TrainControlResponse_ReflashAutomata& a, TrainControlResponse_ReflashAutomata& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_ReflashAutomata* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_ReflashAutomata* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_ReflashAutomata* New() const { return New(NULL); }
-
-  TrainControlResponse_ReflashAutomata* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_ReflashAutomata* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_ReflashAutomata>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_ReflashAutomata& from);
-  void MergeFrom(const TrainControlResponse_ReflashAutomata& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_ReflashAutomata& from) {
+    TrainControlResponse_ReflashAutomata::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_ReflashAutomata* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.ReflashAutomata";
   }
+  protected:
+  explicit TrainControlResponse_ReflashAutomata(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrorFieldNumber = 26,
+  };
   // optional string error = 26;
   bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
   void clear_error();
-  static const int kErrorFieldNumber = 26;
-  const ::std::string& error() const;
-  void set_error(const ::std::string& value);
-  void set_error(const char* value);
-  void set_error(const char* value, size_t size);
-  ::std::string* mutable_error();
-  ::std::string* release_error();
-  void set_allocated_error(::std::string* error);
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.ReflashAutomata)
  private:
-  inline void set_has_error();
-  inline void clear_has_error();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::internal::ArenaStringPtr error_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_ReflashAutomata* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_LokDb_Lok_Function : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.LokDb.Lok.Function) */ {
+class TrainControlResponse_LokDb_Lok_Function final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.LokDb.Lok.Function) */ {
  public:
-  TrainControlResponse_LokDb_Lok_Function();
-  virtual ~TrainControlResponse_LokDb_Lok_Function();
+  inline TrainControlResponse_LokDb_Lok_Function() : TrainControlResponse_LokDb_Lok_Function(nullptr) {}
+  ~TrainControlResponse_LokDb_Lok_Function() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_LokDb_Lok_Function(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_LokDb_Lok_Function(const TrainControlResponse_LokDb_Lok_Function& from);
+  TrainControlResponse_LokDb_Lok_Function(TrainControlResponse_LokDb_Lok_Function&& from) noexcept
+    : TrainControlResponse_LokDb_Lok_Function() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_LokDb_Lok_Function& operator=(const TrainControlResponse_LokDb_Lok_Function& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_LokDb_Lok_Function& operator=(TrainControlResponse_LokDb_Lok_Function&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_LokDb_Lok_Function& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_LokDb_Lok_Function& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_LokDb_Lok_Function* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_LokDb_Lok_Function*>(
+               &_TrainControlResponse_LokDb_Lok_Function_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
 
-  void Swap(TrainControlResponse_LokDb_Lok_Function* other);
+  friend void swap(TrainControlResponse_LokDb_Lok_Function& a, TrainControlResponse_LokDb_Lok_Function& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_LokDb_Lok_Function* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_LokDb_Lok_Function* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_LokDb_Lok_Function* New() const { return New(NULL); }
-
-  TrainControlResponse_LokDb_Lok_Function* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_LokDb_Lok_Function* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_LokDb_Lok_Function>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_LokDb_Lok_Function& from);
-  void MergeFrom(const TrainControlResponse_LokDb_Lok_Function& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_LokDb_Lok_Function& from) {
+    TrainControlResponse_LokDb_Lok_Function::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_LokDb_Lok_Function* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.LokDb.Lok.Function";
   }
+  protected:
+  explicit TrainControlResponse_LokDb_Lok_Function(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kIdFieldNumber = 34,
+    kTypeFieldNumber = 35,
+  };
   // required int32 id = 34;
   bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
   void clear_id();
-  static const int kIdFieldNumber = 34;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // optional int32 type = 35;
   bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
   void clear_type();
-  static const int kTypeFieldNumber = 35;
-  ::google::protobuf::int32 type() const;
-  void set_type(::google::protobuf::int32 value);
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.LokDb.Lok.Function)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_type();
-  inline void clear_has_type();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 id_;
-  ::google::protobuf::int32 type_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_LokDb_Lok_Function* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t id_;
+    int32_t type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_LokDb_Lok : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.LokDb.Lok) */ {
+class TrainControlResponse_LokDb_Lok final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.LokDb.Lok) */ {
  public:
-  TrainControlResponse_LokDb_Lok();
-  virtual ~TrainControlResponse_LokDb_Lok();
+  inline TrainControlResponse_LokDb_Lok() : TrainControlResponse_LokDb_Lok(nullptr) {}
+  ~TrainControlResponse_LokDb_Lok() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_LokDb_Lok(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_LokDb_Lok(const TrainControlResponse_LokDb_Lok& from);
+  TrainControlResponse_LokDb_Lok(TrainControlResponse_LokDb_Lok&& from) noexcept
+    : TrainControlResponse_LokDb_Lok() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_LokDb_Lok& operator=(const TrainControlResponse_LokDb_Lok& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_LokDb_Lok& operator=(TrainControlResponse_LokDb_Lok&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_LokDb_Lok& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_LokDb_Lok& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_LokDb_Lok* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_LokDb_Lok*>(
+               &_TrainControlResponse_LokDb_Lok_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
 
-  void Swap(TrainControlResponse_LokDb_Lok* other);
+  friend void swap(TrainControlResponse_LokDb_Lok& a, TrainControlResponse_LokDb_Lok& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_LokDb_Lok* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_LokDb_Lok* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_LokDb_Lok* New() const { return New(NULL); }
-
-  TrainControlResponse_LokDb_Lok* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_LokDb_Lok* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_LokDb_Lok>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_LokDb_Lok& from);
-  void MergeFrom(const TrainControlResponse_LokDb_Lok& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_LokDb_Lok& from) {
+    TrainControlResponse_LokDb_Lok::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_LokDb_Lok* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.LokDb.Lok";
   }
+  protected:
+  explicit TrainControlResponse_LokDb_Lok(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3459,132 +6087,216 @@ class TrainControlResponse_LokDb_Lok : public ::google::protobuf::Message /* @@p
 
   // accessors -------------------------------------------------------
 
-  // required int32 id = 30;
-  bool has_id() const;
-  void clear_id();
-  static const int kIdFieldNumber = 30;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
+  enum : int {
+    kFunctionFieldNumber = 33,
+    kNameFieldNumber = 31,
+    kIdFieldNumber = 30,
+    kAddressFieldNumber = 32,
+  };
+  // repeated group Function = 33 { ... };
+  int function_size() const;
+  private:
+  int _internal_function_size() const;
+  public:
+  void clear_function();
+  ::server::TrainControlResponse_LokDb_Lok_Function* mutable_function(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok_Function >*
+      mutable_function();
+  private:
+  const ::server::TrainControlResponse_LokDb_Lok_Function& _internal_function(int index) const;
+  ::server::TrainControlResponse_LokDb_Lok_Function* _internal_add_function();
+  public:
+  const ::server::TrainControlResponse_LokDb_Lok_Function& function(int index) const;
+  ::server::TrainControlResponse_LokDb_Lok_Function* add_function();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok_Function >&
+      function() const;
 
   // optional string name = 31;
   bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
   void clear_name();
-  static const int kNameFieldNumber = 31;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // required int32 id = 30;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // optional int32 address = 32;
   bool has_address() const;
+  private:
+  bool _internal_has_address() const;
+  public:
   void clear_address();
-  static const int kAddressFieldNumber = 32;
-  ::google::protobuf::int32 address() const;
-  void set_address(::google::protobuf::int32 value);
-
-  // repeated group Function = 33 { ... };
-  int function_size() const;
-  void clear_function();
-  static const int kFunctionFieldNumber = 33;
-  const ::server::TrainControlResponse_LokDb_Lok_Function& function(int index) const;
-  ::server::TrainControlResponse_LokDb_Lok_Function* mutable_function(int index);
-  ::server::TrainControlResponse_LokDb_Lok_Function* add_function();
-  ::google::protobuf::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok_Function >*
-      mutable_function();
-  const ::google::protobuf::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok_Function >&
-      function() const;
+  int32_t address() const;
+  void set_address(int32_t value);
+  private:
+  int32_t _internal_address() const;
+  void _internal_set_address(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.LokDb.Lok)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_address();
-  inline void clear_has_address();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::int32 id_;
-  ::google::protobuf::int32 address_;
-  ::google::protobuf::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok_Function > function_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_LokDb_Lok* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok_Function > function_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int32_t id_;
+    int32_t address_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_LokDb : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.LokDb) */ {
+class TrainControlResponse_LokDb final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.LokDb) */ {
  public:
-  TrainControlResponse_LokDb();
-  virtual ~TrainControlResponse_LokDb();
+  inline TrainControlResponse_LokDb() : TrainControlResponse_LokDb(nullptr) {}
+  ~TrainControlResponse_LokDb() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_LokDb(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_LokDb(const TrainControlResponse_LokDb& from);
+  TrainControlResponse_LokDb(TrainControlResponse_LokDb&& from) noexcept
+    : TrainControlResponse_LokDb() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_LokDb& operator=(const TrainControlResponse_LokDb& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_LokDb& operator=(TrainControlResponse_LokDb&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_LokDb& default_instance();
-
-  void Swap(TrainControlResponse_LokDb* other);
-
-  // implements Message ----------------------------------------------
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_LokDb& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_LokDb* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_LokDb*>(
+               &_TrainControlResponse_LokDb_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(TrainControlResponse_LokDb& a, TrainControlResponse_LokDb& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_LokDb* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_LokDb* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
-  inline TrainControlResponse_LokDb* New() const { return New(NULL); }
+  // implements Message ----------------------------------------------
 
-  TrainControlResponse_LokDb* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_LokDb* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_LokDb>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_LokDb& from);
-  void MergeFrom(const TrainControlResponse_LokDb& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_LokDb& from) {
+    TrainControlResponse_LokDb::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_LokDb* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.LokDb";
   }
+  protected:
+  explicit TrainControlResponse_LokDb(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -3592,563 +6304,1407 @@ class TrainControlResponse_LokDb : public ::google::protobuf::Message /* @@proto
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kLokFieldNumber = 29,
+  };
   // repeated group Lok = 29 { ... };
   int lok_size() const;
+  private:
+  int _internal_lok_size() const;
+  public:
   void clear_lok();
-  static const int kLokFieldNumber = 29;
-  const ::server::TrainControlResponse_LokDb_Lok& lok(int index) const;
   ::server::TrainControlResponse_LokDb_Lok* mutable_lok(int index);
-  ::server::TrainControlResponse_LokDb_Lok* add_lok();
-  ::google::protobuf::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok >*
       mutable_lok();
-  const ::google::protobuf::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok >&
+  private:
+  const ::server::TrainControlResponse_LokDb_Lok& _internal_lok(int index) const;
+  ::server::TrainControlResponse_LokDb_Lok* _internal_add_lok();
+  public:
+  const ::server::TrainControlResponse_LokDb_Lok& lok(int index) const;
+  ::server::TrainControlResponse_LokDb_Lok* add_lok();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok >&
       lok() const;
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.LokDb)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok > lok_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_LokDb* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok > lok_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_PicMisc : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.PicMisc) */ {
+class TrainControlResponse_PicMisc final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.PicMisc) */ {
  public:
-  TrainControlResponse_PicMisc();
-  virtual ~TrainControlResponse_PicMisc();
+  inline TrainControlResponse_PicMisc() : TrainControlResponse_PicMisc(nullptr) {}
+  ~TrainControlResponse_PicMisc() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_PicMisc(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_PicMisc(const TrainControlResponse_PicMisc& from);
+  TrainControlResponse_PicMisc(TrainControlResponse_PicMisc&& from) noexcept
+    : TrainControlResponse_PicMisc() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_PicMisc& operator=(const TrainControlResponse_PicMisc& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_PicMisc& operator=(TrainControlResponse_PicMisc&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_PicMisc& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_PicMisc& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_PicMisc* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_PicMisc*>(
+               &_TrainControlResponse_PicMisc_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
 
-  void Swap(TrainControlResponse_PicMisc* other);
+  friend void swap(TrainControlResponse_PicMisc& a, TrainControlResponse_PicMisc& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_PicMisc* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_PicMisc* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_PicMisc* New() const { return New(NULL); }
-
-  TrainControlResponse_PicMisc* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_PicMisc* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_PicMisc>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_PicMisc& from);
-  void MergeFrom(const TrainControlResponse_PicMisc& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_PicMisc& from) {
+    TrainControlResponse_PicMisc::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_PicMisc* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.PicMisc";
   }
+  protected:
+  explicit TrainControlResponse_PicMisc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kMoreArgFieldNumber = 42,
+    kCmdFieldNumber = 38,
+    kStatusFieldNumber = 39,
+    kArg1FieldNumber = 40,
+    kArg2FieldNumber = 41,
+  };
+  // repeated int32 more_arg = 42;
+  int more_arg_size() const;
+  private:
+  int _internal_more_arg_size() const;
+  public:
+  void clear_more_arg();
+  private:
+  int32_t _internal_more_arg(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_more_arg() const;
+  void _internal_add_more_arg(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_more_arg();
+  public:
+  int32_t more_arg(int index) const;
+  void set_more_arg(int index, int32_t value);
+  void add_more_arg(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      more_arg() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_more_arg();
+
   // required int32 cmd = 38;
   bool has_cmd() const;
+  private:
+  bool _internal_has_cmd() const;
+  public:
   void clear_cmd();
-  static const int kCmdFieldNumber = 38;
-  ::google::protobuf::int32 cmd() const;
-  void set_cmd(::google::protobuf::int32 value);
+  int32_t cmd() const;
+  void set_cmd(int32_t value);
+  private:
+  int32_t _internal_cmd() const;
+  void _internal_set_cmd(int32_t value);
+  public:
 
   // required int32 status = 39;
   bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
   void clear_status();
-  static const int kStatusFieldNumber = 39;
-  ::google::protobuf::int32 status() const;
-  void set_status(::google::protobuf::int32 value);
+  int32_t status() const;
+  void set_status(int32_t value);
+  private:
+  int32_t _internal_status() const;
+  void _internal_set_status(int32_t value);
+  public:
 
   // required int32 arg1 = 40;
   bool has_arg1() const;
+  private:
+  bool _internal_has_arg1() const;
+  public:
   void clear_arg1();
-  static const int kArg1FieldNumber = 40;
-  ::google::protobuf::int32 arg1() const;
-  void set_arg1(::google::protobuf::int32 value);
+  int32_t arg1() const;
+  void set_arg1(int32_t value);
+  private:
+  int32_t _internal_arg1() const;
+  void _internal_set_arg1(int32_t value);
+  public:
 
   // required int32 arg2 = 41;
   bool has_arg2() const;
+  private:
+  bool _internal_has_arg2() const;
+  public:
   void clear_arg2();
-  static const int kArg2FieldNumber = 41;
-  ::google::protobuf::int32 arg2() const;
-  void set_arg2(::google::protobuf::int32 value);
-
-  // repeated int32 more_arg = 42;
-  int more_arg_size() const;
-  void clear_more_arg();
-  static const int kMoreArgFieldNumber = 42;
-  ::google::protobuf::int32 more_arg(int index) const;
-  void set_more_arg(int index, ::google::protobuf::int32 value);
-  void add_more_arg(::google::protobuf::int32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
-      more_arg() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
-      mutable_more_arg();
+  int32_t arg2() const;
+  void set_arg2(int32_t value);
+  private:
+  int32_t _internal_arg2() const;
+  void _internal_set_arg2(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.PicMisc)
  private:
-  inline void set_has_cmd();
-  inline void clear_has_cmd();
-  inline void set_has_status();
-  inline void clear_has_status();
-  inline void set_has_arg1();
-  inline void clear_has_arg1();
-  inline void set_has_arg2();
-  inline void clear_has_arg2();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 cmd_;
-  ::google::protobuf::int32 status_;
-  ::google::protobuf::int32 arg1_;
-  ::google::protobuf::int32 arg2_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > more_arg_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_PicMisc* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > more_arg_;
+    int32_t cmd_;
+    int32_t status_;
+    int32_t arg1_;
+    int32_t arg2_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_ReflashPic : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.ReflashPic) */ {
+class TrainControlResponse_ReflashPic final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.ReflashPic) */ {
  public:
-  TrainControlResponse_ReflashPic();
-  virtual ~TrainControlResponse_ReflashPic();
+  inline TrainControlResponse_ReflashPic() : TrainControlResponse_ReflashPic(nullptr) {}
+  ~TrainControlResponse_ReflashPic() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_ReflashPic(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_ReflashPic(const TrainControlResponse_ReflashPic& from);
+  TrainControlResponse_ReflashPic(TrainControlResponse_ReflashPic&& from) noexcept
+    : TrainControlResponse_ReflashPic() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_ReflashPic& operator=(const TrainControlResponse_ReflashPic& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_ReflashPic& operator=(TrainControlResponse_ReflashPic&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_ReflashPic& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_ReflashPic& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_ReflashPic* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_ReflashPic*>(
+               &_TrainControlResponse_ReflashPic_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
 
-  void Swap(TrainControlResponse_ReflashPic* other);
+  friend void swap(TrainControlResponse_ReflashPic& a, TrainControlResponse_ReflashPic& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_ReflashPic* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_ReflashPic* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_ReflashPic* New() const { return New(NULL); }
-
-  TrainControlResponse_ReflashPic* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_ReflashPic* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_ReflashPic>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_ReflashPic& from);
-  void MergeFrom(const TrainControlResponse_ReflashPic& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_ReflashPic& from) {
+    TrainControlResponse_ReflashPic::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_ReflashPic* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.ReflashPic";
   }
+  protected:
+  explicit TrainControlResponse_ReflashPic(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrorFieldNumber = 44,
+  };
   // optional string error = 44;
   bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
   void clear_error();
-  static const int kErrorFieldNumber = 44;
-  const ::std::string& error() const;
-  void set_error(const ::std::string& value);
-  void set_error(const char* value);
-  void set_error(const char* value, size_t size);
-  ::std::string* mutable_error();
-  ::std::string* release_error();
-  void set_allocated_error(::std::string* error);
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.ReflashPic)
  private:
-  inline void set_has_error();
-  inline void clear_has_error();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::internal::ArenaStringPtr error_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_ReflashPic* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_Cv : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.Cv) */ {
+class TrainControlResponse_Cv final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.Cv) */ {
  public:
-  TrainControlResponse_Cv();
-  virtual ~TrainControlResponse_Cv();
+  inline TrainControlResponse_Cv() : TrainControlResponse_Cv(nullptr) {}
+  ~TrainControlResponse_Cv() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_Cv(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_Cv(const TrainControlResponse_Cv& from);
+  TrainControlResponse_Cv(TrainControlResponse_Cv&& from) noexcept
+    : TrainControlResponse_Cv() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_Cv& operator=(const TrainControlResponse_Cv& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_Cv& operator=(TrainControlResponse_Cv&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_Cv& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_Cv& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_Cv* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_Cv*>(
+               &_TrainControlResponse_Cv_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
 
-  void Swap(TrainControlResponse_Cv* other);
+  friend void swap(TrainControlResponse_Cv& a, TrainControlResponse_Cv& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_Cv* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_Cv* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_Cv* New() const { return New(NULL); }
-
-  TrainControlResponse_Cv* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_Cv* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_Cv>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_Cv& from);
-  void MergeFrom(const TrainControlResponse_Cv& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_Cv& from) {
+    TrainControlResponse_Cv::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_Cv* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.Cv";
   }
+  protected:
+  explicit TrainControlResponse_Cv(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTrainIdFieldNumber = 46,
+    kCvFieldNumber = 47,
+    kErrorCodeFieldNumber = 48,
+    kValueFieldNumber = 49,
+  };
   // required int32 train_id = 46;
   bool has_train_id() const;
+  private:
+  bool _internal_has_train_id() const;
+  public:
   void clear_train_id();
-  static const int kTrainIdFieldNumber = 46;
-  ::google::protobuf::int32 train_id() const;
-  void set_train_id(::google::protobuf::int32 value);
+  int32_t train_id() const;
+  void set_train_id(int32_t value);
+  private:
+  int32_t _internal_train_id() const;
+  void _internal_set_train_id(int32_t value);
+  public:
 
   // required int32 cv = 47;
   bool has_cv() const;
+  private:
+  bool _internal_has_cv() const;
+  public:
   void clear_cv();
-  static const int kCvFieldNumber = 47;
-  ::google::protobuf::int32 cv() const;
-  void set_cv(::google::protobuf::int32 value);
+  int32_t cv() const;
+  void set_cv(int32_t value);
+  private:
+  int32_t _internal_cv() const;
+  void _internal_set_cv(int32_t value);
+  public:
 
   // optional int32 error_code = 48;
   bool has_error_code() const;
+  private:
+  bool _internal_has_error_code() const;
+  public:
   void clear_error_code();
-  static const int kErrorCodeFieldNumber = 48;
-  ::google::protobuf::int32 error_code() const;
-  void set_error_code(::google::protobuf::int32 value);
+  int32_t error_code() const;
+  void set_error_code(int32_t value);
+  private:
+  int32_t _internal_error_code() const;
+  void _internal_set_error_code(int32_t value);
+  public:
 
   // optional int32 value = 49;
   bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
   void clear_value();
-  static const int kValueFieldNumber = 49;
-  ::google::protobuf::int32 value() const;
-  void set_value(::google::protobuf::int32 value);
+  int32_t value() const;
+  void set_value(int32_t value);
+  private:
+  int32_t _internal_value() const;
+  void _internal_set_value(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.Cv)
  private:
-  inline void set_has_train_id();
-  inline void clear_has_train_id();
-  inline void set_has_cv();
-  inline void clear_has_cv();
-  inline void set_has_error_code();
-  inline void clear_has_error_code();
-  inline void set_has_value();
-  inline void clear_has_value();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::int32 train_id_;
-  ::google::protobuf::int32 cv_;
-  ::google::protobuf::int32 error_code_;
-  ::google::protobuf::int32 value_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_Cv* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t train_id_;
+    int32_t cv_;
+    int32_t error_code_;
+    int32_t value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_WaitForChangeResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.WaitForChangeResponse) */ {
+class TrainControlResponse_WaitForChangeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.WaitForChangeResponse) */ {
  public:
-  TrainControlResponse_WaitForChangeResponse();
-  virtual ~TrainControlResponse_WaitForChangeResponse();
+  inline TrainControlResponse_WaitForChangeResponse() : TrainControlResponse_WaitForChangeResponse(nullptr) {}
+  ~TrainControlResponse_WaitForChangeResponse() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_WaitForChangeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TrainControlResponse_WaitForChangeResponse(const TrainControlResponse_WaitForChangeResponse& from);
+  TrainControlResponse_WaitForChangeResponse(TrainControlResponse_WaitForChangeResponse&& from) noexcept
+    : TrainControlResponse_WaitForChangeResponse() {
+    *this = ::std::move(from);
+  }
 
   inline TrainControlResponse_WaitForChangeResponse& operator=(const TrainControlResponse_WaitForChangeResponse& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TrainControlResponse_WaitForChangeResponse& operator=(TrainControlResponse_WaitForChangeResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse_WaitForChangeResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_WaitForChangeResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_WaitForChangeResponse* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_WaitForChangeResponse*>(
+               &_TrainControlResponse_WaitForChangeResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
 
-  void Swap(TrainControlResponse_WaitForChangeResponse* other);
+  friend void swap(TrainControlResponse_WaitForChangeResponse& a, TrainControlResponse_WaitForChangeResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_WaitForChangeResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_WaitForChangeResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_WaitForChangeResponse* New() const { return New(NULL); }
-
-  TrainControlResponse_WaitForChangeResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TrainControlResponse_WaitForChangeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_WaitForChangeResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse_WaitForChangeResponse& from);
-  void MergeFrom(const TrainControlResponse_WaitForChangeResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_WaitForChangeResponse& from) {
+    TrainControlResponse_WaitForChangeResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse_WaitForChangeResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.WaitForChangeResponse";
   }
+  protected:
+  explicit TrainControlResponse_WaitForChangeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTimestampFieldNumber = 53,
+    kIdFieldNumber = 54,
+  };
   // required uint64 timestamp = 53;
   bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
   void clear_timestamp();
-  static const int kTimestampFieldNumber = 53;
-  ::google::protobuf::uint64 timestamp() const;
-  void set_timestamp(::google::protobuf::uint64 value);
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
 
   // optional int32 id = 54;
   bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
   void clear_id();
-  static const int kIdFieldNumber = 54;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse.WaitForChangeResponse)
  private:
-  inline void set_has_timestamp();
-  inline void clear_has_timestamp();
-  inline void set_has_id();
-  inline void clear_has_id();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::google::protobuf::uint64 timestamp_;
-  ::google::protobuf::int32 id_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse_WaitForChangeResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t timestamp_;
+    int32_t id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse) */ {
+class TrainControlResponse_RpcStats_Method final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.RpcStats.Method) */ {
  public:
-  TrainControlResponse();
-  virtual ~TrainControlResponse();
+  inline TrainControlResponse_RpcStats_Method() : TrainControlResponse_RpcStats_Method(nullptr) {}
+  ~TrainControlResponse_RpcStats_Method() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_RpcStats_Method(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  TrainControlResponse(const TrainControlResponse& from);
+  TrainControlResponse_RpcStats_Method(const TrainControlResponse_RpcStats_Method& from);
+  TrainControlResponse_RpcStats_Method(TrainControlResponse_RpcStats_Method&& from) noexcept
+    : TrainControlResponse_RpcStats_Method() {
+    *this = ::std::move(from);
+  }
 
-  inline TrainControlResponse& operator=(const TrainControlResponse& from) {
+  inline TrainControlResponse_RpcStats_Method& operator=(const TrainControlResponse_RpcStats_Method& from) {
     CopyFrom(from);
     return *this;
   }
+  inline TrainControlResponse_RpcStats_Method& operator=(TrainControlResponse_RpcStats_Method&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_RpcStats_Method& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_RpcStats_Method* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_RpcStats_Method*>(
+               &_TrainControlResponse_RpcStats_Method_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(TrainControlResponse_RpcStats_Method& a, TrainControlResponse_RpcStats_Method& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_RpcStats_Method* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_RpcStats_Method* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TrainControlResponse_RpcStats_Method* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_RpcStats_Method>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TrainControlResponse_RpcStats_Method& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_RpcStats_Method& from) {
+    TrainControlResponse_RpcStats_Method::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TrainControlResponse& default_instance();
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrainControlResponse_RpcStats_Method* other);
 
-  void Swap(TrainControlResponse* other);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.RpcStats.Method";
+  }
+  protected:
+  explicit TrainControlResponse_RpcStats_Method(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLatencyBucketFieldNumber = 62,
+    kNameFieldNumber = 57,
+    kCountFieldNumber = 58,
+    kErrorsFieldNumber = 59,
+    kTotalUsecFieldNumber = 60,
+    kMaxUsecFieldNumber = 61,
+  };
+  // repeated uint32 latency_bucket = 62 [packed = true];
+  int latency_bucket_size() const;
+  private:
+  int _internal_latency_bucket_size() const;
+  public:
+  void clear_latency_bucket();
+  private:
+  uint32_t _internal_latency_bucket(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_latency_bucket() const;
+  void _internal_add_latency_bucket(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_latency_bucket();
+  public:
+  uint32_t latency_bucket(int index) const;
+  void set_latency_bucket(int index, uint32_t value);
+  void add_latency_bucket(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      latency_bucket() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_latency_bucket();
+
+  // required string name = 57;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional uint32 count = 58;
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  uint32_t count() const;
+  void set_count(uint32_t value);
+  private:
+  uint32_t _internal_count() const;
+  void _internal_set_count(uint32_t value);
+  public:
+
+  // optional uint32 errors = 59;
+  bool has_errors() const;
+  private:
+  bool _internal_has_errors() const;
+  public:
+  void clear_errors();
+  uint32_t errors() const;
+  void set_errors(uint32_t value);
+  private:
+  uint32_t _internal_errors() const;
+  void _internal_set_errors(uint32_t value);
+  public:
+
+  // optional uint64 total_usec = 60;
+  bool has_total_usec() const;
+  private:
+  bool _internal_has_total_usec() const;
+  public:
+  void clear_total_usec();
+  uint64_t total_usec() const;
+  void set_total_usec(uint64_t value);
+  private:
+  uint64_t _internal_total_usec() const;
+  void _internal_set_total_usec(uint64_t value);
+  public:
+
+  // optional uint64 max_usec = 61;
+  bool has_max_usec() const;
+  private:
+  bool _internal_has_max_usec() const;
+  public:
+  void clear_max_usec();
+  uint64_t max_usec() const;
+  void set_max_usec(uint64_t value);
+  private:
+  uint64_t _internal_max_usec() const;
+  void _internal_set_max_usec(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:server.TrainControlResponse.RpcStats.Method)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > latency_bucket_;
+    mutable std::atomic<int> _latency_bucket_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t count_;
+    uint32_t errors_;
+    uint64_t total_usec_;
+    uint64_t max_usec_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TrainControlResponse_RpcStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.RpcStats) */ {
+ public:
+  inline TrainControlResponse_RpcStats() : TrainControlResponse_RpcStats(nullptr) {}
+  ~TrainControlResponse_RpcStats() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse_RpcStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TrainControlResponse_RpcStats(const TrainControlResponse_RpcStats& from);
+  TrainControlResponse_RpcStats(TrainControlResponse_RpcStats&& from) noexcept
+    : TrainControlResponse_RpcStats() {
+    *this = ::std::move(from);
+  }
+
+  inline TrainControlResponse_RpcStats& operator=(const TrainControlResponse_RpcStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TrainControlResponse_RpcStats& operator=(TrainControlResponse_RpcStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse_RpcStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse_RpcStats* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_RpcStats*>(
+               &_TrainControlResponse_RpcStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(TrainControlResponse_RpcStats& a, TrainControlResponse_RpcStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_RpcStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_RpcStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse* New() const { return New(NULL); }
+  TrainControlResponse_RpcStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse_RpcStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TrainControlResponse_RpcStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse_RpcStats& from) {
+    TrainControlResponse_RpcStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrainControlResponse_RpcStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.RpcStats";
+  }
+  protected:
+  explicit TrainControlResponse_RpcStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TrainControlResponse_RpcStats_Method Method;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMethodFieldNumber = 56,
+    kBucketBaseUsecFieldNumber = 63,
+    kNumLoggedFieldNumber = 64,
+    kNumCallsFieldNumber = 65,
+  };
+  // repeated group Method = 56 { ... };
+  int method_size() const;
+  private:
+  int _internal_method_size() const;
+  public:
+  void clear_method();
+  ::server::TrainControlResponse_RpcStats_Method* mutable_method(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_RpcStats_Method >*
+      mutable_method();
+  private:
+  const ::server::TrainControlResponse_RpcStats_Method& _internal_method(int index) const;
+  ::server::TrainControlResponse_RpcStats_Method* _internal_add_method();
+  public:
+  const ::server::TrainControlResponse_RpcStats_Method& method(int index) const;
+  ::server::TrainControlResponse_RpcStats_Method* add_method();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_RpcStats_Method >&
+      method() const;
+
+  // optional uint32 bucket_base_usec = 63;
+  bool has_bucket_base_usec() const;
+  private:
+  bool _internal_has_bucket_base_usec() const;
+  public:
+  void clear_bucket_base_usec();
+  uint32_t bucket_base_usec() const;
+  void set_bucket_base_usec(uint32_t value);
+  private:
+  uint32_t _internal_bucket_base_usec() const;
+  void _internal_set_bucket_base_usec(uint32_t value);
+  public:
+
+  // optional uint32 num_logged = 64;
+  bool has_num_logged() const;
+  private:
+  bool _internal_has_num_logged() const;
+  public:
+  void clear_num_logged();
+  uint32_t num_logged() const;
+  void set_num_logged(uint32_t value);
+  private:
+  uint32_t _internal_num_logged() const;
+  void _internal_set_num_logged(uint32_t value);
+  public:
+
+  // optional uint32 num_calls = 65;
+  bool has_num_calls() const;
+  private:
+  bool _internal_has_num_calls() const;
+  public:
+  void clear_num_calls();
+  uint32_t num_calls() const;
+  void set_num_calls(uint32_t value);
+  private:
+  uint32_t _internal_num_calls() const;
+  void _internal_set_num_calls(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:server.TrainControlResponse.RpcStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_RpcStats_Method > method_;
+    uint32_t bucket_base_usec_;
+    uint32_t num_logged_;
+    uint32_t num_calls_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TrainControlResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse) */ {
+ public:
+  inline TrainControlResponse() : TrainControlResponse(nullptr) {}
+  ~TrainControlResponse() override;
+  explicit PROTOBUF_CONSTEXPR TrainControlResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TrainControlResponse(const TrainControlResponse& from);
+  TrainControlResponse(TrainControlResponse&& from) noexcept
+    : TrainControlResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TrainControlResponse& operator=(const TrainControlResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TrainControlResponse& operator=(TrainControlResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
 
-  TrainControlResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TrainControlResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TrainControlResponse* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse*>(
+               &_TrainControlResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(TrainControlResponse& a, TrainControlResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TrainControlResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TrainControlResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TrainControlResponse& from);
-  void MergeFrom(const TrainControlResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TrainControlResponse& from) {
+    TrainControlResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TrainControlResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse";
   }
+  protected:
+  explicit TrainControlResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -4165,506 +7721,816 @@ class TrainControlResponse : public ::google::protobuf::Message /* @@protoc_inse
   typedef TrainControlResponse_ReflashPic ReflashPic;
   typedef TrainControlResponse_Cv Cv;
   typedef TrainControlResponse_WaitForChangeResponse WaitForChangeResponse;
+  typedef TrainControlResponse_RpcStats RpcStats;
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kLokstateFieldNumber = 36,
+    kSpeedFieldNumber = 1,
+    kAccessoryFieldNumber = 4,
+    kEmergencystopFieldNumber = 8,
+    kRpcresponseFieldNumber = 16,
+    kPongFieldNumber = 19,
+    kCurrentaddressFieldNumber = 21,
+    kRawcanpacketFieldNumber = 23,
+    kReflashautomataFieldNumber = 27,
+    kLokdbFieldNumber = 28,
+    kPicmiscFieldNumber = 37,
+    kReflashpicFieldNumber = 43,
+    kCvFieldNumber = 45,
+    kWaitforchangeresponseFieldNumber = 52,
+    kRpcstatsFieldNumber = 55,
+  };
+  // repeated .server.LokStateProto lokstate = 36;
+  int lokstate_size() const;
+  private:
+  int _internal_lokstate_size() const;
+  public:
+  void clear_lokstate();
+  ::server::LokStateProto* mutable_lokstate(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto >*
+      mutable_lokstate();
+  private:
+  const ::server::LokStateProto& _internal_lokstate(int index) const;
+  ::server::LokStateProto* _internal_add_lokstate();
+  public:
+  const ::server::LokStateProto& lokstate(int index) const;
+  ::server::LokStateProto* add_lokstate();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto >&
+      lokstate() const;
+
   // optional group Speed = 1 { ... };
   bool has_speed() const;
+  private:
+  bool _internal_has_speed() const;
+  public:
   void clear_speed();
-  static const int kSpeedFieldNumber = 1;
   const ::server::TrainControlResponse_Speed& speed() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_Speed* release_speed();
   ::server::TrainControlResponse_Speed* mutable_speed();
-  ::server::TrainControlResponse_Speed* release_speed();
   void set_allocated_speed(::server::TrainControlResponse_Speed* speed);
+  private:
+  const ::server::TrainControlResponse_Speed& _internal_speed() const;
+  ::server::TrainControlResponse_Speed* _internal_mutable_speed();
+  public:
+  void unsafe_arena_set_allocated_speed(
+      ::server::TrainControlResponse_Speed* speed);
+  ::server::TrainControlResponse_Speed* unsafe_arena_release_speed();
 
   // optional group Accessory = 4 { ... };
   bool has_accessory() const;
+  private:
+  bool _internal_has_accessory() const;
+  public:
   void clear_accessory();
-  static const int kAccessoryFieldNumber = 4;
   const ::server::TrainControlResponse_Accessory& accessory() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_Accessory* release_accessory();
   ::server::TrainControlResponse_Accessory* mutable_accessory();
-  ::server::TrainControlResponse_Accessory* release_accessory();
   void set_allocated_accessory(::server::TrainControlResponse_Accessory* accessory);
+  private:
+  const ::server::TrainControlResponse_Accessory& _internal_accessory() const;
+  ::server::TrainControlResponse_Accessory* _internal_mutable_accessory();
+  public:
+  void unsafe_arena_set_allocated_accessory(
+      ::server::TrainControlResponse_Accessory* accessory);
+  ::server::TrainControlResponse_Accessory* unsafe_arena_release_accessory();
 
   // optional group EmergencyStop = 8 { ... };
   bool has_emergencystop() const;
+  private:
+  bool _internal_has_emergencystop() const;
+  public:
   void clear_emergencystop();
-  static const int kEmergencystopFieldNumber = 8;
   const ::server::TrainControlResponse_EmergencyStop& emergencystop() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_EmergencyStop* release_emergencystop();
   ::server::TrainControlResponse_EmergencyStop* mutable_emergencystop();
-  ::server::TrainControlResponse_EmergencyStop* release_emergencystop();
   void set_allocated_emergencystop(::server::TrainControlResponse_EmergencyStop* emergencystop);
+  private:
+  const ::server::TrainControlResponse_EmergencyStop& _internal_emergencystop() const;
+  ::server::TrainControlResponse_EmergencyStop* _internal_mutable_emergencystop();
+  public:
+  void unsafe_arena_set_allocated_emergencystop(
+      ::server::TrainControlResponse_EmergencyStop* emergencystop);
+  ::server::TrainControlResponse_EmergencyStop* unsafe_arena_release_emergencystop();
 
   // optional group RpcResponse = 16 { ... };
   bool has_rpcresponse() const;
+  private:
+  bool _internal_has_rpcresponse() const;
+  public:
   void clear_rpcresponse();
-  static const int kRpcresponseFieldNumber = 16;
   const ::server::TrainControlResponse_RpcResponse& rpcresponse() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_RpcResponse* release_rpcresponse();
   ::server::TrainControlResponse_RpcResponse* mutable_rpcresponse();
-  ::server::TrainControlResponse_RpcResponse* release_rpcresponse();
   void set_allocated_rpcresponse(::server::TrainControlResponse_RpcResponse* rpcresponse);
+  private:
+  const ::server::TrainControlResponse_RpcResponse& _internal_rpcresponse() const;
+  ::server::TrainControlResponse_RpcResponse* _internal_mutable_rpcresponse();
+  public:
+  void unsafe_arena_set_allocated_rpcresponse(
+      ::server::TrainControlResponse_RpcResponse* rpcresponse);
+  ::server::TrainControlResponse_RpcResponse* unsafe_arena_release_rpcresponse();
 
   // optional group Pong = 19 { ... };
   bool has_pong() const;
+  private:
+  bool _internal_has_pong() const;
+  public:
   void clear_pong();
-  static const int kPongFieldNumber = 19;
   const ::server::TrainControlResponse_Pong& pong() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_Pong* release_pong();
   ::server::TrainControlResponse_Pong* mutable_pong();
-  ::server::TrainControlResponse_Pong* release_pong();
   void set_allocated_pong(::server::TrainControlResponse_Pong* pong);
+  private:
+  const ::server::TrainControlResponse_Pong& _internal_pong() const;
+  ::server::TrainControlResponse_Pong* _internal_mutable_pong();
+  public:
+  void unsafe_arena_set_allocated_pong(
+      ::server::TrainControlResponse_Pong* pong);
+  ::server::TrainControlResponse_Pong* unsafe_arena_release_pong();
 
   // optional group CurrentAddress = 21 { ... };
   bool has_currentaddress() const;
+  private:
+  bool _internal_has_currentaddress() const;
+  public:
   void clear_currentaddress();
-  static const int kCurrentaddressFieldNumber = 21;
   const ::server::TrainControlResponse_CurrentAddress& currentaddress() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_CurrentAddress* release_currentaddress();
   ::server::TrainControlResponse_CurrentAddress* mutable_currentaddress();
-  ::server::TrainControlResponse_CurrentAddress* release_currentaddress();
   void set_allocated_currentaddress(::server::TrainControlResponse_CurrentAddress* currentaddress);
+  private:
+  const ::server::TrainControlResponse_CurrentAddress& _internal_currentaddress() const;
+  ::server::TrainControlResponse_CurrentAddress* _internal_mutable_currentaddress();
+  public:
+  void unsafe_arena_set_allocated_currentaddress(
+      ::server::TrainControlResponse_CurrentAddress* currentaddress);
+  ::server::TrainControlResponse_CurrentAddress* unsafe_arena_release_currentaddress();
 
   // optional group RawCanPacket = 23 { ... };
   bool has_rawcanpacket() const;
+  private:
+  bool _internal_has_rawcanpacket() const;
+  public:
   void clear_rawcanpacket();
-  static const int kRawcanpacketFieldNumber = 23;
   const ::server::TrainControlResponse_RawCanPacket& rawcanpacket() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_RawCanPacket* release_rawcanpacket();
   ::server::TrainControlResponse_RawCanPacket* mutable_rawcanpacket();
-  ::server::TrainControlResponse_RawCanPacket* release_rawcanpacket();
   void set_allocated_rawcanpacket(::server::TrainControlResponse_RawCanPacket* rawcanpacket);
+  private:
+  const ::server::TrainControlResponse_RawCanPacket& _internal_rawcanpacket() const;
+  ::server::TrainControlResponse_RawCanPacket* _internal_mutable_rawcanpacket();
+  public:
+  void unsafe_arena_set_allocated_rawcanpacket(
+      ::server::TrainControlResponse_RawCanPacket* rawcanpacket);
+  ::server::TrainControlResponse_RawCanPacket* unsafe_arena_release_rawcanpacket();
 
   // optional group ReflashAutomata = 27 { ... };
   bool has_reflashautomata() const;
+  private:
+  bool _internal_has_reflashautomata() const;
+  public:
   void clear_reflashautomata();
-  static const int kReflashautomataFieldNumber = 27;
   const ::server::TrainControlResponse_ReflashAutomata& reflashautomata() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_ReflashAutomata* release_reflashautomata();
   ::server::TrainControlResponse_ReflashAutomata* mutable_reflashautomata();
-  ::server::TrainControlResponse_ReflashAutomata* release_reflashautomata();
   void set_allocated_reflashautomata(::server::TrainControlResponse_ReflashAutomata* reflashautomata);
+  private:
+  const ::server::TrainControlResponse_ReflashAutomata& _internal_reflashautomata() const;
+  ::server::TrainControlResponse_ReflashAutomata* _internal_mutable_reflashautomata();
+  public:
+  void unsafe_arena_set_allocated_reflashautomata(
+      ::server::TrainControlResponse_ReflashAutomata* reflashautomata);
+  ::server::TrainControlResponse_ReflashAutomata* unsafe_arena_release_reflashautomata();
 
   // optional group LokDb = 28 { ... };
   bool has_lokdb() const;
+  private:
+  bool _internal_has_lokdb() const;
+  public:
   void clear_lokdb();
-  static const int kLokdbFieldNumber = 28;
   const ::server::TrainControlResponse_LokDb& lokdb() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_LokDb* release_lokdb();
   ::server::TrainControlResponse_LokDb* mutable_lokdb();
-  ::server::TrainControlResponse_LokDb* release_lokdb();
   void set_allocated_lokdb(::server::TrainControlResponse_LokDb* lokdb);
-
-  // repeated .server.LokStateProto lokstate = 36;
-  int lokstate_size() const;
-  void clear_lokstate();
-  static const int kLokstateFieldNumber = 36;
-  const ::server::LokStateProto& lokstate(int index) const;
-  ::server::LokStateProto* mutable_lokstate(int index);
-  ::server::LokStateProto* add_lokstate();
-  ::google::protobuf::RepeatedPtrField< ::server::LokStateProto >*
-      mutable_lokstate();
-  const ::google::protobuf::RepeatedPtrField< ::server::LokStateProto >&
-      lokstate() const;
+  private:
+  const ::server::TrainControlResponse_LokDb& _internal_lokdb() const;
+  ::server::TrainControlResponse_LokDb* _internal_mutable_lokdb();
+  public:
+  void unsafe_arena_set_allocated_lokdb(
+      ::server::TrainControlResponse_LokDb* lokdb);
+  ::server::TrainControlResponse_LokDb* unsafe_arena_release_lokdb();
 
   // optional group PicMisc = 37 { ... };
   bool has_picmisc() const;
+  private:
+  bool _internal_has_picmisc() const;
+  public:
   void clear_picmisc();
-  static const int kPicmiscFieldNumber = 37;
   const ::server::TrainControlResponse_PicMisc& picmisc() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_PicMisc* release_picmisc();
   ::server::TrainControlResponse_PicMisc* mutable_picmisc();
-  ::server::TrainControlResponse_PicMisc* release_picmisc();
   void set_allocated_picmisc(::server::TrainControlResponse_PicMisc* picmisc);
+  private:
+  const ::server::TrainControlResponse_PicMisc& _internal_picmisc() const;
+  ::server::TrainControlResponse_PicMisc* _internal_mutable_picmisc();
+  public:
+  void unsafe_arena_set_allocated_picmisc(
+      ::server::TrainControlResponse_PicMisc* picmisc);
+  ::server::TrainControlResponse_PicMisc* unsafe_arena_release_picmisc();
 
   // optional group ReflashPic = 43 { ... };
   bool has_reflashpic() const;
+  private:
+  bool _internal_has_reflashpic() const;
+  public:
   void clear_reflashpic();
-  static const int kReflashpicFieldNumber = 43;
   const ::server::TrainControlResponse_ReflashPic& reflashpic() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_ReflashPic* release_reflashpic();
   ::server::TrainControlResponse_ReflashPic* mutable_reflashpic();
-  ::server::TrainControlResponse_ReflashPic* release_reflashpic();
   void set_allocated_reflashpic(::server::TrainControlResponse_ReflashPic* reflashpic);
+  private:
+  const ::server::TrainControlResponse_ReflashPic& _internal_reflashpic() const;
+  ::server::TrainControlResponse_ReflashPic* _internal_mutable_reflashpic();
+  public:
+  void unsafe_arena_set_allocated_reflashpic(
+      ::server::TrainControlResponse_ReflashPic* reflashpic);
+  ::server::TrainControlResponse_ReflashPic* unsafe_arena_release_reflashpic();
 
   // optional group Cv = 45 { ... };
   bool has_cv() const;
+  private:
+  bool _internal_has_cv() const;
+  public:
   void clear_cv();
-  static const int kCvFieldNumber = 45;
   const ::server::TrainControlResponse_Cv& cv() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_Cv* release_cv();
   ::server::TrainControlResponse_Cv* mutable_cv();
-  ::server::TrainControlResponse_Cv* release_cv();
   void set_allocated_cv(::server::TrainControlResponse_Cv* cv);
+  private:
+  const ::server::TrainControlResponse_Cv& _internal_cv() const;
+  ::server::TrainControlResponse_Cv* _internal_mutable_cv();
+  public:
+  void unsafe_arena_set_allocated_cv(
+      ::server::TrainControlResponse_Cv* cv);
+  ::server::TrainControlResponse_Cv* unsafe_arena_release_cv();
 
   // optional group WaitForChangeResponse = 52 { ... };
   bool has_waitforchangeresponse() const;
+  private:
+  bool _internal_has_waitforchangeresponse() const;
+  public:
   void clear_waitforchangeresponse();
-  static const int kWaitforchangeresponseFieldNumber = 52;
   const ::server::TrainControlResponse_WaitForChangeResponse& waitforchangeresponse() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_WaitForChangeResponse* release_waitforchangeresponse();
   ::server::TrainControlResponse_WaitForChangeResponse* mutable_waitforchangeresponse();
-  ::server::TrainControlResponse_WaitForChangeResponse* release_waitforchangeresponse();
   void set_allocated_waitforchangeresponse(::server::TrainControlResponse_WaitForChangeResponse* waitforchangeresponse);
+  private:
+  const ::server::TrainControlResponse_WaitForChangeResponse& _internal_waitforchangeresponse() const;
+  ::server::TrainControlResponse_WaitForChangeResponse* _internal_mutable_waitforchangeresponse();
+  public:
+  void unsafe_arena_set_allocated_waitforchangeresponse(
+      ::server::TrainControlResponse_WaitForChangeResponse* waitforchangeresponse);
+  ::server::TrainControlResponse_WaitForChangeResponse* unsafe_arena_release_waitforchangeresponse();
+
+  // optional group RpcStats = 55 { ... };
+  bool has_rpcstats() const;
+  private:
+  bool _internal_has_rpcstats() const;
+  public:
+  void clear_rpcstats();
+  const ::server::TrainControlResponse_RpcStats& rpcstats() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse_RpcStats* release_rpcstats();
+  ::server::TrainControlResponse_RpcStats* mutable_rpcstats();
+  void set_allocated_rpcstats(::server::TrainControlResponse_RpcStats* rpcstats);
+  private:
+  const ::server::TrainControlResponse_RpcStats& _internal_rpcstats() const;
+  ::server::TrainControlResponse_RpcStats* _internal_mutable_rpcstats();
+  public:
+  void unsafe_arena_set_allocated_rpcstats(
+      ::server::TrainControlResponse_RpcStats* rpcstats);
+  ::server::TrainControlResponse_RpcStats* unsafe_arena_release_rpcstats();
 
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse)
  private:
-  inline void set_has_speed();
-  inline void clear_has_speed();
-  inline void set_has_accessory();
-  inline void clear_has_accessory();
-  inline void set_has_emergencystop();
-  inline void clear_has_emergencystop();
-  inline void set_has_rpcresponse();
-  inline void clear_has_rpcresponse();
-  inline void set_has_pong();
-  inline void clear_has_pong();
-  inline void set_has_currentaddress();
-  inline void clear_has_currentaddress();
-  inline void set_has_rawcanpacket();
-  inline void clear_has_rawcanpacket();
-  inline void set_has_reflashautomata();
-  inline void clear_has_reflashautomata();
-  inline void set_has_lokdb();
-  inline void clear_has_lokdb();
-  inline void set_has_picmisc();
-  inline void clear_has_picmisc();
-  inline void set_has_reflashpic();
-  inline void clear_has_reflashpic();
-  inline void set_has_cv();
-  inline void clear_has_cv();
-  inline void set_has_waitforchangeresponse();
-  inline void clear_has_waitforchangeresponse();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::server::TrainControlResponse_Speed* speed_;
-  ::server::TrainControlResponse_Accessory* accessory_;
-  ::server::TrainControlResponse_EmergencyStop* emergencystop_;
-  ::server::TrainControlResponse_RpcResponse* rpcresponse_;
-  ::server::TrainControlResponse_Pong* pong_;
-  ::server::TrainControlResponse_CurrentAddress* currentaddress_;
-  ::server::TrainControlResponse_RawCanPacket* rawcanpacket_;
-  ::server::TrainControlResponse_ReflashAutomata* reflashautomata_;
-  ::server::TrainControlResponse_LokDb* lokdb_;
-  ::google::protobuf::RepeatedPtrField< ::server::LokStateProto > lokstate_;
-  ::server::TrainControlResponse_PicMisc* picmisc_;
-  ::server::TrainControlResponse_ReflashPic* reflashpic_;
-  ::server::TrainControlResponse_Cv* cv_;
-  ::server::TrainControlResponse_WaitForChangeResponse* waitforchangeresponse_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TrainControlResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto > lokstate_;
+    ::server::TrainControlResponse_Speed* speed_;
+    ::server::TrainControlResponse_Accessory* accessory_;
+    ::server::TrainControlResponse_EmergencyStop* emergencystop_;
+    ::server::TrainControlResponse_RpcResponse* rpcresponse_;
+    ::server::TrainControlResponse_Pong* pong_;
+    ::server::TrainControlResponse_CurrentAddress* currentaddress_;
+    ::server::TrainControlResponse_RawCanPacket* rawcanpacket_;
+    ::server::TrainControlResponse_ReflashAutomata* reflashautomata_;
+    ::server::TrainControlResponse_LokDb* lokdb_;
+    ::server::TrainControlResponse_PicMisc* picmisc_;
+    ::server::TrainControlResponse_ReflashPic* reflashpic_;
+    ::server::TrainControlResponse_Cv* cv_;
+    ::server::TrainControlResponse_WaitForChangeResponse* waitforchangeresponse_;
+    ::server::TrainControlResponse_RpcStats* rpcstats_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TinyRpcRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TinyRpcRequest) */ {
+class TinyRpcRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TinyRpcRequest) */ {
  public:
-  TinyRpcRequest();
-  virtual ~TinyRpcRequest();
+  inline TinyRpcRequest() : TinyRpcRequest(nullptr) {}
+  ~TinyRpcRequest() override;
+  explicit PROTOBUF_CONSTEXPR TinyRpcRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TinyRpcRequest(const TinyRpcRequest& from);
+  TinyRpcRequest(TinyRpcRequest&& from) noexcept
+    : TinyRpcRequest() {
+    *this = ::std::move(from);
+  }
 
   inline TinyRpcRequest& operator=(const TinyRpcRequest& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TinyRpcRequest& operator=(TinyRpcRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TinyRpcRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TinyRpcRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TinyRpcRequest* internal_default_instance() {
+    return reinterpret_cast<const TinyRpcRequest*>(
+               &_TinyRpcRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    39;
 
-  void Swap(TinyRpcRequest* other);
+  friend void swap(TinyRpcRequest& a, TinyRpcRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TinyRpcRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TinyRpcRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TinyRpcRequest* New() const { return New(NULL); }
-
-  TinyRpcRequest* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TinyRpcRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TinyRpcRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TinyRpcRequest& from);
-  void MergeFrom(const TinyRpcRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TinyRpcRequest& from) {
+    TinyRpcRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TinyRpcRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TinyRpcRequest";
   }
+  protected:
+  explicit TinyRpcRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 id = 1;
-  bool has_id() const;
-  void clear_id();
-  static const int kIdFieldNumber = 1;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
-
+  enum : int {
+    kRequestFieldNumber = 2,
+    kIdFieldNumber = 1,
+  };
   // required .server.TrainControlRequest request = 2;
   bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
   void clear_request();
-  static const int kRequestFieldNumber = 2;
   const ::server::TrainControlRequest& request() const;
+  PROTOBUF_NODISCARD ::server::TrainControlRequest* release_request();
   ::server::TrainControlRequest* mutable_request();
-  ::server::TrainControlRequest* release_request();
   void set_allocated_request(::server::TrainControlRequest* request);
+  private:
+  const ::server::TrainControlRequest& _internal_request() const;
+  ::server::TrainControlRequest* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::server::TrainControlRequest* request);
+  ::server::TrainControlRequest* unsafe_arena_release_request();
+
+  // required int32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TinyRpcRequest)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_request();
-  inline void clear_has_request();
-
-  // helper for ByteSize()
-  int RequiredFieldsByteSizeFallback() const;
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::server::TrainControlRequest* request_;
-  ::google::protobuf::int32 id_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TinyRpcRequest* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::server::TrainControlRequest* request_;
+    int32_t id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TinyRpcResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:server.TinyRpcResponse) */ {
+class TinyRpcResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TinyRpcResponse) */ {
  public:
-  TinyRpcResponse();
-  virtual ~TinyRpcResponse();
+  inline TinyRpcResponse() : TinyRpcResponse(nullptr) {}
+  ~TinyRpcResponse() override;
+  explicit PROTOBUF_CONSTEXPR TinyRpcResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TinyRpcResponse(const TinyRpcResponse& from);
+  TinyRpcResponse(TinyRpcResponse&& from) noexcept
+    : TinyRpcResponse() {
+    *this = ::std::move(from);
+  }
 
   inline TinyRpcResponse& operator=(const TinyRpcResponse& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _internal_metadata_.unknown_fields();
+  inline TinyRpcResponse& operator=(TinyRpcResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return _internal_metadata_.mutable_unknown_fields();
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TinyRpcResponse& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TinyRpcResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TinyRpcResponse* internal_default_instance() {
+    return reinterpret_cast<const TinyRpcResponse*>(
+               &_TinyRpcResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    40;
 
-  void Swap(TinyRpcResponse* other);
+  friend void swap(TinyRpcResponse& a, TinyRpcResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TinyRpcResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TinyRpcResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TinyRpcResponse* New() const { return New(NULL); }
-
-  TinyRpcResponse* New(::google::protobuf::Arena* arena) const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  TinyRpcResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TinyRpcResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TinyRpcResponse& from);
-  void MergeFrom(const TinyRpcResponse& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const {
-    return InternalSerializeWithCachedSizesToArray(false, output);
-  }
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TinyRpcResponse& from) {
+    TinyRpcResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
   void InternalSwap(TinyRpcResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return _internal_metadata_.arena();
-  }
-  inline void* MaybeArenaPtr() const {
-    return _internal_metadata_.raw_arena_ptr();
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TinyRpcResponse";
   }
+  protected:
+  explicit TinyRpcResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 id = 1;
-  bool has_id() const;
-  void clear_id();
-  static const int kIdFieldNumber = 1;
-  ::google::protobuf::int32 id() const;
-  void set_id(::google::protobuf::int32 value);
+  enum : int {
+    kErrorDetailFieldNumber = 3,
+    kResponseFieldNumber = 4,
+    kIdFieldNumber = 1,
+    kFailedFieldNumber = 2,
+  };
+  // optional string error_detail = 3;
+  bool has_error_detail() const;
+  private:
+  bool _internal_has_error_detail() const;
+  public:
+  void clear_error_detail();
+  const std::string& error_detail() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_detail(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_detail();
+  PROTOBUF_NODISCARD std::string* release_error_detail();
+  void set_allocated_error_detail(std::string* error_detail);
+  private:
+  const std::string& _internal_error_detail() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_detail(const std::string& value);
+  std::string* _internal_mutable_error_detail();
+  public:
 
   // optional .server.TrainControlResponse response = 4;
   bool has_response() const;
+  private:
+  bool _internal_has_response() const;
+  public:
   void clear_response();
-  static const int kResponseFieldNumber = 4;
   const ::server::TrainControlResponse& response() const;
+  PROTOBUF_NODISCARD ::server::TrainControlResponse* release_response();
   ::server::TrainControlResponse* mutable_response();
-  ::server::TrainControlResponse* release_response();
   void set_allocated_response(::server::TrainControlResponse* response);
+  private:
+  const ::server::TrainControlResponse& _internal_response() const;
+  ::server::TrainControlResponse* _internal_mutable_response();
+  public:
+  void unsafe_arena_set_allocated_response(
+      ::server::TrainControlResponse* response);
+  ::server::TrainControlResponse* unsafe_arena_release_response();
+
+  // required int32 id = 1;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  int32_t id() const;
+  void set_id(int32_t value);
+  private:
+  int32_t _internal_id() const;
+  void _internal_set_id(int32_t value);
+  public:
 
   // optional bool failed = 2 [default = false];
   bool has_failed() const;
+  private:
+  bool _internal_has_failed() const;
+  public:
   void clear_failed();
-  static const int kFailedFieldNumber = 2;
   bool failed() const;
   void set_failed(bool value);
-
-  // optional string error_detail = 3;
-  bool has_error_detail() const;
-  void clear_error_detail();
-  static const int kErrorDetailFieldNumber = 3;
-  const ::std::string& error_detail() const;
-  void set_error_detail(const ::std::string& value);
-  void set_error_detail(const char* value);
-  void set_error_detail(const char* value, size_t size);
-  ::std::string* mutable_error_detail();
-  ::std::string* release_error_detail();
-  void set_allocated_error_detail(::std::string* error_detail);
+  private:
+  bool _internal_failed() const;
+  void _internal_set_failed(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:server.TinyRpcResponse)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_response();
-  inline void clear_has_response();
-  inline void set_has_failed();
-  inline void clear_has_failed();
-  inline void set_has_error_detail();
-  inline void clear_has_error_detail();
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 _has_bits_[1];
-  mutable int _cached_size_;
-  ::server::TrainControlResponse* response_;
-  ::google::protobuf::int32 id_;
-  bool failed_;
-  ::google::protobuf::internal::ArenaStringPtr error_detail_;
-  friend void  protobuf_AddDesc_train_5fcontrol_2eproto();
-  friend void protobuf_AssignDesc_train_5fcontrol_2eproto();
-  friend void protobuf_ShutdownFile_train_5fcontrol_2eproto();
-
-  void InitAsDefaultInstance();
-  static TinyRpcResponse* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_detail_;
+    ::server::TrainControlResponse* response_;
+    int32_t id_;
+    bool failed_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
-#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // LokStateProto_Function
 
 // required int32 id = 5;
-inline bool LokStateProto_Function::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool LokStateProto_Function::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void LokStateProto_Function::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void LokStateProto_Function::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool LokStateProto_Function::has_id() const {
+  return _internal_has_id();
 }
 inline void LokStateProto_Function::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::google::protobuf::int32 LokStateProto_Function::id() const {
+inline int32_t LokStateProto_Function::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t LokStateProto_Function::id() const {
   // @@protoc_insertion_point(field_get:server.LokStateProto.Function.id)
-  return id_;
+  return _internal_id();
+}
+inline void LokStateProto_Function::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
 }
-inline void LokStateProto_Function::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void LokStateProto_Function::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.LokStateProto.Function.id)
 }
 
 // optional int32 value = 6;
-inline bool LokStateProto_Function::has_value() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void LokStateProto_Function::set_has_value() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool LokStateProto_Function::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void LokStateProto_Function::clear_has_value() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool LokStateProto_Function::has_value() const {
+  return _internal_has_value();
 }
 inline void LokStateProto_Function::clear_value() {
-  value_ = 0;
-  clear_has_value();
+  _impl_.value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t LokStateProto_Function::_internal_value() const {
+  return _impl_.value_;
 }
-inline ::google::protobuf::int32 LokStateProto_Function::value() const {
+inline int32_t LokStateProto_Function::value() const {
   // @@protoc_insertion_point(field_get:server.LokStateProto.Function.value)
-  return value_;
+  return _internal_value();
 }
-inline void LokStateProto_Function::set_value(::google::protobuf::int32 value) {
-  set_has_value();
-  value_ = value;
+inline void LokStateProto_Function::_internal_set_value(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_ = value;
+}
+inline void LokStateProto_Function::set_value(int32_t value) {
+  _internal_set_value(value);
   // @@protoc_insertion_point(field_set:server.LokStateProto.Function.value)
 }
 
 // optional int64 ts = 8;
-inline bool LokStateProto_Function::has_ts() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool LokStateProto_Function::_internal_has_ts() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void LokStateProto_Function::set_has_ts() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void LokStateProto_Function::clear_has_ts() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool LokStateProto_Function::has_ts() const {
+  return _internal_has_ts();
 }
 inline void LokStateProto_Function::clear_ts() {
-  ts_ = GOOGLE_LONGLONG(0);
-  clear_has_ts();
+  _impl_.ts_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::int64 LokStateProto_Function::ts() const {
+inline int64_t LokStateProto_Function::_internal_ts() const {
+  return _impl_.ts_;
+}
+inline int64_t LokStateProto_Function::ts() const {
   // @@protoc_insertion_point(field_get:server.LokStateProto.Function.ts)
-  return ts_;
+  return _internal_ts();
+}
+inline void LokStateProto_Function::_internal_set_ts(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.ts_ = value;
 }
-inline void LokStateProto_Function::set_ts(::google::protobuf::int64 value) {
-  set_has_ts();
-  ts_ = value;
+inline void LokStateProto_Function::set_ts(int64_t value) {
+  _internal_set_ts(value);
   // @@protoc_insertion_point(field_set:server.LokStateProto.Function.ts)
 }
 
@@ -4673,152 +8539,182 @@ inline void LokStateProto_Function::set_ts(::google::protobuf::int64 value) {
 // LokStateProto
 
 // required int32 id = 1;
-inline bool LokStateProto::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void LokStateProto::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool LokStateProto::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void LokStateProto::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool LokStateProto::has_id() const {
+  return _internal_has_id();
 }
 inline void LokStateProto::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t LokStateProto::_internal_id() const {
+  return _impl_.id_;
 }
-inline ::google::protobuf::int32 LokStateProto::id() const {
+inline int32_t LokStateProto::id() const {
   // @@protoc_insertion_point(field_get:server.LokStateProto.id)
-  return id_;
+  return _internal_id();
 }
-inline void LokStateProto::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void LokStateProto::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void LokStateProto::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.LokStateProto.id)
 }
 
 // optional int32 dir = 2 [default = 1];
-inline bool LokStateProto::has_dir() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool LokStateProto::_internal_has_dir() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void LokStateProto::set_has_dir() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void LokStateProto::clear_has_dir() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool LokStateProto::has_dir() const {
+  return _internal_has_dir();
 }
 inline void LokStateProto::clear_dir() {
-  dir_ = 1;
-  clear_has_dir();
+  _impl_.dir_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline ::google::protobuf::int32 LokStateProto::dir() const {
+inline int32_t LokStateProto::_internal_dir() const {
+  return _impl_.dir_;
+}
+inline int32_t LokStateProto::dir() const {
   // @@protoc_insertion_point(field_get:server.LokStateProto.dir)
-  return dir_;
+  return _internal_dir();
+}
+inline void LokStateProto::_internal_set_dir(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.dir_ = value;
 }
-inline void LokStateProto::set_dir(::google::protobuf::int32 value) {
-  set_has_dir();
-  dir_ = value;
+inline void LokStateProto::set_dir(int32_t value) {
+  _internal_set_dir(value);
   // @@protoc_insertion_point(field_set:server.LokStateProto.dir)
 }
 
 // optional int32 speed = 3;
-inline bool LokStateProto::has_speed() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void LokStateProto::set_has_speed() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool LokStateProto::_internal_has_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void LokStateProto::clear_has_speed() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool LokStateProto::has_speed() const {
+  return _internal_has_speed();
 }
 inline void LokStateProto::clear_speed() {
-  speed_ = 0;
-  clear_has_speed();
+  _impl_.speed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t LokStateProto::_internal_speed() const {
+  return _impl_.speed_;
 }
-inline ::google::protobuf::int32 LokStateProto::speed() const {
+inline int32_t LokStateProto::speed() const {
   // @@protoc_insertion_point(field_get:server.LokStateProto.speed)
-  return speed_;
+  return _internal_speed();
 }
-inline void LokStateProto::set_speed(::google::protobuf::int32 value) {
-  set_has_speed();
-  speed_ = value;
+inline void LokStateProto::_internal_set_speed(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.speed_ = value;
+}
+inline void LokStateProto::set_speed(int32_t value) {
+  _internal_set_speed(value);
   // @@protoc_insertion_point(field_set:server.LokStateProto.speed)
 }
 
 // optional int64 speed_ts = 9;
-inline bool LokStateProto::has_speed_ts() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool LokStateProto::_internal_has_speed_ts() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void LokStateProto::set_has_speed_ts() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void LokStateProto::clear_has_speed_ts() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool LokStateProto::has_speed_ts() const {
+  return _internal_has_speed_ts();
 }
 inline void LokStateProto::clear_speed_ts() {
-  speed_ts_ = GOOGLE_LONGLONG(0);
-  clear_has_speed_ts();
+  _impl_.speed_ts_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::google::protobuf::int64 LokStateProto::speed_ts() const {
+inline int64_t LokStateProto::_internal_speed_ts() const {
+  return _impl_.speed_ts_;
+}
+inline int64_t LokStateProto::speed_ts() const {
   // @@protoc_insertion_point(field_get:server.LokStateProto.speed_ts)
-  return speed_ts_;
+  return _internal_speed_ts();
+}
+inline void LokStateProto::_internal_set_speed_ts(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.speed_ts_ = value;
 }
-inline void LokStateProto::set_speed_ts(::google::protobuf::int64 value) {
-  set_has_speed_ts();
-  speed_ts_ = value;
+inline void LokStateProto::set_speed_ts(int64_t value) {
+  _internal_set_speed_ts(value);
   // @@protoc_insertion_point(field_set:server.LokStateProto.speed_ts)
 }
 
 // repeated group Function = 4 { ... };
+inline int LokStateProto::_internal_function_size() const {
+  return _impl_.function_.size();
+}
 inline int LokStateProto::function_size() const {
-  return function_.size();
+  return _internal_function_size();
 }
 inline void LokStateProto::clear_function() {
-  function_.Clear();
+  _impl_.function_.Clear();
+}
+inline ::server::LokStateProto_Function* LokStateProto::mutable_function(int index) {
+  // @@protoc_insertion_point(field_mutable:server.LokStateProto.function)
+  return _impl_.function_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto_Function >*
+LokStateProto::mutable_function() {
+  // @@protoc_insertion_point(field_mutable_list:server.LokStateProto.function)
+  return &_impl_.function_;
+}
+inline const ::server::LokStateProto_Function& LokStateProto::_internal_function(int index) const {
+  return _impl_.function_.Get(index);
 }
 inline const ::server::LokStateProto_Function& LokStateProto::function(int index) const {
   // @@protoc_insertion_point(field_get:server.LokStateProto.function)
-  return function_.Get(index);
+  return _internal_function(index);
 }
-inline ::server::LokStateProto_Function* LokStateProto::mutable_function(int index) {
-  // @@protoc_insertion_point(field_mutable:server.LokStateProto.function)
-  return function_.Mutable(index);
+inline ::server::LokStateProto_Function* LokStateProto::_internal_add_function() {
+  return _impl_.function_.Add();
 }
 inline ::server::LokStateProto_Function* LokStateProto::add_function() {
+  ::server::LokStateProto_Function* _add = _internal_add_function();
   // @@protoc_insertion_point(field_add:server.LokStateProto.function)
-  return function_.Add();
+  return _add;
 }
-inline ::google::protobuf::RepeatedPtrField< ::server::LokStateProto_Function >*
-LokStateProto::mutable_function() {
-  // @@protoc_insertion_point(field_mutable_list:server.LokStateProto.function)
-  return &function_;
-}
-inline const ::google::protobuf::RepeatedPtrField< ::server::LokStateProto_Function >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto_Function >&
 LokStateProto::function() const {
   // @@protoc_insertion_point(field_list:server.LokStateProto.function)
-  return function_;
+  return _impl_.function_;
 }
 
 // optional int64 ts = 7;
-inline bool LokStateProto::has_ts() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool LokStateProto::_internal_has_ts() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void LokStateProto::set_has_ts() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void LokStateProto::clear_has_ts() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool LokStateProto::has_ts() const {
+  return _internal_has_ts();
 }
 inline void LokStateProto::clear_ts() {
-  ts_ = GOOGLE_LONGLONG(0);
-  clear_has_ts();
+  _impl_.ts_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::int64 LokStateProto::ts() const {
+inline int64_t LokStateProto::_internal_ts() const {
+  return _impl_.ts_;
+}
+inline int64_t LokStateProto::ts() const {
   // @@protoc_insertion_point(field_get:server.LokStateProto.ts)
-  return ts_;
+  return _internal_ts();
+}
+inline void LokStateProto::_internal_set_ts(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.ts_ = value;
 }
-inline void LokStateProto::set_ts(::google::protobuf::int64 value) {
-  set_has_ts();
-  ts_ = value;
+inline void LokStateProto::set_ts(int64_t value) {
+  _internal_set_ts(value);
   // @@protoc_insertion_point(field_set:server.LokStateProto.ts)
 }
 
@@ -4827,74 +8723,86 @@ inline void LokStateProto::set_ts(::google::protobuf::int64 value) {
 // TrainControlRequest_DoSetSpeed
 
 // required int32 id = 2;
-inline bool TrainControlRequest_DoSetSpeed::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlRequest_DoSetSpeed::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlRequest_DoSetSpeed::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoSetSpeed::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoSetSpeed::has_id() const {
+  return _internal_has_id();
 }
 inline void TrainControlRequest_DoSetSpeed::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlRequest_DoSetSpeed::_internal_id() const {
+  return _impl_.id_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoSetSpeed::id() const {
+inline int32_t TrainControlRequest_DoSetSpeed::id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSetSpeed.id)
-  return id_;
+  return _internal_id();
 }
-inline void TrainControlRequest_DoSetSpeed::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void TrainControlRequest_DoSetSpeed::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void TrainControlRequest_DoSetSpeed::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoSetSpeed.id)
 }
 
 // optional int32 dir = 36 [default = 1];
-inline bool TrainControlRequest_DoSetSpeed::has_dir() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TrainControlRequest_DoSetSpeed::_internal_has_dir() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoSetSpeed::set_has_dir() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TrainControlRequest_DoSetSpeed::clear_has_dir() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlRequest_DoSetSpeed::has_dir() const {
+  return _internal_has_dir();
 }
 inline void TrainControlRequest_DoSetSpeed::clear_dir() {
-  dir_ = 1;
-  clear_has_dir();
+  _impl_.dir_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoSetSpeed::dir() const {
+inline int32_t TrainControlRequest_DoSetSpeed::_internal_dir() const {
+  return _impl_.dir_;
+}
+inline int32_t TrainControlRequest_DoSetSpeed::dir() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSetSpeed.dir)
-  return dir_;
+  return _internal_dir();
+}
+inline void TrainControlRequest_DoSetSpeed::_internal_set_dir(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.dir_ = value;
 }
-inline void TrainControlRequest_DoSetSpeed::set_dir(::google::protobuf::int32 value) {
-  set_has_dir();
-  dir_ = value;
+inline void TrainControlRequest_DoSetSpeed::set_dir(int32_t value) {
+  _internal_set_dir(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoSetSpeed.dir)
 }
 
 // optional int32 speed = 3;
-inline bool TrainControlRequest_DoSetSpeed::has_speed() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TrainControlRequest_DoSetSpeed::set_has_speed() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool TrainControlRequest_DoSetSpeed::_internal_has_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoSetSpeed::clear_has_speed() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlRequest_DoSetSpeed::has_speed() const {
+  return _internal_has_speed();
 }
 inline void TrainControlRequest_DoSetSpeed::clear_speed() {
-  speed_ = 0;
-  clear_has_speed();
+  _impl_.speed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t TrainControlRequest_DoSetSpeed::_internal_speed() const {
+  return _impl_.speed_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoSetSpeed::speed() const {
+inline int32_t TrainControlRequest_DoSetSpeed::speed() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSetSpeed.speed)
-  return speed_;
+  return _internal_speed();
 }
-inline void TrainControlRequest_DoSetSpeed::set_speed(::google::protobuf::int32 value) {
-  set_has_speed();
-  speed_ = value;
+inline void TrainControlRequest_DoSetSpeed::_internal_set_speed(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.speed_ = value;
+}
+inline void TrainControlRequest_DoSetSpeed::set_speed(int32_t value) {
+  _internal_set_speed(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoSetSpeed.speed)
 }
 
@@ -4903,74 +8811,86 @@ inline void TrainControlRequest_DoSetSpeed::set_speed(::google::protobuf::int32
 // TrainControlRequest_DoSetAccessory
 
 // required int32 train_id = 5;
-inline bool TrainControlRequest_DoSetAccessory::has_train_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlRequest_DoSetAccessory::_internal_has_train_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoSetAccessory::set_has_train_id() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlRequest_DoSetAccessory::clear_has_train_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoSetAccessory::has_train_id() const {
+  return _internal_has_train_id();
 }
 inline void TrainControlRequest_DoSetAccessory::clear_train_id() {
-  train_id_ = 0;
-  clear_has_train_id();
+  _impl_.train_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoSetAccessory::train_id() const {
+inline int32_t TrainControlRequest_DoSetAccessory::_internal_train_id() const {
+  return _impl_.train_id_;
+}
+inline int32_t TrainControlRequest_DoSetAccessory::train_id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSetAccessory.train_id)
-  return train_id_;
+  return _internal_train_id();
+}
+inline void TrainControlRequest_DoSetAccessory::_internal_set_train_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.train_id_ = value;
 }
-inline void TrainControlRequest_DoSetAccessory::set_train_id(::google::protobuf::int32 value) {
-  set_has_train_id();
-  train_id_ = value;
+inline void TrainControlRequest_DoSetAccessory::set_train_id(int32_t value) {
+  _internal_set_train_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoSetAccessory.train_id)
 }
 
 // required int32 accessory_id = 6;
-inline bool TrainControlRequest_DoSetAccessory::has_accessory_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void TrainControlRequest_DoSetAccessory::set_has_accessory_id() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool TrainControlRequest_DoSetAccessory::_internal_has_accessory_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoSetAccessory::clear_has_accessory_id() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlRequest_DoSetAccessory::has_accessory_id() const {
+  return _internal_has_accessory_id();
 }
 inline void TrainControlRequest_DoSetAccessory::clear_accessory_id() {
-  accessory_id_ = 0;
-  clear_has_accessory_id();
+  _impl_.accessory_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t TrainControlRequest_DoSetAccessory::_internal_accessory_id() const {
+  return _impl_.accessory_id_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoSetAccessory::accessory_id() const {
+inline int32_t TrainControlRequest_DoSetAccessory::accessory_id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSetAccessory.accessory_id)
-  return accessory_id_;
+  return _internal_accessory_id();
 }
-inline void TrainControlRequest_DoSetAccessory::set_accessory_id(::google::protobuf::int32 value) {
-  set_has_accessory_id();
-  accessory_id_ = value;
+inline void TrainControlRequest_DoSetAccessory::_internal_set_accessory_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.accessory_id_ = value;
+}
+inline void TrainControlRequest_DoSetAccessory::set_accessory_id(int32_t value) {
+  _internal_set_accessory_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoSetAccessory.accessory_id)
 }
 
 // optional int32 value = 7;
-inline bool TrainControlRequest_DoSetAccessory::has_value() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool TrainControlRequest_DoSetAccessory::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoSetAccessory::set_has_value() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void TrainControlRequest_DoSetAccessory::clear_has_value() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlRequest_DoSetAccessory::has_value() const {
+  return _internal_has_value();
 }
 inline void TrainControlRequest_DoSetAccessory::clear_value() {
-  value_ = 0;
-  clear_has_value();
+  _impl_.value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoSetAccessory::value() const {
+inline int32_t TrainControlRequest_DoSetAccessory::_internal_value() const {
+  return _impl_.value_;
+}
+inline int32_t TrainControlRequest_DoSetAccessory::value() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSetAccessory.value)
-  return value_;
+  return _internal_value();
+}
+inline void TrainControlRequest_DoSetAccessory::_internal_set_value(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.value_ = value;
 }
-inline void TrainControlRequest_DoSetAccessory::set_value(::google::protobuf::int32 value) {
-  set_has_value();
-  value_ = value;
+inline void TrainControlRequest_DoSetAccessory::set_value(int32_t value) {
+  _internal_set_value(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoSetAccessory.value)
 }
 
@@ -4979,26 +8899,30 @@ inline void TrainControlRequest_DoSetAccessory::set_value(::google::protobuf::in
 // TrainControlRequest_DoSetEmergencyStop
 
 // optional bool stop = 9;
-inline bool TrainControlRequest_DoSetEmergencyStop::has_stop() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlRequest_DoSetEmergencyStop::set_has_stop() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlRequest_DoSetEmergencyStop::_internal_has_stop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoSetEmergencyStop::clear_has_stop() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoSetEmergencyStop::has_stop() const {
+  return _internal_has_stop();
 }
 inline void TrainControlRequest_DoSetEmergencyStop::clear_stop() {
-  stop_ = false;
-  clear_has_stop();
+  _impl_.stop_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool TrainControlRequest_DoSetEmergencyStop::_internal_stop() const {
+  return _impl_.stop_;
 }
 inline bool TrainControlRequest_DoSetEmergencyStop::stop() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSetEmergencyStop.stop)
-  return stop_;
+  return _internal_stop();
+}
+inline void TrainControlRequest_DoSetEmergencyStop::_internal_set_stop(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.stop_ = value;
 }
 inline void TrainControlRequest_DoSetEmergencyStop::set_stop(bool value) {
-  set_has_stop();
-  stop_ = value;
+  _internal_set_stop(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoSetEmergencyStop.stop)
 }
 
@@ -5007,129 +8931,162 @@ inline void TrainControlRequest_DoSetEmergencyStop::set_stop(bool value) {
 // TrainControlRequest_DoRpc
 
 // required int32 destination_address = 17;
-inline bool TrainControlRequest_DoRpc::has_destination_address() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlRequest_DoRpc::_internal_has_destination_address() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoRpc::set_has_destination_address() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlRequest_DoRpc::clear_has_destination_address() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoRpc::has_destination_address() const {
+  return _internal_has_destination_address();
 }
 inline void TrainControlRequest_DoRpc::clear_destination_address() {
-  destination_address_ = 0;
-  clear_has_destination_address();
+  _impl_.destination_address_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoRpc::destination_address() const {
+inline int32_t TrainControlRequest_DoRpc::_internal_destination_address() const {
+  return _impl_.destination_address_;
+}
+inline int32_t TrainControlRequest_DoRpc::destination_address() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoRpc.destination_address)
-  return destination_address_;
+  return _internal_destination_address();
+}
+inline void TrainControlRequest_DoRpc::_internal_set_destination_address(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.destination_address_ = value;
 }
-inline void TrainControlRequest_DoRpc::set_destination_address(::google::protobuf::int32 value) {
-  set_has_destination_address();
-  destination_address_ = value;
+inline void TrainControlRequest_DoRpc::set_destination_address(int32_t value) {
+  _internal_set_destination_address(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoRpc.destination_address)
 }
 
 // required int32 command = 18;
-inline bool TrainControlRequest_DoRpc::has_command() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void TrainControlRequest_DoRpc::set_has_command() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool TrainControlRequest_DoRpc::_internal_has_command() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoRpc::clear_has_command() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlRequest_DoRpc::has_command() const {
+  return _internal_has_command();
 }
 inline void TrainControlRequest_DoRpc::clear_command() {
-  command_ = 0;
-  clear_has_command();
+  _impl_.command_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t TrainControlRequest_DoRpc::_internal_command() const {
+  return _impl_.command_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoRpc::command() const {
+inline int32_t TrainControlRequest_DoRpc::command() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoRpc.command)
-  return command_;
+  return _internal_command();
 }
-inline void TrainControlRequest_DoRpc::set_command(::google::protobuf::int32 value) {
-  set_has_command();
-  command_ = value;
+inline void TrainControlRequest_DoRpc::_internal_set_command(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.command_ = value;
+}
+inline void TrainControlRequest_DoRpc::set_command(int32_t value) {
+  _internal_set_command(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoRpc.command)
 }
 
 // required int32 arg1 = 19;
-inline bool TrainControlRequest_DoRpc::has_arg1() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool TrainControlRequest_DoRpc::_internal_has_arg1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoRpc::set_has_arg1() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void TrainControlRequest_DoRpc::clear_has_arg1() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlRequest_DoRpc::has_arg1() const {
+  return _internal_has_arg1();
 }
 inline void TrainControlRequest_DoRpc::clear_arg1() {
-  arg1_ = 0;
-  clear_has_arg1();
+  _impl_.arg1_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoRpc::arg1() const {
+inline int32_t TrainControlRequest_DoRpc::_internal_arg1() const {
+  return _impl_.arg1_;
+}
+inline int32_t TrainControlRequest_DoRpc::arg1() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoRpc.arg1)
-  return arg1_;
+  return _internal_arg1();
+}
+inline void TrainControlRequest_DoRpc::_internal_set_arg1(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.arg1_ = value;
 }
-inline void TrainControlRequest_DoRpc::set_arg1(::google::protobuf::int32 value) {
-  set_has_arg1();
-  arg1_ = value;
+inline void TrainControlRequest_DoRpc::set_arg1(int32_t value) {
+  _internal_set_arg1(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoRpc.arg1)
 }
 
 // required int32 arg2 = 20;
-inline bool TrainControlRequest_DoRpc::has_arg2() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void TrainControlRequest_DoRpc::set_has_arg2() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool TrainControlRequest_DoRpc::_internal_has_arg2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoRpc::clear_has_arg2() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool TrainControlRequest_DoRpc::has_arg2() const {
+  return _internal_has_arg2();
 }
 inline void TrainControlRequest_DoRpc::clear_arg2() {
-  arg2_ = 0;
-  clear_has_arg2();
+  _impl_.arg2_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t TrainControlRequest_DoRpc::_internal_arg2() const {
+  return _impl_.arg2_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoRpc::arg2() const {
+inline int32_t TrainControlRequest_DoRpc::arg2() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoRpc.arg2)
-  return arg2_;
+  return _internal_arg2();
 }
-inline void TrainControlRequest_DoRpc::set_arg2(::google::protobuf::int32 value) {
-  set_has_arg2();
-  arg2_ = value;
+inline void TrainControlRequest_DoRpc::_internal_set_arg2(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.arg2_ = value;
+}
+inline void TrainControlRequest_DoRpc::set_arg2(int32_t value) {
+  _internal_set_arg2(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoRpc.arg2)
 }
 
 // repeated int32 payload = 60;
+inline int TrainControlRequest_DoRpc::_internal_payload_size() const {
+  return _impl_.payload_.size();
+}
 inline int TrainControlRequest_DoRpc::payload_size() const {
-  return payload_.size();
+  return _internal_payload_size();
 }
 inline void TrainControlRequest_DoRpc::clear_payload() {
-  payload_.Clear();
+  _impl_.payload_.Clear();
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoRpc::payload(int index) const {
+inline int32_t TrainControlRequest_DoRpc::_internal_payload(int index) const {
+  return _impl_.payload_.Get(index);
+}
+inline int32_t TrainControlRequest_DoRpc::payload(int index) const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoRpc.payload)
-  return payload_.Get(index);
+  return _internal_payload(index);
 }
-inline void TrainControlRequest_DoRpc::set_payload(int index, ::google::protobuf::int32 value) {
-  payload_.Set(index, value);
+inline void TrainControlRequest_DoRpc::set_payload(int index, int32_t value) {
+  _impl_.payload_.Set(index, value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoRpc.payload)
 }
-inline void TrainControlRequest_DoRpc::add_payload(::google::protobuf::int32 value) {
-  payload_.Add(value);
+inline void TrainControlRequest_DoRpc::_internal_add_payload(int32_t value) {
+  _impl_.payload_.Add(value);
+}
+inline void TrainControlRequest_DoRpc::add_payload(int32_t value) {
+  _internal_add_payload(value);
   // @@protoc_insertion_point(field_add:server.TrainControlRequest.DoRpc.payload)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TrainControlRequest_DoRpc::_internal_payload() const {
+  return _impl_.payload_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
 TrainControlRequest_DoRpc::payload() const {
   // @@protoc_insertion_point(field_list:server.TrainControlRequest.DoRpc.payload)
-  return payload_;
+  return _internal_payload();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TrainControlRequest_DoRpc::_internal_mutable_payload() {
+  return &_impl_.payload_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
 TrainControlRequest_DoRpc::mutable_payload() {
   // @@protoc_insertion_point(field_mutable_list:server.TrainControlRequest.DoRpc.payload)
-  return &payload_;
+  return _internal_mutable_payload();
 }
 
 // -------------------------------------------------------------------
@@ -5137,26 +9094,30 @@ TrainControlRequest_DoRpc::mutable_payload() {
 // TrainControlRequest_DoPing
 
 // optional int32 value = 22 [default = 0];
-inline bool TrainControlRequest_DoPing::has_value() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlRequest_DoPing::set_has_value() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlRequest_DoPing::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoPing::clear_has_value() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoPing::has_value() const {
+  return _internal_has_value();
 }
 inline void TrainControlRequest_DoPing::clear_value() {
-  value_ = 0;
-  clear_has_value();
+  _impl_.value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlRequest_DoPing::_internal_value() const {
+  return _impl_.value_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoPing::value() const {
+inline int32_t TrainControlRequest_DoPing::value() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoPing.value)
-  return value_;
+  return _internal_value();
 }
-inline void TrainControlRequest_DoPing::set_value(::google::protobuf::int32 value) {
-  set_has_value();
-  value_ = value;
+inline void TrainControlRequest_DoPing::_internal_set_value(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.value_ = value;
+}
+inline void TrainControlRequest_DoPing::set_value(int32_t value) {
+  _internal_set_value(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoPing.value)
 }
 
@@ -5165,26 +9126,30 @@ inline void TrainControlRequest_DoPing::set_value(::google::protobuf::int32 valu
 // TrainControlRequest_DoGetOrSetAddress
 
 // optional int32 new_address = 24;
-inline bool TrainControlRequest_DoGetOrSetAddress::has_new_address() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlRequest_DoGetOrSetAddress::_internal_has_new_address() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoGetOrSetAddress::set_has_new_address() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlRequest_DoGetOrSetAddress::clear_has_new_address() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoGetOrSetAddress::has_new_address() const {
+  return _internal_has_new_address();
 }
 inline void TrainControlRequest_DoGetOrSetAddress::clear_new_address() {
-  new_address_ = 0;
-  clear_has_new_address();
+  _impl_.new_address_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoGetOrSetAddress::new_address() const {
+inline int32_t TrainControlRequest_DoGetOrSetAddress::_internal_new_address() const {
+  return _impl_.new_address_;
+}
+inline int32_t TrainControlRequest_DoGetOrSetAddress::new_address() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoGetOrSetAddress.new_address)
-  return new_address_;
+  return _internal_new_address();
+}
+inline void TrainControlRequest_DoGetOrSetAddress::_internal_set_new_address(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.new_address_ = value;
 }
-inline void TrainControlRequest_DoGetOrSetAddress::set_new_address(::google::protobuf::int32 value) {
-  set_has_new_address();
-  new_address_ = value;
+inline void TrainControlRequest_DoGetOrSetAddress::set_new_address(int32_t value) {
+  _internal_set_new_address(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoGetOrSetAddress.new_address)
 }
 
@@ -5197,122 +9162,142 @@ inline void TrainControlRequest_DoGetOrSetAddress::set_new_address(::google::pro
 // TrainControlRequest_DoChangeSavedState
 
 // required int32 client_id = 27;
-inline bool TrainControlRequest_DoChangeSavedState::has_client_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlRequest_DoChangeSavedState::set_has_client_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlRequest_DoChangeSavedState::_internal_has_client_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoChangeSavedState::clear_has_client_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoChangeSavedState::has_client_id() const {
+  return _internal_has_client_id();
 }
 inline void TrainControlRequest_DoChangeSavedState::clear_client_id() {
-  client_id_ = 0;
-  clear_has_client_id();
+  _impl_.client_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlRequest_DoChangeSavedState::_internal_client_id() const {
+  return _impl_.client_id_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoChangeSavedState::client_id() const {
+inline int32_t TrainControlRequest_DoChangeSavedState::client_id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoChangeSavedState.client_id)
-  return client_id_;
+  return _internal_client_id();
 }
-inline void TrainControlRequest_DoChangeSavedState::set_client_id(::google::protobuf::int32 value) {
-  set_has_client_id();
-  client_id_ = value;
+inline void TrainControlRequest_DoChangeSavedState::_internal_set_client_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.client_id_ = value;
+}
+inline void TrainControlRequest_DoChangeSavedState::set_client_id(int32_t value) {
+  _internal_set_client_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoChangeSavedState.client_id)
 }
 
 // required int32 offset = 28;
-inline bool TrainControlRequest_DoChangeSavedState::has_offset() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TrainControlRequest_DoChangeSavedState::_internal_has_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoChangeSavedState::set_has_offset() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TrainControlRequest_DoChangeSavedState::clear_has_offset() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlRequest_DoChangeSavedState::has_offset() const {
+  return _internal_has_offset();
 }
 inline void TrainControlRequest_DoChangeSavedState::clear_offset() {
-  offset_ = 0;
-  clear_has_offset();
+  _impl_.offset_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoChangeSavedState::offset() const {
+inline int32_t TrainControlRequest_DoChangeSavedState::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int32_t TrainControlRequest_DoChangeSavedState::offset() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoChangeSavedState.offset)
-  return offset_;
+  return _internal_offset();
+}
+inline void TrainControlRequest_DoChangeSavedState::_internal_set_offset(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.offset_ = value;
 }
-inline void TrainControlRequest_DoChangeSavedState::set_offset(::google::protobuf::int32 value) {
-  set_has_offset();
-  offset_ = value;
+inline void TrainControlRequest_DoChangeSavedState::set_offset(int32_t value) {
+  _internal_set_offset(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoChangeSavedState.offset)
 }
 
 // optional int32 new_value = 29;
-inline bool TrainControlRequest_DoChangeSavedState::has_new_value() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TrainControlRequest_DoChangeSavedState::set_has_new_value() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool TrainControlRequest_DoChangeSavedState::_internal_has_new_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoChangeSavedState::clear_has_new_value() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlRequest_DoChangeSavedState::has_new_value() const {
+  return _internal_has_new_value();
 }
 inline void TrainControlRequest_DoChangeSavedState::clear_new_value() {
-  new_value_ = 0;
-  clear_has_new_value();
+  _impl_.new_value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t TrainControlRequest_DoChangeSavedState::_internal_new_value() const {
+  return _impl_.new_value_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoChangeSavedState::new_value() const {
+inline int32_t TrainControlRequest_DoChangeSavedState::new_value() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoChangeSavedState.new_value)
-  return new_value_;
+  return _internal_new_value();
 }
-inline void TrainControlRequest_DoChangeSavedState::set_new_value(::google::protobuf::int32 value) {
-  set_has_new_value();
-  new_value_ = value;
+inline void TrainControlRequest_DoChangeSavedState::_internal_set_new_value(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.new_value_ = value;
+}
+inline void TrainControlRequest_DoChangeSavedState::set_new_value(int32_t value) {
+  _internal_set_new_value(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoChangeSavedState.new_value)
 }
 
 // optional int32 bits_to_set = 30 [default = 0];
-inline bool TrainControlRequest_DoChangeSavedState::has_bits_to_set() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool TrainControlRequest_DoChangeSavedState::_internal_has_bits_to_set() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoChangeSavedState::set_has_bits_to_set() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void TrainControlRequest_DoChangeSavedState::clear_has_bits_to_set() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool TrainControlRequest_DoChangeSavedState::has_bits_to_set() const {
+  return _internal_has_bits_to_set();
 }
 inline void TrainControlRequest_DoChangeSavedState::clear_bits_to_set() {
-  bits_to_set_ = 0;
-  clear_has_bits_to_set();
+  _impl_.bits_to_set_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoChangeSavedState::bits_to_set() const {
+inline int32_t TrainControlRequest_DoChangeSavedState::_internal_bits_to_set() const {
+  return _impl_.bits_to_set_;
+}
+inline int32_t TrainControlRequest_DoChangeSavedState::bits_to_set() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoChangeSavedState.bits_to_set)
-  return bits_to_set_;
+  return _internal_bits_to_set();
+}
+inline void TrainControlRequest_DoChangeSavedState::_internal_set_bits_to_set(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.bits_to_set_ = value;
 }
-inline void TrainControlRequest_DoChangeSavedState::set_bits_to_set(::google::protobuf::int32 value) {
-  set_has_bits_to_set();
-  bits_to_set_ = value;
+inline void TrainControlRequest_DoChangeSavedState::set_bits_to_set(int32_t value) {
+  _internal_set_bits_to_set(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoChangeSavedState.bits_to_set)
 }
 
 // optional int32 bits_to_clear = 31 [default = 0];
-inline bool TrainControlRequest_DoChangeSavedState::has_bits_to_clear() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void TrainControlRequest_DoChangeSavedState::set_has_bits_to_clear() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool TrainControlRequest_DoChangeSavedState::_internal_has_bits_to_clear() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoChangeSavedState::clear_has_bits_to_clear() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool TrainControlRequest_DoChangeSavedState::has_bits_to_clear() const {
+  return _internal_has_bits_to_clear();
 }
 inline void TrainControlRequest_DoChangeSavedState::clear_bits_to_clear() {
-  bits_to_clear_ = 0;
-  clear_has_bits_to_clear();
+  _impl_.bits_to_clear_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline int32_t TrainControlRequest_DoChangeSavedState::_internal_bits_to_clear() const {
+  return _impl_.bits_to_clear_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoChangeSavedState::bits_to_clear() const {
+inline int32_t TrainControlRequest_DoChangeSavedState::bits_to_clear() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoChangeSavedState.bits_to_clear)
-  return bits_to_clear_;
+  return _internal_bits_to_clear();
 }
-inline void TrainControlRequest_DoChangeSavedState::set_bits_to_clear(::google::protobuf::int32 value) {
-  set_has_bits_to_clear();
-  bits_to_clear_ = value;
+inline void TrainControlRequest_DoChangeSavedState::_internal_set_bits_to_clear(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.bits_to_clear_ = value;
+}
+inline void TrainControlRequest_DoChangeSavedState::set_bits_to_clear(int32_t value) {
+  _internal_set_bits_to_clear(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoChangeSavedState.bits_to_clear)
 }
 
@@ -5321,110 +9306,145 @@ inline void TrainControlRequest_DoChangeSavedState::set_bits_to_clear(::google::
 // TrainControlRequest_DoSendRawCanPacket
 
 // optional bool wait = 33 [default = false];
-inline bool TrainControlRequest_DoSendRawCanPacket::has_wait() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlRequest_DoSendRawCanPacket::_internal_has_wait() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoSendRawCanPacket::set_has_wait() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlRequest_DoSendRawCanPacket::clear_has_wait() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoSendRawCanPacket::has_wait() const {
+  return _internal_has_wait();
 }
 inline void TrainControlRequest_DoSendRawCanPacket::clear_wait() {
-  wait_ = false;
-  clear_has_wait();
+  _impl_.wait_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool TrainControlRequest_DoSendRawCanPacket::_internal_wait() const {
+  return _impl_.wait_;
 }
 inline bool TrainControlRequest_DoSendRawCanPacket::wait() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSendRawCanPacket.wait)
-  return wait_;
+  return _internal_wait();
+}
+inline void TrainControlRequest_DoSendRawCanPacket::_internal_set_wait(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.wait_ = value;
 }
 inline void TrainControlRequest_DoSendRawCanPacket::set_wait(bool value) {
-  set_has_wait();
-  wait_ = value;
+  _internal_set_wait(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoSendRawCanPacket.wait)
 }
 
 // repeated int32 d = 34;
+inline int TrainControlRequest_DoSendRawCanPacket::_internal_d_size() const {
+  return _impl_.d_.size();
+}
 inline int TrainControlRequest_DoSendRawCanPacket::d_size() const {
-  return d_.size();
+  return _internal_d_size();
 }
 inline void TrainControlRequest_DoSendRawCanPacket::clear_d() {
-  d_.Clear();
+  _impl_.d_.Clear();
+}
+inline int32_t TrainControlRequest_DoSendRawCanPacket::_internal_d(int index) const {
+  return _impl_.d_.Get(index);
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoSendRawCanPacket::d(int index) const {
+inline int32_t TrainControlRequest_DoSendRawCanPacket::d(int index) const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSendRawCanPacket.d)
-  return d_.Get(index);
+  return _internal_d(index);
 }
-inline void TrainControlRequest_DoSendRawCanPacket::set_d(int index, ::google::protobuf::int32 value) {
-  d_.Set(index, value);
+inline void TrainControlRequest_DoSendRawCanPacket::set_d(int index, int32_t value) {
+  _impl_.d_.Set(index, value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoSendRawCanPacket.d)
 }
-inline void TrainControlRequest_DoSendRawCanPacket::add_d(::google::protobuf::int32 value) {
-  d_.Add(value);
+inline void TrainControlRequest_DoSendRawCanPacket::_internal_add_d(int32_t value) {
+  _impl_.d_.Add(value);
+}
+inline void TrainControlRequest_DoSendRawCanPacket::add_d(int32_t value) {
+  _internal_add_d(value);
   // @@protoc_insertion_point(field_add:server.TrainControlRequest.DoSendRawCanPacket.d)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TrainControlRequest_DoSendRawCanPacket::_internal_d() const {
+  return _impl_.d_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
 TrainControlRequest_DoSendRawCanPacket::d() const {
   // @@protoc_insertion_point(field_list:server.TrainControlRequest.DoSendRawCanPacket.d)
-  return d_;
+  return _internal_d();
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TrainControlRequest_DoSendRawCanPacket::_internal_mutable_d() {
+  return &_impl_.d_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
 TrainControlRequest_DoSendRawCanPacket::mutable_d() {
   // @@protoc_insertion_point(field_mutable_list:server.TrainControlRequest.DoSendRawCanPacket.d)
-  return &d_;
+  return _internal_mutable_d();
 }
 
-// optional string data = 35;
-inline bool TrainControlRequest_DoSendRawCanPacket::has_data() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TrainControlRequest_DoSendRawCanPacket::set_has_data() {
-  _has_bits_[0] |= 0x00000004u;
+// optional string data = 35;
+inline bool TrainControlRequest_DoSendRawCanPacket::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoSendRawCanPacket::clear_has_data() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlRequest_DoSendRawCanPacket::has_data() const {
+  return _internal_has_data();
 }
 inline void TrainControlRequest_DoSendRawCanPacket::clear_data() {
-  data_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_data();
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::std::string& TrainControlRequest_DoSendRawCanPacket::data() const {
+inline const std::string& TrainControlRequest_DoSendRawCanPacket::data() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSendRawCanPacket.data)
-  return data_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_data();
 }
-inline void TrainControlRequest_DoSendRawCanPacket::set_data(const ::std::string& value) {
-  set_has_data();
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TrainControlRequest_DoSendRawCanPacket::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.data_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoSendRawCanPacket.data)
 }
-inline void TrainControlRequest_DoSendRawCanPacket::set_data(const char* value) {
-  set_has_data();
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:server.TrainControlRequest.DoSendRawCanPacket.data)
+inline std::string* TrainControlRequest_DoSendRawCanPacket::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.DoSendRawCanPacket.data)
+  return _s;
 }
-inline void TrainControlRequest_DoSendRawCanPacket::set_data(const char* value, size_t size) {
-  set_has_data();
-  data_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:server.TrainControlRequest.DoSendRawCanPacket.data)
+inline const std::string& TrainControlRequest_DoSendRawCanPacket::_internal_data() const {
+  return _impl_.data_.Get();
 }
-inline ::std::string* TrainControlRequest_DoSendRawCanPacket::mutable_data() {
-  set_has_data();
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.DoSendRawCanPacket.data)
-  return data_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void TrainControlRequest_DoSendRawCanPacket::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* TrainControlRequest_DoSendRawCanPacket::release_data() {
+inline std::string* TrainControlRequest_DoSendRawCanPacket::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TrainControlRequest_DoSendRawCanPacket::release_data() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.DoSendRawCanPacket.data)
-  clear_has_data();
-  return data_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void TrainControlRequest_DoSendRawCanPacket::set_allocated_data(::std::string* data) {
-  if (data != NULL) {
-    set_has_data();
+inline void TrainControlRequest_DoSendRawCanPacket::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_data();
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
   }
-  data_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), data);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.DoSendRawCanPacket.data)
 }
 
@@ -5433,105 +9453,134 @@ inline void TrainControlRequest_DoSendRawCanPacket::set_allocated_data(::std::st
 // TrainControlRequest_DoReflashAutomata
 
 // required int32 destination_address = 37;
-inline bool TrainControlRequest_DoReflashAutomata::has_destination_address() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlRequest_DoReflashAutomata::set_has_destination_address() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlRequest_DoReflashAutomata::_internal_has_destination_address() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoReflashAutomata::clear_has_destination_address() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoReflashAutomata::has_destination_address() const {
+  return _internal_has_destination_address();
 }
 inline void TrainControlRequest_DoReflashAutomata::clear_destination_address() {
-  destination_address_ = 0;
-  clear_has_destination_address();
+  _impl_.destination_address_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlRequest_DoReflashAutomata::_internal_destination_address() const {
+  return _impl_.destination_address_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoReflashAutomata::destination_address() const {
+inline int32_t TrainControlRequest_DoReflashAutomata::destination_address() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoReflashAutomata.destination_address)
-  return destination_address_;
+  return _internal_destination_address();
 }
-inline void TrainControlRequest_DoReflashAutomata::set_destination_address(::google::protobuf::int32 value) {
-  set_has_destination_address();
-  destination_address_ = value;
+inline void TrainControlRequest_DoReflashAutomata::_internal_set_destination_address(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.destination_address_ = value;
+}
+inline void TrainControlRequest_DoReflashAutomata::set_destination_address(int32_t value) {
+  _internal_set_destination_address(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoReflashAutomata.destination_address)
 }
 
 // optional int32 signal_address = 61;
-inline bool TrainControlRequest_DoReflashAutomata::has_signal_address() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TrainControlRequest_DoReflashAutomata::_internal_has_signal_address() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoReflashAutomata::set_has_signal_address() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TrainControlRequest_DoReflashAutomata::clear_has_signal_address() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlRequest_DoReflashAutomata::has_signal_address() const {
+  return _internal_has_signal_address();
 }
 inline void TrainControlRequest_DoReflashAutomata::clear_signal_address() {
-  signal_address_ = 0;
-  clear_has_signal_address();
+  _impl_.signal_address_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoReflashAutomata::signal_address() const {
+inline int32_t TrainControlRequest_DoReflashAutomata::_internal_signal_address() const {
+  return _impl_.signal_address_;
+}
+inline int32_t TrainControlRequest_DoReflashAutomata::signal_address() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoReflashAutomata.signal_address)
-  return signal_address_;
+  return _internal_signal_address();
+}
+inline void TrainControlRequest_DoReflashAutomata::_internal_set_signal_address(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.signal_address_ = value;
 }
-inline void TrainControlRequest_DoReflashAutomata::set_signal_address(::google::protobuf::int32 value) {
-  set_has_signal_address();
-  signal_address_ = value;
+inline void TrainControlRequest_DoReflashAutomata::set_signal_address(int32_t value) {
+  _internal_set_signal_address(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoReflashAutomata.signal_address)
 }
 
 // optional int32 offset = 38 [default = 3328];
-inline bool TrainControlRequest_DoReflashAutomata::has_offset() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TrainControlRequest_DoReflashAutomata::set_has_offset() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool TrainControlRequest_DoReflashAutomata::_internal_has_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoReflashAutomata::clear_has_offset() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlRequest_DoReflashAutomata::has_offset() const {
+  return _internal_has_offset();
 }
 inline void TrainControlRequest_DoReflashAutomata::clear_offset() {
-  offset_ = 3328;
-  clear_has_offset();
+  _impl_.offset_ = 3328;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t TrainControlRequest_DoReflashAutomata::_internal_offset() const {
+  return _impl_.offset_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoReflashAutomata::offset() const {
+inline int32_t TrainControlRequest_DoReflashAutomata::offset() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoReflashAutomata.offset)
-  return offset_;
+  return _internal_offset();
 }
-inline void TrainControlRequest_DoReflashAutomata::set_offset(::google::protobuf::int32 value) {
-  set_has_offset();
-  offset_ = value;
+inline void TrainControlRequest_DoReflashAutomata::_internal_set_offset(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.offset_ = value;
+}
+inline void TrainControlRequest_DoReflashAutomata::set_offset(int32_t value) {
+  _internal_set_offset(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoReflashAutomata.offset)
 }
 
 // repeated int32 data = 39;
+inline int TrainControlRequest_DoReflashAutomata::_internal_data_size() const {
+  return _impl_.data_.size();
+}
 inline int TrainControlRequest_DoReflashAutomata::data_size() const {
-  return data_.size();
+  return _internal_data_size();
 }
 inline void TrainControlRequest_DoReflashAutomata::clear_data() {
-  data_.Clear();
+  _impl_.data_.Clear();
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoReflashAutomata::data(int index) const {
+inline int32_t TrainControlRequest_DoReflashAutomata::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
+}
+inline int32_t TrainControlRequest_DoReflashAutomata::data(int index) const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoReflashAutomata.data)
-  return data_.Get(index);
+  return _internal_data(index);
 }
-inline void TrainControlRequest_DoReflashAutomata::set_data(int index, ::google::protobuf::int32 value) {
-  data_.Set(index, value);
+inline void TrainControlRequest_DoReflashAutomata::set_data(int index, int32_t value) {
+  _impl_.data_.Set(index, value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoReflashAutomata.data)
 }
-inline void TrainControlRequest_DoReflashAutomata::add_data(::google::protobuf::int32 value) {
-  data_.Add(value);
+inline void TrainControlRequest_DoReflashAutomata::_internal_add_data(int32_t value) {
+  _impl_.data_.Add(value);
+}
+inline void TrainControlRequest_DoReflashAutomata::add_data(int32_t value) {
+  _internal_add_data(value);
   // @@protoc_insertion_point(field_add:server.TrainControlRequest.DoReflashAutomata.data)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TrainControlRequest_DoReflashAutomata::_internal_data() const {
+  return _impl_.data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
 TrainControlRequest_DoReflashAutomata::data() const {
   // @@protoc_insertion_point(field_list:server.TrainControlRequest.DoReflashAutomata.data)
-  return data_;
+  return _internal_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TrainControlRequest_DoReflashAutomata::_internal_mutable_data() {
+  return &_impl_.data_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
 TrainControlRequest_DoReflashAutomata::mutable_data() {
   // @@protoc_insertion_point(field_mutable_list:server.TrainControlRequest.DoReflashAutomata.data)
-  return &data_;
+  return _internal_mutable_data();
 }
 
 // -------------------------------------------------------------------
@@ -5543,26 +9592,30 @@ TrainControlRequest_DoReflashAutomata::mutable_data() {
 // TrainControlRequest_DoGetLokState
 
 // optional int32 id = 43;
-inline bool TrainControlRequest_DoGetLokState::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlRequest_DoGetLokState::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlRequest_DoGetLokState::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoGetLokState::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoGetLokState::has_id() const {
+  return _internal_has_id();
 }
 inline void TrainControlRequest_DoGetLokState::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlRequest_DoGetLokState::_internal_id() const {
+  return _impl_.id_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoGetLokState::id() const {
+inline int32_t TrainControlRequest_DoGetLokState::id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoGetLokState.id)
-  return id_;
+  return _internal_id();
 }
-inline void TrainControlRequest_DoGetLokState::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void TrainControlRequest_DoGetLokState::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void TrainControlRequest_DoGetLokState::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoGetLokState.id)
 }
 
@@ -5571,26 +9624,30 @@ inline void TrainControlRequest_DoGetLokState::set_id(::google::protobuf::int32
 // TrainControlRequest_DoEStopLoco
 
 // required int32 id = 46;
-inline bool TrainControlRequest_DoEStopLoco::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlRequest_DoEStopLoco::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoEStopLoco::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlRequest_DoEStopLoco::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoEStopLoco::has_id() const {
+  return _internal_has_id();
 }
 inline void TrainControlRequest_DoEStopLoco::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoEStopLoco::id() const {
+inline int32_t TrainControlRequest_DoEStopLoco::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t TrainControlRequest_DoEStopLoco::id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoEStopLoco.id)
-  return id_;
+  return _internal_id();
+}
+inline void TrainControlRequest_DoEStopLoco::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
 }
-inline void TrainControlRequest_DoEStopLoco::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void TrainControlRequest_DoEStopLoco::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoEStopLoco.id)
 }
 
@@ -5599,57 +9656,78 @@ inline void TrainControlRequest_DoEStopLoco::set_id(::google::protobuf::int32 va
 // TrainControlRequest_DoPicMisc
 
 // required int32 cmd = 48;
-inline bool TrainControlRequest_DoPicMisc::has_cmd() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlRequest_DoPicMisc::set_has_cmd() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlRequest_DoPicMisc::_internal_has_cmd() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoPicMisc::clear_has_cmd() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoPicMisc::has_cmd() const {
+  return _internal_has_cmd();
 }
 inline void TrainControlRequest_DoPicMisc::clear_cmd() {
-  cmd_ = 0;
-  clear_has_cmd();
+  _impl_.cmd_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlRequest_DoPicMisc::_internal_cmd() const {
+  return _impl_.cmd_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoPicMisc::cmd() const {
+inline int32_t TrainControlRequest_DoPicMisc::cmd() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoPicMisc.cmd)
-  return cmd_;
+  return _internal_cmd();
 }
-inline void TrainControlRequest_DoPicMisc::set_cmd(::google::protobuf::int32 value) {
-  set_has_cmd();
-  cmd_ = value;
+inline void TrainControlRequest_DoPicMisc::_internal_set_cmd(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.cmd_ = value;
+}
+inline void TrainControlRequest_DoPicMisc::set_cmd(int32_t value) {
+  _internal_set_cmd(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoPicMisc.cmd)
 }
 
 // repeated int32 arg = 49;
+inline int TrainControlRequest_DoPicMisc::_internal_arg_size() const {
+  return _impl_.arg_.size();
+}
 inline int TrainControlRequest_DoPicMisc::arg_size() const {
-  return arg_.size();
+  return _internal_arg_size();
 }
 inline void TrainControlRequest_DoPicMisc::clear_arg() {
-  arg_.Clear();
+  _impl_.arg_.Clear();
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoPicMisc::arg(int index) const {
+inline int32_t TrainControlRequest_DoPicMisc::_internal_arg(int index) const {
+  return _impl_.arg_.Get(index);
+}
+inline int32_t TrainControlRequest_DoPicMisc::arg(int index) const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoPicMisc.arg)
-  return arg_.Get(index);
+  return _internal_arg(index);
 }
-inline void TrainControlRequest_DoPicMisc::set_arg(int index, ::google::protobuf::int32 value) {
-  arg_.Set(index, value);
+inline void TrainControlRequest_DoPicMisc::set_arg(int index, int32_t value) {
+  _impl_.arg_.Set(index, value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoPicMisc.arg)
 }
-inline void TrainControlRequest_DoPicMisc::add_arg(::google::protobuf::int32 value) {
-  arg_.Add(value);
+inline void TrainControlRequest_DoPicMisc::_internal_add_arg(int32_t value) {
+  _impl_.arg_.Add(value);
+}
+inline void TrainControlRequest_DoPicMisc::add_arg(int32_t value) {
+  _internal_add_arg(value);
   // @@protoc_insertion_point(field_add:server.TrainControlRequest.DoPicMisc.arg)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TrainControlRequest_DoPicMisc::_internal_arg() const {
+  return _impl_.arg_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
 TrainControlRequest_DoPicMisc::arg() const {
   // @@protoc_insertion_point(field_list:server.TrainControlRequest.DoPicMisc.arg)
-  return arg_;
+  return _internal_arg();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TrainControlRequest_DoPicMisc::_internal_mutable_arg() {
+  return &_impl_.arg_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
 TrainControlRequest_DoPicMisc::mutable_arg() {
   // @@protoc_insertion_point(field_mutable_list:server.TrainControlRequest.DoPicMisc.arg)
-  return &arg_;
+  return _internal_mutable_arg();
 }
 
 // -------------------------------------------------------------------
@@ -5657,33 +9735,50 @@ TrainControlRequest_DoPicMisc::mutable_arg() {
 // TrainControlRequest_DoReflashPic
 
 // repeated int32 data = 51;
+inline int TrainControlRequest_DoReflashPic::_internal_data_size() const {
+  return _impl_.data_.size();
+}
 inline int TrainControlRequest_DoReflashPic::data_size() const {
-  return data_.size();
+  return _internal_data_size();
 }
 inline void TrainControlRequest_DoReflashPic::clear_data() {
-  data_.Clear();
+  _impl_.data_.Clear();
+}
+inline int32_t TrainControlRequest_DoReflashPic::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoReflashPic::data(int index) const {
+inline int32_t TrainControlRequest_DoReflashPic::data(int index) const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoReflashPic.data)
-  return data_.Get(index);
+  return _internal_data(index);
 }
-inline void TrainControlRequest_DoReflashPic::set_data(int index, ::google::protobuf::int32 value) {
-  data_.Set(index, value);
+inline void TrainControlRequest_DoReflashPic::set_data(int index, int32_t value) {
+  _impl_.data_.Set(index, value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoReflashPic.data)
 }
-inline void TrainControlRequest_DoReflashPic::add_data(::google::protobuf::int32 value) {
-  data_.Add(value);
+inline void TrainControlRequest_DoReflashPic::_internal_add_data(int32_t value) {
+  _impl_.data_.Add(value);
+}
+inline void TrainControlRequest_DoReflashPic::add_data(int32_t value) {
+  _internal_add_data(value);
   // @@protoc_insertion_point(field_add:server.TrainControlRequest.DoReflashPic.data)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TrainControlRequest_DoReflashPic::_internal_data() const {
+  return _impl_.data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
 TrainControlRequest_DoReflashPic::data() const {
   // @@protoc_insertion_point(field_list:server.TrainControlRequest.DoReflashPic.data)
-  return data_;
+  return _internal_data();
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TrainControlRequest_DoReflashPic::_internal_mutable_data() {
+  return &_impl_.data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
 TrainControlRequest_DoReflashPic::mutable_data() {
   // @@protoc_insertion_point(field_mutable_list:server.TrainControlRequest.DoReflashPic.data)
-  return &data_;
+  return _internal_mutable_data();
 }
 
 // -------------------------------------------------------------------
@@ -5691,74 +9786,86 @@ TrainControlRequest_DoReflashPic::mutable_data() {
 // TrainControlRequest_DoGetOrSetCV
 
 // optional int32 train_id = 53 [default = 63];
-inline bool TrainControlRequest_DoGetOrSetCV::has_train_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlRequest_DoGetOrSetCV::_internal_has_train_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoGetOrSetCV::set_has_train_id() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlRequest_DoGetOrSetCV::clear_has_train_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoGetOrSetCV::has_train_id() const {
+  return _internal_has_train_id();
 }
 inline void TrainControlRequest_DoGetOrSetCV::clear_train_id() {
-  train_id_ = 63;
-  clear_has_train_id();
+  _impl_.train_id_ = 63;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoGetOrSetCV::train_id() const {
+inline int32_t TrainControlRequest_DoGetOrSetCV::_internal_train_id() const {
+  return _impl_.train_id_;
+}
+inline int32_t TrainControlRequest_DoGetOrSetCV::train_id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoGetOrSetCV.train_id)
-  return train_id_;
+  return _internal_train_id();
+}
+inline void TrainControlRequest_DoGetOrSetCV::_internal_set_train_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.train_id_ = value;
 }
-inline void TrainControlRequest_DoGetOrSetCV::set_train_id(::google::protobuf::int32 value) {
-  set_has_train_id();
-  train_id_ = value;
+inline void TrainControlRequest_DoGetOrSetCV::set_train_id(int32_t value) {
+  _internal_set_train_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoGetOrSetCV.train_id)
 }
 
 // required int32 cv = 54;
-inline bool TrainControlRequest_DoGetOrSetCV::has_cv() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void TrainControlRequest_DoGetOrSetCV::set_has_cv() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool TrainControlRequest_DoGetOrSetCV::_internal_has_cv() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoGetOrSetCV::clear_has_cv() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlRequest_DoGetOrSetCV::has_cv() const {
+  return _internal_has_cv();
 }
 inline void TrainControlRequest_DoGetOrSetCV::clear_cv() {
-  cv_ = 0;
-  clear_has_cv();
+  _impl_.cv_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlRequest_DoGetOrSetCV::_internal_cv() const {
+  return _impl_.cv_;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoGetOrSetCV::cv() const {
+inline int32_t TrainControlRequest_DoGetOrSetCV::cv() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoGetOrSetCV.cv)
-  return cv_;
+  return _internal_cv();
 }
-inline void TrainControlRequest_DoGetOrSetCV::set_cv(::google::protobuf::int32 value) {
-  set_has_cv();
-  cv_ = value;
+inline void TrainControlRequest_DoGetOrSetCV::_internal_set_cv(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.cv_ = value;
+}
+inline void TrainControlRequest_DoGetOrSetCV::set_cv(int32_t value) {
+  _internal_set_cv(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoGetOrSetCV.cv)
 }
 
 // optional int32 value = 55;
-inline bool TrainControlRequest_DoGetOrSetCV::has_value() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool TrainControlRequest_DoGetOrSetCV::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoGetOrSetCV::set_has_value() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void TrainControlRequest_DoGetOrSetCV::clear_has_value() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlRequest_DoGetOrSetCV::has_value() const {
+  return _internal_has_value();
 }
 inline void TrainControlRequest_DoGetOrSetCV::clear_value() {
-  value_ = 0;
-  clear_has_value();
+  _impl_.value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoGetOrSetCV::value() const {
+inline int32_t TrainControlRequest_DoGetOrSetCV::_internal_value() const {
+  return _impl_.value_;
+}
+inline int32_t TrainControlRequest_DoGetOrSetCV::value() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoGetOrSetCV.value)
-  return value_;
+  return _internal_value();
+}
+inline void TrainControlRequest_DoGetOrSetCV::_internal_set_value(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_ = value;
 }
-inline void TrainControlRequest_DoGetOrSetCV::set_value(::google::protobuf::int32 value) {
-  set_has_value();
-  value_ = value;
+inline void TrainControlRequest_DoGetOrSetCV::set_value(int32_t value) {
+  _internal_set_value(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoGetOrSetCV.value)
 }
 
@@ -5767,946 +9874,1920 @@ inline void TrainControlRequest_DoGetOrSetCV::set_value(::google::protobuf::int3
 // TrainControlRequest_DoWaitForChange
 
 // required uint64 timestamp = 57;
-inline bool TrainControlRequest_DoWaitForChange::has_timestamp() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlRequest_DoWaitForChange::set_has_timestamp() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlRequest_DoWaitForChange::_internal_has_timestamp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoWaitForChange::clear_has_timestamp() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest_DoWaitForChange::has_timestamp() const {
+  return _internal_has_timestamp();
 }
 inline void TrainControlRequest_DoWaitForChange::clear_timestamp() {
-  timestamp_ = GOOGLE_ULONGLONG(0);
-  clear_has_timestamp();
+  _impl_.timestamp_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t TrainControlRequest_DoWaitForChange::_internal_timestamp() const {
+  return _impl_.timestamp_;
 }
-inline ::google::protobuf::uint64 TrainControlRequest_DoWaitForChange::timestamp() const {
+inline uint64_t TrainControlRequest_DoWaitForChange::timestamp() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoWaitForChange.timestamp)
-  return timestamp_;
+  return _internal_timestamp();
 }
-inline void TrainControlRequest_DoWaitForChange::set_timestamp(::google::protobuf::uint64 value) {
-  set_has_timestamp();
-  timestamp_ = value;
+inline void TrainControlRequest_DoWaitForChange::_internal_set_timestamp(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.timestamp_ = value;
+}
+inline void TrainControlRequest_DoWaitForChange::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoWaitForChange.timestamp)
 }
 
 // optional int32 id = 58;
-inline bool TrainControlRequest_DoWaitForChange::has_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TrainControlRequest_DoWaitForChange::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlRequest_DoWaitForChange::set_has_id() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TrainControlRequest_DoWaitForChange::clear_has_id() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlRequest_DoWaitForChange::has_id() const {
+  return _internal_has_id();
 }
 inline void TrainControlRequest_DoWaitForChange::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::int32 TrainControlRequest_DoWaitForChange::id() const {
+inline int32_t TrainControlRequest_DoWaitForChange::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t TrainControlRequest_DoWaitForChange::id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoWaitForChange.id)
-  return id_;
+  return _internal_id();
+}
+inline void TrainControlRequest_DoWaitForChange::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
 }
-inline void TrainControlRequest_DoWaitForChange::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void TrainControlRequest_DoWaitForChange::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoWaitForChange.id)
 }
 
 // -------------------------------------------------------------------
 
+// TrainControlRequest_DoGetRpcStats
+
+// optional bool reset = 63 [default = false];
+inline bool TrainControlRequest_DoGetRpcStats::_internal_has_reset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TrainControlRequest_DoGetRpcStats::has_reset() const {
+  return _internal_has_reset();
+}
+inline void TrainControlRequest_DoGetRpcStats::clear_reset() {
+  _impl_.reset_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool TrainControlRequest_DoGetRpcStats::_internal_reset() const {
+  return _impl_.reset_;
+}
+inline bool TrainControlRequest_DoGetRpcStats::reset() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoGetRpcStats.reset)
+  return _internal_reset();
+}
+inline void TrainControlRequest_DoGetRpcStats::_internal_set_reset(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reset_ = value;
+}
+inline void TrainControlRequest_DoGetRpcStats::set_reset(bool value) {
+  _internal_set_reset(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoGetRpcStats.reset)
+}
+
+// -------------------------------------------------------------------
+
 // TrainControlRequest
 
 // optional group DoSetSpeed = 1 { ... };
-inline bool TrainControlRequest::has_dosetspeed() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlRequest::_internal_has_dosetspeed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dosetspeed_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::set_has_dosetspeed() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlRequest::clear_has_dosetspeed() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlRequest::has_dosetspeed() const {
+  return _internal_has_dosetspeed();
 }
 inline void TrainControlRequest::clear_dosetspeed() {
-  if (dosetspeed_ != NULL) dosetspeed_->::server::TrainControlRequest_DoSetSpeed::Clear();
-  clear_has_dosetspeed();
+  if (_impl_.dosetspeed_ != nullptr) _impl_.dosetspeed_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::server::TrainControlRequest_DoSetSpeed& TrainControlRequest::_internal_dosetspeed() const {
+  const ::server::TrainControlRequest_DoSetSpeed* p = _impl_.dosetspeed_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoSetSpeed&>(
+      ::server::_TrainControlRequest_DoSetSpeed_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoSetSpeed& TrainControlRequest::dosetspeed() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dosetspeed)
-  return dosetspeed_ != NULL ? *dosetspeed_ : *default_instance_->dosetspeed_;
+  return _internal_dosetspeed();
 }
-inline ::server::TrainControlRequest_DoSetSpeed* TrainControlRequest::mutable_dosetspeed() {
-  set_has_dosetspeed();
-  if (dosetspeed_ == NULL) {
-    dosetspeed_ = new ::server::TrainControlRequest_DoSetSpeed;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dosetspeed(
+    ::server::TrainControlRequest_DoSetSpeed* dosetspeed) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dosetspeed_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dosetspeed)
-  return dosetspeed_;
+  _impl_.dosetspeed_ = dosetspeed;
+  if (dosetspeed) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dosetspeed)
 }
 inline ::server::TrainControlRequest_DoSetSpeed* TrainControlRequest::release_dosetspeed() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::server::TrainControlRequest_DoSetSpeed* temp = _impl_.dosetspeed_;
+  _impl_.dosetspeed_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoSetSpeed* TrainControlRequest::unsafe_arena_release_dosetspeed() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dosetspeed)
-  clear_has_dosetspeed();
-  ::server::TrainControlRequest_DoSetSpeed* temp = dosetspeed_;
-  dosetspeed_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::server::TrainControlRequest_DoSetSpeed* temp = _impl_.dosetspeed_;
+  _impl_.dosetspeed_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoSetSpeed* TrainControlRequest::_internal_mutable_dosetspeed() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.dosetspeed_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoSetSpeed>(GetArenaForAllocation());
+    _impl_.dosetspeed_ = p;
+  }
+  return _impl_.dosetspeed_;
+}
+inline ::server::TrainControlRequest_DoSetSpeed* TrainControlRequest::mutable_dosetspeed() {
+  ::server::TrainControlRequest_DoSetSpeed* _msg = _internal_mutable_dosetspeed();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dosetspeed)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dosetspeed(::server::TrainControlRequest_DoSetSpeed* dosetspeed) {
-  delete dosetspeed_;
-  dosetspeed_ = dosetspeed;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dosetspeed_;
+  }
   if (dosetspeed) {
-    set_has_dosetspeed();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dosetspeed);
+    if (message_arena != submessage_arena) {
+      dosetspeed = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dosetspeed, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_dosetspeed();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.dosetspeed_ = dosetspeed;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dosetspeed)
 }
 
 // optional group DoSetAccessory = 4 { ... };
-inline bool TrainControlRequest::has_dosetaccessory() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void TrainControlRequest::set_has_dosetaccessory() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool TrainControlRequest::_internal_has_dosetaccessory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dosetaccessory_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::clear_has_dosetaccessory() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlRequest::has_dosetaccessory() const {
+  return _internal_has_dosetaccessory();
 }
 inline void TrainControlRequest::clear_dosetaccessory() {
-  if (dosetaccessory_ != NULL) dosetaccessory_->::server::TrainControlRequest_DoSetAccessory::Clear();
-  clear_has_dosetaccessory();
+  if (_impl_.dosetaccessory_ != nullptr) _impl_.dosetaccessory_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::server::TrainControlRequest_DoSetAccessory& TrainControlRequest::_internal_dosetaccessory() const {
+  const ::server::TrainControlRequest_DoSetAccessory* p = _impl_.dosetaccessory_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoSetAccessory&>(
+      ::server::_TrainControlRequest_DoSetAccessory_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoSetAccessory& TrainControlRequest::dosetaccessory() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dosetaccessory)
-  return dosetaccessory_ != NULL ? *dosetaccessory_ : *default_instance_->dosetaccessory_;
+  return _internal_dosetaccessory();
 }
-inline ::server::TrainControlRequest_DoSetAccessory* TrainControlRequest::mutable_dosetaccessory() {
-  set_has_dosetaccessory();
-  if (dosetaccessory_ == NULL) {
-    dosetaccessory_ = new ::server::TrainControlRequest_DoSetAccessory;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dosetaccessory(
+    ::server::TrainControlRequest_DoSetAccessory* dosetaccessory) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dosetaccessory_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dosetaccessory)
-  return dosetaccessory_;
+  _impl_.dosetaccessory_ = dosetaccessory;
+  if (dosetaccessory) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dosetaccessory)
 }
 inline ::server::TrainControlRequest_DoSetAccessory* TrainControlRequest::release_dosetaccessory() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::server::TrainControlRequest_DoSetAccessory* temp = _impl_.dosetaccessory_;
+  _impl_.dosetaccessory_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoSetAccessory* TrainControlRequest::unsafe_arena_release_dosetaccessory() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dosetaccessory)
-  clear_has_dosetaccessory();
-  ::server::TrainControlRequest_DoSetAccessory* temp = dosetaccessory_;
-  dosetaccessory_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::server::TrainControlRequest_DoSetAccessory* temp = _impl_.dosetaccessory_;
+  _impl_.dosetaccessory_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoSetAccessory* TrainControlRequest::_internal_mutable_dosetaccessory() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.dosetaccessory_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoSetAccessory>(GetArenaForAllocation());
+    _impl_.dosetaccessory_ = p;
+  }
+  return _impl_.dosetaccessory_;
+}
+inline ::server::TrainControlRequest_DoSetAccessory* TrainControlRequest::mutable_dosetaccessory() {
+  ::server::TrainControlRequest_DoSetAccessory* _msg = _internal_mutable_dosetaccessory();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dosetaccessory)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dosetaccessory(::server::TrainControlRequest_DoSetAccessory* dosetaccessory) {
-  delete dosetaccessory_;
-  dosetaccessory_ = dosetaccessory;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dosetaccessory_;
+  }
   if (dosetaccessory) {
-    set_has_dosetaccessory();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dosetaccessory);
+    if (message_arena != submessage_arena) {
+      dosetaccessory = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dosetaccessory, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_dosetaccessory();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.dosetaccessory_ = dosetaccessory;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dosetaccessory)
 }
 
 // optional group DoSetEmergencyStop = 8 { ... };
-inline bool TrainControlRequest::has_dosetemergencystop() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool TrainControlRequest::_internal_has_dosetemergencystop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dosetemergencystop_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::set_has_dosetemergencystop() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void TrainControlRequest::clear_has_dosetemergencystop() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlRequest::has_dosetemergencystop() const {
+  return _internal_has_dosetemergencystop();
 }
 inline void TrainControlRequest::clear_dosetemergencystop() {
-  if (dosetemergencystop_ != NULL) dosetemergencystop_->::server::TrainControlRequest_DoSetEmergencyStop::Clear();
-  clear_has_dosetemergencystop();
+  if (_impl_.dosetemergencystop_ != nullptr) _impl_.dosetemergencystop_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::server::TrainControlRequest_DoSetEmergencyStop& TrainControlRequest::_internal_dosetemergencystop() const {
+  const ::server::TrainControlRequest_DoSetEmergencyStop* p = _impl_.dosetemergencystop_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoSetEmergencyStop&>(
+      ::server::_TrainControlRequest_DoSetEmergencyStop_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoSetEmergencyStop& TrainControlRequest::dosetemergencystop() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dosetemergencystop)
-  return dosetemergencystop_ != NULL ? *dosetemergencystop_ : *default_instance_->dosetemergencystop_;
+  return _internal_dosetemergencystop();
 }
-inline ::server::TrainControlRequest_DoSetEmergencyStop* TrainControlRequest::mutable_dosetemergencystop() {
-  set_has_dosetemergencystop();
-  if (dosetemergencystop_ == NULL) {
-    dosetemergencystop_ = new ::server::TrainControlRequest_DoSetEmergencyStop;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dosetemergencystop(
+    ::server::TrainControlRequest_DoSetEmergencyStop* dosetemergencystop) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dosetemergencystop_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dosetemergencystop)
-  return dosetemergencystop_;
+  _impl_.dosetemergencystop_ = dosetemergencystop;
+  if (dosetemergencystop) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dosetemergencystop)
 }
 inline ::server::TrainControlRequest_DoSetEmergencyStop* TrainControlRequest::release_dosetemergencystop() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::server::TrainControlRequest_DoSetEmergencyStop* temp = _impl_.dosetemergencystop_;
+  _impl_.dosetemergencystop_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoSetEmergencyStop* TrainControlRequest::unsafe_arena_release_dosetemergencystop() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dosetemergencystop)
-  clear_has_dosetemergencystop();
-  ::server::TrainControlRequest_DoSetEmergencyStop* temp = dosetemergencystop_;
-  dosetemergencystop_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::server::TrainControlRequest_DoSetEmergencyStop* temp = _impl_.dosetemergencystop_;
+  _impl_.dosetemergencystop_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoSetEmergencyStop* TrainControlRequest::_internal_mutable_dosetemergencystop() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.dosetemergencystop_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoSetEmergencyStop>(GetArenaForAllocation());
+    _impl_.dosetemergencystop_ = p;
+  }
+  return _impl_.dosetemergencystop_;
+}
+inline ::server::TrainControlRequest_DoSetEmergencyStop* TrainControlRequest::mutable_dosetemergencystop() {
+  ::server::TrainControlRequest_DoSetEmergencyStop* _msg = _internal_mutable_dosetemergencystop();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dosetemergencystop)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dosetemergencystop(::server::TrainControlRequest_DoSetEmergencyStop* dosetemergencystop) {
-  delete dosetemergencystop_;
-  dosetemergencystop_ = dosetemergencystop;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dosetemergencystop_;
+  }
   if (dosetemergencystop) {
-    set_has_dosetemergencystop();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dosetemergencystop);
+    if (message_arena != submessage_arena) {
+      dosetemergencystop = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dosetemergencystop, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_dosetemergencystop();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.dosetemergencystop_ = dosetemergencystop;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dosetemergencystop)
 }
 
 // optional group DoRpc = 16 { ... };
-inline bool TrainControlRequest::has_dorpc() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void TrainControlRequest::set_has_dorpc() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool TrainControlRequest::_internal_has_dorpc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dorpc_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::clear_has_dorpc() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool TrainControlRequest::has_dorpc() const {
+  return _internal_has_dorpc();
 }
 inline void TrainControlRequest::clear_dorpc() {
-  if (dorpc_ != NULL) dorpc_->::server::TrainControlRequest_DoRpc::Clear();
-  clear_has_dorpc();
+  if (_impl_.dorpc_ != nullptr) _impl_.dorpc_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::server::TrainControlRequest_DoRpc& TrainControlRequest::_internal_dorpc() const {
+  const ::server::TrainControlRequest_DoRpc* p = _impl_.dorpc_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoRpc&>(
+      ::server::_TrainControlRequest_DoRpc_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoRpc& TrainControlRequest::dorpc() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dorpc)
-  return dorpc_ != NULL ? *dorpc_ : *default_instance_->dorpc_;
+  return _internal_dorpc();
 }
-inline ::server::TrainControlRequest_DoRpc* TrainControlRequest::mutable_dorpc() {
-  set_has_dorpc();
-  if (dorpc_ == NULL) {
-    dorpc_ = new ::server::TrainControlRequest_DoRpc;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dorpc(
+    ::server::TrainControlRequest_DoRpc* dorpc) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dorpc_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dorpc)
-  return dorpc_;
+  _impl_.dorpc_ = dorpc;
+  if (dorpc) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dorpc)
 }
 inline ::server::TrainControlRequest_DoRpc* TrainControlRequest::release_dorpc() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::server::TrainControlRequest_DoRpc* temp = _impl_.dorpc_;
+  _impl_.dorpc_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoRpc* TrainControlRequest::unsafe_arena_release_dorpc() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dorpc)
-  clear_has_dorpc();
-  ::server::TrainControlRequest_DoRpc* temp = dorpc_;
-  dorpc_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::server::TrainControlRequest_DoRpc* temp = _impl_.dorpc_;
+  _impl_.dorpc_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoRpc* TrainControlRequest::_internal_mutable_dorpc() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.dorpc_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoRpc>(GetArenaForAllocation());
+    _impl_.dorpc_ = p;
+  }
+  return _impl_.dorpc_;
+}
+inline ::server::TrainControlRequest_DoRpc* TrainControlRequest::mutable_dorpc() {
+  ::server::TrainControlRequest_DoRpc* _msg = _internal_mutable_dorpc();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dorpc)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dorpc(::server::TrainControlRequest_DoRpc* dorpc) {
-  delete dorpc_;
-  dorpc_ = dorpc;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dorpc_;
+  }
   if (dorpc) {
-    set_has_dorpc();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dorpc);
+    if (message_arena != submessage_arena) {
+      dorpc = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dorpc, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_dorpc();
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.dorpc_ = dorpc;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dorpc)
 }
 
 // optional group DoPing = 21 { ... };
-inline bool TrainControlRequest::has_doping() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool TrainControlRequest::_internal_has_doping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.doping_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::set_has_doping() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void TrainControlRequest::clear_has_doping() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool TrainControlRequest::has_doping() const {
+  return _internal_has_doping();
 }
 inline void TrainControlRequest::clear_doping() {
-  if (doping_ != NULL) doping_->::server::TrainControlRequest_DoPing::Clear();
-  clear_has_doping();
+  if (_impl_.doping_ != nullptr) _impl_.doping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::server::TrainControlRequest_DoPing& TrainControlRequest::_internal_doping() const {
+  const ::server::TrainControlRequest_DoPing* p = _impl_.doping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoPing&>(
+      ::server::_TrainControlRequest_DoPing_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoPing& TrainControlRequest::doping() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.doping)
-  return doping_ != NULL ? *doping_ : *default_instance_->doping_;
+  return _internal_doping();
 }
-inline ::server::TrainControlRequest_DoPing* TrainControlRequest::mutable_doping() {
-  set_has_doping();
-  if (doping_ == NULL) {
-    doping_ = new ::server::TrainControlRequest_DoPing;
+inline void TrainControlRequest::unsafe_arena_set_allocated_doping(
+    ::server::TrainControlRequest_DoPing* doping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.doping_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.doping)
-  return doping_;
+  _impl_.doping_ = doping;
+  if (doping) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.doping)
 }
 inline ::server::TrainControlRequest_DoPing* TrainControlRequest::release_doping() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::server::TrainControlRequest_DoPing* temp = _impl_.doping_;
+  _impl_.doping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoPing* TrainControlRequest::unsafe_arena_release_doping() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.doping)
-  clear_has_doping();
-  ::server::TrainControlRequest_DoPing* temp = doping_;
-  doping_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::server::TrainControlRequest_DoPing* temp = _impl_.doping_;
+  _impl_.doping_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoPing* TrainControlRequest::_internal_mutable_doping() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.doping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoPing>(GetArenaForAllocation());
+    _impl_.doping_ = p;
+  }
+  return _impl_.doping_;
+}
+inline ::server::TrainControlRequest_DoPing* TrainControlRequest::mutable_doping() {
+  ::server::TrainControlRequest_DoPing* _msg = _internal_mutable_doping();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.doping)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_doping(::server::TrainControlRequest_DoPing* doping) {
-  delete doping_;
-  doping_ = doping;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.doping_;
+  }
   if (doping) {
-    set_has_doping();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(doping);
+    if (message_arena != submessage_arena) {
+      doping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, doping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    clear_has_doping();
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
+  _impl_.doping_ = doping;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.doping)
 }
 
 // optional group DoGetOrSetAddress = 23 { ... };
-inline bool TrainControlRequest::has_dogetorsetaddress() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void TrainControlRequest::set_has_dogetorsetaddress() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool TrainControlRequest::_internal_has_dogetorsetaddress() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dogetorsetaddress_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::clear_has_dogetorsetaddress() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool TrainControlRequest::has_dogetorsetaddress() const {
+  return _internal_has_dogetorsetaddress();
 }
 inline void TrainControlRequest::clear_dogetorsetaddress() {
-  if (dogetorsetaddress_ != NULL) dogetorsetaddress_->::server::TrainControlRequest_DoGetOrSetAddress::Clear();
-  clear_has_dogetorsetaddress();
+  if (_impl_.dogetorsetaddress_ != nullptr) _impl_.dogetorsetaddress_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::server::TrainControlRequest_DoGetOrSetAddress& TrainControlRequest::_internal_dogetorsetaddress() const {
+  const ::server::TrainControlRequest_DoGetOrSetAddress* p = _impl_.dogetorsetaddress_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoGetOrSetAddress&>(
+      ::server::_TrainControlRequest_DoGetOrSetAddress_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoGetOrSetAddress& TrainControlRequest::dogetorsetaddress() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dogetorsetaddress)
-  return dogetorsetaddress_ != NULL ? *dogetorsetaddress_ : *default_instance_->dogetorsetaddress_;
+  return _internal_dogetorsetaddress();
 }
-inline ::server::TrainControlRequest_DoGetOrSetAddress* TrainControlRequest::mutable_dogetorsetaddress() {
-  set_has_dogetorsetaddress();
-  if (dogetorsetaddress_ == NULL) {
-    dogetorsetaddress_ = new ::server::TrainControlRequest_DoGetOrSetAddress;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dogetorsetaddress(
+    ::server::TrainControlRequest_DoGetOrSetAddress* dogetorsetaddress) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dogetorsetaddress_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dogetorsetaddress)
-  return dogetorsetaddress_;
+  _impl_.dogetorsetaddress_ = dogetorsetaddress;
+  if (dogetorsetaddress) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dogetorsetaddress)
 }
 inline ::server::TrainControlRequest_DoGetOrSetAddress* TrainControlRequest::release_dogetorsetaddress() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::server::TrainControlRequest_DoGetOrSetAddress* temp = _impl_.dogetorsetaddress_;
+  _impl_.dogetorsetaddress_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoGetOrSetAddress* TrainControlRequest::unsafe_arena_release_dogetorsetaddress() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dogetorsetaddress)
-  clear_has_dogetorsetaddress();
-  ::server::TrainControlRequest_DoGetOrSetAddress* temp = dogetorsetaddress_;
-  dogetorsetaddress_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::server::TrainControlRequest_DoGetOrSetAddress* temp = _impl_.dogetorsetaddress_;
+  _impl_.dogetorsetaddress_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoGetOrSetAddress* TrainControlRequest::_internal_mutable_dogetorsetaddress() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.dogetorsetaddress_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoGetOrSetAddress>(GetArenaForAllocation());
+    _impl_.dogetorsetaddress_ = p;
+  }
+  return _impl_.dogetorsetaddress_;
+}
+inline ::server::TrainControlRequest_DoGetOrSetAddress* TrainControlRequest::mutable_dogetorsetaddress() {
+  ::server::TrainControlRequest_DoGetOrSetAddress* _msg = _internal_mutable_dogetorsetaddress();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dogetorsetaddress)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dogetorsetaddress(::server::TrainControlRequest_DoGetOrSetAddress* dogetorsetaddress) {
-  delete dogetorsetaddress_;
-  dogetorsetaddress_ = dogetorsetaddress;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dogetorsetaddress_;
+  }
   if (dogetorsetaddress) {
-    set_has_dogetorsetaddress();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dogetorsetaddress);
+    if (message_arena != submessage_arena) {
+      dogetorsetaddress = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dogetorsetaddress, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    clear_has_dogetorsetaddress();
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
+  _impl_.dogetorsetaddress_ = dogetorsetaddress;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dogetorsetaddress)
 }
 
 // optional group DoDropState = 25 { ... };
-inline bool TrainControlRequest::has_dodropstate() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+inline bool TrainControlRequest::_internal_has_dodropstate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dodropstate_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::set_has_dodropstate() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void TrainControlRequest::clear_has_dodropstate() {
-  _has_bits_[0] &= ~0x00000040u;
+inline bool TrainControlRequest::has_dodropstate() const {
+  return _internal_has_dodropstate();
 }
 inline void TrainControlRequest::clear_dodropstate() {
-  if (dodropstate_ != NULL) dodropstate_->::server::TrainControlRequest_DoDropState::Clear();
-  clear_has_dodropstate();
+  if (_impl_.dodropstate_ != nullptr) _impl_.dodropstate_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::server::TrainControlRequest_DoDropState& TrainControlRequest::_internal_dodropstate() const {
+  const ::server::TrainControlRequest_DoDropState* p = _impl_.dodropstate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoDropState&>(
+      ::server::_TrainControlRequest_DoDropState_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoDropState& TrainControlRequest::dodropstate() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dodropstate)
-  return dodropstate_ != NULL ? *dodropstate_ : *default_instance_->dodropstate_;
+  return _internal_dodropstate();
 }
-inline ::server::TrainControlRequest_DoDropState* TrainControlRequest::mutable_dodropstate() {
-  set_has_dodropstate();
-  if (dodropstate_ == NULL) {
-    dodropstate_ = new ::server::TrainControlRequest_DoDropState;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dodropstate(
+    ::server::TrainControlRequest_DoDropState* dodropstate) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dodropstate_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dodropstate)
-  return dodropstate_;
+  _impl_.dodropstate_ = dodropstate;
+  if (dodropstate) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dodropstate)
 }
 inline ::server::TrainControlRequest_DoDropState* TrainControlRequest::release_dodropstate() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::server::TrainControlRequest_DoDropState* temp = _impl_.dodropstate_;
+  _impl_.dodropstate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoDropState* TrainControlRequest::unsafe_arena_release_dodropstate() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dodropstate)
-  clear_has_dodropstate();
-  ::server::TrainControlRequest_DoDropState* temp = dodropstate_;
-  dodropstate_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::server::TrainControlRequest_DoDropState* temp = _impl_.dodropstate_;
+  _impl_.dodropstate_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoDropState* TrainControlRequest::_internal_mutable_dodropstate() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.dodropstate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoDropState>(GetArenaForAllocation());
+    _impl_.dodropstate_ = p;
+  }
+  return _impl_.dodropstate_;
+}
+inline ::server::TrainControlRequest_DoDropState* TrainControlRequest::mutable_dodropstate() {
+  ::server::TrainControlRequest_DoDropState* _msg = _internal_mutable_dodropstate();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dodropstate)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dodropstate(::server::TrainControlRequest_DoDropState* dodropstate) {
-  delete dodropstate_;
-  dodropstate_ = dodropstate;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dodropstate_;
+  }
   if (dodropstate) {
-    set_has_dodropstate();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dodropstate);
+    if (message_arena != submessage_arena) {
+      dodropstate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dodropstate, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
   } else {
-    clear_has_dodropstate();
+    _impl_._has_bits_[0] &= ~0x00000040u;
   }
+  _impl_.dodropstate_ = dodropstate;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dodropstate)
 }
 
 // optional group DoChangeSavedState = 26 { ... };
-inline bool TrainControlRequest::has_dochangesavedstate() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void TrainControlRequest::set_has_dochangesavedstate() {
-  _has_bits_[0] |= 0x00000080u;
+inline bool TrainControlRequest::_internal_has_dochangesavedstate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dochangesavedstate_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::clear_has_dochangesavedstate() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool TrainControlRequest::has_dochangesavedstate() const {
+  return _internal_has_dochangesavedstate();
 }
 inline void TrainControlRequest::clear_dochangesavedstate() {
-  if (dochangesavedstate_ != NULL) dochangesavedstate_->::server::TrainControlRequest_DoChangeSavedState::Clear();
-  clear_has_dochangesavedstate();
+  if (_impl_.dochangesavedstate_ != nullptr) _impl_.dochangesavedstate_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::server::TrainControlRequest_DoChangeSavedState& TrainControlRequest::_internal_dochangesavedstate() const {
+  const ::server::TrainControlRequest_DoChangeSavedState* p = _impl_.dochangesavedstate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoChangeSavedState&>(
+      ::server::_TrainControlRequest_DoChangeSavedState_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoChangeSavedState& TrainControlRequest::dochangesavedstate() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dochangesavedstate)
-  return dochangesavedstate_ != NULL ? *dochangesavedstate_ : *default_instance_->dochangesavedstate_;
+  return _internal_dochangesavedstate();
 }
-inline ::server::TrainControlRequest_DoChangeSavedState* TrainControlRequest::mutable_dochangesavedstate() {
-  set_has_dochangesavedstate();
-  if (dochangesavedstate_ == NULL) {
-    dochangesavedstate_ = new ::server::TrainControlRequest_DoChangeSavedState;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dochangesavedstate(
+    ::server::TrainControlRequest_DoChangeSavedState* dochangesavedstate) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dochangesavedstate_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dochangesavedstate)
-  return dochangesavedstate_;
+  _impl_.dochangesavedstate_ = dochangesavedstate;
+  if (dochangesavedstate) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dochangesavedstate)
 }
 inline ::server::TrainControlRequest_DoChangeSavedState* TrainControlRequest::release_dochangesavedstate() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::server::TrainControlRequest_DoChangeSavedState* temp = _impl_.dochangesavedstate_;
+  _impl_.dochangesavedstate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoChangeSavedState* TrainControlRequest::unsafe_arena_release_dochangesavedstate() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dochangesavedstate)
-  clear_has_dochangesavedstate();
-  ::server::TrainControlRequest_DoChangeSavedState* temp = dochangesavedstate_;
-  dochangesavedstate_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::server::TrainControlRequest_DoChangeSavedState* temp = _impl_.dochangesavedstate_;
+  _impl_.dochangesavedstate_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoChangeSavedState* TrainControlRequest::_internal_mutable_dochangesavedstate() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.dochangesavedstate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoChangeSavedState>(GetArenaForAllocation());
+    _impl_.dochangesavedstate_ = p;
+  }
+  return _impl_.dochangesavedstate_;
+}
+inline ::server::TrainControlRequest_DoChangeSavedState* TrainControlRequest::mutable_dochangesavedstate() {
+  ::server::TrainControlRequest_DoChangeSavedState* _msg = _internal_mutable_dochangesavedstate();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dochangesavedstate)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dochangesavedstate(::server::TrainControlRequest_DoChangeSavedState* dochangesavedstate) {
-  delete dochangesavedstate_;
-  dochangesavedstate_ = dochangesavedstate;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dochangesavedstate_;
+  }
   if (dochangesavedstate) {
-    set_has_dochangesavedstate();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dochangesavedstate);
+    if (message_arena != submessage_arena) {
+      dochangesavedstate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dochangesavedstate, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
   } else {
-    clear_has_dochangesavedstate();
+    _impl_._has_bits_[0] &= ~0x00000080u;
   }
+  _impl_.dochangesavedstate_ = dochangesavedstate;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dochangesavedstate)
 }
 
 // optional group DoSendRawCanPacket = 32 { ... };
-inline bool TrainControlRequest::has_dosendrawcanpacket() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+inline bool TrainControlRequest::_internal_has_dosendrawcanpacket() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dosendrawcanpacket_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::set_has_dosendrawcanpacket() {
-  _has_bits_[0] |= 0x00000100u;
-}
-inline void TrainControlRequest::clear_has_dosendrawcanpacket() {
-  _has_bits_[0] &= ~0x00000100u;
+inline bool TrainControlRequest::has_dosendrawcanpacket() const {
+  return _internal_has_dosendrawcanpacket();
 }
 inline void TrainControlRequest::clear_dosendrawcanpacket() {
-  if (dosendrawcanpacket_ != NULL) dosendrawcanpacket_->::server::TrainControlRequest_DoSendRawCanPacket::Clear();
-  clear_has_dosendrawcanpacket();
+  if (_impl_.dosendrawcanpacket_ != nullptr) _impl_.dosendrawcanpacket_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline const ::server::TrainControlRequest_DoSendRawCanPacket& TrainControlRequest::_internal_dosendrawcanpacket() const {
+  const ::server::TrainControlRequest_DoSendRawCanPacket* p = _impl_.dosendrawcanpacket_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoSendRawCanPacket&>(
+      ::server::_TrainControlRequest_DoSendRawCanPacket_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoSendRawCanPacket& TrainControlRequest::dosendrawcanpacket() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dosendrawcanpacket)
-  return dosendrawcanpacket_ != NULL ? *dosendrawcanpacket_ : *default_instance_->dosendrawcanpacket_;
+  return _internal_dosendrawcanpacket();
 }
-inline ::server::TrainControlRequest_DoSendRawCanPacket* TrainControlRequest::mutable_dosendrawcanpacket() {
-  set_has_dosendrawcanpacket();
-  if (dosendrawcanpacket_ == NULL) {
-    dosendrawcanpacket_ = new ::server::TrainControlRequest_DoSendRawCanPacket;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dosendrawcanpacket(
+    ::server::TrainControlRequest_DoSendRawCanPacket* dosendrawcanpacket) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dosendrawcanpacket_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dosendrawcanpacket)
-  return dosendrawcanpacket_;
+  _impl_.dosendrawcanpacket_ = dosendrawcanpacket;
+  if (dosendrawcanpacket) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dosendrawcanpacket)
 }
 inline ::server::TrainControlRequest_DoSendRawCanPacket* TrainControlRequest::release_dosendrawcanpacket() {
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::server::TrainControlRequest_DoSendRawCanPacket* temp = _impl_.dosendrawcanpacket_;
+  _impl_.dosendrawcanpacket_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoSendRawCanPacket* TrainControlRequest::unsafe_arena_release_dosendrawcanpacket() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dosendrawcanpacket)
-  clear_has_dosendrawcanpacket();
-  ::server::TrainControlRequest_DoSendRawCanPacket* temp = dosendrawcanpacket_;
-  dosendrawcanpacket_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::server::TrainControlRequest_DoSendRawCanPacket* temp = _impl_.dosendrawcanpacket_;
+  _impl_.dosendrawcanpacket_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoSendRawCanPacket* TrainControlRequest::_internal_mutable_dosendrawcanpacket() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.dosendrawcanpacket_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoSendRawCanPacket>(GetArenaForAllocation());
+    _impl_.dosendrawcanpacket_ = p;
+  }
+  return _impl_.dosendrawcanpacket_;
+}
+inline ::server::TrainControlRequest_DoSendRawCanPacket* TrainControlRequest::mutable_dosendrawcanpacket() {
+  ::server::TrainControlRequest_DoSendRawCanPacket* _msg = _internal_mutable_dosendrawcanpacket();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dosendrawcanpacket)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dosendrawcanpacket(::server::TrainControlRequest_DoSendRawCanPacket* dosendrawcanpacket) {
-  delete dosendrawcanpacket_;
-  dosendrawcanpacket_ = dosendrawcanpacket;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dosendrawcanpacket_;
+  }
   if (dosendrawcanpacket) {
-    set_has_dosendrawcanpacket();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dosendrawcanpacket);
+    if (message_arena != submessage_arena) {
+      dosendrawcanpacket = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dosendrawcanpacket, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
   } else {
-    clear_has_dosendrawcanpacket();
+    _impl_._has_bits_[0] &= ~0x00000100u;
   }
+  _impl_.dosendrawcanpacket_ = dosendrawcanpacket;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dosendrawcanpacket)
 }
 
 // optional group DoReflashAutomata = 40 { ... };
-inline bool TrainControlRequest::has_doreflashautomata() const {
-  return (_has_bits_[0] & 0x00000200u) != 0;
-}
-inline void TrainControlRequest::set_has_doreflashautomata() {
-  _has_bits_[0] |= 0x00000200u;
+inline bool TrainControlRequest::_internal_has_doreflashautomata() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.doreflashautomata_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::clear_has_doreflashautomata() {
-  _has_bits_[0] &= ~0x00000200u;
+inline bool TrainControlRequest::has_doreflashautomata() const {
+  return _internal_has_doreflashautomata();
 }
 inline void TrainControlRequest::clear_doreflashautomata() {
-  if (doreflashautomata_ != NULL) doreflashautomata_->::server::TrainControlRequest_DoReflashAutomata::Clear();
-  clear_has_doreflashautomata();
+  if (_impl_.doreflashautomata_ != nullptr) _impl_.doreflashautomata_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline const ::server::TrainControlRequest_DoReflashAutomata& TrainControlRequest::_internal_doreflashautomata() const {
+  const ::server::TrainControlRequest_DoReflashAutomata* p = _impl_.doreflashautomata_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoReflashAutomata&>(
+      ::server::_TrainControlRequest_DoReflashAutomata_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoReflashAutomata& TrainControlRequest::doreflashautomata() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.doreflashautomata)
-  return doreflashautomata_ != NULL ? *doreflashautomata_ : *default_instance_->doreflashautomata_;
+  return _internal_doreflashautomata();
 }
-inline ::server::TrainControlRequest_DoReflashAutomata* TrainControlRequest::mutable_doreflashautomata() {
-  set_has_doreflashautomata();
-  if (doreflashautomata_ == NULL) {
-    doreflashautomata_ = new ::server::TrainControlRequest_DoReflashAutomata;
+inline void TrainControlRequest::unsafe_arena_set_allocated_doreflashautomata(
+    ::server::TrainControlRequest_DoReflashAutomata* doreflashautomata) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.doreflashautomata_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.doreflashautomata)
-  return doreflashautomata_;
+  _impl_.doreflashautomata_ = doreflashautomata;
+  if (doreflashautomata) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.doreflashautomata)
 }
 inline ::server::TrainControlRequest_DoReflashAutomata* TrainControlRequest::release_doreflashautomata() {
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::server::TrainControlRequest_DoReflashAutomata* temp = _impl_.doreflashautomata_;
+  _impl_.doreflashautomata_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoReflashAutomata* TrainControlRequest::unsafe_arena_release_doreflashautomata() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.doreflashautomata)
-  clear_has_doreflashautomata();
-  ::server::TrainControlRequest_DoReflashAutomata* temp = doreflashautomata_;
-  doreflashautomata_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::server::TrainControlRequest_DoReflashAutomata* temp = _impl_.doreflashautomata_;
+  _impl_.doreflashautomata_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoReflashAutomata* TrainControlRequest::_internal_mutable_doreflashautomata() {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.doreflashautomata_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoReflashAutomata>(GetArenaForAllocation());
+    _impl_.doreflashautomata_ = p;
+  }
+  return _impl_.doreflashautomata_;
+}
+inline ::server::TrainControlRequest_DoReflashAutomata* TrainControlRequest::mutable_doreflashautomata() {
+  ::server::TrainControlRequest_DoReflashAutomata* _msg = _internal_mutable_doreflashautomata();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.doreflashautomata)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_doreflashautomata(::server::TrainControlRequest_DoReflashAutomata* doreflashautomata) {
-  delete doreflashautomata_;
-  doreflashautomata_ = doreflashautomata;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.doreflashautomata_;
+  }
   if (doreflashautomata) {
-    set_has_doreflashautomata();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(doreflashautomata);
+    if (message_arena != submessage_arena) {
+      doreflashautomata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, doreflashautomata, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
   } else {
-    clear_has_doreflashautomata();
+    _impl_._has_bits_[0] &= ~0x00000200u;
   }
+  _impl_.doreflashautomata_ = doreflashautomata;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.doreflashautomata)
 }
 
 // optional group DoGetLokDb = 41 { ... };
-inline bool TrainControlRequest::has_dogetlokdb() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
+inline bool TrainControlRequest::_internal_has_dogetlokdb() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dogetlokdb_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::set_has_dogetlokdb() {
-  _has_bits_[0] |= 0x00000400u;
-}
-inline void TrainControlRequest::clear_has_dogetlokdb() {
-  _has_bits_[0] &= ~0x00000400u;
+inline bool TrainControlRequest::has_dogetlokdb() const {
+  return _internal_has_dogetlokdb();
 }
 inline void TrainControlRequest::clear_dogetlokdb() {
-  if (dogetlokdb_ != NULL) dogetlokdb_->::server::TrainControlRequest_DoGetLokDb::Clear();
-  clear_has_dogetlokdb();
+  if (_impl_.dogetlokdb_ != nullptr) _impl_.dogetlokdb_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline const ::server::TrainControlRequest_DoGetLokDb& TrainControlRequest::_internal_dogetlokdb() const {
+  const ::server::TrainControlRequest_DoGetLokDb* p = _impl_.dogetlokdb_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoGetLokDb&>(
+      ::server::_TrainControlRequest_DoGetLokDb_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoGetLokDb& TrainControlRequest::dogetlokdb() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dogetlokdb)
-  return dogetlokdb_ != NULL ? *dogetlokdb_ : *default_instance_->dogetlokdb_;
+  return _internal_dogetlokdb();
 }
-inline ::server::TrainControlRequest_DoGetLokDb* TrainControlRequest::mutable_dogetlokdb() {
-  set_has_dogetlokdb();
-  if (dogetlokdb_ == NULL) {
-    dogetlokdb_ = new ::server::TrainControlRequest_DoGetLokDb;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dogetlokdb(
+    ::server::TrainControlRequest_DoGetLokDb* dogetlokdb) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dogetlokdb_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dogetlokdb)
-  return dogetlokdb_;
+  _impl_.dogetlokdb_ = dogetlokdb;
+  if (dogetlokdb) {
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dogetlokdb)
 }
 inline ::server::TrainControlRequest_DoGetLokDb* TrainControlRequest::release_dogetlokdb() {
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::server::TrainControlRequest_DoGetLokDb* temp = _impl_.dogetlokdb_;
+  _impl_.dogetlokdb_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoGetLokDb* TrainControlRequest::unsafe_arena_release_dogetlokdb() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dogetlokdb)
-  clear_has_dogetlokdb();
-  ::server::TrainControlRequest_DoGetLokDb* temp = dogetlokdb_;
-  dogetlokdb_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::server::TrainControlRequest_DoGetLokDb* temp = _impl_.dogetlokdb_;
+  _impl_.dogetlokdb_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoGetLokDb* TrainControlRequest::_internal_mutable_dogetlokdb() {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  if (_impl_.dogetlokdb_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoGetLokDb>(GetArenaForAllocation());
+    _impl_.dogetlokdb_ = p;
+  }
+  return _impl_.dogetlokdb_;
+}
+inline ::server::TrainControlRequest_DoGetLokDb* TrainControlRequest::mutable_dogetlokdb() {
+  ::server::TrainControlRequest_DoGetLokDb* _msg = _internal_mutable_dogetlokdb();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dogetlokdb)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dogetlokdb(::server::TrainControlRequest_DoGetLokDb* dogetlokdb) {
-  delete dogetlokdb_;
-  dogetlokdb_ = dogetlokdb;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dogetlokdb_;
+  }
   if (dogetlokdb) {
-    set_has_dogetlokdb();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dogetlokdb);
+    if (message_arena != submessage_arena) {
+      dogetlokdb = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dogetlokdb, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000400u;
   } else {
-    clear_has_dogetlokdb();
+    _impl_._has_bits_[0] &= ~0x00000400u;
   }
+  _impl_.dogetlokdb_ = dogetlokdb;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dogetlokdb)
 }
 
 // optional group DoGetLokState = 42 { ... };
-inline bool TrainControlRequest::has_dogetlokstate() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-inline void TrainControlRequest::set_has_dogetlokstate() {
-  _has_bits_[0] |= 0x00000800u;
+inline bool TrainControlRequest::_internal_has_dogetlokstate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dogetlokstate_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::clear_has_dogetlokstate() {
-  _has_bits_[0] &= ~0x00000800u;
+inline bool TrainControlRequest::has_dogetlokstate() const {
+  return _internal_has_dogetlokstate();
 }
 inline void TrainControlRequest::clear_dogetlokstate() {
-  if (dogetlokstate_ != NULL) dogetlokstate_->::server::TrainControlRequest_DoGetLokState::Clear();
-  clear_has_dogetlokstate();
+  if (_impl_.dogetlokstate_ != nullptr) _impl_.dogetlokstate_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline const ::server::TrainControlRequest_DoGetLokState& TrainControlRequest::_internal_dogetlokstate() const {
+  const ::server::TrainControlRequest_DoGetLokState* p = _impl_.dogetlokstate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoGetLokState&>(
+      ::server::_TrainControlRequest_DoGetLokState_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoGetLokState& TrainControlRequest::dogetlokstate() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dogetlokstate)
-  return dogetlokstate_ != NULL ? *dogetlokstate_ : *default_instance_->dogetlokstate_;
+  return _internal_dogetlokstate();
 }
-inline ::server::TrainControlRequest_DoGetLokState* TrainControlRequest::mutable_dogetlokstate() {
-  set_has_dogetlokstate();
-  if (dogetlokstate_ == NULL) {
-    dogetlokstate_ = new ::server::TrainControlRequest_DoGetLokState;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dogetlokstate(
+    ::server::TrainControlRequest_DoGetLokState* dogetlokstate) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dogetlokstate_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dogetlokstate)
-  return dogetlokstate_;
+  _impl_.dogetlokstate_ = dogetlokstate;
+  if (dogetlokstate) {
+    _impl_._has_bits_[0] |= 0x00000800u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000800u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dogetlokstate)
 }
 inline ::server::TrainControlRequest_DoGetLokState* TrainControlRequest::release_dogetlokstate() {
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::server::TrainControlRequest_DoGetLokState* temp = _impl_.dogetlokstate_;
+  _impl_.dogetlokstate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoGetLokState* TrainControlRequest::unsafe_arena_release_dogetlokstate() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dogetlokstate)
-  clear_has_dogetlokstate();
-  ::server::TrainControlRequest_DoGetLokState* temp = dogetlokstate_;
-  dogetlokstate_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::server::TrainControlRequest_DoGetLokState* temp = _impl_.dogetlokstate_;
+  _impl_.dogetlokstate_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoGetLokState* TrainControlRequest::_internal_mutable_dogetlokstate() {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  if (_impl_.dogetlokstate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoGetLokState>(GetArenaForAllocation());
+    _impl_.dogetlokstate_ = p;
+  }
+  return _impl_.dogetlokstate_;
+}
+inline ::server::TrainControlRequest_DoGetLokState* TrainControlRequest::mutable_dogetlokstate() {
+  ::server::TrainControlRequest_DoGetLokState* _msg = _internal_mutable_dogetlokstate();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dogetlokstate)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dogetlokstate(::server::TrainControlRequest_DoGetLokState* dogetlokstate) {
-  delete dogetlokstate_;
-  dogetlokstate_ = dogetlokstate;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dogetlokstate_;
+  }
   if (dogetlokstate) {
-    set_has_dogetlokstate();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dogetlokstate);
+    if (message_arena != submessage_arena) {
+      dogetlokstate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dogetlokstate, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000800u;
   } else {
-    clear_has_dogetlokstate();
+    _impl_._has_bits_[0] &= ~0x00000800u;
   }
+  _impl_.dogetlokstate_ = dogetlokstate;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dogetlokstate)
 }
 
 // optional .server.LokStateProto DoSetLokState = 44;
-inline bool TrainControlRequest::has_dosetlokstate() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
+inline bool TrainControlRequest::_internal_has_dosetlokstate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dosetlokstate_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::set_has_dosetlokstate() {
-  _has_bits_[0] |= 0x00001000u;
-}
-inline void TrainControlRequest::clear_has_dosetlokstate() {
-  _has_bits_[0] &= ~0x00001000u;
+inline bool TrainControlRequest::has_dosetlokstate() const {
+  return _internal_has_dosetlokstate();
 }
 inline void TrainControlRequest::clear_dosetlokstate() {
-  if (dosetlokstate_ != NULL) dosetlokstate_->::server::LokStateProto::Clear();
-  clear_has_dosetlokstate();
+  if (_impl_.dosetlokstate_ != nullptr) _impl_.dosetlokstate_->Clear();
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline const ::server::LokStateProto& TrainControlRequest::_internal_dosetlokstate() const {
+  const ::server::LokStateProto* p = _impl_.dosetlokstate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::LokStateProto&>(
+      ::server::_LokStateProto_default_instance_);
 }
 inline const ::server::LokStateProto& TrainControlRequest::dosetlokstate() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSetLokState)
-  return dosetlokstate_ != NULL ? *dosetlokstate_ : *default_instance_->dosetlokstate_;
+  return _internal_dosetlokstate();
 }
-inline ::server::LokStateProto* TrainControlRequest::mutable_dosetlokstate() {
-  set_has_dosetlokstate();
-  if (dosetlokstate_ == NULL) {
-    dosetlokstate_ = new ::server::LokStateProto;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dosetlokstate(
+    ::server::LokStateProto* dosetlokstate) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dosetlokstate_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.DoSetLokState)
-  return dosetlokstate_;
+  _impl_.dosetlokstate_ = dosetlokstate;
+  if (dosetlokstate) {
+    _impl_._has_bits_[0] |= 0x00001000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00001000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.DoSetLokState)
 }
 inline ::server::LokStateProto* TrainControlRequest::release_dosetlokstate() {
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::server::LokStateProto* temp = _impl_.dosetlokstate_;
+  _impl_.dosetlokstate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::LokStateProto* TrainControlRequest::unsafe_arena_release_dosetlokstate() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.DoSetLokState)
-  clear_has_dosetlokstate();
-  ::server::LokStateProto* temp = dosetlokstate_;
-  dosetlokstate_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::server::LokStateProto* temp = _impl_.dosetlokstate_;
+  _impl_.dosetlokstate_ = nullptr;
   return temp;
 }
+inline ::server::LokStateProto* TrainControlRequest::_internal_mutable_dosetlokstate() {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  if (_impl_.dosetlokstate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::LokStateProto>(GetArenaForAllocation());
+    _impl_.dosetlokstate_ = p;
+  }
+  return _impl_.dosetlokstate_;
+}
+inline ::server::LokStateProto* TrainControlRequest::mutable_dosetlokstate() {
+  ::server::LokStateProto* _msg = _internal_mutable_dosetlokstate();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.DoSetLokState)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dosetlokstate(::server::LokStateProto* dosetlokstate) {
-  delete dosetlokstate_;
-  dosetlokstate_ = dosetlokstate;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dosetlokstate_;
+  }
   if (dosetlokstate) {
-    set_has_dosetlokstate();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dosetlokstate);
+    if (message_arena != submessage_arena) {
+      dosetlokstate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dosetlokstate, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00001000u;
   } else {
-    clear_has_dosetlokstate();
+    _impl_._has_bits_[0] &= ~0x00001000u;
   }
+  _impl_.dosetlokstate_ = dosetlokstate;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.DoSetLokState)
 }
 
 // optional group DoEStopLoco = 45 { ... };
-inline bool TrainControlRequest::has_doestoploco() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
-}
-inline void TrainControlRequest::set_has_doestoploco() {
-  _has_bits_[0] |= 0x00002000u;
+inline bool TrainControlRequest::_internal_has_doestoploco() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.doestoploco_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::clear_has_doestoploco() {
-  _has_bits_[0] &= ~0x00002000u;
+inline bool TrainControlRequest::has_doestoploco() const {
+  return _internal_has_doestoploco();
 }
 inline void TrainControlRequest::clear_doestoploco() {
-  if (doestoploco_ != NULL) doestoploco_->::server::TrainControlRequest_DoEStopLoco::Clear();
-  clear_has_doestoploco();
+  if (_impl_.doestoploco_ != nullptr) _impl_.doestoploco_->Clear();
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline const ::server::TrainControlRequest_DoEStopLoco& TrainControlRequest::_internal_doestoploco() const {
+  const ::server::TrainControlRequest_DoEStopLoco* p = _impl_.doestoploco_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoEStopLoco&>(
+      ::server::_TrainControlRequest_DoEStopLoco_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoEStopLoco& TrainControlRequest::doestoploco() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.doestoploco)
-  return doestoploco_ != NULL ? *doestoploco_ : *default_instance_->doestoploco_;
+  return _internal_doestoploco();
 }
-inline ::server::TrainControlRequest_DoEStopLoco* TrainControlRequest::mutable_doestoploco() {
-  set_has_doestoploco();
-  if (doestoploco_ == NULL) {
-    doestoploco_ = new ::server::TrainControlRequest_DoEStopLoco;
+inline void TrainControlRequest::unsafe_arena_set_allocated_doestoploco(
+    ::server::TrainControlRequest_DoEStopLoco* doestoploco) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.doestoploco_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.doestoploco)
-  return doestoploco_;
+  _impl_.doestoploco_ = doestoploco;
+  if (doestoploco) {
+    _impl_._has_bits_[0] |= 0x00002000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00002000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.doestoploco)
 }
 inline ::server::TrainControlRequest_DoEStopLoco* TrainControlRequest::release_doestoploco() {
+  _impl_._has_bits_[0] &= ~0x00002000u;
+  ::server::TrainControlRequest_DoEStopLoco* temp = _impl_.doestoploco_;
+  _impl_.doestoploco_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoEStopLoco* TrainControlRequest::unsafe_arena_release_doestoploco() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.doestoploco)
-  clear_has_doestoploco();
-  ::server::TrainControlRequest_DoEStopLoco* temp = doestoploco_;
-  doestoploco_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+  ::server::TrainControlRequest_DoEStopLoco* temp = _impl_.doestoploco_;
+  _impl_.doestoploco_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoEStopLoco* TrainControlRequest::_internal_mutable_doestoploco() {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  if (_impl_.doestoploco_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoEStopLoco>(GetArenaForAllocation());
+    _impl_.doestoploco_ = p;
+  }
+  return _impl_.doestoploco_;
+}
+inline ::server::TrainControlRequest_DoEStopLoco* TrainControlRequest::mutable_doestoploco() {
+  ::server::TrainControlRequest_DoEStopLoco* _msg = _internal_mutable_doestoploco();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.doestoploco)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_doestoploco(::server::TrainControlRequest_DoEStopLoco* doestoploco) {
-  delete doestoploco_;
-  doestoploco_ = doestoploco;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.doestoploco_;
+  }
   if (doestoploco) {
-    set_has_doestoploco();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(doestoploco);
+    if (message_arena != submessage_arena) {
+      doestoploco = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, doestoploco, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00002000u;
   } else {
-    clear_has_doestoploco();
+    _impl_._has_bits_[0] &= ~0x00002000u;
   }
+  _impl_.doestoploco_ = doestoploco;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.doestoploco)
 }
 
 // optional group DoPicMisc = 47 { ... };
-inline bool TrainControlRequest::has_dopicmisc() const {
-  return (_has_bits_[0] & 0x00004000u) != 0;
+inline bool TrainControlRequest::_internal_has_dopicmisc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dopicmisc_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::set_has_dopicmisc() {
-  _has_bits_[0] |= 0x00004000u;
-}
-inline void TrainControlRequest::clear_has_dopicmisc() {
-  _has_bits_[0] &= ~0x00004000u;
+inline bool TrainControlRequest::has_dopicmisc() const {
+  return _internal_has_dopicmisc();
 }
 inline void TrainControlRequest::clear_dopicmisc() {
-  if (dopicmisc_ != NULL) dopicmisc_->::server::TrainControlRequest_DoPicMisc::Clear();
-  clear_has_dopicmisc();
+  if (_impl_.dopicmisc_ != nullptr) _impl_.dopicmisc_->Clear();
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline const ::server::TrainControlRequest_DoPicMisc& TrainControlRequest::_internal_dopicmisc() const {
+  const ::server::TrainControlRequest_DoPicMisc* p = _impl_.dopicmisc_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoPicMisc&>(
+      ::server::_TrainControlRequest_DoPicMisc_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoPicMisc& TrainControlRequest::dopicmisc() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dopicmisc)
-  return dopicmisc_ != NULL ? *dopicmisc_ : *default_instance_->dopicmisc_;
+  return _internal_dopicmisc();
 }
-inline ::server::TrainControlRequest_DoPicMisc* TrainControlRequest::mutable_dopicmisc() {
-  set_has_dopicmisc();
-  if (dopicmisc_ == NULL) {
-    dopicmisc_ = new ::server::TrainControlRequest_DoPicMisc;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dopicmisc(
+    ::server::TrainControlRequest_DoPicMisc* dopicmisc) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dopicmisc_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dopicmisc)
-  return dopicmisc_;
+  _impl_.dopicmisc_ = dopicmisc;
+  if (dopicmisc) {
+    _impl_._has_bits_[0] |= 0x00004000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00004000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dopicmisc)
 }
 inline ::server::TrainControlRequest_DoPicMisc* TrainControlRequest::release_dopicmisc() {
+  _impl_._has_bits_[0] &= ~0x00004000u;
+  ::server::TrainControlRequest_DoPicMisc* temp = _impl_.dopicmisc_;
+  _impl_.dopicmisc_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoPicMisc* TrainControlRequest::unsafe_arena_release_dopicmisc() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dopicmisc)
-  clear_has_dopicmisc();
-  ::server::TrainControlRequest_DoPicMisc* temp = dopicmisc_;
-  dopicmisc_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+  ::server::TrainControlRequest_DoPicMisc* temp = _impl_.dopicmisc_;
+  _impl_.dopicmisc_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoPicMisc* TrainControlRequest::_internal_mutable_dopicmisc() {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  if (_impl_.dopicmisc_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoPicMisc>(GetArenaForAllocation());
+    _impl_.dopicmisc_ = p;
+  }
+  return _impl_.dopicmisc_;
+}
+inline ::server::TrainControlRequest_DoPicMisc* TrainControlRequest::mutable_dopicmisc() {
+  ::server::TrainControlRequest_DoPicMisc* _msg = _internal_mutable_dopicmisc();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dopicmisc)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dopicmisc(::server::TrainControlRequest_DoPicMisc* dopicmisc) {
-  delete dopicmisc_;
-  dopicmisc_ = dopicmisc;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dopicmisc_;
+  }
   if (dopicmisc) {
-    set_has_dopicmisc();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dopicmisc);
+    if (message_arena != submessage_arena) {
+      dopicmisc = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dopicmisc, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00004000u;
   } else {
-    clear_has_dopicmisc();
+    _impl_._has_bits_[0] &= ~0x00004000u;
   }
+  _impl_.dopicmisc_ = dopicmisc;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dopicmisc)
 }
 
 // optional group DoReflashPic = 50 { ... };
-inline bool TrainControlRequest::has_doreflashpic() const {
-  return (_has_bits_[0] & 0x00008000u) != 0;
-}
-inline void TrainControlRequest::set_has_doreflashpic() {
-  _has_bits_[0] |= 0x00008000u;
+inline bool TrainControlRequest::_internal_has_doreflashpic() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.doreflashpic_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::clear_has_doreflashpic() {
-  _has_bits_[0] &= ~0x00008000u;
+inline bool TrainControlRequest::has_doreflashpic() const {
+  return _internal_has_doreflashpic();
 }
 inline void TrainControlRequest::clear_doreflashpic() {
-  if (doreflashpic_ != NULL) doreflashpic_->::server::TrainControlRequest_DoReflashPic::Clear();
-  clear_has_doreflashpic();
+  if (_impl_.doreflashpic_ != nullptr) _impl_.doreflashpic_->Clear();
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline const ::server::TrainControlRequest_DoReflashPic& TrainControlRequest::_internal_doreflashpic() const {
+  const ::server::TrainControlRequest_DoReflashPic* p = _impl_.doreflashpic_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoReflashPic&>(
+      ::server::_TrainControlRequest_DoReflashPic_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoReflashPic& TrainControlRequest::doreflashpic() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.doreflashpic)
-  return doreflashpic_ != NULL ? *doreflashpic_ : *default_instance_->doreflashpic_;
+  return _internal_doreflashpic();
 }
-inline ::server::TrainControlRequest_DoReflashPic* TrainControlRequest::mutable_doreflashpic() {
-  set_has_doreflashpic();
-  if (doreflashpic_ == NULL) {
-    doreflashpic_ = new ::server::TrainControlRequest_DoReflashPic;
+inline void TrainControlRequest::unsafe_arena_set_allocated_doreflashpic(
+    ::server::TrainControlRequest_DoReflashPic* doreflashpic) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.doreflashpic_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.doreflashpic)
-  return doreflashpic_;
+  _impl_.doreflashpic_ = doreflashpic;
+  if (doreflashpic) {
+    _impl_._has_bits_[0] |= 0x00008000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00008000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.doreflashpic)
 }
 inline ::server::TrainControlRequest_DoReflashPic* TrainControlRequest::release_doreflashpic() {
+  _impl_._has_bits_[0] &= ~0x00008000u;
+  ::server::TrainControlRequest_DoReflashPic* temp = _impl_.doreflashpic_;
+  _impl_.doreflashpic_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoReflashPic* TrainControlRequest::unsafe_arena_release_doreflashpic() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.doreflashpic)
-  clear_has_doreflashpic();
-  ::server::TrainControlRequest_DoReflashPic* temp = doreflashpic_;
-  doreflashpic_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+  ::server::TrainControlRequest_DoReflashPic* temp = _impl_.doreflashpic_;
+  _impl_.doreflashpic_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoReflashPic* TrainControlRequest::_internal_mutable_doreflashpic() {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  if (_impl_.doreflashpic_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoReflashPic>(GetArenaForAllocation());
+    _impl_.doreflashpic_ = p;
+  }
+  return _impl_.doreflashpic_;
+}
+inline ::server::TrainControlRequest_DoReflashPic* TrainControlRequest::mutable_doreflashpic() {
+  ::server::TrainControlRequest_DoReflashPic* _msg = _internal_mutable_doreflashpic();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.doreflashpic)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_doreflashpic(::server::TrainControlRequest_DoReflashPic* doreflashpic) {
-  delete doreflashpic_;
-  doreflashpic_ = doreflashpic;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.doreflashpic_;
+  }
   if (doreflashpic) {
-    set_has_doreflashpic();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(doreflashpic);
+    if (message_arena != submessage_arena) {
+      doreflashpic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, doreflashpic, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00008000u;
   } else {
-    clear_has_doreflashpic();
+    _impl_._has_bits_[0] &= ~0x00008000u;
   }
+  _impl_.doreflashpic_ = doreflashpic;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.doreflashpic)
 }
 
 // optional group DoGetOrSetCV = 52 { ... };
-inline bool TrainControlRequest::has_dogetorsetcv() const {
-  return (_has_bits_[0] & 0x00010000u) != 0;
+inline bool TrainControlRequest::_internal_has_dogetorsetcv() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dogetorsetcv_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::set_has_dogetorsetcv() {
-  _has_bits_[0] |= 0x00010000u;
-}
-inline void TrainControlRequest::clear_has_dogetorsetcv() {
-  _has_bits_[0] &= ~0x00010000u;
+inline bool TrainControlRequest::has_dogetorsetcv() const {
+  return _internal_has_dogetorsetcv();
 }
 inline void TrainControlRequest::clear_dogetorsetcv() {
-  if (dogetorsetcv_ != NULL) dogetorsetcv_->::server::TrainControlRequest_DoGetOrSetCV::Clear();
-  clear_has_dogetorsetcv();
+  if (_impl_.dogetorsetcv_ != nullptr) _impl_.dogetorsetcv_->Clear();
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline const ::server::TrainControlRequest_DoGetOrSetCV& TrainControlRequest::_internal_dogetorsetcv() const {
+  const ::server::TrainControlRequest_DoGetOrSetCV* p = _impl_.dogetorsetcv_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoGetOrSetCV&>(
+      ::server::_TrainControlRequest_DoGetOrSetCV_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoGetOrSetCV& TrainControlRequest::dogetorsetcv() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dogetorsetcv)
-  return dogetorsetcv_ != NULL ? *dogetorsetcv_ : *default_instance_->dogetorsetcv_;
+  return _internal_dogetorsetcv();
 }
-inline ::server::TrainControlRequest_DoGetOrSetCV* TrainControlRequest::mutable_dogetorsetcv() {
-  set_has_dogetorsetcv();
-  if (dogetorsetcv_ == NULL) {
-    dogetorsetcv_ = new ::server::TrainControlRequest_DoGetOrSetCV;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dogetorsetcv(
+    ::server::TrainControlRequest_DoGetOrSetCV* dogetorsetcv) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dogetorsetcv_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dogetorsetcv)
-  return dogetorsetcv_;
+  _impl_.dogetorsetcv_ = dogetorsetcv;
+  if (dogetorsetcv) {
+    _impl_._has_bits_[0] |= 0x00010000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00010000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dogetorsetcv)
 }
 inline ::server::TrainControlRequest_DoGetOrSetCV* TrainControlRequest::release_dogetorsetcv() {
+  _impl_._has_bits_[0] &= ~0x00010000u;
+  ::server::TrainControlRequest_DoGetOrSetCV* temp = _impl_.dogetorsetcv_;
+  _impl_.dogetorsetcv_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoGetOrSetCV* TrainControlRequest::unsafe_arena_release_dogetorsetcv() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dogetorsetcv)
-  clear_has_dogetorsetcv();
-  ::server::TrainControlRequest_DoGetOrSetCV* temp = dogetorsetcv_;
-  dogetorsetcv_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+  ::server::TrainControlRequest_DoGetOrSetCV* temp = _impl_.dogetorsetcv_;
+  _impl_.dogetorsetcv_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoGetOrSetCV* TrainControlRequest::_internal_mutable_dogetorsetcv() {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  if (_impl_.dogetorsetcv_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoGetOrSetCV>(GetArenaForAllocation());
+    _impl_.dogetorsetcv_ = p;
+  }
+  return _impl_.dogetorsetcv_;
+}
+inline ::server::TrainControlRequest_DoGetOrSetCV* TrainControlRequest::mutable_dogetorsetcv() {
+  ::server::TrainControlRequest_DoGetOrSetCV* _msg = _internal_mutable_dogetorsetcv();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dogetorsetcv)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dogetorsetcv(::server::TrainControlRequest_DoGetOrSetCV* dogetorsetcv) {
-  delete dogetorsetcv_;
-  dogetorsetcv_ = dogetorsetcv;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dogetorsetcv_;
+  }
   if (dogetorsetcv) {
-    set_has_dogetorsetcv();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dogetorsetcv);
+    if (message_arena != submessage_arena) {
+      dogetorsetcv = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dogetorsetcv, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00010000u;
   } else {
-    clear_has_dogetorsetcv();
+    _impl_._has_bits_[0] &= ~0x00010000u;
   }
+  _impl_.dogetorsetcv_ = dogetorsetcv;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dogetorsetcv)
 }
 
 // optional group DoWaitForChange = 56 { ... };
-inline bool TrainControlRequest::has_dowaitforchange() const {
-  return (_has_bits_[0] & 0x00020000u) != 0;
-}
-inline void TrainControlRequest::set_has_dowaitforchange() {
-  _has_bits_[0] |= 0x00020000u;
+inline bool TrainControlRequest::_internal_has_dowaitforchange() const {
+  bool value = (_impl_._has_bits_[0] & 0x00020000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dowaitforchange_ != nullptr);
+  return value;
 }
-inline void TrainControlRequest::clear_has_dowaitforchange() {
-  _has_bits_[0] &= ~0x00020000u;
+inline bool TrainControlRequest::has_dowaitforchange() const {
+  return _internal_has_dowaitforchange();
 }
 inline void TrainControlRequest::clear_dowaitforchange() {
-  if (dowaitforchange_ != NULL) dowaitforchange_->::server::TrainControlRequest_DoWaitForChange::Clear();
-  clear_has_dowaitforchange();
+  if (_impl_.dowaitforchange_ != nullptr) _impl_.dowaitforchange_->Clear();
+  _impl_._has_bits_[0] &= ~0x00020000u;
+}
+inline const ::server::TrainControlRequest_DoWaitForChange& TrainControlRequest::_internal_dowaitforchange() const {
+  const ::server::TrainControlRequest_DoWaitForChange* p = _impl_.dowaitforchange_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoWaitForChange&>(
+      ::server::_TrainControlRequest_DoWaitForChange_default_instance_);
 }
 inline const ::server::TrainControlRequest_DoWaitForChange& TrainControlRequest::dowaitforchange() const {
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dowaitforchange)
-  return dowaitforchange_ != NULL ? *dowaitforchange_ : *default_instance_->dowaitforchange_;
+  return _internal_dowaitforchange();
 }
-inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::mutable_dowaitforchange() {
-  set_has_dowaitforchange();
-  if (dowaitforchange_ == NULL) {
-    dowaitforchange_ = new ::server::TrainControlRequest_DoWaitForChange;
+inline void TrainControlRequest::unsafe_arena_set_allocated_dowaitforchange(
+    ::server::TrainControlRequest_DoWaitForChange* dowaitforchange) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dowaitforchange_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dowaitforchange)
-  return dowaitforchange_;
+  _impl_.dowaitforchange_ = dowaitforchange;
+  if (dowaitforchange) {
+    _impl_._has_bits_[0] |= 0x00020000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00020000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dowaitforchange)
 }
 inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::release_dowaitforchange() {
+  _impl_._has_bits_[0] &= ~0x00020000u;
+  ::server::TrainControlRequest_DoWaitForChange* temp = _impl_.dowaitforchange_;
+  _impl_.dowaitforchange_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::unsafe_arena_release_dowaitforchange() {
   // @@protoc_insertion_point(field_release:server.TrainControlRequest.dowaitforchange)
-  clear_has_dowaitforchange();
-  ::server::TrainControlRequest_DoWaitForChange* temp = dowaitforchange_;
-  dowaitforchange_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00020000u;
+  ::server::TrainControlRequest_DoWaitForChange* temp = _impl_.dowaitforchange_;
+  _impl_.dowaitforchange_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::_internal_mutable_dowaitforchange() {
+  _impl_._has_bits_[0] |= 0x00020000u;
+  if (_impl_.dowaitforchange_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoWaitForChange>(GetArenaForAllocation());
+    _impl_.dowaitforchange_ = p;
+  }
+  return _impl_.dowaitforchange_;
+}
+inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::mutable_dowaitforchange() {
+  ::server::TrainControlRequest_DoWaitForChange* _msg = _internal_mutable_dowaitforchange();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dowaitforchange)
+  return _msg;
+}
 inline void TrainControlRequest::set_allocated_dowaitforchange(::server::TrainControlRequest_DoWaitForChange* dowaitforchange) {
-  delete dowaitforchange_;
-  dowaitforchange_ = dowaitforchange;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dowaitforchange_;
+  }
   if (dowaitforchange) {
-    set_has_dowaitforchange();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dowaitforchange);
+    if (message_arena != submessage_arena) {
+      dowaitforchange = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dowaitforchange, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00020000u;
   } else {
-    clear_has_dowaitforchange();
+    _impl_._has_bits_[0] &= ~0x00020000u;
   }
+  _impl_.dowaitforchange_ = dowaitforchange;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dowaitforchange)
 }
 
+// optional group DoGetRpcStats = 62 { ... };
+inline bool TrainControlRequest::_internal_has_dogetrpcstats() const {
+  bool value = (_impl_._has_bits_[0] & 0x00040000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.dogetrpcstats_ != nullptr);
+  return value;
+}
+inline bool TrainControlRequest::has_dogetrpcstats() const {
+  return _internal_has_dogetrpcstats();
+}
+inline void TrainControlRequest::clear_dogetrpcstats() {
+  if (_impl_.dogetrpcstats_ != nullptr) _impl_.dogetrpcstats_->Clear();
+  _impl_._has_bits_[0] &= ~0x00040000u;
+}
+inline const ::server::TrainControlRequest_DoGetRpcStats& TrainControlRequest::_internal_dogetrpcstats() const {
+  const ::server::TrainControlRequest_DoGetRpcStats* p = _impl_.dogetrpcstats_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest_DoGetRpcStats&>(
+      ::server::_TrainControlRequest_DoGetRpcStats_default_instance_);
+}
+inline const ::server::TrainControlRequest_DoGetRpcStats& TrainControlRequest::dogetrpcstats() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlRequest.dogetrpcstats)
+  return _internal_dogetrpcstats();
+}
+inline void TrainControlRequest::unsafe_arena_set_allocated_dogetrpcstats(
+    ::server::TrainControlRequest_DoGetRpcStats* dogetrpcstats) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.dogetrpcstats_);
+  }
+  _impl_.dogetrpcstats_ = dogetrpcstats;
+  if (dogetrpcstats) {
+    _impl_._has_bits_[0] |= 0x00040000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00040000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dogetrpcstats)
+}
+inline ::server::TrainControlRequest_DoGetRpcStats* TrainControlRequest::release_dogetrpcstats() {
+  _impl_._has_bits_[0] &= ~0x00040000u;
+  ::server::TrainControlRequest_DoGetRpcStats* temp = _impl_.dogetrpcstats_;
+  _impl_.dogetrpcstats_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest_DoGetRpcStats* TrainControlRequest::unsafe_arena_release_dogetrpcstats() {
+  // @@protoc_insertion_point(field_release:server.TrainControlRequest.dogetrpcstats)
+  _impl_._has_bits_[0] &= ~0x00040000u;
+  ::server::TrainControlRequest_DoGetRpcStats* temp = _impl_.dogetrpcstats_;
+  _impl_.dogetrpcstats_ = nullptr;
+  return temp;
+}
+inline ::server::TrainControlRequest_DoGetRpcStats* TrainControlRequest::_internal_mutable_dogetrpcstats() {
+  _impl_._has_bits_[0] |= 0x00040000u;
+  if (_impl_.dogetrpcstats_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoGetRpcStats>(GetArenaForAllocation());
+    _impl_.dogetrpcstats_ = p;
+  }
+  return _impl_.dogetrpcstats_;
+}
+inline ::server::TrainControlRequest_DoGetRpcStats* TrainControlRequest::mutable_dogetrpcstats() {
+  ::server::TrainControlRequest_DoGetRpcStats* _msg = _internal_mutable_dogetrpcstats();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dogetrpcstats)
+  return _msg;
+}
+inline void TrainControlRequest::set_allocated_dogetrpcstats(::server::TrainControlRequest_DoGetRpcStats* dogetrpcstats) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.dogetrpcstats_;
+  }
+  if (dogetrpcstats) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(dogetrpcstats);
+    if (message_arena != submessage_arena) {
+      dogetrpcstats = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dogetrpcstats, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00040000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00040000u;
+  }
+  _impl_.dogetrpcstats_ = dogetrpcstats;
+  // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dogetrpcstats)
+}
+
 // -------------------------------------------------------------------
 
 // TrainControlResponse_Speed
 
 // required int32 id = 2;
-inline bool TrainControlResponse_Speed::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlResponse_Speed::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlResponse_Speed::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Speed::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_Speed::has_id() const {
+  return _internal_has_id();
 }
 inline void TrainControlResponse_Speed::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlResponse_Speed::_internal_id() const {
+  return _impl_.id_;
 }
-inline ::google::protobuf::int32 TrainControlResponse_Speed::id() const {
+inline int32_t TrainControlResponse_Speed::id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Speed.id)
-  return id_;
+  return _internal_id();
 }
-inline void TrainControlResponse_Speed::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void TrainControlResponse_Speed::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
+}
+inline void TrainControlResponse_Speed::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Speed.id)
 }
 
 // optional int32 dir = 25 [default = 1];
-inline bool TrainControlResponse_Speed::has_dir() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TrainControlResponse_Speed::_internal_has_dir() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Speed::set_has_dir() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TrainControlResponse_Speed::clear_has_dir() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlResponse_Speed::has_dir() const {
+  return _internal_has_dir();
 }
 inline void TrainControlResponse_Speed::clear_dir() {
-  dir_ = 1;
-  clear_has_dir();
+  _impl_.dir_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::google::protobuf::int32 TrainControlResponse_Speed::dir() const {
+inline int32_t TrainControlResponse_Speed::_internal_dir() const {
+  return _impl_.dir_;
+}
+inline int32_t TrainControlResponse_Speed::dir() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Speed.dir)
-  return dir_;
+  return _internal_dir();
+}
+inline void TrainControlResponse_Speed::_internal_set_dir(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.dir_ = value;
 }
-inline void TrainControlResponse_Speed::set_dir(::google::protobuf::int32 value) {
-  set_has_dir();
-  dir_ = value;
+inline void TrainControlResponse_Speed::set_dir(int32_t value) {
+  _internal_set_dir(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Speed.dir)
 }
 
 // required int32 speed = 3;
-inline bool TrainControlResponse_Speed::has_speed() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TrainControlResponse_Speed::set_has_speed() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool TrainControlResponse_Speed::_internal_has_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Speed::clear_has_speed() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlResponse_Speed::has_speed() const {
+  return _internal_has_speed();
 }
 inline void TrainControlResponse_Speed::clear_speed() {
-  speed_ = 0;
-  clear_has_speed();
+  _impl_.speed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t TrainControlResponse_Speed::_internal_speed() const {
+  return _impl_.speed_;
 }
-inline ::google::protobuf::int32 TrainControlResponse_Speed::speed() const {
+inline int32_t TrainControlResponse_Speed::speed() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Speed.speed)
-  return speed_;
+  return _internal_speed();
 }
-inline void TrainControlResponse_Speed::set_speed(::google::protobuf::int32 value) {
-  set_has_speed();
-  speed_ = value;
+inline void TrainControlResponse_Speed::_internal_set_speed(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.speed_ = value;
+}
+inline void TrainControlResponse_Speed::set_speed(int32_t value) {
+  _internal_set_speed(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Speed.speed)
 }
 
 // optional uint64 timestamp = 50;
-inline bool TrainControlResponse_Speed::has_timestamp() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool TrainControlResponse_Speed::_internal_has_timestamp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Speed::set_has_timestamp() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void TrainControlResponse_Speed::clear_has_timestamp() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool TrainControlResponse_Speed::has_timestamp() const {
+  return _internal_has_timestamp();
 }
 inline void TrainControlResponse_Speed::clear_timestamp() {
-  timestamp_ = GOOGLE_ULONGLONG(0);
-  clear_has_timestamp();
+  _impl_.timestamp_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::uint64 TrainControlResponse_Speed::timestamp() const {
+inline uint64_t TrainControlResponse_Speed::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t TrainControlResponse_Speed::timestamp() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Speed.timestamp)
-  return timestamp_;
+  return _internal_timestamp();
+}
+inline void TrainControlResponse_Speed::_internal_set_timestamp(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.timestamp_ = value;
 }
-inline void TrainControlResponse_Speed::set_timestamp(::google::protobuf::uint64 value) {
-  set_has_timestamp();
-  timestamp_ = value;
+inline void TrainControlResponse_Speed::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Speed.timestamp)
 }
 
@@ -6715,98 +11796,114 @@ inline void TrainControlResponse_Speed::set_timestamp(::google::protobuf::uint64
 // TrainControlResponse_Accessory
 
 // required int32 train_id = 5;
-inline bool TrainControlResponse_Accessory::has_train_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlResponse_Accessory::set_has_train_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlResponse_Accessory::_internal_has_train_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Accessory::clear_has_train_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_Accessory::has_train_id() const {
+  return _internal_has_train_id();
 }
 inline void TrainControlResponse_Accessory::clear_train_id() {
-  train_id_ = 0;
-  clear_has_train_id();
+  _impl_.train_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlResponse_Accessory::_internal_train_id() const {
+  return _impl_.train_id_;
 }
-inline ::google::protobuf::int32 TrainControlResponse_Accessory::train_id() const {
+inline int32_t TrainControlResponse_Accessory::train_id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Accessory.train_id)
-  return train_id_;
+  return _internal_train_id();
 }
-inline void TrainControlResponse_Accessory::set_train_id(::google::protobuf::int32 value) {
-  set_has_train_id();
-  train_id_ = value;
+inline void TrainControlResponse_Accessory::_internal_set_train_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.train_id_ = value;
+}
+inline void TrainControlResponse_Accessory::set_train_id(int32_t value) {
+  _internal_set_train_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Accessory.train_id)
 }
 
 // required int32 accessory_id = 6;
-inline bool TrainControlResponse_Accessory::has_accessory_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TrainControlResponse_Accessory::_internal_has_accessory_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Accessory::set_has_accessory_id() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TrainControlResponse_Accessory::clear_has_accessory_id() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlResponse_Accessory::has_accessory_id() const {
+  return _internal_has_accessory_id();
 }
 inline void TrainControlResponse_Accessory::clear_accessory_id() {
-  accessory_id_ = 0;
-  clear_has_accessory_id();
+  _impl_.accessory_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::int32 TrainControlResponse_Accessory::accessory_id() const {
+inline int32_t TrainControlResponse_Accessory::_internal_accessory_id() const {
+  return _impl_.accessory_id_;
+}
+inline int32_t TrainControlResponse_Accessory::accessory_id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Accessory.accessory_id)
-  return accessory_id_;
+  return _internal_accessory_id();
+}
+inline void TrainControlResponse_Accessory::_internal_set_accessory_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.accessory_id_ = value;
 }
-inline void TrainControlResponse_Accessory::set_accessory_id(::google::protobuf::int32 value) {
-  set_has_accessory_id();
-  accessory_id_ = value;
+inline void TrainControlResponse_Accessory::set_accessory_id(int32_t value) {
+  _internal_set_accessory_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Accessory.accessory_id)
 }
 
 // required int32 value = 7;
-inline bool TrainControlResponse_Accessory::has_value() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TrainControlResponse_Accessory::set_has_value() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool TrainControlResponse_Accessory::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Accessory::clear_has_value() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlResponse_Accessory::has_value() const {
+  return _internal_has_value();
 }
 inline void TrainControlResponse_Accessory::clear_value() {
-  value_ = 0;
-  clear_has_value();
+  _impl_.value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline int32_t TrainControlResponse_Accessory::_internal_value() const {
+  return _impl_.value_;
 }
-inline ::google::protobuf::int32 TrainControlResponse_Accessory::value() const {
+inline int32_t TrainControlResponse_Accessory::value() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Accessory.value)
-  return value_;
+  return _internal_value();
 }
-inline void TrainControlResponse_Accessory::set_value(::google::protobuf::int32 value) {
-  set_has_value();
-  value_ = value;
+inline void TrainControlResponse_Accessory::_internal_set_value(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.value_ = value;
+}
+inline void TrainControlResponse_Accessory::set_value(int32_t value) {
+  _internal_set_value(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Accessory.value)
 }
 
 // optional uint64 timestamp = 51;
-inline bool TrainControlResponse_Accessory::has_timestamp() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool TrainControlResponse_Accessory::_internal_has_timestamp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Accessory::set_has_timestamp() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void TrainControlResponse_Accessory::clear_has_timestamp() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool TrainControlResponse_Accessory::has_timestamp() const {
+  return _internal_has_timestamp();
 }
 inline void TrainControlResponse_Accessory::clear_timestamp() {
-  timestamp_ = GOOGLE_ULONGLONG(0);
-  clear_has_timestamp();
+  _impl_.timestamp_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::uint64 TrainControlResponse_Accessory::timestamp() const {
+inline uint64_t TrainControlResponse_Accessory::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t TrainControlResponse_Accessory::timestamp() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Accessory.timestamp)
-  return timestamp_;
+  return _internal_timestamp();
+}
+inline void TrainControlResponse_Accessory::_internal_set_timestamp(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.timestamp_ = value;
 }
-inline void TrainControlResponse_Accessory::set_timestamp(::google::protobuf::uint64 value) {
-  set_has_timestamp();
-  timestamp_ = value;
+inline void TrainControlResponse_Accessory::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Accessory.timestamp)
 }
 
@@ -6815,26 +11912,30 @@ inline void TrainControlResponse_Accessory::set_timestamp(::google::protobuf::ui
 // TrainControlResponse_EmergencyStop
 
 // required bool stop = 9;
-inline bool TrainControlResponse_EmergencyStop::has_stop() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlResponse_EmergencyStop::set_has_stop() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlResponse_EmergencyStop::_internal_has_stop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_EmergencyStop::clear_has_stop() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_EmergencyStop::has_stop() const {
+  return _internal_has_stop();
 }
 inline void TrainControlResponse_EmergencyStop::clear_stop() {
-  stop_ = false;
-  clear_has_stop();
+  _impl_.stop_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool TrainControlResponse_EmergencyStop::_internal_stop() const {
+  return _impl_.stop_;
 }
 inline bool TrainControlResponse_EmergencyStop::stop() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.EmergencyStop.stop)
-  return stop_;
+  return _internal_stop();
+}
+inline void TrainControlResponse_EmergencyStop::_internal_set_stop(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.stop_ = value;
 }
 inline void TrainControlResponse_EmergencyStop::set_stop(bool value) {
-  set_has_stop();
-  stop_ = value;
+  _internal_set_stop(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.EmergencyStop.stop)
 }
 
@@ -6843,50 +11944,58 @@ inline void TrainControlResponse_EmergencyStop::set_stop(bool value) {
 // TrainControlResponse_RpcResponse
 
 // required bool success = 17;
-inline bool TrainControlResponse_RpcResponse::has_success() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlResponse_RpcResponse::_internal_has_success() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_RpcResponse::set_has_success() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlResponse_RpcResponse::clear_has_success() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_RpcResponse::has_success() const {
+  return _internal_has_success();
 }
 inline void TrainControlResponse_RpcResponse::clear_success() {
-  success_ = false;
-  clear_has_success();
+  _impl_.success_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool TrainControlResponse_RpcResponse::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool TrainControlResponse_RpcResponse::success() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcResponse.success)
-  return success_;
+  return _internal_success();
+}
+inline void TrainControlResponse_RpcResponse::_internal_set_success(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.success_ = value;
 }
 inline void TrainControlResponse_RpcResponse::set_success(bool value) {
-  set_has_success();
-  success_ = value;
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.RpcResponse.success)
 }
 
 // required int32 response = 18;
-inline bool TrainControlResponse_RpcResponse::has_response() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void TrainControlResponse_RpcResponse::set_has_response() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool TrainControlResponse_RpcResponse::_internal_has_response() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlResponse_RpcResponse::clear_has_response() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlResponse_RpcResponse::has_response() const {
+  return _internal_has_response();
 }
 inline void TrainControlResponse_RpcResponse::clear_response() {
-  response_ = 0;
-  clear_has_response();
+  _impl_.response_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t TrainControlResponse_RpcResponse::_internal_response() const {
+  return _impl_.response_;
 }
-inline ::google::protobuf::int32 TrainControlResponse_RpcResponse::response() const {
+inline int32_t TrainControlResponse_RpcResponse::response() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcResponse.response)
-  return response_;
+  return _internal_response();
 }
-inline void TrainControlResponse_RpcResponse::set_response(::google::protobuf::int32 value) {
-  set_has_response();
-  response_ = value;
+inline void TrainControlResponse_RpcResponse::_internal_set_response(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.response_ = value;
+}
+inline void TrainControlResponse_RpcResponse::set_response(int32_t value) {
+  _internal_set_response(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.RpcResponse.response)
 }
 
@@ -6895,26 +12004,30 @@ inline void TrainControlResponse_RpcResponse::set_response(::google::protobuf::i
 // TrainControlResponse_Pong
 
 // required int32 value = 20;
-inline bool TrainControlResponse_Pong::has_value() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlResponse_Pong::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Pong::set_has_value() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlResponse_Pong::clear_has_value() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_Pong::has_value() const {
+  return _internal_has_value();
 }
 inline void TrainControlResponse_Pong::clear_value() {
-  value_ = 0;
-  clear_has_value();
+  _impl_.value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::google::protobuf::int32 TrainControlResponse_Pong::value() const {
+inline int32_t TrainControlResponse_Pong::_internal_value() const {
+  return _impl_.value_;
+}
+inline int32_t TrainControlResponse_Pong::value() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Pong.value)
-  return value_;
+  return _internal_value();
+}
+inline void TrainControlResponse_Pong::_internal_set_value(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.value_ = value;
 }
-inline void TrainControlResponse_Pong::set_value(::google::protobuf::int32 value) {
-  set_has_value();
-  value_ = value;
+inline void TrainControlResponse_Pong::set_value(int32_t value) {
+  _internal_set_value(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Pong.value)
 }
 
@@ -6923,26 +12036,30 @@ inline void TrainControlResponse_Pong::set_value(::google::protobuf::int32 value
 // TrainControlResponse_CurrentAddress
 
 // required int32 address = 22;
-inline bool TrainControlResponse_CurrentAddress::has_address() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlResponse_CurrentAddress::set_has_address() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlResponse_CurrentAddress::_internal_has_address() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_CurrentAddress::clear_has_address() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_CurrentAddress::has_address() const {
+  return _internal_has_address();
 }
 inline void TrainControlResponse_CurrentAddress::clear_address() {
-  address_ = 0;
-  clear_has_address();
+  _impl_.address_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlResponse_CurrentAddress::_internal_address() const {
+  return _impl_.address_;
 }
-inline ::google::protobuf::int32 TrainControlResponse_CurrentAddress::address() const {
+inline int32_t TrainControlResponse_CurrentAddress::address() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.CurrentAddress.address)
-  return address_;
+  return _internal_address();
 }
-inline void TrainControlResponse_CurrentAddress::set_address(::google::protobuf::int32 value) {
-  set_has_address();
-  address_ = value;
+inline void TrainControlResponse_CurrentAddress::_internal_set_address(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.address_ = value;
+}
+inline void TrainControlResponse_CurrentAddress::set_address(int32_t value) {
+  _internal_set_address(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.CurrentAddress.address)
 }
 
@@ -6951,33 +12068,50 @@ inline void TrainControlResponse_CurrentAddress::set_address(::google::protobuf:
 // TrainControlResponse_RawCanPacket
 
 // repeated int32 data = 24;
+inline int TrainControlResponse_RawCanPacket::_internal_data_size() const {
+  return _impl_.data_.size();
+}
 inline int TrainControlResponse_RawCanPacket::data_size() const {
-  return data_.size();
+  return _internal_data_size();
 }
 inline void TrainControlResponse_RawCanPacket::clear_data() {
-  data_.Clear();
+  _impl_.data_.Clear();
 }
-inline ::google::protobuf::int32 TrainControlResponse_RawCanPacket::data(int index) const {
+inline int32_t TrainControlResponse_RawCanPacket::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
+}
+inline int32_t TrainControlResponse_RawCanPacket::data(int index) const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.RawCanPacket.data)
-  return data_.Get(index);
+  return _internal_data(index);
 }
-inline void TrainControlResponse_RawCanPacket::set_data(int index, ::google::protobuf::int32 value) {
-  data_.Set(index, value);
+inline void TrainControlResponse_RawCanPacket::set_data(int index, int32_t value) {
+  _impl_.data_.Set(index, value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.RawCanPacket.data)
 }
-inline void TrainControlResponse_RawCanPacket::add_data(::google::protobuf::int32 value) {
-  data_.Add(value);
+inline void TrainControlResponse_RawCanPacket::_internal_add_data(int32_t value) {
+  _impl_.data_.Add(value);
+}
+inline void TrainControlResponse_RawCanPacket::add_data(int32_t value) {
+  _internal_add_data(value);
   // @@protoc_insertion_point(field_add:server.TrainControlResponse.RawCanPacket.data)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TrainControlResponse_RawCanPacket::_internal_data() const {
+  return _impl_.data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
 TrainControlResponse_RawCanPacket::data() const {
   // @@protoc_insertion_point(field_list:server.TrainControlResponse.RawCanPacket.data)
-  return data_;
+  return _internal_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TrainControlResponse_RawCanPacket::_internal_mutable_data() {
+  return &_impl_.data_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
 TrainControlResponse_RawCanPacket::mutable_data() {
   // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.RawCanPacket.data)
-  return &data_;
+  return _internal_mutable_data();
 }
 
 // -------------------------------------------------------------------
@@ -6985,56 +12119,70 @@ TrainControlResponse_RawCanPacket::mutable_data() {
 // TrainControlResponse_ReflashAutomata
 
 // optional string error = 26;
-inline bool TrainControlResponse_ReflashAutomata::has_error() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlResponse_ReflashAutomata::set_has_error() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlResponse_ReflashAutomata::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_ReflashAutomata::clear_has_error() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_ReflashAutomata::has_error() const {
+  return _internal_has_error();
 }
 inline void TrainControlResponse_ReflashAutomata::clear_error() {
-  error_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_error();
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::std::string& TrainControlResponse_ReflashAutomata::error() const {
+inline const std::string& TrainControlResponse_ReflashAutomata::error() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.ReflashAutomata.error)
-  return error_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_error();
 }
-inline void TrainControlResponse_ReflashAutomata::set_error(const ::std::string& value) {
-  set_has_error();
-  error_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TrainControlResponse_ReflashAutomata::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.ReflashAutomata.error)
 }
-inline void TrainControlResponse_ReflashAutomata::set_error(const char* value) {
-  set_has_error();
-  error_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:server.TrainControlResponse.ReflashAutomata.error)
+inline std::string* TrainControlResponse_ReflashAutomata::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.ReflashAutomata.error)
+  return _s;
+}
+inline const std::string& TrainControlResponse_ReflashAutomata::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void TrainControlResponse_ReflashAutomata::set_error(const char* value, size_t size) {
-  set_has_error();
-  error_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:server.TrainControlResponse.ReflashAutomata.error)
+inline void TrainControlResponse_ReflashAutomata::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* TrainControlResponse_ReflashAutomata::mutable_error() {
-  set_has_error();
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.ReflashAutomata.error)
-  return error_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* TrainControlResponse_ReflashAutomata::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* TrainControlResponse_ReflashAutomata::release_error() {
+inline std::string* TrainControlResponse_ReflashAutomata::release_error() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.ReflashAutomata.error)
-  clear_has_error();
-  return error_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void TrainControlResponse_ReflashAutomata::set_allocated_error(::std::string* error) {
-  if (error != NULL) {
-    set_has_error();
+inline void TrainControlResponse_ReflashAutomata::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_error();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  error_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error);
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.ReflashAutomata.error)
 }
 
@@ -7043,50 +12191,58 @@ inline void TrainControlResponse_ReflashAutomata::set_allocated_error(::std::str
 // TrainControlResponse_LokDb_Lok_Function
 
 // required int32 id = 34;
-inline bool TrainControlResponse_LokDb_Lok_Function::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlResponse_LokDb_Lok_Function::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_LokDb_Lok_Function::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlResponse_LokDb_Lok_Function::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_LokDb_Lok_Function::has_id() const {
+  return _internal_has_id();
 }
 inline void TrainControlResponse_LokDb_Lok_Function::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline ::google::protobuf::int32 TrainControlResponse_LokDb_Lok_Function::id() const {
+inline int32_t TrainControlResponse_LokDb_Lok_Function::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t TrainControlResponse_LokDb_Lok_Function::id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.LokDb.Lok.Function.id)
-  return id_;
+  return _internal_id();
+}
+inline void TrainControlResponse_LokDb_Lok_Function::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.id_ = value;
 }
-inline void TrainControlResponse_LokDb_Lok_Function::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void TrainControlResponse_LokDb_Lok_Function::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.LokDb.Lok.Function.id)
 }
 
 // optional int32 type = 35;
-inline bool TrainControlResponse_LokDb_Lok_Function::has_type() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void TrainControlResponse_LokDb_Lok_Function::set_has_type() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool TrainControlResponse_LokDb_Lok_Function::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlResponse_LokDb_Lok_Function::clear_has_type() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlResponse_LokDb_Lok_Function::has_type() const {
+  return _internal_has_type();
 }
 inline void TrainControlResponse_LokDb_Lok_Function::clear_type() {
-  type_ = 0;
-  clear_has_type();
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t TrainControlResponse_LokDb_Lok_Function::_internal_type() const {
+  return _impl_.type_;
 }
-inline ::google::protobuf::int32 TrainControlResponse_LokDb_Lok_Function::type() const {
+inline int32_t TrainControlResponse_LokDb_Lok_Function::type() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.LokDb.Lok.Function.type)
-  return type_;
+  return _internal_type();
 }
-inline void TrainControlResponse_LokDb_Lok_Function::set_type(::google::protobuf::int32 value) {
-  set_has_type();
-  type_ = value;
+inline void TrainControlResponse_LokDb_Lok_Function::_internal_set_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void TrainControlResponse_LokDb_Lok_Function::set_type(int32_t value) {
+  _internal_set_type(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.LokDb.Lok.Function.type)
 }
 
@@ -7095,135 +12251,167 @@ inline void TrainControlResponse_LokDb_Lok_Function::set_type(::google::protobuf
 // TrainControlResponse_LokDb_Lok
 
 // required int32 id = 30;
-inline bool TrainControlResponse_LokDb_Lok::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlResponse_LokDb_Lok::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlResponse_LokDb_Lok::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlResponse_LokDb_Lok::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_LokDb_Lok::has_id() const {
+  return _internal_has_id();
 }
 inline void TrainControlResponse_LokDb_Lok::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::int32 TrainControlResponse_LokDb_Lok::id() const {
+inline int32_t TrainControlResponse_LokDb_Lok::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t TrainControlResponse_LokDb_Lok::id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.LokDb.Lok.id)
-  return id_;
+  return _internal_id();
+}
+inline void TrainControlResponse_LokDb_Lok::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
 }
-inline void TrainControlResponse_LokDb_Lok::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void TrainControlResponse_LokDb_Lok::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.LokDb.Lok.id)
 }
 
 // optional string name = 31;
-inline bool TrainControlResponse_LokDb_Lok::has_name() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void TrainControlResponse_LokDb_Lok::set_has_name() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool TrainControlResponse_LokDb_Lok::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_LokDb_Lok::clear_has_name() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlResponse_LokDb_Lok::has_name() const {
+  return _internal_has_name();
 }
 inline void TrainControlResponse_LokDb_Lok::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_name();
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::std::string& TrainControlResponse_LokDb_Lok::name() const {
+inline const std::string& TrainControlResponse_LokDb_Lok::name() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.LokDb.Lok.name)
-  return name_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_name();
 }
-inline void TrainControlResponse_LokDb_Lok::set_name(const ::std::string& value) {
-  set_has_name();
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TrainControlResponse_LokDb_Lok::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.LokDb.Lok.name)
 }
-inline void TrainControlResponse_LokDb_Lok::set_name(const char* value) {
-  set_has_name();
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:server.TrainControlResponse.LokDb.Lok.name)
+inline std::string* TrainControlResponse_LokDb_Lok::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.LokDb.Lok.name)
+  return _s;
+}
+inline const std::string& TrainControlResponse_LokDb_Lok::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void TrainControlResponse_LokDb_Lok::set_name(const char* value, size_t size) {
-  set_has_name();
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:server.TrainControlResponse.LokDb.Lok.name)
+inline void TrainControlResponse_LokDb_Lok::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* TrainControlResponse_LokDb_Lok::mutable_name() {
-  set_has_name();
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.LokDb.Lok.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline std::string* TrainControlResponse_LokDb_Lok::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* TrainControlResponse_LokDb_Lok::release_name() {
+inline std::string* TrainControlResponse_LokDb_Lok::release_name() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.LokDb.Lok.name)
-  clear_has_name();
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void TrainControlResponse_LokDb_Lok::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
-    set_has_name();
+inline void TrainControlResponse_LokDb_Lok::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_name();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.LokDb.Lok.name)
 }
 
 // optional int32 address = 32;
-inline bool TrainControlResponse_LokDb_Lok::has_address() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool TrainControlResponse_LokDb_Lok::_internal_has_address() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TrainControlResponse_LokDb_Lok::set_has_address() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void TrainControlResponse_LokDb_Lok::clear_has_address() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlResponse_LokDb_Lok::has_address() const {
+  return _internal_has_address();
 }
 inline void TrainControlResponse_LokDb_Lok::clear_address() {
-  address_ = 0;
-  clear_has_address();
+  _impl_.address_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::google::protobuf::int32 TrainControlResponse_LokDb_Lok::address() const {
+inline int32_t TrainControlResponse_LokDb_Lok::_internal_address() const {
+  return _impl_.address_;
+}
+inline int32_t TrainControlResponse_LokDb_Lok::address() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.LokDb.Lok.address)
-  return address_;
+  return _internal_address();
+}
+inline void TrainControlResponse_LokDb_Lok::_internal_set_address(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.address_ = value;
 }
-inline void TrainControlResponse_LokDb_Lok::set_address(::google::protobuf::int32 value) {
-  set_has_address();
-  address_ = value;
+inline void TrainControlResponse_LokDb_Lok::set_address(int32_t value) {
+  _internal_set_address(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.LokDb.Lok.address)
 }
 
 // repeated group Function = 33 { ... };
+inline int TrainControlResponse_LokDb_Lok::_internal_function_size() const {
+  return _impl_.function_.size();
+}
 inline int TrainControlResponse_LokDb_Lok::function_size() const {
-  return function_.size();
+  return _internal_function_size();
 }
 inline void TrainControlResponse_LokDb_Lok::clear_function() {
-  function_.Clear();
+  _impl_.function_.Clear();
+}
+inline ::server::TrainControlResponse_LokDb_Lok_Function* TrainControlResponse_LokDb_Lok::mutable_function(int index) {
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.LokDb.Lok.function)
+  return _impl_.function_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok_Function >*
+TrainControlResponse_LokDb_Lok::mutable_function() {
+  // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.LokDb.Lok.function)
+  return &_impl_.function_;
+}
+inline const ::server::TrainControlResponse_LokDb_Lok_Function& TrainControlResponse_LokDb_Lok::_internal_function(int index) const {
+  return _impl_.function_.Get(index);
 }
 inline const ::server::TrainControlResponse_LokDb_Lok_Function& TrainControlResponse_LokDb_Lok::function(int index) const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.LokDb.Lok.function)
-  return function_.Get(index);
+  return _internal_function(index);
 }
-inline ::server::TrainControlResponse_LokDb_Lok_Function* TrainControlResponse_LokDb_Lok::mutable_function(int index) {
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.LokDb.Lok.function)
-  return function_.Mutable(index);
+inline ::server::TrainControlResponse_LokDb_Lok_Function* TrainControlResponse_LokDb_Lok::_internal_add_function() {
+  return _impl_.function_.Add();
 }
 inline ::server::TrainControlResponse_LokDb_Lok_Function* TrainControlResponse_LokDb_Lok::add_function() {
+  ::server::TrainControlResponse_LokDb_Lok_Function* _add = _internal_add_function();
   // @@protoc_insertion_point(field_add:server.TrainControlResponse.LokDb.Lok.function)
-  return function_.Add();
+  return _add;
 }
-inline ::google::protobuf::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok_Function >*
-TrainControlResponse_LokDb_Lok::mutable_function() {
-  // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.LokDb.Lok.function)
-  return &function_;
-}
-inline const ::google::protobuf::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok_Function >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok_Function >&
 TrainControlResponse_LokDb_Lok::function() const {
   // @@protoc_insertion_point(field_list:server.TrainControlResponse.LokDb.Lok.function)
-  return function_;
+  return _impl_.function_;
 }
 
 // -------------------------------------------------------------------
@@ -7231,33 +12419,43 @@ TrainControlResponse_LokDb_Lok::function() const {
 // TrainControlResponse_LokDb
 
 // repeated group Lok = 29 { ... };
+inline int TrainControlResponse_LokDb::_internal_lok_size() const {
+  return _impl_.lok_.size();
+}
 inline int TrainControlResponse_LokDb::lok_size() const {
-  return lok_.size();
+  return _internal_lok_size();
 }
 inline void TrainControlResponse_LokDb::clear_lok() {
-  lok_.Clear();
+  _impl_.lok_.Clear();
+}
+inline ::server::TrainControlResponse_LokDb_Lok* TrainControlResponse_LokDb::mutable_lok(int index) {
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.LokDb.lok)
+  return _impl_.lok_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok >*
+TrainControlResponse_LokDb::mutable_lok() {
+  // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.LokDb.lok)
+  return &_impl_.lok_;
+}
+inline const ::server::TrainControlResponse_LokDb_Lok& TrainControlResponse_LokDb::_internal_lok(int index) const {
+  return _impl_.lok_.Get(index);
 }
 inline const ::server::TrainControlResponse_LokDb_Lok& TrainControlResponse_LokDb::lok(int index) const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.LokDb.lok)
-  return lok_.Get(index);
+  return _internal_lok(index);
 }
-inline ::server::TrainControlResponse_LokDb_Lok* TrainControlResponse_LokDb::mutable_lok(int index) {
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.LokDb.lok)
-  return lok_.Mutable(index);
+inline ::server::TrainControlResponse_LokDb_Lok* TrainControlResponse_LokDb::_internal_add_lok() {
+  return _impl_.lok_.Add();
 }
 inline ::server::TrainControlResponse_LokDb_Lok* TrainControlResponse_LokDb::add_lok() {
+  ::server::TrainControlResponse_LokDb_Lok* _add = _internal_add_lok();
   // @@protoc_insertion_point(field_add:server.TrainControlResponse.LokDb.lok)
-  return lok_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok >*
-TrainControlResponse_LokDb::mutable_lok() {
-  // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.LokDb.lok)
-  return &lok_;
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_LokDb_Lok >&
 TrainControlResponse_LokDb::lok() const {
   // @@protoc_insertion_point(field_list:server.TrainControlResponse.LokDb.lok)
-  return lok_;
+  return _impl_.lok_;
 }
 
 // -------------------------------------------------------------------
@@ -7265,129 +12463,162 @@ TrainControlResponse_LokDb::lok() const {
 // TrainControlResponse_PicMisc
 
 // required int32 cmd = 38;
-inline bool TrainControlResponse_PicMisc::has_cmd() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlResponse_PicMisc::set_has_cmd() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlResponse_PicMisc::_internal_has_cmd() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_PicMisc::clear_has_cmd() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_PicMisc::has_cmd() const {
+  return _internal_has_cmd();
 }
 inline void TrainControlResponse_PicMisc::clear_cmd() {
-  cmd_ = 0;
-  clear_has_cmd();
+  _impl_.cmd_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlResponse_PicMisc::_internal_cmd() const {
+  return _impl_.cmd_;
 }
-inline ::google::protobuf::int32 TrainControlResponse_PicMisc::cmd() const {
+inline int32_t TrainControlResponse_PicMisc::cmd() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.PicMisc.cmd)
-  return cmd_;
+  return _internal_cmd();
 }
-inline void TrainControlResponse_PicMisc::set_cmd(::google::protobuf::int32 value) {
-  set_has_cmd();
-  cmd_ = value;
+inline void TrainControlResponse_PicMisc::_internal_set_cmd(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.cmd_ = value;
+}
+inline void TrainControlResponse_PicMisc::set_cmd(int32_t value) {
+  _internal_set_cmd(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.PicMisc.cmd)
 }
 
 // required int32 status = 39;
-inline bool TrainControlResponse_PicMisc::has_status() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TrainControlResponse_PicMisc::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlResponse_PicMisc::set_has_status() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TrainControlResponse_PicMisc::clear_has_status() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlResponse_PicMisc::has_status() const {
+  return _internal_has_status();
 }
 inline void TrainControlResponse_PicMisc::clear_status() {
-  status_ = 0;
-  clear_has_status();
+  _impl_.status_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::int32 TrainControlResponse_PicMisc::status() const {
+inline int32_t TrainControlResponse_PicMisc::_internal_status() const {
+  return _impl_.status_;
+}
+inline int32_t TrainControlResponse_PicMisc::status() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.PicMisc.status)
-  return status_;
+  return _internal_status();
+}
+inline void TrainControlResponse_PicMisc::_internal_set_status(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.status_ = value;
 }
-inline void TrainControlResponse_PicMisc::set_status(::google::protobuf::int32 value) {
-  set_has_status();
-  status_ = value;
+inline void TrainControlResponse_PicMisc::set_status(int32_t value) {
+  _internal_set_status(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.PicMisc.status)
 }
 
 // required int32 arg1 = 40;
-inline bool TrainControlResponse_PicMisc::has_arg1() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TrainControlResponse_PicMisc::set_has_arg1() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool TrainControlResponse_PicMisc::_internal_has_arg1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TrainControlResponse_PicMisc::clear_has_arg1() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlResponse_PicMisc::has_arg1() const {
+  return _internal_has_arg1();
 }
 inline void TrainControlResponse_PicMisc::clear_arg1() {
-  arg1_ = 0;
-  clear_has_arg1();
+  _impl_.arg1_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t TrainControlResponse_PicMisc::_internal_arg1() const {
+  return _impl_.arg1_;
 }
-inline ::google::protobuf::int32 TrainControlResponse_PicMisc::arg1() const {
+inline int32_t TrainControlResponse_PicMisc::arg1() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.PicMisc.arg1)
-  return arg1_;
+  return _internal_arg1();
 }
-inline void TrainControlResponse_PicMisc::set_arg1(::google::protobuf::int32 value) {
-  set_has_arg1();
-  arg1_ = value;
+inline void TrainControlResponse_PicMisc::_internal_set_arg1(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.arg1_ = value;
+}
+inline void TrainControlResponse_PicMisc::set_arg1(int32_t value) {
+  _internal_set_arg1(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.PicMisc.arg1)
 }
 
 // required int32 arg2 = 41;
-inline bool TrainControlResponse_PicMisc::has_arg2() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool TrainControlResponse_PicMisc::_internal_has_arg2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void TrainControlResponse_PicMisc::set_has_arg2() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void TrainControlResponse_PicMisc::clear_has_arg2() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool TrainControlResponse_PicMisc::has_arg2() const {
+  return _internal_has_arg2();
 }
 inline void TrainControlResponse_PicMisc::clear_arg2() {
-  arg2_ = 0;
-  clear_has_arg2();
+  _impl_.arg2_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::google::protobuf::int32 TrainControlResponse_PicMisc::arg2() const {
+inline int32_t TrainControlResponse_PicMisc::_internal_arg2() const {
+  return _impl_.arg2_;
+}
+inline int32_t TrainControlResponse_PicMisc::arg2() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.PicMisc.arg2)
-  return arg2_;
+  return _internal_arg2();
+}
+inline void TrainControlResponse_PicMisc::_internal_set_arg2(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.arg2_ = value;
 }
-inline void TrainControlResponse_PicMisc::set_arg2(::google::protobuf::int32 value) {
-  set_has_arg2();
-  arg2_ = value;
+inline void TrainControlResponse_PicMisc::set_arg2(int32_t value) {
+  _internal_set_arg2(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.PicMisc.arg2)
 }
 
 // repeated int32 more_arg = 42;
+inline int TrainControlResponse_PicMisc::_internal_more_arg_size() const {
+  return _impl_.more_arg_.size();
+}
 inline int TrainControlResponse_PicMisc::more_arg_size() const {
-  return more_arg_.size();
+  return _internal_more_arg_size();
 }
 inline void TrainControlResponse_PicMisc::clear_more_arg() {
-  more_arg_.Clear();
+  _impl_.more_arg_.Clear();
+}
+inline int32_t TrainControlResponse_PicMisc::_internal_more_arg(int index) const {
+  return _impl_.more_arg_.Get(index);
 }
-inline ::google::protobuf::int32 TrainControlResponse_PicMisc::more_arg(int index) const {
+inline int32_t TrainControlResponse_PicMisc::more_arg(int index) const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.PicMisc.more_arg)
-  return more_arg_.Get(index);
+  return _internal_more_arg(index);
 }
-inline void TrainControlResponse_PicMisc::set_more_arg(int index, ::google::protobuf::int32 value) {
-  more_arg_.Set(index, value);
+inline void TrainControlResponse_PicMisc::set_more_arg(int index, int32_t value) {
+  _impl_.more_arg_.Set(index, value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.PicMisc.more_arg)
 }
-inline void TrainControlResponse_PicMisc::add_more_arg(::google::protobuf::int32 value) {
-  more_arg_.Add(value);
+inline void TrainControlResponse_PicMisc::_internal_add_more_arg(int32_t value) {
+  _impl_.more_arg_.Add(value);
+}
+inline void TrainControlResponse_PicMisc::add_more_arg(int32_t value) {
+  _internal_add_more_arg(value);
   // @@protoc_insertion_point(field_add:server.TrainControlResponse.PicMisc.more_arg)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TrainControlResponse_PicMisc::_internal_more_arg() const {
+  return _impl_.more_arg_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
 TrainControlResponse_PicMisc::more_arg() const {
   // @@protoc_insertion_point(field_list:server.TrainControlResponse.PicMisc.more_arg)
-  return more_arg_;
+  return _internal_more_arg();
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TrainControlResponse_PicMisc::_internal_mutable_more_arg() {
+  return &_impl_.more_arg_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
 TrainControlResponse_PicMisc::mutable_more_arg() {
   // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.PicMisc.more_arg)
-  return &more_arg_;
+  return _internal_mutable_more_arg();
 }
 
 // -------------------------------------------------------------------
@@ -7395,56 +12626,70 @@ TrainControlResponse_PicMisc::mutable_more_arg() {
 // TrainControlResponse_ReflashPic
 
 // optional string error = 44;
-inline bool TrainControlResponse_ReflashPic::has_error() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlResponse_ReflashPic::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_ReflashPic::set_has_error() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlResponse_ReflashPic::clear_has_error() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_ReflashPic::has_error() const {
+  return _internal_has_error();
 }
 inline void TrainControlResponse_ReflashPic::clear_error() {
-  error_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_error();
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::std::string& TrainControlResponse_ReflashPic::error() const {
+inline const std::string& TrainControlResponse_ReflashPic::error() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.ReflashPic.error)
-  return error_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_error();
 }
-inline void TrainControlResponse_ReflashPic::set_error(const ::std::string& value) {
-  set_has_error();
-  error_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TrainControlResponse_ReflashPic::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.ReflashPic.error)
 }
-inline void TrainControlResponse_ReflashPic::set_error(const char* value) {
-  set_has_error();
-  error_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:server.TrainControlResponse.ReflashPic.error)
+inline std::string* TrainControlResponse_ReflashPic::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.ReflashPic.error)
+  return _s;
 }
-inline void TrainControlResponse_ReflashPic::set_error(const char* value, size_t size) {
-  set_has_error();
-  error_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:server.TrainControlResponse.ReflashPic.error)
+inline const std::string& TrainControlResponse_ReflashPic::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline ::std::string* TrainControlResponse_ReflashPic::mutable_error() {
-  set_has_error();
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.ReflashPic.error)
-  return error_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void TrainControlResponse_ReflashPic::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* TrainControlResponse_ReflashPic::release_error() {
+inline std::string* TrainControlResponse_ReflashPic::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TrainControlResponse_ReflashPic::release_error() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.ReflashPic.error)
-  clear_has_error();
-  return error_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void TrainControlResponse_ReflashPic::set_allocated_error(::std::string* error) {
-  if (error != NULL) {
-    set_has_error();
+inline void TrainControlResponse_ReflashPic::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_error();
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
-  error_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.ReflashPic.error)
 }
 
@@ -7453,98 +12698,114 @@ inline void TrainControlResponse_ReflashPic::set_allocated_error(::std::string*
 // TrainControlResponse_Cv
 
 // required int32 train_id = 46;
-inline bool TrainControlResponse_Cv::has_train_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlResponse_Cv::set_has_train_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlResponse_Cv::_internal_has_train_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Cv::clear_has_train_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_Cv::has_train_id() const {
+  return _internal_has_train_id();
 }
 inline void TrainControlResponse_Cv::clear_train_id() {
-  train_id_ = 0;
-  clear_has_train_id();
+  _impl_.train_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t TrainControlResponse_Cv::_internal_train_id() const {
+  return _impl_.train_id_;
 }
-inline ::google::protobuf::int32 TrainControlResponse_Cv::train_id() const {
+inline int32_t TrainControlResponse_Cv::train_id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Cv.train_id)
-  return train_id_;
+  return _internal_train_id();
 }
-inline void TrainControlResponse_Cv::set_train_id(::google::protobuf::int32 value) {
-  set_has_train_id();
-  train_id_ = value;
+inline void TrainControlResponse_Cv::_internal_set_train_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.train_id_ = value;
+}
+inline void TrainControlResponse_Cv::set_train_id(int32_t value) {
+  _internal_set_train_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Cv.train_id)
 }
 
 // required int32 cv = 47;
-inline bool TrainControlResponse_Cv::has_cv() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TrainControlResponse_Cv::_internal_has_cv() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Cv::set_has_cv() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TrainControlResponse_Cv::clear_has_cv() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlResponse_Cv::has_cv() const {
+  return _internal_has_cv();
 }
 inline void TrainControlResponse_Cv::clear_cv() {
-  cv_ = 0;
-  clear_has_cv();
+  _impl_.cv_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::int32 TrainControlResponse_Cv::cv() const {
+inline int32_t TrainControlResponse_Cv::_internal_cv() const {
+  return _impl_.cv_;
+}
+inline int32_t TrainControlResponse_Cv::cv() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Cv.cv)
-  return cv_;
+  return _internal_cv();
+}
+inline void TrainControlResponse_Cv::_internal_set_cv(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.cv_ = value;
 }
-inline void TrainControlResponse_Cv::set_cv(::google::protobuf::int32 value) {
-  set_has_cv();
-  cv_ = value;
+inline void TrainControlResponse_Cv::set_cv(int32_t value) {
+  _internal_set_cv(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Cv.cv)
 }
 
 // optional int32 error_code = 48;
-inline bool TrainControlResponse_Cv::has_error_code() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TrainControlResponse_Cv::set_has_error_code() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool TrainControlResponse_Cv::_internal_has_error_code() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Cv::clear_has_error_code() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlResponse_Cv::has_error_code() const {
+  return _internal_has_error_code();
 }
 inline void TrainControlResponse_Cv::clear_error_code() {
-  error_code_ = 0;
-  clear_has_error_code();
+  _impl_.error_code_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t TrainControlResponse_Cv::_internal_error_code() const {
+  return _impl_.error_code_;
 }
-inline ::google::protobuf::int32 TrainControlResponse_Cv::error_code() const {
+inline int32_t TrainControlResponse_Cv::error_code() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Cv.error_code)
-  return error_code_;
+  return _internal_error_code();
 }
-inline void TrainControlResponse_Cv::set_error_code(::google::protobuf::int32 value) {
-  set_has_error_code();
-  error_code_ = value;
+inline void TrainControlResponse_Cv::_internal_set_error_code(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.error_code_ = value;
+}
+inline void TrainControlResponse_Cv::set_error_code(int32_t value) {
+  _internal_set_error_code(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Cv.error_code)
 }
 
 // optional int32 value = 49;
-inline bool TrainControlResponse_Cv::has_value() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool TrainControlResponse_Cv::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void TrainControlResponse_Cv::set_has_value() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void TrainControlResponse_Cv::clear_has_value() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool TrainControlResponse_Cv::has_value() const {
+  return _internal_has_value();
 }
 inline void TrainControlResponse_Cv::clear_value() {
-  value_ = 0;
-  clear_has_value();
+  _impl_.value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::google::protobuf::int32 TrainControlResponse_Cv::value() const {
+inline int32_t TrainControlResponse_Cv::_internal_value() const {
+  return _impl_.value_;
+}
+inline int32_t TrainControlResponse_Cv::value() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.Cv.value)
-  return value_;
+  return _internal_value();
+}
+inline void TrainControlResponse_Cv::_internal_set_value(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.value_ = value;
 }
-inline void TrainControlResponse_Cv::set_value(::google::protobuf::int32 value) {
-  set_has_value();
-  value_ = value;
+inline void TrainControlResponse_Cv::set_value(int32_t value) {
+  _internal_set_value(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.Cv.value)
 }
 
@@ -7553,728 +12814,1843 @@ inline void TrainControlResponse_Cv::set_value(::google::protobuf::int32 value)
 // TrainControlResponse_WaitForChangeResponse
 
 // required uint64 timestamp = 53;
-inline bool TrainControlResponse_WaitForChangeResponse::has_timestamp() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TrainControlResponse_WaitForChangeResponse::set_has_timestamp() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TrainControlResponse_WaitForChangeResponse::_internal_has_timestamp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TrainControlResponse_WaitForChangeResponse::clear_has_timestamp() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse_WaitForChangeResponse::has_timestamp() const {
+  return _internal_has_timestamp();
 }
 inline void TrainControlResponse_WaitForChangeResponse::clear_timestamp() {
-  timestamp_ = GOOGLE_ULONGLONG(0);
-  clear_has_timestamp();
+  _impl_.timestamp_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t TrainControlResponse_WaitForChangeResponse::_internal_timestamp() const {
+  return _impl_.timestamp_;
 }
-inline ::google::protobuf::uint64 TrainControlResponse_WaitForChangeResponse::timestamp() const {
+inline uint64_t TrainControlResponse_WaitForChangeResponse::timestamp() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.WaitForChangeResponse.timestamp)
-  return timestamp_;
+  return _internal_timestamp();
 }
-inline void TrainControlResponse_WaitForChangeResponse::set_timestamp(::google::protobuf::uint64 value) {
-  set_has_timestamp();
-  timestamp_ = value;
+inline void TrainControlResponse_WaitForChangeResponse::_internal_set_timestamp(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.timestamp_ = value;
+}
+inline void TrainControlResponse_WaitForChangeResponse::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.WaitForChangeResponse.timestamp)
 }
 
 // optional int32 id = 54;
-inline bool TrainControlResponse_WaitForChangeResponse::has_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TrainControlResponse_WaitForChangeResponse::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TrainControlResponse_WaitForChangeResponse::set_has_id() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TrainControlResponse_WaitForChangeResponse::clear_has_id() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlResponse_WaitForChangeResponse::has_id() const {
+  return _internal_has_id();
 }
 inline void TrainControlResponse_WaitForChangeResponse::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::google::protobuf::int32 TrainControlResponse_WaitForChangeResponse::id() const {
+inline int32_t TrainControlResponse_WaitForChangeResponse::_internal_id() const {
+  return _impl_.id_;
+}
+inline int32_t TrainControlResponse_WaitForChangeResponse::id() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.WaitForChangeResponse.id)
-  return id_;
+  return _internal_id();
+}
+inline void TrainControlResponse_WaitForChangeResponse::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
 }
-inline void TrainControlResponse_WaitForChangeResponse::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void TrainControlResponse_WaitForChangeResponse::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.TrainControlResponse.WaitForChangeResponse.id)
 }
 
 // -------------------------------------------------------------------
 
+// TrainControlResponse_RpcStats_Method
+
+// required string name = 57;
+inline bool TrainControlResponse_RpcStats_Method::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_RpcStats_Method::has_name() const {
+  return _internal_has_name();
+}
+inline void TrainControlResponse_RpcStats_Method::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TrainControlResponse_RpcStats_Method::name() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcStats.Method.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TrainControlResponse_RpcStats_Method::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.RpcStats.Method.name)
+}
+inline std::string* TrainControlResponse_RpcStats_Method::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.RpcStats.Method.name)
+  return _s;
+}
+inline const std::string& TrainControlResponse_RpcStats_Method::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void TrainControlResponse_RpcStats_Method::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TrainControlResponse_RpcStats_Method::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TrainControlResponse_RpcStats_Method::release_name() {
+  // @@protoc_insertion_point(field_release:server.TrainControlResponse.RpcStats.Method.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TrainControlResponse_RpcStats_Method::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.RpcStats.Method.name)
+}
+
+// optional uint32 count = 58;
+inline bool TrainControlResponse_RpcStats_Method::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_RpcStats_Method::has_count() const {
+  return _internal_has_count();
+}
+inline void TrainControlResponse_RpcStats_Method::clear_count() {
+  _impl_.count_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t TrainControlResponse_RpcStats_Method::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint32_t TrainControlResponse_RpcStats_Method::count() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcStats.Method.count)
+  return _internal_count();
+}
+inline void TrainControlResponse_RpcStats_Method::_internal_set_count(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.count_ = value;
+}
+inline void TrainControlResponse_RpcStats_Method::set_count(uint32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.RpcStats.Method.count)
+}
+
+// optional uint32 errors = 59;
+inline bool TrainControlResponse_RpcStats_Method::_internal_has_errors() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_RpcStats_Method::has_errors() const {
+  return _internal_has_errors();
+}
+inline void TrainControlResponse_RpcStats_Method::clear_errors() {
+  _impl_.errors_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t TrainControlResponse_RpcStats_Method::_internal_errors() const {
+  return _impl_.errors_;
+}
+inline uint32_t TrainControlResponse_RpcStats_Method::errors() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcStats.Method.errors)
+  return _internal_errors();
+}
+inline void TrainControlResponse_RpcStats_Method::_internal_set_errors(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.errors_ = value;
+}
+inline void TrainControlResponse_RpcStats_Method::set_errors(uint32_t value) {
+  _internal_set_errors(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.RpcStats.Method.errors)
+}
+
+// optional uint64 total_usec = 60;
+inline bool TrainControlResponse_RpcStats_Method::_internal_has_total_usec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_RpcStats_Method::has_total_usec() const {
+  return _internal_has_total_usec();
+}
+inline void TrainControlResponse_RpcStats_Method::clear_total_usec() {
+  _impl_.total_usec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t TrainControlResponse_RpcStats_Method::_internal_total_usec() const {
+  return _impl_.total_usec_;
+}
+inline uint64_t TrainControlResponse_RpcStats_Method::total_usec() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcStats.Method.total_usec)
+  return _internal_total_usec();
+}
+inline void TrainControlResponse_RpcStats_Method::_internal_set_total_usec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.total_usec_ = value;
+}
+inline void TrainControlResponse_RpcStats_Method::set_total_usec(uint64_t value) {
+  _internal_set_total_usec(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.RpcStats.Method.total_usec)
+}
+
+// optional uint64 max_usec = 61;
+inline bool TrainControlResponse_RpcStats_Method::_internal_has_max_usec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_RpcStats_Method::has_max_usec() const {
+  return _internal_has_max_usec();
+}
+inline void TrainControlResponse_RpcStats_Method::clear_max_usec() {
+  _impl_.max_usec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t TrainControlResponse_RpcStats_Method::_internal_max_usec() const {
+  return _impl_.max_usec_;
+}
+inline uint64_t TrainControlResponse_RpcStats_Method::max_usec() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcStats.Method.max_usec)
+  return _internal_max_usec();
+}
+inline void TrainControlResponse_RpcStats_Method::_internal_set_max_usec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.max_usec_ = value;
+}
+inline void TrainControlResponse_RpcStats_Method::set_max_usec(uint64_t value) {
+  _internal_set_max_usec(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.RpcStats.Method.max_usec)
+}
+
+// repeated uint32 latency_bucket = 62 [packed = true];
+inline int TrainControlResponse_RpcStats_Method::_internal_latency_bucket_size() const {
+  return _impl_.latency_bucket_.size();
+}
+inline int TrainControlResponse_RpcStats_Method::latency_bucket_size() const {
+  return _internal_latency_bucket_size();
+}
+inline void TrainControlResponse_RpcStats_Method::clear_latency_bucket() {
+  _impl_.latency_bucket_.Clear();
+}
+inline uint32_t TrainControlResponse_RpcStats_Method::_internal_latency_bucket(int index) const {
+  return _impl_.latency_bucket_.Get(index);
+}
+inline uint32_t TrainControlResponse_RpcStats_Method::latency_bucket(int index) const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcStats.Method.latency_bucket)
+  return _internal_latency_bucket(index);
+}
+inline void TrainControlResponse_RpcStats_Method::set_latency_bucket(int index, uint32_t value) {
+  _impl_.latency_bucket_.Set(index, value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.RpcStats.Method.latency_bucket)
+}
+inline void TrainControlResponse_RpcStats_Method::_internal_add_latency_bucket(uint32_t value) {
+  _impl_.latency_bucket_.Add(value);
+}
+inline void TrainControlResponse_RpcStats_Method::add_latency_bucket(uint32_t value) {
+  _internal_add_latency_bucket(value);
+  // @@protoc_insertion_point(field_add:server.TrainControlResponse.RpcStats.Method.latency_bucket)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+TrainControlResponse_RpcStats_Method::_internal_latency_bucket() const {
+  return _impl_.latency_bucket_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+TrainControlResponse_RpcStats_Method::latency_bucket() const {
+  // @@protoc_insertion_point(field_list:server.TrainControlResponse.RpcStats.Method.latency_bucket)
+  return _internal_latency_bucket();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+TrainControlResponse_RpcStats_Method::_internal_mutable_latency_bucket() {
+  return &_impl_.latency_bucket_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+TrainControlResponse_RpcStats_Method::mutable_latency_bucket() {
+  // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.RpcStats.Method.latency_bucket)
+  return _internal_mutable_latency_bucket();
+}
+
+// -------------------------------------------------------------------
+
+// TrainControlResponse_RpcStats
+
+// repeated group Method = 56 { ... };
+inline int TrainControlResponse_RpcStats::_internal_method_size() const {
+  return _impl_.method_.size();
+}
+inline int TrainControlResponse_RpcStats::method_size() const {
+  return _internal_method_size();
+}
+inline void TrainControlResponse_RpcStats::clear_method() {
+  _impl_.method_.Clear();
+}
+inline ::server::TrainControlResponse_RpcStats_Method* TrainControlResponse_RpcStats::mutable_method(int index) {
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.RpcStats.method)
+  return _impl_.method_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_RpcStats_Method >*
+TrainControlResponse_RpcStats::mutable_method() {
+  // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.RpcStats.method)
+  return &_impl_.method_;
+}
+inline const ::server::TrainControlResponse_RpcStats_Method& TrainControlResponse_RpcStats::_internal_method(int index) const {
+  return _impl_.method_.Get(index);
+}
+inline const ::server::TrainControlResponse_RpcStats_Method& TrainControlResponse_RpcStats::method(int index) const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcStats.method)
+  return _internal_method(index);
+}
+inline ::server::TrainControlResponse_RpcStats_Method* TrainControlResponse_RpcStats::_internal_add_method() {
+  return _impl_.method_.Add();
+}
+inline ::server::TrainControlResponse_RpcStats_Method* TrainControlResponse_RpcStats::add_method() {
+  ::server::TrainControlResponse_RpcStats_Method* _add = _internal_add_method();
+  // @@protoc_insertion_point(field_add:server.TrainControlResponse.RpcStats.method)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_RpcStats_Method >&
+TrainControlResponse_RpcStats::method() const {
+  // @@protoc_insertion_point(field_list:server.TrainControlResponse.RpcStats.method)
+  return _impl_.method_;
+}
+
+// optional uint32 bucket_base_usec = 63;
+inline bool TrainControlResponse_RpcStats::_internal_has_bucket_base_usec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_RpcStats::has_bucket_base_usec() const {
+  return _internal_has_bucket_base_usec();
+}
+inline void TrainControlResponse_RpcStats::clear_bucket_base_usec() {
+  _impl_.bucket_base_usec_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t TrainControlResponse_RpcStats::_internal_bucket_base_usec() const {
+  return _impl_.bucket_base_usec_;
+}
+inline uint32_t TrainControlResponse_RpcStats::bucket_base_usec() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcStats.bucket_base_usec)
+  return _internal_bucket_base_usec();
+}
+inline void TrainControlResponse_RpcStats::_internal_set_bucket_base_usec(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.bucket_base_usec_ = value;
+}
+inline void TrainControlResponse_RpcStats::set_bucket_base_usec(uint32_t value) {
+  _internal_set_bucket_base_usec(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.RpcStats.bucket_base_usec)
+}
+
+// optional uint32 num_logged = 64;
+inline bool TrainControlResponse_RpcStats::_internal_has_num_logged() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_RpcStats::has_num_logged() const {
+  return _internal_has_num_logged();
+}
+inline void TrainControlResponse_RpcStats::clear_num_logged() {
+  _impl_.num_logged_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t TrainControlResponse_RpcStats::_internal_num_logged() const {
+  return _impl_.num_logged_;
+}
+inline uint32_t TrainControlResponse_RpcStats::num_logged() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcStats.num_logged)
+  return _internal_num_logged();
+}
+inline void TrainControlResponse_RpcStats::_internal_set_num_logged(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.num_logged_ = value;
+}
+inline void TrainControlResponse_RpcStats::set_num_logged(uint32_t value) {
+  _internal_set_num_logged(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.RpcStats.num_logged)
+}
+
+// optional uint32 num_calls = 65;
+inline bool TrainControlResponse_RpcStats::_internal_has_num_calls() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_RpcStats::has_num_calls() const {
+  return _internal_has_num_calls();
+}
+inline void TrainControlResponse_RpcStats::clear_num_calls() {
+  _impl_.num_calls_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t TrainControlResponse_RpcStats::_internal_num_calls() const {
+  return _impl_.num_calls_;
+}
+inline uint32_t TrainControlResponse_RpcStats::num_calls() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.RpcStats.num_calls)
+  return _internal_num_calls();
+}
+inline void TrainControlResponse_RpcStats::_internal_set_num_calls(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.num_calls_ = value;
+}
+inline void TrainControlResponse_RpcStats::set_num_calls(uint32_t value) {
+  _internal_set_num_calls(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.RpcStats.num_calls)
+}
+
+// -------------------------------------------------------------------
+
 // TrainControlResponse
 
 // optional group Speed = 1 { ... };
-inline bool TrainControlResponse::has_speed() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool TrainControlResponse::_internal_has_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.speed_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::set_has_speed() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void TrainControlResponse::clear_has_speed() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TrainControlResponse::has_speed() const {
+  return _internal_has_speed();
 }
 inline void TrainControlResponse::clear_speed() {
-  if (speed_ != NULL) speed_->::server::TrainControlResponse_Speed::Clear();
-  clear_has_speed();
+  if (_impl_.speed_ != nullptr) _impl_.speed_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::server::TrainControlResponse_Speed& TrainControlResponse::_internal_speed() const {
+  const ::server::TrainControlResponse_Speed* p = _impl_.speed_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_Speed&>(
+      ::server::_TrainControlResponse_Speed_default_instance_);
 }
 inline const ::server::TrainControlResponse_Speed& TrainControlResponse::speed() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.speed)
-  return speed_ != NULL ? *speed_ : *default_instance_->speed_;
+  return _internal_speed();
 }
-inline ::server::TrainControlResponse_Speed* TrainControlResponse::mutable_speed() {
-  set_has_speed();
-  if (speed_ == NULL) {
-    speed_ = new ::server::TrainControlResponse_Speed;
+inline void TrainControlResponse::unsafe_arena_set_allocated_speed(
+    ::server::TrainControlResponse_Speed* speed) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.speed_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.speed)
-  return speed_;
+  _impl_.speed_ = speed;
+  if (speed) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.speed)
 }
 inline ::server::TrainControlResponse_Speed* TrainControlResponse::release_speed() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::server::TrainControlResponse_Speed* temp = _impl_.speed_;
+  _impl_.speed_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_Speed* TrainControlResponse::unsafe_arena_release_speed() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.speed)
-  clear_has_speed();
-  ::server::TrainControlResponse_Speed* temp = speed_;
-  speed_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::server::TrainControlResponse_Speed* temp = _impl_.speed_;
+  _impl_.speed_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_Speed* TrainControlResponse::_internal_mutable_speed() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.speed_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_Speed>(GetArenaForAllocation());
+    _impl_.speed_ = p;
+  }
+  return _impl_.speed_;
+}
+inline ::server::TrainControlResponse_Speed* TrainControlResponse::mutable_speed() {
+  ::server::TrainControlResponse_Speed* _msg = _internal_mutable_speed();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.speed)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_speed(::server::TrainControlResponse_Speed* speed) {
-  delete speed_;
-  speed_ = speed;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.speed_;
+  }
   if (speed) {
-    set_has_speed();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(speed);
+    if (message_arena != submessage_arena) {
+      speed = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, speed, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_speed();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.speed_ = speed;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.speed)
 }
 
 // optional group Accessory = 4 { ... };
-inline bool TrainControlResponse::has_accessory() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void TrainControlResponse::set_has_accessory() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool TrainControlResponse::_internal_has_accessory() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.accessory_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::clear_has_accessory() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TrainControlResponse::has_accessory() const {
+  return _internal_has_accessory();
 }
 inline void TrainControlResponse::clear_accessory() {
-  if (accessory_ != NULL) accessory_->::server::TrainControlResponse_Accessory::Clear();
-  clear_has_accessory();
+  if (_impl_.accessory_ != nullptr) _impl_.accessory_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::server::TrainControlResponse_Accessory& TrainControlResponse::_internal_accessory() const {
+  const ::server::TrainControlResponse_Accessory* p = _impl_.accessory_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_Accessory&>(
+      ::server::_TrainControlResponse_Accessory_default_instance_);
 }
 inline const ::server::TrainControlResponse_Accessory& TrainControlResponse::accessory() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.accessory)
-  return accessory_ != NULL ? *accessory_ : *default_instance_->accessory_;
+  return _internal_accessory();
 }
-inline ::server::TrainControlResponse_Accessory* TrainControlResponse::mutable_accessory() {
-  set_has_accessory();
-  if (accessory_ == NULL) {
-    accessory_ = new ::server::TrainControlResponse_Accessory;
+inline void TrainControlResponse::unsafe_arena_set_allocated_accessory(
+    ::server::TrainControlResponse_Accessory* accessory) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.accessory_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.accessory)
-  return accessory_;
+  _impl_.accessory_ = accessory;
+  if (accessory) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.accessory)
 }
 inline ::server::TrainControlResponse_Accessory* TrainControlResponse::release_accessory() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::server::TrainControlResponse_Accessory* temp = _impl_.accessory_;
+  _impl_.accessory_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_Accessory* TrainControlResponse::unsafe_arena_release_accessory() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.accessory)
-  clear_has_accessory();
-  ::server::TrainControlResponse_Accessory* temp = accessory_;
-  accessory_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::server::TrainControlResponse_Accessory* temp = _impl_.accessory_;
+  _impl_.accessory_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_Accessory* TrainControlResponse::_internal_mutable_accessory() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.accessory_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_Accessory>(GetArenaForAllocation());
+    _impl_.accessory_ = p;
+  }
+  return _impl_.accessory_;
+}
+inline ::server::TrainControlResponse_Accessory* TrainControlResponse::mutable_accessory() {
+  ::server::TrainControlResponse_Accessory* _msg = _internal_mutable_accessory();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.accessory)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_accessory(::server::TrainControlResponse_Accessory* accessory) {
-  delete accessory_;
-  accessory_ = accessory;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.accessory_;
+  }
   if (accessory) {
-    set_has_accessory();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(accessory);
+    if (message_arena != submessage_arena) {
+      accessory = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, accessory, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_accessory();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.accessory_ = accessory;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.accessory)
 }
 
 // optional group EmergencyStop = 8 { ... };
-inline bool TrainControlResponse::has_emergencystop() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool TrainControlResponse::_internal_has_emergencystop() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.emergencystop_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::set_has_emergencystop() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void TrainControlResponse::clear_has_emergencystop() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TrainControlResponse::has_emergencystop() const {
+  return _internal_has_emergencystop();
 }
 inline void TrainControlResponse::clear_emergencystop() {
-  if (emergencystop_ != NULL) emergencystop_->::server::TrainControlResponse_EmergencyStop::Clear();
-  clear_has_emergencystop();
+  if (_impl_.emergencystop_ != nullptr) _impl_.emergencystop_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::server::TrainControlResponse_EmergencyStop& TrainControlResponse::_internal_emergencystop() const {
+  const ::server::TrainControlResponse_EmergencyStop* p = _impl_.emergencystop_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_EmergencyStop&>(
+      ::server::_TrainControlResponse_EmergencyStop_default_instance_);
 }
 inline const ::server::TrainControlResponse_EmergencyStop& TrainControlResponse::emergencystop() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.emergencystop)
-  return emergencystop_ != NULL ? *emergencystop_ : *default_instance_->emergencystop_;
+  return _internal_emergencystop();
 }
-inline ::server::TrainControlResponse_EmergencyStop* TrainControlResponse::mutable_emergencystop() {
-  set_has_emergencystop();
-  if (emergencystop_ == NULL) {
-    emergencystop_ = new ::server::TrainControlResponse_EmergencyStop;
+inline void TrainControlResponse::unsafe_arena_set_allocated_emergencystop(
+    ::server::TrainControlResponse_EmergencyStop* emergencystop) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.emergencystop_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.emergencystop)
-  return emergencystop_;
+  _impl_.emergencystop_ = emergencystop;
+  if (emergencystop) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.emergencystop)
 }
 inline ::server::TrainControlResponse_EmergencyStop* TrainControlResponse::release_emergencystop() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::server::TrainControlResponse_EmergencyStop* temp = _impl_.emergencystop_;
+  _impl_.emergencystop_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_EmergencyStop* TrainControlResponse::unsafe_arena_release_emergencystop() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.emergencystop)
-  clear_has_emergencystop();
-  ::server::TrainControlResponse_EmergencyStop* temp = emergencystop_;
-  emergencystop_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::server::TrainControlResponse_EmergencyStop* temp = _impl_.emergencystop_;
+  _impl_.emergencystop_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_EmergencyStop* TrainControlResponse::_internal_mutable_emergencystop() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.emergencystop_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_EmergencyStop>(GetArenaForAllocation());
+    _impl_.emergencystop_ = p;
+  }
+  return _impl_.emergencystop_;
+}
+inline ::server::TrainControlResponse_EmergencyStop* TrainControlResponse::mutable_emergencystop() {
+  ::server::TrainControlResponse_EmergencyStop* _msg = _internal_mutable_emergencystop();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.emergencystop)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_emergencystop(::server::TrainControlResponse_EmergencyStop* emergencystop) {
-  delete emergencystop_;
-  emergencystop_ = emergencystop;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.emergencystop_;
+  }
   if (emergencystop) {
-    set_has_emergencystop();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(emergencystop);
+    if (message_arena != submessage_arena) {
+      emergencystop = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, emergencystop, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_emergencystop();
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.emergencystop_ = emergencystop;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.emergencystop)
 }
 
 // optional group RpcResponse = 16 { ... };
-inline bool TrainControlResponse::has_rpcresponse() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void TrainControlResponse::set_has_rpcresponse() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool TrainControlResponse::_internal_has_rpcresponse() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rpcresponse_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::clear_has_rpcresponse() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool TrainControlResponse::has_rpcresponse() const {
+  return _internal_has_rpcresponse();
 }
 inline void TrainControlResponse::clear_rpcresponse() {
-  if (rpcresponse_ != NULL) rpcresponse_->::server::TrainControlResponse_RpcResponse::Clear();
-  clear_has_rpcresponse();
+  if (_impl_.rpcresponse_ != nullptr) _impl_.rpcresponse_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::server::TrainControlResponse_RpcResponse& TrainControlResponse::_internal_rpcresponse() const {
+  const ::server::TrainControlResponse_RpcResponse* p = _impl_.rpcresponse_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_RpcResponse&>(
+      ::server::_TrainControlResponse_RpcResponse_default_instance_);
 }
 inline const ::server::TrainControlResponse_RpcResponse& TrainControlResponse::rpcresponse() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.rpcresponse)
-  return rpcresponse_ != NULL ? *rpcresponse_ : *default_instance_->rpcresponse_;
+  return _internal_rpcresponse();
 }
-inline ::server::TrainControlResponse_RpcResponse* TrainControlResponse::mutable_rpcresponse() {
-  set_has_rpcresponse();
-  if (rpcresponse_ == NULL) {
-    rpcresponse_ = new ::server::TrainControlResponse_RpcResponse;
+inline void TrainControlResponse::unsafe_arena_set_allocated_rpcresponse(
+    ::server::TrainControlResponse_RpcResponse* rpcresponse) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rpcresponse_);
+  }
+  _impl_.rpcresponse_ = rpcresponse;
+  if (rpcresponse) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.rpcresponse)
-  return rpcresponse_;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.rpcresponse)
 }
 inline ::server::TrainControlResponse_RpcResponse* TrainControlResponse::release_rpcresponse() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::server::TrainControlResponse_RpcResponse* temp = _impl_.rpcresponse_;
+  _impl_.rpcresponse_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_RpcResponse* TrainControlResponse::unsafe_arena_release_rpcresponse() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.rpcresponse)
-  clear_has_rpcresponse();
-  ::server::TrainControlResponse_RpcResponse* temp = rpcresponse_;
-  rpcresponse_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::server::TrainControlResponse_RpcResponse* temp = _impl_.rpcresponse_;
+  _impl_.rpcresponse_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_RpcResponse* TrainControlResponse::_internal_mutable_rpcresponse() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.rpcresponse_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_RpcResponse>(GetArenaForAllocation());
+    _impl_.rpcresponse_ = p;
+  }
+  return _impl_.rpcresponse_;
+}
+inline ::server::TrainControlResponse_RpcResponse* TrainControlResponse::mutable_rpcresponse() {
+  ::server::TrainControlResponse_RpcResponse* _msg = _internal_mutable_rpcresponse();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.rpcresponse)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_rpcresponse(::server::TrainControlResponse_RpcResponse* rpcresponse) {
-  delete rpcresponse_;
-  rpcresponse_ = rpcresponse;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rpcresponse_;
+  }
   if (rpcresponse) {
-    set_has_rpcresponse();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rpcresponse);
+    if (message_arena != submessage_arena) {
+      rpcresponse = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rpcresponse, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_rpcresponse();
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.rpcresponse_ = rpcresponse;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.rpcresponse)
 }
 
 // optional group Pong = 19 { ... };
-inline bool TrainControlResponse::has_pong() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool TrainControlResponse::_internal_has_pong() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pong_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::set_has_pong() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void TrainControlResponse::clear_has_pong() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool TrainControlResponse::has_pong() const {
+  return _internal_has_pong();
 }
 inline void TrainControlResponse::clear_pong() {
-  if (pong_ != NULL) pong_->::server::TrainControlResponse_Pong::Clear();
-  clear_has_pong();
+  if (_impl_.pong_ != nullptr) _impl_.pong_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::server::TrainControlResponse_Pong& TrainControlResponse::_internal_pong() const {
+  const ::server::TrainControlResponse_Pong* p = _impl_.pong_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_Pong&>(
+      ::server::_TrainControlResponse_Pong_default_instance_);
 }
 inline const ::server::TrainControlResponse_Pong& TrainControlResponse::pong() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.pong)
-  return pong_ != NULL ? *pong_ : *default_instance_->pong_;
+  return _internal_pong();
 }
-inline ::server::TrainControlResponse_Pong* TrainControlResponse::mutable_pong() {
-  set_has_pong();
-  if (pong_ == NULL) {
-    pong_ = new ::server::TrainControlResponse_Pong;
+inline void TrainControlResponse::unsafe_arena_set_allocated_pong(
+    ::server::TrainControlResponse_Pong* pong) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pong_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.pong)
-  return pong_;
+  _impl_.pong_ = pong;
+  if (pong) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.pong)
 }
 inline ::server::TrainControlResponse_Pong* TrainControlResponse::release_pong() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::server::TrainControlResponse_Pong* temp = _impl_.pong_;
+  _impl_.pong_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_Pong* TrainControlResponse::unsafe_arena_release_pong() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.pong)
-  clear_has_pong();
-  ::server::TrainControlResponse_Pong* temp = pong_;
-  pong_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::server::TrainControlResponse_Pong* temp = _impl_.pong_;
+  _impl_.pong_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_Pong* TrainControlResponse::_internal_mutable_pong() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.pong_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_Pong>(GetArenaForAllocation());
+    _impl_.pong_ = p;
+  }
+  return _impl_.pong_;
+}
+inline ::server::TrainControlResponse_Pong* TrainControlResponse::mutable_pong() {
+  ::server::TrainControlResponse_Pong* _msg = _internal_mutable_pong();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.pong)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_pong(::server::TrainControlResponse_Pong* pong) {
-  delete pong_;
-  pong_ = pong;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pong_;
+  }
   if (pong) {
-    set_has_pong();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pong);
+    if (message_arena != submessage_arena) {
+      pong = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pong, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    clear_has_pong();
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
+  _impl_.pong_ = pong;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.pong)
 }
 
 // optional group CurrentAddress = 21 { ... };
-inline bool TrainControlResponse::has_currentaddress() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void TrainControlResponse::set_has_currentaddress() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool TrainControlResponse::_internal_has_currentaddress() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.currentaddress_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::clear_has_currentaddress() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool TrainControlResponse::has_currentaddress() const {
+  return _internal_has_currentaddress();
 }
 inline void TrainControlResponse::clear_currentaddress() {
-  if (currentaddress_ != NULL) currentaddress_->::server::TrainControlResponse_CurrentAddress::Clear();
-  clear_has_currentaddress();
+  if (_impl_.currentaddress_ != nullptr) _impl_.currentaddress_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::server::TrainControlResponse_CurrentAddress& TrainControlResponse::_internal_currentaddress() const {
+  const ::server::TrainControlResponse_CurrentAddress* p = _impl_.currentaddress_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_CurrentAddress&>(
+      ::server::_TrainControlResponse_CurrentAddress_default_instance_);
 }
 inline const ::server::TrainControlResponse_CurrentAddress& TrainControlResponse::currentaddress() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.currentaddress)
-  return currentaddress_ != NULL ? *currentaddress_ : *default_instance_->currentaddress_;
+  return _internal_currentaddress();
 }
-inline ::server::TrainControlResponse_CurrentAddress* TrainControlResponse::mutable_currentaddress() {
-  set_has_currentaddress();
-  if (currentaddress_ == NULL) {
-    currentaddress_ = new ::server::TrainControlResponse_CurrentAddress;
+inline void TrainControlResponse::unsafe_arena_set_allocated_currentaddress(
+    ::server::TrainControlResponse_CurrentAddress* currentaddress) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.currentaddress_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.currentaddress)
-  return currentaddress_;
+  _impl_.currentaddress_ = currentaddress;
+  if (currentaddress) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.currentaddress)
 }
 inline ::server::TrainControlResponse_CurrentAddress* TrainControlResponse::release_currentaddress() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::server::TrainControlResponse_CurrentAddress* temp = _impl_.currentaddress_;
+  _impl_.currentaddress_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_CurrentAddress* TrainControlResponse::unsafe_arena_release_currentaddress() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.currentaddress)
-  clear_has_currentaddress();
-  ::server::TrainControlResponse_CurrentAddress* temp = currentaddress_;
-  currentaddress_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::server::TrainControlResponse_CurrentAddress* temp = _impl_.currentaddress_;
+  _impl_.currentaddress_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_CurrentAddress* TrainControlResponse::_internal_mutable_currentaddress() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.currentaddress_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_CurrentAddress>(GetArenaForAllocation());
+    _impl_.currentaddress_ = p;
+  }
+  return _impl_.currentaddress_;
+}
+inline ::server::TrainControlResponse_CurrentAddress* TrainControlResponse::mutable_currentaddress() {
+  ::server::TrainControlResponse_CurrentAddress* _msg = _internal_mutable_currentaddress();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.currentaddress)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_currentaddress(::server::TrainControlResponse_CurrentAddress* currentaddress) {
-  delete currentaddress_;
-  currentaddress_ = currentaddress;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.currentaddress_;
+  }
   if (currentaddress) {
-    set_has_currentaddress();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(currentaddress);
+    if (message_arena != submessage_arena) {
+      currentaddress = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, currentaddress, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
   } else {
-    clear_has_currentaddress();
+    _impl_._has_bits_[0] &= ~0x00000020u;
   }
+  _impl_.currentaddress_ = currentaddress;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.currentaddress)
 }
 
 // optional group RawCanPacket = 23 { ... };
-inline bool TrainControlResponse::has_rawcanpacket() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+inline bool TrainControlResponse::_internal_has_rawcanpacket() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rawcanpacket_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::set_has_rawcanpacket() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void TrainControlResponse::clear_has_rawcanpacket() {
-  _has_bits_[0] &= ~0x00000040u;
+inline bool TrainControlResponse::has_rawcanpacket() const {
+  return _internal_has_rawcanpacket();
 }
 inline void TrainControlResponse::clear_rawcanpacket() {
-  if (rawcanpacket_ != NULL) rawcanpacket_->::server::TrainControlResponse_RawCanPacket::Clear();
-  clear_has_rawcanpacket();
+  if (_impl_.rawcanpacket_ != nullptr) _impl_.rawcanpacket_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::server::TrainControlResponse_RawCanPacket& TrainControlResponse::_internal_rawcanpacket() const {
+  const ::server::TrainControlResponse_RawCanPacket* p = _impl_.rawcanpacket_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_RawCanPacket&>(
+      ::server::_TrainControlResponse_RawCanPacket_default_instance_);
 }
 inline const ::server::TrainControlResponse_RawCanPacket& TrainControlResponse::rawcanpacket() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.rawcanpacket)
-  return rawcanpacket_ != NULL ? *rawcanpacket_ : *default_instance_->rawcanpacket_;
+  return _internal_rawcanpacket();
 }
-inline ::server::TrainControlResponse_RawCanPacket* TrainControlResponse::mutable_rawcanpacket() {
-  set_has_rawcanpacket();
-  if (rawcanpacket_ == NULL) {
-    rawcanpacket_ = new ::server::TrainControlResponse_RawCanPacket;
+inline void TrainControlResponse::unsafe_arena_set_allocated_rawcanpacket(
+    ::server::TrainControlResponse_RawCanPacket* rawcanpacket) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rawcanpacket_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.rawcanpacket)
-  return rawcanpacket_;
+  _impl_.rawcanpacket_ = rawcanpacket;
+  if (rawcanpacket) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.rawcanpacket)
 }
 inline ::server::TrainControlResponse_RawCanPacket* TrainControlResponse::release_rawcanpacket() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::server::TrainControlResponse_RawCanPacket* temp = _impl_.rawcanpacket_;
+  _impl_.rawcanpacket_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_RawCanPacket* TrainControlResponse::unsafe_arena_release_rawcanpacket() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.rawcanpacket)
-  clear_has_rawcanpacket();
-  ::server::TrainControlResponse_RawCanPacket* temp = rawcanpacket_;
-  rawcanpacket_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::server::TrainControlResponse_RawCanPacket* temp = _impl_.rawcanpacket_;
+  _impl_.rawcanpacket_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_RawCanPacket* TrainControlResponse::_internal_mutable_rawcanpacket() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.rawcanpacket_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_RawCanPacket>(GetArenaForAllocation());
+    _impl_.rawcanpacket_ = p;
+  }
+  return _impl_.rawcanpacket_;
+}
+inline ::server::TrainControlResponse_RawCanPacket* TrainControlResponse::mutable_rawcanpacket() {
+  ::server::TrainControlResponse_RawCanPacket* _msg = _internal_mutable_rawcanpacket();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.rawcanpacket)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_rawcanpacket(::server::TrainControlResponse_RawCanPacket* rawcanpacket) {
-  delete rawcanpacket_;
-  rawcanpacket_ = rawcanpacket;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rawcanpacket_;
+  }
   if (rawcanpacket) {
-    set_has_rawcanpacket();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rawcanpacket);
+    if (message_arena != submessage_arena) {
+      rawcanpacket = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rawcanpacket, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
   } else {
-    clear_has_rawcanpacket();
+    _impl_._has_bits_[0] &= ~0x00000040u;
   }
+  _impl_.rawcanpacket_ = rawcanpacket;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.rawcanpacket)
 }
 
 // optional group ReflashAutomata = 27 { ... };
-inline bool TrainControlResponse::has_reflashautomata() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void TrainControlResponse::set_has_reflashautomata() {
-  _has_bits_[0] |= 0x00000080u;
+inline bool TrainControlResponse::_internal_has_reflashautomata() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.reflashautomata_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::clear_has_reflashautomata() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool TrainControlResponse::has_reflashautomata() const {
+  return _internal_has_reflashautomata();
 }
 inline void TrainControlResponse::clear_reflashautomata() {
-  if (reflashautomata_ != NULL) reflashautomata_->::server::TrainControlResponse_ReflashAutomata::Clear();
-  clear_has_reflashautomata();
+  if (_impl_.reflashautomata_ != nullptr) _impl_.reflashautomata_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::server::TrainControlResponse_ReflashAutomata& TrainControlResponse::_internal_reflashautomata() const {
+  const ::server::TrainControlResponse_ReflashAutomata* p = _impl_.reflashautomata_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_ReflashAutomata&>(
+      ::server::_TrainControlResponse_ReflashAutomata_default_instance_);
 }
 inline const ::server::TrainControlResponse_ReflashAutomata& TrainControlResponse::reflashautomata() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.reflashautomata)
-  return reflashautomata_ != NULL ? *reflashautomata_ : *default_instance_->reflashautomata_;
+  return _internal_reflashautomata();
 }
-inline ::server::TrainControlResponse_ReflashAutomata* TrainControlResponse::mutable_reflashautomata() {
-  set_has_reflashautomata();
-  if (reflashautomata_ == NULL) {
-    reflashautomata_ = new ::server::TrainControlResponse_ReflashAutomata;
+inline void TrainControlResponse::unsafe_arena_set_allocated_reflashautomata(
+    ::server::TrainControlResponse_ReflashAutomata* reflashautomata) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reflashautomata_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.reflashautomata)
-  return reflashautomata_;
+  _impl_.reflashautomata_ = reflashautomata;
+  if (reflashautomata) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.reflashautomata)
 }
 inline ::server::TrainControlResponse_ReflashAutomata* TrainControlResponse::release_reflashautomata() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::server::TrainControlResponse_ReflashAutomata* temp = _impl_.reflashautomata_;
+  _impl_.reflashautomata_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_ReflashAutomata* TrainControlResponse::unsafe_arena_release_reflashautomata() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.reflashautomata)
-  clear_has_reflashautomata();
-  ::server::TrainControlResponse_ReflashAutomata* temp = reflashautomata_;
-  reflashautomata_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::server::TrainControlResponse_ReflashAutomata* temp = _impl_.reflashautomata_;
+  _impl_.reflashautomata_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_ReflashAutomata* TrainControlResponse::_internal_mutable_reflashautomata() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.reflashautomata_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_ReflashAutomata>(GetArenaForAllocation());
+    _impl_.reflashautomata_ = p;
+  }
+  return _impl_.reflashautomata_;
+}
+inline ::server::TrainControlResponse_ReflashAutomata* TrainControlResponse::mutable_reflashautomata() {
+  ::server::TrainControlResponse_ReflashAutomata* _msg = _internal_mutable_reflashautomata();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.reflashautomata)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_reflashautomata(::server::TrainControlResponse_ReflashAutomata* reflashautomata) {
-  delete reflashautomata_;
-  reflashautomata_ = reflashautomata;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reflashautomata_;
+  }
   if (reflashautomata) {
-    set_has_reflashautomata();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reflashautomata);
+    if (message_arena != submessage_arena) {
+      reflashautomata = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reflashautomata, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
   } else {
-    clear_has_reflashautomata();
+    _impl_._has_bits_[0] &= ~0x00000080u;
   }
+  _impl_.reflashautomata_ = reflashautomata;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.reflashautomata)
 }
 
 // optional group LokDb = 28 { ... };
-inline bool TrainControlResponse::has_lokdb() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+inline bool TrainControlResponse::_internal_has_lokdb() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.lokdb_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::set_has_lokdb() {
-  _has_bits_[0] |= 0x00000100u;
-}
-inline void TrainControlResponse::clear_has_lokdb() {
-  _has_bits_[0] &= ~0x00000100u;
+inline bool TrainControlResponse::has_lokdb() const {
+  return _internal_has_lokdb();
 }
 inline void TrainControlResponse::clear_lokdb() {
-  if (lokdb_ != NULL) lokdb_->::server::TrainControlResponse_LokDb::Clear();
-  clear_has_lokdb();
+  if (_impl_.lokdb_ != nullptr) _impl_.lokdb_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline const ::server::TrainControlResponse_LokDb& TrainControlResponse::_internal_lokdb() const {
+  const ::server::TrainControlResponse_LokDb* p = _impl_.lokdb_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_LokDb&>(
+      ::server::_TrainControlResponse_LokDb_default_instance_);
 }
 inline const ::server::TrainControlResponse_LokDb& TrainControlResponse::lokdb() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.lokdb)
-  return lokdb_ != NULL ? *lokdb_ : *default_instance_->lokdb_;
+  return _internal_lokdb();
 }
-inline ::server::TrainControlResponse_LokDb* TrainControlResponse::mutable_lokdb() {
-  set_has_lokdb();
-  if (lokdb_ == NULL) {
-    lokdb_ = new ::server::TrainControlResponse_LokDb;
+inline void TrainControlResponse::unsafe_arena_set_allocated_lokdb(
+    ::server::TrainControlResponse_LokDb* lokdb) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.lokdb_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.lokdb)
-  return lokdb_;
+  _impl_.lokdb_ = lokdb;
+  if (lokdb) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.lokdb)
 }
 inline ::server::TrainControlResponse_LokDb* TrainControlResponse::release_lokdb() {
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::server::TrainControlResponse_LokDb* temp = _impl_.lokdb_;
+  _impl_.lokdb_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_LokDb* TrainControlResponse::unsafe_arena_release_lokdb() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.lokdb)
-  clear_has_lokdb();
-  ::server::TrainControlResponse_LokDb* temp = lokdb_;
-  lokdb_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::server::TrainControlResponse_LokDb* temp = _impl_.lokdb_;
+  _impl_.lokdb_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_LokDb* TrainControlResponse::_internal_mutable_lokdb() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.lokdb_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_LokDb>(GetArenaForAllocation());
+    _impl_.lokdb_ = p;
+  }
+  return _impl_.lokdb_;
+}
+inline ::server::TrainControlResponse_LokDb* TrainControlResponse::mutable_lokdb() {
+  ::server::TrainControlResponse_LokDb* _msg = _internal_mutable_lokdb();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.lokdb)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_lokdb(::server::TrainControlResponse_LokDb* lokdb) {
-  delete lokdb_;
-  lokdb_ = lokdb;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.lokdb_;
+  }
   if (lokdb) {
-    set_has_lokdb();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(lokdb);
+    if (message_arena != submessage_arena) {
+      lokdb = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, lokdb, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
   } else {
-    clear_has_lokdb();
+    _impl_._has_bits_[0] &= ~0x00000100u;
   }
+  _impl_.lokdb_ = lokdb;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.lokdb)
 }
 
 // repeated .server.LokStateProto lokstate = 36;
+inline int TrainControlResponse::_internal_lokstate_size() const {
+  return _impl_.lokstate_.size();
+}
 inline int TrainControlResponse::lokstate_size() const {
-  return lokstate_.size();
+  return _internal_lokstate_size();
 }
 inline void TrainControlResponse::clear_lokstate() {
-  lokstate_.Clear();
+  _impl_.lokstate_.Clear();
+}
+inline ::server::LokStateProto* TrainControlResponse::mutable_lokstate(int index) {
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.lokstate)
+  return _impl_.lokstate_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto >*
+TrainControlResponse::mutable_lokstate() {
+  // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.lokstate)
+  return &_impl_.lokstate_;
+}
+inline const ::server::LokStateProto& TrainControlResponse::_internal_lokstate(int index) const {
+  return _impl_.lokstate_.Get(index);
 }
 inline const ::server::LokStateProto& TrainControlResponse::lokstate(int index) const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.lokstate)
-  return lokstate_.Get(index);
+  return _internal_lokstate(index);
 }
-inline ::server::LokStateProto* TrainControlResponse::mutable_lokstate(int index) {
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.lokstate)
-  return lokstate_.Mutable(index);
+inline ::server::LokStateProto* TrainControlResponse::_internal_add_lokstate() {
+  return _impl_.lokstate_.Add();
 }
 inline ::server::LokStateProto* TrainControlResponse::add_lokstate() {
+  ::server::LokStateProto* _add = _internal_add_lokstate();
   // @@protoc_insertion_point(field_add:server.TrainControlResponse.lokstate)
-  return lokstate_.Add();
-}
-inline ::google::protobuf::RepeatedPtrField< ::server::LokStateProto >*
-TrainControlResponse::mutable_lokstate() {
-  // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.lokstate)
-  return &lokstate_;
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::server::LokStateProto >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto >&
 TrainControlResponse::lokstate() const {
   // @@protoc_insertion_point(field_list:server.TrainControlResponse.lokstate)
-  return lokstate_;
+  return _impl_.lokstate_;
 }
 
 // optional group PicMisc = 37 { ... };
-inline bool TrainControlResponse::has_picmisc() const {
-  return (_has_bits_[0] & 0x00000400u) != 0;
+inline bool TrainControlResponse::_internal_has_picmisc() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.picmisc_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::set_has_picmisc() {
-  _has_bits_[0] |= 0x00000400u;
-}
-inline void TrainControlResponse::clear_has_picmisc() {
-  _has_bits_[0] &= ~0x00000400u;
+inline bool TrainControlResponse::has_picmisc() const {
+  return _internal_has_picmisc();
 }
 inline void TrainControlResponse::clear_picmisc() {
-  if (picmisc_ != NULL) picmisc_->::server::TrainControlResponse_PicMisc::Clear();
-  clear_has_picmisc();
+  if (_impl_.picmisc_ != nullptr) _impl_.picmisc_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline const ::server::TrainControlResponse_PicMisc& TrainControlResponse::_internal_picmisc() const {
+  const ::server::TrainControlResponse_PicMisc* p = _impl_.picmisc_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_PicMisc&>(
+      ::server::_TrainControlResponse_PicMisc_default_instance_);
 }
 inline const ::server::TrainControlResponse_PicMisc& TrainControlResponse::picmisc() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.picmisc)
-  return picmisc_ != NULL ? *picmisc_ : *default_instance_->picmisc_;
+  return _internal_picmisc();
 }
-inline ::server::TrainControlResponse_PicMisc* TrainControlResponse::mutable_picmisc() {
-  set_has_picmisc();
-  if (picmisc_ == NULL) {
-    picmisc_ = new ::server::TrainControlResponse_PicMisc;
+inline void TrainControlResponse::unsafe_arena_set_allocated_picmisc(
+    ::server::TrainControlResponse_PicMisc* picmisc) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.picmisc_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.picmisc)
-  return picmisc_;
+  _impl_.picmisc_ = picmisc;
+  if (picmisc) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.picmisc)
 }
 inline ::server::TrainControlResponse_PicMisc* TrainControlResponse::release_picmisc() {
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::server::TrainControlResponse_PicMisc* temp = _impl_.picmisc_;
+  _impl_.picmisc_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_PicMisc* TrainControlResponse::unsafe_arena_release_picmisc() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.picmisc)
-  clear_has_picmisc();
-  ::server::TrainControlResponse_PicMisc* temp = picmisc_;
-  picmisc_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::server::TrainControlResponse_PicMisc* temp = _impl_.picmisc_;
+  _impl_.picmisc_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_PicMisc* TrainControlResponse::_internal_mutable_picmisc() {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.picmisc_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_PicMisc>(GetArenaForAllocation());
+    _impl_.picmisc_ = p;
+  }
+  return _impl_.picmisc_;
+}
+inline ::server::TrainControlResponse_PicMisc* TrainControlResponse::mutable_picmisc() {
+  ::server::TrainControlResponse_PicMisc* _msg = _internal_mutable_picmisc();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.picmisc)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_picmisc(::server::TrainControlResponse_PicMisc* picmisc) {
-  delete picmisc_;
-  picmisc_ = picmisc;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.picmisc_;
+  }
   if (picmisc) {
-    set_has_picmisc();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(picmisc);
+    if (message_arena != submessage_arena) {
+      picmisc = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, picmisc, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
   } else {
-    clear_has_picmisc();
+    _impl_._has_bits_[0] &= ~0x00000200u;
   }
+  _impl_.picmisc_ = picmisc;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.picmisc)
 }
 
 // optional group ReflashPic = 43 { ... };
-inline bool TrainControlResponse::has_reflashpic() const {
-  return (_has_bits_[0] & 0x00000800u) != 0;
-}
-inline void TrainControlResponse::set_has_reflashpic() {
-  _has_bits_[0] |= 0x00000800u;
+inline bool TrainControlResponse::_internal_has_reflashpic() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.reflashpic_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::clear_has_reflashpic() {
-  _has_bits_[0] &= ~0x00000800u;
+inline bool TrainControlResponse::has_reflashpic() const {
+  return _internal_has_reflashpic();
 }
 inline void TrainControlResponse::clear_reflashpic() {
-  if (reflashpic_ != NULL) reflashpic_->::server::TrainControlResponse_ReflashPic::Clear();
-  clear_has_reflashpic();
+  if (_impl_.reflashpic_ != nullptr) _impl_.reflashpic_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline const ::server::TrainControlResponse_ReflashPic& TrainControlResponse::_internal_reflashpic() const {
+  const ::server::TrainControlResponse_ReflashPic* p = _impl_.reflashpic_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_ReflashPic&>(
+      ::server::_TrainControlResponse_ReflashPic_default_instance_);
 }
 inline const ::server::TrainControlResponse_ReflashPic& TrainControlResponse::reflashpic() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.reflashpic)
-  return reflashpic_ != NULL ? *reflashpic_ : *default_instance_->reflashpic_;
+  return _internal_reflashpic();
 }
-inline ::server::TrainControlResponse_ReflashPic* TrainControlResponse::mutable_reflashpic() {
-  set_has_reflashpic();
-  if (reflashpic_ == NULL) {
-    reflashpic_ = new ::server::TrainControlResponse_ReflashPic;
+inline void TrainControlResponse::unsafe_arena_set_allocated_reflashpic(
+    ::server::TrainControlResponse_ReflashPic* reflashpic) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reflashpic_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.reflashpic)
-  return reflashpic_;
+  _impl_.reflashpic_ = reflashpic;
+  if (reflashpic) {
+    _impl_._has_bits_[0] |= 0x00000400u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000400u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.reflashpic)
 }
 inline ::server::TrainControlResponse_ReflashPic* TrainControlResponse::release_reflashpic() {
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::server::TrainControlResponse_ReflashPic* temp = _impl_.reflashpic_;
+  _impl_.reflashpic_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_ReflashPic* TrainControlResponse::unsafe_arena_release_reflashpic() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.reflashpic)
-  clear_has_reflashpic();
-  ::server::TrainControlResponse_ReflashPic* temp = reflashpic_;
-  reflashpic_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+  ::server::TrainControlResponse_ReflashPic* temp = _impl_.reflashpic_;
+  _impl_.reflashpic_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_ReflashPic* TrainControlResponse::_internal_mutable_reflashpic() {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  if (_impl_.reflashpic_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_ReflashPic>(GetArenaForAllocation());
+    _impl_.reflashpic_ = p;
+  }
+  return _impl_.reflashpic_;
+}
+inline ::server::TrainControlResponse_ReflashPic* TrainControlResponse::mutable_reflashpic() {
+  ::server::TrainControlResponse_ReflashPic* _msg = _internal_mutable_reflashpic();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.reflashpic)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_reflashpic(::server::TrainControlResponse_ReflashPic* reflashpic) {
-  delete reflashpic_;
-  reflashpic_ = reflashpic;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reflashpic_;
+  }
   if (reflashpic) {
-    set_has_reflashpic();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reflashpic);
+    if (message_arena != submessage_arena) {
+      reflashpic = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reflashpic, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000400u;
   } else {
-    clear_has_reflashpic();
+    _impl_._has_bits_[0] &= ~0x00000400u;
   }
+  _impl_.reflashpic_ = reflashpic;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.reflashpic)
 }
 
 // optional group Cv = 45 { ... };
-inline bool TrainControlResponse::has_cv() const {
-  return (_has_bits_[0] & 0x00001000u) != 0;
+inline bool TrainControlResponse::_internal_has_cv() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.cv_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::set_has_cv() {
-  _has_bits_[0] |= 0x00001000u;
-}
-inline void TrainControlResponse::clear_has_cv() {
-  _has_bits_[0] &= ~0x00001000u;
+inline bool TrainControlResponse::has_cv() const {
+  return _internal_has_cv();
 }
 inline void TrainControlResponse::clear_cv() {
-  if (cv_ != NULL) cv_->::server::TrainControlResponse_Cv::Clear();
-  clear_has_cv();
+  if (_impl_.cv_ != nullptr) _impl_.cv_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline const ::server::TrainControlResponse_Cv& TrainControlResponse::_internal_cv() const {
+  const ::server::TrainControlResponse_Cv* p = _impl_.cv_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_Cv&>(
+      ::server::_TrainControlResponse_Cv_default_instance_);
 }
 inline const ::server::TrainControlResponse_Cv& TrainControlResponse::cv() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.cv)
-  return cv_ != NULL ? *cv_ : *default_instance_->cv_;
+  return _internal_cv();
 }
-inline ::server::TrainControlResponse_Cv* TrainControlResponse::mutable_cv() {
-  set_has_cv();
-  if (cv_ == NULL) {
-    cv_ = new ::server::TrainControlResponse_Cv;
+inline void TrainControlResponse::unsafe_arena_set_allocated_cv(
+    ::server::TrainControlResponse_Cv* cv) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.cv_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.cv)
-  return cv_;
+  _impl_.cv_ = cv;
+  if (cv) {
+    _impl_._has_bits_[0] |= 0x00000800u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000800u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.cv)
 }
 inline ::server::TrainControlResponse_Cv* TrainControlResponse::release_cv() {
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::server::TrainControlResponse_Cv* temp = _impl_.cv_;
+  _impl_.cv_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_Cv* TrainControlResponse::unsafe_arena_release_cv() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.cv)
-  clear_has_cv();
-  ::server::TrainControlResponse_Cv* temp = cv_;
-  cv_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+  ::server::TrainControlResponse_Cv* temp = _impl_.cv_;
+  _impl_.cv_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_Cv* TrainControlResponse::_internal_mutable_cv() {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  if (_impl_.cv_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_Cv>(GetArenaForAllocation());
+    _impl_.cv_ = p;
+  }
+  return _impl_.cv_;
+}
+inline ::server::TrainControlResponse_Cv* TrainControlResponse::mutable_cv() {
+  ::server::TrainControlResponse_Cv* _msg = _internal_mutable_cv();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.cv)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_cv(::server::TrainControlResponse_Cv* cv) {
-  delete cv_;
-  cv_ = cv;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.cv_;
+  }
   if (cv) {
-    set_has_cv();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(cv);
+    if (message_arena != submessage_arena) {
+      cv = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, cv, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000800u;
   } else {
-    clear_has_cv();
+    _impl_._has_bits_[0] &= ~0x00000800u;
   }
+  _impl_.cv_ = cv;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.cv)
 }
 
 // optional group WaitForChangeResponse = 52 { ... };
-inline bool TrainControlResponse::has_waitforchangeresponse() const {
-  return (_has_bits_[0] & 0x00002000u) != 0;
-}
-inline void TrainControlResponse::set_has_waitforchangeresponse() {
-  _has_bits_[0] |= 0x00002000u;
+inline bool TrainControlResponse::_internal_has_waitforchangeresponse() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.waitforchangeresponse_ != nullptr);
+  return value;
 }
-inline void TrainControlResponse::clear_has_waitforchangeresponse() {
-  _has_bits_[0] &= ~0x00002000u;
+inline bool TrainControlResponse::has_waitforchangeresponse() const {
+  return _internal_has_waitforchangeresponse();
 }
 inline void TrainControlResponse::clear_waitforchangeresponse() {
-  if (waitforchangeresponse_ != NULL) waitforchangeresponse_->::server::TrainControlResponse_WaitForChangeResponse::Clear();
-  clear_has_waitforchangeresponse();
+  if (_impl_.waitforchangeresponse_ != nullptr) _impl_.waitforchangeresponse_->Clear();
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline const ::server::TrainControlResponse_WaitForChangeResponse& TrainControlResponse::_internal_waitforchangeresponse() const {
+  const ::server::TrainControlResponse_WaitForChangeResponse* p = _impl_.waitforchangeresponse_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_WaitForChangeResponse&>(
+      ::server::_TrainControlResponse_WaitForChangeResponse_default_instance_);
 }
 inline const ::server::TrainControlResponse_WaitForChangeResponse& TrainControlResponse::waitforchangeresponse() const {
   // @@protoc_insertion_point(field_get:server.TrainControlResponse.waitforchangeresponse)
-  return waitforchangeresponse_ != NULL ? *waitforchangeresponse_ : *default_instance_->waitforchangeresponse_;
+  return _internal_waitforchangeresponse();
 }
-inline ::server::TrainControlResponse_WaitForChangeResponse* TrainControlResponse::mutable_waitforchangeresponse() {
-  set_has_waitforchangeresponse();
-  if (waitforchangeresponse_ == NULL) {
-    waitforchangeresponse_ = new ::server::TrainControlResponse_WaitForChangeResponse;
+inline void TrainControlResponse::unsafe_arena_set_allocated_waitforchangeresponse(
+    ::server::TrainControlResponse_WaitForChangeResponse* waitforchangeresponse) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.waitforchangeresponse_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.waitforchangeresponse)
-  return waitforchangeresponse_;
+  _impl_.waitforchangeresponse_ = waitforchangeresponse;
+  if (waitforchangeresponse) {
+    _impl_._has_bits_[0] |= 0x00001000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00001000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.waitforchangeresponse)
 }
 inline ::server::TrainControlResponse_WaitForChangeResponse* TrainControlResponse::release_waitforchangeresponse() {
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::server::TrainControlResponse_WaitForChangeResponse* temp = _impl_.waitforchangeresponse_;
+  _impl_.waitforchangeresponse_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_WaitForChangeResponse* TrainControlResponse::unsafe_arena_release_waitforchangeresponse() {
   // @@protoc_insertion_point(field_release:server.TrainControlResponse.waitforchangeresponse)
-  clear_has_waitforchangeresponse();
-  ::server::TrainControlResponse_WaitForChangeResponse* temp = waitforchangeresponse_;
-  waitforchangeresponse_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+  ::server::TrainControlResponse_WaitForChangeResponse* temp = _impl_.waitforchangeresponse_;
+  _impl_.waitforchangeresponse_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse_WaitForChangeResponse* TrainControlResponse::_internal_mutable_waitforchangeresponse() {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  if (_impl_.waitforchangeresponse_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_WaitForChangeResponse>(GetArenaForAllocation());
+    _impl_.waitforchangeresponse_ = p;
+  }
+  return _impl_.waitforchangeresponse_;
+}
+inline ::server::TrainControlResponse_WaitForChangeResponse* TrainControlResponse::mutable_waitforchangeresponse() {
+  ::server::TrainControlResponse_WaitForChangeResponse* _msg = _internal_mutable_waitforchangeresponse();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.waitforchangeresponse)
+  return _msg;
+}
 inline void TrainControlResponse::set_allocated_waitforchangeresponse(::server::TrainControlResponse_WaitForChangeResponse* waitforchangeresponse) {
-  delete waitforchangeresponse_;
-  waitforchangeresponse_ = waitforchangeresponse;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.waitforchangeresponse_;
+  }
   if (waitforchangeresponse) {
-    set_has_waitforchangeresponse();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(waitforchangeresponse);
+    if (message_arena != submessage_arena) {
+      waitforchangeresponse = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, waitforchangeresponse, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00001000u;
   } else {
-    clear_has_waitforchangeresponse();
+    _impl_._has_bits_[0] &= ~0x00001000u;
   }
+  _impl_.waitforchangeresponse_ = waitforchangeresponse;
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.waitforchangeresponse)
 }
 
+// optional group RpcStats = 55 { ... };
+inline bool TrainControlResponse::_internal_has_rpcstats() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rpcstats_ != nullptr);
+  return value;
+}
+inline bool TrainControlResponse::has_rpcstats() const {
+  return _internal_has_rpcstats();
+}
+inline void TrainControlResponse::clear_rpcstats() {
+  if (_impl_.rpcstats_ != nullptr) _impl_.rpcstats_->Clear();
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline const ::server::TrainControlResponse_RpcStats& TrainControlResponse::_internal_rpcstats() const {
+  const ::server::TrainControlResponse_RpcStats* p = _impl_.rpcstats_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse_RpcStats&>(
+      ::server::_TrainControlResponse_RpcStats_default_instance_);
+}
+inline const ::server::TrainControlResponse_RpcStats& TrainControlResponse::rpcstats() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.rpcstats)
+  return _internal_rpcstats();
+}
+inline void TrainControlResponse::unsafe_arena_set_allocated_rpcstats(
+    ::server::TrainControlResponse_RpcStats* rpcstats) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rpcstats_);
+  }
+  _impl_.rpcstats_ = rpcstats;
+  if (rpcstats) {
+    _impl_._has_bits_[0] |= 0x00002000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00002000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.rpcstats)
+}
+inline ::server::TrainControlResponse_RpcStats* TrainControlResponse::release_rpcstats() {
+  _impl_._has_bits_[0] &= ~0x00002000u;
+  ::server::TrainControlResponse_RpcStats* temp = _impl_.rpcstats_;
+  _impl_.rpcstats_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse_RpcStats* TrainControlResponse::unsafe_arena_release_rpcstats() {
+  // @@protoc_insertion_point(field_release:server.TrainControlResponse.rpcstats)
+  _impl_._has_bits_[0] &= ~0x00002000u;
+  ::server::TrainControlResponse_RpcStats* temp = _impl_.rpcstats_;
+  _impl_.rpcstats_ = nullptr;
+  return temp;
+}
+inline ::server::TrainControlResponse_RpcStats* TrainControlResponse::_internal_mutable_rpcstats() {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  if (_impl_.rpcstats_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_RpcStats>(GetArenaForAllocation());
+    _impl_.rpcstats_ = p;
+  }
+  return _impl_.rpcstats_;
+}
+inline ::server::TrainControlResponse_RpcStats* TrainControlResponse::mutable_rpcstats() {
+  ::server::TrainControlResponse_RpcStats* _msg = _internal_mutable_rpcstats();
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.rpcstats)
+  return _msg;
+}
+inline void TrainControlResponse::set_allocated_rpcstats(::server::TrainControlResponse_RpcStats* rpcstats) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rpcstats_;
+  }
+  if (rpcstats) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rpcstats);
+    if (message_arena != submessage_arena) {
+      rpcstats = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rpcstats, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00002000u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00002000u;
+  }
+  _impl_.rpcstats_ = rpcstats;
+  // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.rpcstats)
+}
+
 // -------------------------------------------------------------------
 
 // TinyRpcRequest
 
 // required int32 id = 1;
-inline bool TinyRpcRequest::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TinyRpcRequest::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TinyRpcRequest::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TinyRpcRequest::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TinyRpcRequest::has_id() const {
+  return _internal_has_id();
 }
 inline void TinyRpcRequest::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t TinyRpcRequest::_internal_id() const {
+  return _impl_.id_;
 }
-inline ::google::protobuf::int32 TinyRpcRequest::id() const {
+inline int32_t TinyRpcRequest::id() const {
   // @@protoc_insertion_point(field_get:server.TinyRpcRequest.id)
-  return id_;
+  return _internal_id();
 }
-inline void TinyRpcRequest::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void TinyRpcRequest::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
+}
+inline void TinyRpcRequest::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.TinyRpcRequest.id)
 }
 
 // required .server.TrainControlRequest request = 2;
-inline bool TinyRpcRequest::has_request() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TinyRpcRequest::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_ != nullptr);
+  return value;
 }
-inline void TinyRpcRequest::set_has_request() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TinyRpcRequest::clear_has_request() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TinyRpcRequest::has_request() const {
+  return _internal_has_request();
 }
 inline void TinyRpcRequest::clear_request() {
-  if (request_ != NULL) request_->::server::TrainControlRequest::Clear();
-  clear_has_request();
+  if (_impl_.request_ != nullptr) _impl_.request_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::server::TrainControlRequest& TinyRpcRequest::_internal_request() const {
+  const ::server::TrainControlRequest* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlRequest&>(
+      ::server::_TrainControlRequest_default_instance_);
 }
 inline const ::server::TrainControlRequest& TinyRpcRequest::request() const {
   // @@protoc_insertion_point(field_get:server.TinyRpcRequest.request)
-  return request_ != NULL ? *request_ : *default_instance_->request_;
+  return _internal_request();
 }
-inline ::server::TrainControlRequest* TinyRpcRequest::mutable_request() {
-  set_has_request();
-  if (request_ == NULL) {
-    request_ = new ::server::TrainControlRequest;
+inline void TinyRpcRequest::unsafe_arena_set_allocated_request(
+    ::server::TrainControlRequest* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TinyRpcRequest.request)
-  return request_;
+  _impl_.request_ = request;
+  if (request) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TinyRpcRequest.request)
 }
 inline ::server::TrainControlRequest* TinyRpcRequest::release_request() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::server::TrainControlRequest* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlRequest* TinyRpcRequest::unsafe_arena_release_request() {
   // @@protoc_insertion_point(field_release:server.TinyRpcRequest.request)
-  clear_has_request();
-  ::server::TrainControlRequest* temp = request_;
-  request_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::server::TrainControlRequest* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlRequest* TinyRpcRequest::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::server::TrainControlRequest* TinyRpcRequest::mutable_request() {
+  ::server::TrainControlRequest* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:server.TinyRpcRequest.request)
+  return _msg;
+}
 inline void TinyRpcRequest::set_allocated_request(::server::TrainControlRequest* request) {
-  delete request_;
-  request_ = request;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.request_;
+  }
   if (request) {
-    set_has_request();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_request();
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.request_ = request;
   // @@protoc_insertion_point(field_set_allocated:server.TinyRpcRequest.request)
 }
 
@@ -8283,152 +14659,228 @@ inline void TinyRpcRequest::set_allocated_request(::server::TrainControlRequest*
 // TinyRpcResponse
 
 // required int32 id = 1;
-inline bool TinyRpcResponse::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TinyRpcResponse::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TinyRpcResponse::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TinyRpcResponse::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TinyRpcResponse::has_id() const {
+  return _internal_has_id();
 }
 inline void TinyRpcResponse::clear_id() {
-  id_ = 0;
-  clear_has_id();
+  _impl_.id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline int32_t TinyRpcResponse::_internal_id() const {
+  return _impl_.id_;
 }
-inline ::google::protobuf::int32 TinyRpcResponse::id() const {
+inline int32_t TinyRpcResponse::id() const {
   // @@protoc_insertion_point(field_get:server.TinyRpcResponse.id)
-  return id_;
+  return _internal_id();
 }
-inline void TinyRpcResponse::set_id(::google::protobuf::int32 value) {
-  set_has_id();
-  id_ = value;
+inline void TinyRpcResponse::_internal_set_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.id_ = value;
+}
+inline void TinyRpcResponse::set_id(int32_t value) {
+  _internal_set_id(value);
   // @@protoc_insertion_point(field_set:server.TinyRpcResponse.id)
 }
 
 // optional .server.TrainControlResponse response = 4;
-inline bool TinyRpcResponse::has_response() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TinyRpcResponse::_internal_has_response() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.response_ != nullptr);
+  return value;
 }
-inline void TinyRpcResponse::set_has_response() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TinyRpcResponse::clear_has_response() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TinyRpcResponse::has_response() const {
+  return _internal_has_response();
 }
 inline void TinyRpcResponse::clear_response() {
-  if (response_ != NULL) response_->::server::TrainControlResponse::Clear();
-  clear_has_response();
+  if (_impl_.response_ != nullptr) _impl_.response_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::server::TrainControlResponse& TinyRpcResponse::_internal_response() const {
+  const ::server::TrainControlResponse* p = _impl_.response_;
+  return p != nullptr ? *p : reinterpret_cast<const ::server::TrainControlResponse&>(
+      ::server::_TrainControlResponse_default_instance_);
 }
 inline const ::server::TrainControlResponse& TinyRpcResponse::response() const {
   // @@protoc_insertion_point(field_get:server.TinyRpcResponse.response)
-  return response_ != NULL ? *response_ : *default_instance_->response_;
+  return _internal_response();
 }
-inline ::server::TrainControlResponse* TinyRpcResponse::mutable_response() {
-  set_has_response();
-  if (response_ == NULL) {
-    response_ = new ::server::TrainControlResponse;
+inline void TinyRpcResponse::unsafe_arena_set_allocated_response(
+    ::server::TrainControlResponse* response) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.response_);
   }
-  // @@protoc_insertion_point(field_mutable:server.TinyRpcResponse.response)
-  return response_;
+  _impl_.response_ = response;
+  if (response) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TinyRpcResponse.response)
 }
 inline ::server::TrainControlResponse* TinyRpcResponse::release_response() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::server::TrainControlResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::server::TrainControlResponse* TinyRpcResponse::unsafe_arena_release_response() {
   // @@protoc_insertion_point(field_release:server.TinyRpcResponse.response)
-  clear_has_response();
-  ::server::TrainControlResponse* temp = response_;
-  response_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::server::TrainControlResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
   return temp;
 }
+inline ::server::TrainControlResponse* TinyRpcResponse::_internal_mutable_response() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.response_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse>(GetArenaForAllocation());
+    _impl_.response_ = p;
+  }
+  return _impl_.response_;
+}
+inline ::server::TrainControlResponse* TinyRpcResponse::mutable_response() {
+  ::server::TrainControlResponse* _msg = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:server.TinyRpcResponse.response)
+  return _msg;
+}
 inline void TinyRpcResponse::set_allocated_response(::server::TrainControlResponse* response) {
-  delete response_;
-  response_ = response;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.response_;
+  }
   if (response) {
-    set_has_response();
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(response);
+    if (message_arena != submessage_arena) {
+      response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, response, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    clear_has_response();
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.response_ = response;
   // @@protoc_insertion_point(field_set_allocated:server.TinyRpcResponse.response)
 }
 
 // optional bool failed = 2 [default = false];
-inline bool TinyRpcResponse::has_failed() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TinyRpcResponse::set_has_failed() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool TinyRpcResponse::_internal_has_failed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void TinyRpcResponse::clear_has_failed() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TinyRpcResponse::has_failed() const {
+  return _internal_has_failed();
 }
 inline void TinyRpcResponse::clear_failed() {
-  failed_ = false;
-  clear_has_failed();
+  _impl_.failed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool TinyRpcResponse::_internal_failed() const {
+  return _impl_.failed_;
 }
 inline bool TinyRpcResponse::failed() const {
   // @@protoc_insertion_point(field_get:server.TinyRpcResponse.failed)
-  return failed_;
+  return _internal_failed();
+}
+inline void TinyRpcResponse::_internal_set_failed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.failed_ = value;
 }
 inline void TinyRpcResponse::set_failed(bool value) {
-  set_has_failed();
-  failed_ = value;
+  _internal_set_failed(value);
   // @@protoc_insertion_point(field_set:server.TinyRpcResponse.failed)
 }
 
 // optional string error_detail = 3;
-inline bool TinyRpcResponse::has_error_detail() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool TinyRpcResponse::_internal_has_error_detail() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TinyRpcResponse::set_has_error_detail() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void TinyRpcResponse::clear_has_error_detail() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool TinyRpcResponse::has_error_detail() const {
+  return _internal_has_error_detail();
 }
 inline void TinyRpcResponse::clear_error_detail() {
-  error_detail_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  clear_has_error_detail();
+  _impl_.error_detail_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::std::string& TinyRpcResponse::error_detail() const {
+inline const std::string& TinyRpcResponse::error_detail() const {
   // @@protoc_insertion_point(field_get:server.TinyRpcResponse.error_detail)
-  return error_detail_.GetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _internal_error_detail();
 }
-inline void TinyRpcResponse::set_error_detail(const ::std::string& value) {
-  set_has_error_detail();
-  error_detail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TinyRpcResponse::set_error_detail(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_detail_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:server.TinyRpcResponse.error_detail)
 }
-inline void TinyRpcResponse::set_error_detail(const char* value) {
-  set_has_error_detail();
-  error_detail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:server.TinyRpcResponse.error_detail)
+inline std::string* TinyRpcResponse::mutable_error_detail() {
+  std::string* _s = _internal_mutable_error_detail();
+  // @@protoc_insertion_point(field_mutable:server.TinyRpcResponse.error_detail)
+  return _s;
 }
-inline void TinyRpcResponse::set_error_detail(const char* value, size_t size) {
-  set_has_error_detail();
-  error_detail_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:server.TinyRpcResponse.error_detail)
+inline const std::string& TinyRpcResponse::_internal_error_detail() const {
+  return _impl_.error_detail_.Get();
 }
-inline ::std::string* TinyRpcResponse::mutable_error_detail() {
-  set_has_error_detail();
-  // @@protoc_insertion_point(field_mutable:server.TinyRpcResponse.error_detail)
-  return error_detail_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void TinyRpcResponse::_internal_set_error_detail(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_detail_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* TinyRpcResponse::release_error_detail() {
+inline std::string* TinyRpcResponse::_internal_mutable_error_detail() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_detail_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TinyRpcResponse::release_error_detail() {
   // @@protoc_insertion_point(field_release:server.TinyRpcResponse.error_detail)
-  clear_has_error_detail();
-  return error_detail_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (!_internal_has_error_detail()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_detail_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_detail_.IsDefault()) {
+    _impl_.error_detail_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void TinyRpcResponse::set_allocated_error_detail(::std::string* error_detail) {
-  if (error_detail != NULL) {
-    set_has_error_detail();
+inline void TinyRpcResponse::set_allocated_error_detail(std::string* error_detail) {
+  if (error_detail != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_error_detail();
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_detail_.SetAllocated(error_detail, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_detail_.IsDefault()) {
+    _impl_.error_detail_.Set("", GetArenaForAllocation());
   }
-  error_detail_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_detail);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:server.TinyRpcResponse.error_detail)
 }
 
-#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -8510,4 +14962,5 @@ inline void TinyRpcResponse::set_allocated_error_detail(::std::string* error_det
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_train_5fcontrol_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_train_5fcontrol_2eproto
@@ -7,16 +7,24 @@
 #include "can-queue.h"
 //#include "can.h"
 #include "can_frame.h"
+#include "can_tx_queue.hxx"
+#include "dcc_refresh_timer.hxx"
 #include "host_packet.h"
 #include "usb_proto.h"
 #include "mosta-master.h"
 #include "dcc-master.h"
 #include "pic_can.h"
 #include "custom/MCPCanFrameFormat.hxx"
+#include "utils/logging.h"
 
 //! File descriptor handling the CAN interface towards the DCC/MoSta CAN.
 static int mostacan_fd;
 
+//! Outgoing frames towards the DCC/MoSta CAN. The DCC and mobile station code
+//! only enqueue frames here (while holding dcc_mutex); the actual write
+//! happens on the queue's own thread.
+static CanTxQueue* mostacan_tx;
+
 //! Used by certain commands in the Mobile Station client code to override
 //! certain bits in the CAN header frame whilw reading a const progmem packet.
 uint8_t CANQueue_eidh_mask;
@@ -25,7 +33,8 @@ uint8_t CANQueue_eidh_mask;
 os_mutex_t dcc_mutex;
 
 
-void CANQueue_SendPacket_back(const uint8_t* packet, can_opts_t opts) {
+static void CANQueue_SendPacket_impl(const uint8_t* packet, can_opts_t opts,
+                                     bool priority) {
     struct can_frame frame = {0,};
     const uint8_t* data = packet;
     if (opts & (O_SKIP_TWO_BYTES)) data += 2;
@@ -35,8 +44,14 @@ void CANQueue_SendPacket_back(const uint8_t* packet, can_opts_t opts) {
       frame.can_id |= CANQueue_eidh_mask;
     }
 
-    int res = write(mostacan_fd, &frame, sizeof(frame));
-    ASSERT(res == sizeof(frame));
+    if (!mostacan_tx->send(frame, priority)) {
+        // The writer thread cannot keep up with the bus. Logs the 1st, 2nd,
+        // 4th, 8th... drop so that a stuck bus does not flood the log.
+        unsigned dropped = mostacan_tx->num_dropped();
+        if ((dropped & (dropped - 1)) == 0) {
+            LOG(WARNING, "dcc can: tx queue full, %u frames dropped", dropped);
+        }
+    }
 
     if (opts & O_HOST) {
         int len = data[4];
@@ -55,6 +70,15 @@ void CANQueue_SendPacket_back(const uint8_t* packet, can_opts_t opts) {
 }
 
 
+void CANQueue_SendPacket_back(const uint8_t* packet, can_opts_t opts) {
+    CANQueue_SendPacket_impl(packet, opts, false);
+}
+
+void CANQueue_SendPacket_front(const uint8_t* packet, can_opts_t opts) {
+    CANQueue_SendPacket_impl(packet, opts, true);
+}
+
+
 void can_frame_to_mcp_buffer(const struct can_frame& frame, uint8_t* pkt) {
     bracz_custom::frame_to_mcp(frame, pkt + CAN_START);
     pkt[0] = pkt[CAN_LEN] + 5 + 1;
@@ -90,8 +114,7 @@ void* dcc_can_thread(void*) {
 	can_destination = DST_CAN_INCOMING;
 	MoStaMaster_HandlePacket(pkt);
 	DccLoop_HandlePacket(pkt);
-	DccLoop_ProcessIO();
-	DccLoop_ProcessIO();
+	// Sending the refresh packets is left to the refresh timer.
 	bool send_to_host = can_destination & CDST_HOST;
 	ASSERT(can_pending == 0);
 	os_mutex_unlock(&dcc_mutex);
@@ -103,27 +126,18 @@ void* dcc_can_thread(void*) {
 }
 
 
-/* TODO: delete this entire file or do something about this timer.
-static long long dcc_timer_callback(void*, void*) {
-    os_mutex_lock(&dcc_mutex);
-    DccLoop_Timer();
-    MoStaMaster_Timer();
-    DccLoop_ProcessIO();
-    DccLoop_ProcessIO();
-    os_mutex_unlock(&dcc_mutex);
-    return OS_TIMER_RESTART; //SEC_TO_NSEC(1);
-    }
-
-    static os_timer_t dcc_timer; */
+static DccRefreshTimer* dcc_timer;
 
-void dcc_can_init(int devfd) {
+void dcc_can_init(int devfd, ExecutorBase* executor) {
     os_mutex_init(&dcc_mutex);
     mostacan_fd = devfd;
+    mostacan_tx = new CanTxQueue(devfd);
+    mostacan_tx->start("dcc_can_tx", 1, DCC_CAN_TX_THREAD_STACK_SIZE);
     DccLoop_Init();
-    /* TODO: delete this entire file or do something about this timer.
-    dcc_timer = os_timer_create(&dcc_timer_callback, NULL, NULL);
-    os_timer_start(dcc_timer, MSEC_TO_NSEC(100));
-    */
+    dcc_timer = new DccRefreshTimer(
+        executor, &dcc_mutex, MSEC_TO_NSEC(DCC_REFRESH_PERIOD_MSEC),
+        DCC_TIMER_PERIOD_MSEC / DCC_REFRESH_PERIOD_MSEC);
+    dcc_timer->start();
     os_thread_create(NULL, "dcc_can_rx", 0, DCC_CAN_THREAD_CAN_STACK_SIZE,
 		     dcc_can_thread, NULL);
 }
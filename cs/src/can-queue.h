@@ -27,12 +27,18 @@ typedef enum {
 
 void CANQueue_SendPacket_back(const uint8_t* packet, can_opts_t opts);
 
-// no separate _front implementation.
-#define CANQueue_SendPacket_front(p, o) CANQueue_SendPacket_back(p, o)
+// Enqueues a packet in the priority lane, ahead of all packets sent with
+// _back. Use for emergency stop and track power.
+void CANQueue_SendPacket_front(const uint8_t* packet, can_opts_t opts);
 
 extern uint8_t CANQueue_eidh_mask;
 
-void dcc_can_init(int devfd);
+class ExecutorBase;
+
+// Starts talking to the DCC controller and the Mobile Station on the CAN bus
+// at devfd. The periodic refresh of the state machines runs on a timer of
+// executor.
+void dcc_can_init(int devfd, ExecutorBase* executor);
 
 extern os_mutex_t dcc_mutex;
 
@@ -0,0 +1,79 @@
+#include <unistd.h>
+
+#include "cs_config.h"
+#include "can_tx_queue.hxx"
+
+CanTxQueue::CanTxQueue(int fd) : fd_(fd) {
+  os_sem_init(&sem_, 0);
+  os_sem_init(&exitSem_, 0);
+}
+
+CanTxQueue::~CanTxQueue() {
+  os_sem_destroy(&exitSem_);
+  os_sem_destroy(&sem_);
+}
+
+void CanTxQueue::start(const char* name, int priority, size_t stack_size) {
+  os_thread_create(NULL, name, priority, stack_size, &CanTxQueue::thread_entry,
+                   this);
+}
+
+void CanTxQueue::shutdown() {
+  {
+    AtomicHolder h(this);
+    exiting_ = true;
+  }
+  os_sem_post(&sem_);
+  os_sem_wait(&exitSem_);
+}
+
+bool CanTxQueue::send(const struct can_frame& frame, bool priority) {
+  bool was_empty;
+  {
+    AtomicHolder h(this);
+    was_empty = !priority_.count && !normal_.count;
+    bool ok = priority ? priority_.push(frame) : normal_.push(frame);
+    if (!ok) {
+      ++numDropped_;
+      return false;
+    }
+  }
+  if (was_empty) {
+    os_sem_post(&sem_);
+  }
+  return true;
+}
+
+void* CanTxQueue::thread_entry(void* arg) {
+  static_cast<CanTxQueue*>(arg)->writer_loop();
+  return NULL;
+}
+
+void CanTxQueue::writer_loop() {
+  struct can_frame batch[kMaxBatch];
+  while (true) {
+    unsigned n;
+    bool exiting;
+    {
+      AtomicHolder h(this);
+      n = priority_.pop(batch, kMaxBatch);
+      n += normal_.pop(batch + n, kMaxBatch - n);
+      exiting = exiting_;
+    }
+    if (!n) {
+      if (exiting) break;
+      os_sem_wait(&sem_);
+      continue;
+    }
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(batch);
+    size_t len = n * sizeof(batch[0]);
+    while (len) {
+      ssize_t ret = ::write(fd_, data, len);
+      ASSERT(ret > 0);
+      data += ret;
+      len -= ret;
+    }
+    ++numWrites_;
+  }
+  os_sem_post(&exitSem_);
+}
@@ -0,0 +1,91 @@
+#ifndef _BRACZ_TRAIN_CAN_TX_QUEUE_HXX_
+#define _BRACZ_TRAIN_CAN_TX_QUEUE_HXX_
+
+#include "can_frame.h"
+#include "os/os.h"
+#include "utils/Atomic.hxx"
+
+//! Outgoing queue of CAN frames with a dedicated writer thread. Senders only
+//! copy the frame into a ring buffer and never block on the device; the
+//! writer thread drains several frames per write() call. Frames sent with
+//! priority (e.g. emergency stop, track power) overtake the normal frames
+//! that are still queued.
+class CanTxQueue : private Atomic {
+ public:
+  //! How many normal frames can be queued. If full, new frames are dropped.
+  static const unsigned kQueueSize = 32;
+  //! How many priority frames can be queued.
+  static const unsigned kPriorityQueueSize = 4;
+  //! At most this many frames are handed to the device in one write() call.
+  static const unsigned kMaxBatch = 8;
+
+  //! @param fd is the device to write the frames to.
+  CanTxQueue(int fd);
+  //! If start() was called, shutdown() must be called first.
+  ~CanTxQueue();
+
+  //! Starts the writer thread. Frames sent before this call will be kept
+  //! until the thread starts.
+  void start(const char* name, int priority, size_t stack_size);
+
+  //! Stops the writer thread once it has written out all queued frames.
+  //! Blocks until the thread has exited. Frames sent after this call are
+  //! kept but never written.
+  void shutdown();
+
+  //! Enqueues a frame. Can be called from any thread.
+  //! @param frame is the frame to send.
+  //! @param priority if true, the frame goes ahead of all normal frames.
+  //! @return false if the queue was full and the frame was dropped.
+  bool send(const struct can_frame& frame, bool priority);
+
+  //! @return how many frames were dropped due to the queue being full.
+  unsigned num_dropped() { return numDropped_; }
+
+  //! @return how many write() calls the writer thread made.
+  unsigned num_writes() { return numWrites_; }
+
+ private:
+  //! Fixed size ring buffer of frames. Accessed under the Atomic lock.
+  template <unsigned N> struct Ring {
+    struct can_frame frames[N];
+    unsigned head = 0;
+    unsigned count = 0;
+
+    bool push(const struct can_frame& f) {
+      if (count >= N) return false;
+      frames[(head + count) % N] = f;
+      ++count;
+      return true;
+    }
+
+    //! Moves up to max frames to dst. @return number of frames moved.
+    unsigned pop(struct can_frame* dst, unsigned max) {
+      unsigned n = 0;
+      while (count && n < max) {
+        dst[n++] = frames[head];
+        head = (head + 1) % N;
+        --count;
+      }
+      return n;
+    }
+  };
+
+  static void* thread_entry(void* arg);
+  //! Main loop of the writer thread.
+  void writer_loop();
+
+  int fd_;
+  Ring<kPriorityQueueSize> priority_;
+  Ring<kQueueSize> normal_;
+  //! Posted when the queue becomes non-empty.
+  os_sem_t sem_;
+  //! Posted by the writer thread when it exits.
+  os_sem_t exitSem_;
+  //! Tells the writer thread to exit once the queue is empty.
+  bool exiting_ = false;
+  unsigned numDropped_ = 0;
+  unsigned numWrites_ = 0;
+};
+
+#endif // _BRACZ_TRAIN_CAN_TX_QUEUE_HXX_
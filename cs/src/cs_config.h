@@ -30,10 +30,21 @@ extern uint32_t blinker_pattern;
 //! How many entries of pending packets to send to the USB host we should
 //! maintain. Each entry costs 8 bytes.
 #define PACKET_TX_QUEUE_LENGTH 10
+//! Host packets with a payload up to this size come from a slab pool instead
+//! of malloc. Fits a CAN frame in MCP2515 format.
+#define PACKET_POOL_BLOCK_SIZE 16
+//! Number of blocks in the host packet slab pool.
+#define PACKET_POOL_COUNT 24
 
 ///////////
 
 #define DCC_CAN_THREAD_CAN_STACK_SIZE 1000
+#define DCC_CAN_TX_THREAD_STACK_SIZE 512
+//! How often the legacy DCC loop gets a chance to send refresh packets.
+#define DCC_REFRESH_PERIOD_MSEC 20
+//! Period of DccLoop_Timer and MoStaMaster_Timer. Must match HZ in
+//! mosta-master.cpp.
+#define DCC_TIMER_PERIOD_MSEC 100
 #define AUTOMATA_THREAD_STACK_SIZE 1700
 
 #define MAX_SIGNALS 64
@@ -552,7 +552,7 @@ void DccLoop_HandlePacket(const PacketBase& can_buf) {
     if (can_buf[CAN_D2]) {
       DccLoop_EmergencyStop();
     } else {
-      CANQueue_SendPacket((uint8_t*)dcc_go, O_LOG_AT);
+      CANQueue_SendPacket_front((uint8_t*)dcc_go, O_LOG_AT);
     }
   }
   while (SIDMATCH(0x4048) &&
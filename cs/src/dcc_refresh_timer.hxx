@@ -0,0 +1,65 @@
+#ifndef _BRACZ_TRAIN_DCC_REFRESH_TIMER_HXX_
+#define _BRACZ_TRAIN_DCC_REFRESH_TIMER_HXX_
+
+#include "os/os.h"
+#include "src/dcc-master.h"
+#include "src/mosta-master.h"
+#include "src/periodic_refresh_timer.hxx"
+
+//! Drives the DCC and MoSta state machines at a fixed rate, independent of
+//! the CAN traffic.
+class DccRefreshTimer : public PeriodicRefreshTimer {
+ public:
+  //! @param executor runs the timer.
+  //! @param mutex protects the state machines. The receive thread holds it
+  //! while it feeds a frame to them.
+  //! @param period_nsec is the time between two refreshes.
+  //! @param slow_divider tells how many refreshes make one period of the
+  //! timer functions.
+  DccRefreshTimer(ExecutorBase* executor, os_mutex_t* mutex,
+                  long long period_nsec, unsigned slow_divider)
+      : PeriodicRefreshTimer(executor, period_nsec, slow_divider),
+        mutex_(mutex) {}
+
+ protected:
+  //! Calls the timer functions of the state machines. Called with the mutex
+  //! held.
+  virtual void timer_functions() {
+    DccLoop_Timer();
+    MoStaMaster_Timer();
+  }
+
+  //! Lets the state machines send their packets. Called with the mutex held.
+  virtual void process_io() {
+    DccLoop_ProcessIO();
+    DccLoop_ProcessIO();
+  }
+
+ private:
+  void refresh() override {
+    // Waiting for the receive thread here would stall every other flow on
+    // the executor, so a busy mutex leaves the work to the next tick.
+    if (os_mutex_trylock(mutex_) != 0) {
+      return;
+    }
+    if (slowPending_) {
+      slowPending_ = false;
+      timer_functions();
+    }
+    process_io();
+    os_mutex_unlock(mutex_);
+  }
+
+  void slow_tick() override {
+    // Runs in the refresh() that follows, under the same lock. A skipped
+    // refresh keeps it pending, so no timer tick of the state machines is
+    // lost.
+    slowPending_ = true;
+  }
+
+  os_mutex_t* mutex_;
+  //! True if the timer functions of the state machines are due.
+  bool slowPending_ = false;
+};
+
+#endif // _BRACZ_TRAIN_DCC_REFRESH_TIMER_HXX_
@@ -1,4 +1,4 @@
-#include <map>
+#include <vector>
 #include <algorithm>
 
 #include "cs_config.h"
@@ -7,8 +7,52 @@
 using namespace std;
 
 struct EventRegistry::Impl {
-  typedef multimap<uint64_t, EventHandler*> Handlers;
-  Handlers handlers;
+  typedef pair<uint64_t, EventHandler*> Entry;
+  //! Handlers of specific events, sorted by event ID. Handlers of the same
+  //! event are in registration order.
+  vector<Entry> handlers;
+  //! Handlers to be called for every event, in registration order.
+  vector<EventHandler*> globals;
+  //! Incremented on every change to handlers or globals. Allows HandleEvent
+  //! to notice when a handler (un)registers something during dispatch.
+  unsigned generation = 0;
+
+  static bool entry_less(const Entry& e, uint64_t event) {
+    return e.first < event;
+  }
+
+  static bool event_less(uint64_t event, const Entry& e) {
+    return event < e.first;
+  }
+
+  //! @return the index of the first handler for event.
+  size_t lower_bound(uint64_t event) {
+    return std::lower_bound(handlers.begin(), handlers.end(), event,
+                            entry_less) -
+           handlers.begin();
+  }
+
+  //! @return the index of the first handler after the ones for event.
+  size_t upper_bound(uint64_t event) {
+    return std::upper_bound(handlers.begin(), handlers.end(), event,
+                            event_less) -
+           handlers.begin();
+  }
+
+  //! Finds where to continue the dispatch of event after the index was
+  //! modified by a handler.
+  //! @param begin is the current index of the first handler for event.
+  //! @param called is the handler that was called last.
+  //! @param offset is where called was within the handlers of event.
+  size_t resync(uint64_t event, size_t begin, EventHandler* called,
+                size_t offset) {
+    size_t end = upper_bound(event);
+    for (size_t i = begin; i < end; ++i) {
+      if (handlers[i].second == called) return i + 1;
+    }
+    // The called handler removed itself; the next one took its place.
+    return min(begin + offset, end);
+  }
 };
 
 EventRegistry::EventRegistry() {
@@ -23,29 +67,61 @@ EventRegistry::~EventRegistry() {
 }
 
 void EventRegistry::RegisterHandler(EventHandler* handler, uint64_t event) {
-  impl_->handlers.insert(make_pair(event, handler));
+  if (!event) {
+    impl_->globals.push_back(handler);
+  } else {
+    impl_->handlers.insert(
+        impl_->handlers.begin() + impl_->upper_bound(event),
+        make_pair(event, handler));
+  }
+  ++impl_->generation;
 }
 
 void EventRegistry::UnregisterHandler(EventHandler* handler, uint64_t event) {
-  auto r = impl_->handlers.equal_range(event);
-  for (auto it = r.first; it != r.second;) {
-    if (it->second == handler) {
-      it = impl_->handlers.erase(it);
-    } else {
-      ++it;
-    }
+  if (!event) {
+    auto& g = impl_->globals;
+    g.erase(remove(g.begin(), g.end(), handler), g.end());
+  } else {
+    auto& h = impl_->handlers;
+    auto begin = h.begin() + impl_->lower_bound(event);
+    auto end = h.begin() + impl_->upper_bound(event);
+    h.erase(remove_if(begin, end,
+                      [handler](const Impl::Entry& e) {
+                        return e.second == handler;
+                      }),
+            end);
   }
+  ++impl_->generation;
 }
 
 void EventRegistry::HandleEvent(uint64_t event) {
-  auto r = impl_->handlers.equal_range(event);
-  for (auto it = r.first; it != r.second; it++) {
-    it->second->HandleEvent(event);
+  Impl* impl = impl_;
+  unsigned gen = impl->generation;
+  size_t begin = impl->lower_bound(event);
+  for (size_t i = begin; i < impl->handlers.size() &&
+                         impl->handlers[i].first == event;) {
+    EventHandler* h = impl->handlers[i].second;
+    h->HandleEvent(event);
+    if (gen == impl->generation) {
+      ++i;
+    } else {
+      gen = impl->generation;
+      size_t offset = i - begin;
+      begin = impl->lower_bound(event);
+      i = impl->resync(event, begin, h, offset);
+    }
   }
   // Call global event handlers too.
-  r = impl_->handlers.equal_range(0);
-  for (auto it = r.first; it != r.second; it++) {
-    it->second->HandleEvent(event);
+  for (size_t i = 0; i < impl->globals.size();) {
+    EventHandler* h = impl->globals[i];
+    h->HandleEvent(event);
+    if (gen == impl->generation) {
+      ++i;
+    } else {
+      gen = impl->generation;
+      auto it = find(impl->globals.begin(), impl->globals.end(), h);
+      i = it == impl->globals.end() ? i : (it - impl->globals.begin()) + 1;
+    }
   }
 }
 
@@ -16,6 +16,7 @@
 
 #include "os/os.h"
 #include "utils/logging.h"
+#include "utils/Atomic.hxx"
 #include "utils/GridConnectHub.hxx"
 #include "executor/Service.hxx"
 #include "utils/Hub.hxx"
@@ -90,6 +91,113 @@ extern "C" { void start(void); }
 
 PacketQueue* PacketQueue::instance_ = NULL;
 
+namespace {
+
+//! Fixed set of equal-sized payload buffers. The blocks are handed out from a
+//! free list; any pointer into blocks_ is owned by the pool.
+class PacketPool : private Atomic {
+ public:
+  uint8_t* alloc() {
+    AtomicHolder h(this);
+    if (freeList_) {
+      Block* b = freeList_;
+      freeList_ = b->next;
+      --numFree_;
+      return b->data;
+    }
+    if (numUsed_ < PACKET_POOL_COUNT) {
+      --numFree_;
+      return blocks_[numUsed_++].data;
+    }
+    return NULL;
+  }
+
+  bool owns(const uint8_t* data) {
+    return data >= reinterpret_cast<const uint8_t*>(blocks_) &&
+           data < reinterpret_cast<const uint8_t*>(blocks_ + PACKET_POOL_COUNT);
+  }
+
+  void free(uint8_t* data) {
+    Block* b = reinterpret_cast<Block*>(data);
+    AtomicHolder h(this);
+    b->next = freeList_;
+    freeList_ = b;
+    ++numFree_;
+  }
+
+  unsigned num_free() {
+    return numFree_;
+  }
+
+ private:
+  union Block {
+    Block* next;
+    uint8_t data[PACKET_POOL_BLOCK_SIZE];
+  };
+  Block blocks_[PACKET_POOL_COUNT];
+  //! Returned blocks.
+  Block* freeList_ = NULL;
+  //! Blocks at and above this index have never been handed out.
+  unsigned numUsed_ = 0;
+  unsigned numFree_ = PACKET_POOL_COUNT;
+};
+
+PacketPool* packet_pool() {
+  static PacketPool pool;
+  return &pool;
+}
+
+}  // namespace
+
+uint8_t* packet_payload_alloc(size_t size) {
+  if (size <= PACKET_POOL_BLOCK_SIZE) {
+    uint8_t* data = packet_pool()->alloc();
+    if (data) return data;
+  }
+  return static_cast<uint8_t*>(malloc(size));
+}
+
+void packet_payload_free(uint8_t* data) {
+  if (!data) return;
+  if (packet_pool()->owns(data)) {
+    packet_pool()->free(data);
+  } else {
+    free(data);
+  }
+}
+
+unsigned packet_pool_available() {
+  return packet_pool()->num_free();
+}
+
+bool HostPacketReader::read_packet(bool synced, PacketBase* pkt) {
+  while (true) {
+    unsigned have = end_ - begin_;
+    if (have && !synced && buf_[begin_] != CMD_SYNC_LEN) {
+      // Drops one byte at a time until we find something that looks like
+      // the start of a sync packet.
+      ++begin_;
+      continue;
+    }
+    if (have && have > buf_[begin_]) {
+      unsigned size = buf_[begin_];
+      pkt->reset(size);
+      memcpy(pkt->buf(), buf_ + begin_ + 1, size);
+      begin_ += size + 1;
+      return true;
+    }
+    if (begin_ > 0) {
+      memmove(buf_, buf_ + begin_, have);
+      begin_ = 0;
+      end_ = have;
+    }
+    ssize_t ret = ::read(fd_, buf_ + end_, sizeof(buf_) - end_);
+    ++numReads_;
+    if (ret <= 0) return false;
+    end_ += ret;
+  }
+}
+
 void PacketQueue::initialize(CanHubFlow* openlcb_can, const char* serial_device, bool force_sync) {
   instance_ = new DefaultPacketQueue(openlcb_can, serial_device, force_sync);
 }
@@ -217,19 +325,12 @@ void DefaultPacketQueue::ForceInitialSync() {
 }
 
 void DefaultPacketQueue::RxThreadBody() {
-    uint8_t size;
+    // Too large for the thread's stack.
+    HostPacketReader* reader = new HostPacketReader(sync_fd_);
     while(1) {
-	ssize_t ret = read(sync_fd_, &size, 1);
-	ASSERT(ret == 1);
-        if (!synced_ && size != 15) continue;
-	PacketBase* pkt = new PacketBase(size);
-	uint8_t* buf = pkt->buf();
-	while (size) {
-	    ret = read(sync_fd_, buf, size);
-	    ASSERT(ret >= 0);
-	    buf += ret;
-	    size -= ret;
-	}
+	PacketBase* pkt = new PacketBase();
+	bool ok = reader->read_packet(synced_, pkt);
+	ASSERT(ok);
 	ProcessPacket(pkt);
     }
 }
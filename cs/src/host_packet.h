@@ -13,6 +13,15 @@
 
 class GCAdapterBase;
 
+//! Allocates the memory for a packet payload. Payloads up to
+//! PACKET_POOL_BLOCK_SIZE bytes come from a fixed slab pool; larger ones, or
+//! all when the pool is exhausted, fall back to malloc.
+uint8_t* packet_payload_alloc(size_t size);
+//! Releases memory returned by packet_payload_alloc. Accepts NULL.
+void packet_payload_free(uint8_t* data);
+//! @return how many blocks of the slab pool are currently free.
+unsigned packet_pool_available();
+
 class PacketBase {
 public:
     PacketBase()
@@ -21,12 +30,12 @@ public:
 
     explicit PacketBase(int size)
 	: size_(size),
-	  data_(static_cast<uint8_t*>(malloc(size))) {
+	  data_(packet_payload_alloc(size)) {
 	ASSERT(data_);
     }
 
     ~PacketBase() {
-	free(data_);
+	packet_payload_free(data_);
     }
 
     uint8_t& operator[](size_t offset) {
@@ -59,6 +68,14 @@ public:
 	data_ = NULL;
     }
 
+    //! Frees the current payload and allocates a new one.
+    void reset(int size) {
+	packet_payload_free(data_);
+	size_ = size;
+	data_ = packet_payload_alloc(size);
+	ASSERT(data_);
+    }
+
     vector<uint8_t> as_vector() const {
       return vector<uint8_t>(buf(), buf() + size());
     }
@@ -78,6 +95,34 @@ public:
 };
 
 
+//! Splits a byte stream of host packets (one length byte followed by that many
+//! bytes of payload) into packets. Reads in large chunks, so that many small
+//! packets come out of one read() call.
+class HostPacketReader {
+public:
+    //! @param fd is the file to read from. Must be in blocking mode.
+    HostPacketReader(int fd) : fd_(fd) {}
+
+    //! Blocks until the next packet arrives.
+    //! @param synced if false, skips bytes until a sync packet's length byte.
+    //! @param pkt will be reset to the payload of the packet.
+    //! @return false on end of file or error.
+    bool read_packet(bool synced, PacketBase* pkt);
+
+    //! @return how many read() calls were made.
+    unsigned num_reads() { return numReads_; }
+
+private:
+    int fd_;
+    //! Offset of the first unparsed byte in buf_.
+    unsigned begin_{0};
+    //! Offset past the last byte read into buf_.
+    unsigned end_{0};
+    unsigned numReads_{0};
+    //! Incoming bytes. A packet is at most 256 bytes long.
+    uint8_t buf_[512];
+};
+
 class PacketQueue {
 public:
     //! Returns the static instance of PacketQueue. Dies if packet queue is not running.
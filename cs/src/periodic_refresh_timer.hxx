@@ -0,0 +1,72 @@
+#ifndef _BRACZ_TRAIN_PERIODIC_REFRESH_TIMER_HXX_
+#define _BRACZ_TRAIN_PERIODIC_REFRESH_TIMER_HXX_
+
+#include "executor/Executor.hxx"
+#include "executor/Timer.hxx"
+
+//! Executor timer that calls into polled legacy state machines at a fixed
+//! rate, independent of how much traffic is arriving. Every tick calls
+//! refresh(); every slow_divider-th tick additionally calls slow_tick().
+class PeriodicRefreshTimer : public ::Timer {
+ public:
+  //! @param executor is the executor whose timers to use. The callbacks run
+  //! on this executor.
+  //! @param period_nsec is the time between two refresh() calls.
+  //! @param slow_divider tells how many refresh ticks make one slow tick.
+  PeriodicRefreshTimer(ExecutorBase* executor, long long period_nsec,
+                       unsigned slow_divider)
+      : Timer(executor->active_timers()),
+        periodNsec_(period_nsec),
+        slowDivider_(slow_divider) {}
+
+  //! Starts calling the state machines.
+  void start() {
+    stopped_ = false;
+    Timer::start(periodNsec_);
+  }
+
+  //! Stops the timer after the next tick. The object may be deleted once
+  //! is_running() returned false.
+  void stop() { stopped_ = true; }
+
+  //! @return false if the timer has stopped.
+  bool is_running() { return running_; }
+
+  //! @return the number of refresh ticks so far.
+  unsigned num_ticks() { return numTicks_; }
+
+ protected:
+  //! Called at every tick.
+  virtual void refresh() = 0;
+
+  //! Called at every slow_divider-th tick, before refresh().
+  virtual void slow_tick() = 0;
+
+ private:
+  long long timeout() override {
+    if (stopped_) {
+      running_ = false;
+      return NONE;
+    }
+    if (++slowCount_ >= slowDivider_) {
+      slowCount_ = 0;
+      slow_tick();
+    }
+    refresh();
+    ++numTicks_;
+    // Restarting keeps the expiry times on a fixed grid, so a slow callback
+    // does not add drift.
+    return RESTART;
+  }
+
+  long long periodNsec_;
+  unsigned slowDivider_;
+  unsigned slowCount_ = 0;
+  unsigned numTicks_ = 0;
+  //! Set by stop(), read on the executor.
+  volatile bool stopped_ = false;
+  //! Cleared on the executor when the timer has stopped.
+  volatile bool running_ = true;
+};
+
+#endif // _BRACZ_TRAIN_PERIODIC_REFRESH_TIMER_HXX_
@@ -66,6 +66,18 @@
 // Virtual COM port 3. Bytes in this packet will be forwarded to the
 // virtual serial port.
 #define CMD_VCOM3 0x26
+// Sequenced host packet, host to MCU only. data: sequence number (mod 256),
+// then a host packet including its command byte. The MCU executes these in
+// sequence order, acknowledges repeated ones without executing them again,
+// and rejects the ones that arrive ahead of a missing predecessor. A plain
+// CMD_SYNC restarts the sequence at zero. The host only sends these after
+// the MCU announced CAP_SEQ in CMD_CAPS.
+#define CMD_SEQ 0x27
+// Capabilities of the MCU, sent in reply to a plain CMD_SYNC. data: one byte
+// of capability bits (HostProtocolDefs::CAP_*). A CMD_SYNC datagram from the
+// host may carry one byte of host capability bits
+// (HostProtocolDefs::HOST_CAP_*) in turn.
+#define CMD_CAPS 0x28
 
 
 
@@ -140,7 +140,7 @@ DigitalIn startpin(p20);
 CanIf can1_interface(stack.service(), &can_hub1);
 bracz_custom::TrackIfSend track_send(&can_hub1);
 commandstation::UpdateProcessor cs_loop(stack.service(), &track_send);
-bracz_custom::TrackIfReceive track_recv(&can1_interface, &cs_loop);
+bracz_custom::TrackIfReceive track_recv(&can1_interface, &cs_loop, &track_send);
 static const uint64_t ON_EVENT_ID = 0x0501010114FF0004ULL;
 bracz_custom::TrackPowerOnOffBit on_off(ON_EVENT_ID, ON_EVENT_ID+1, &track_send);
 openlcb::BitEventConsumer powerbit(&on_off);
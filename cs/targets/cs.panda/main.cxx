@@ -68,6 +68,7 @@
 #include "custom/HostProtocol.hxx"
 
 #include "commandstation/UpdateProcessor.hxx"
+#include "commandstation/DccLatencyMonitor.hxx"
 #include "openlcb/TractionTrain.hxx"
 
 #include "custom/HostPacketCanPort.hxx"
@@ -108,7 +109,7 @@ void send_host_log_event(HostLogEvent e) {
 
 OVERRIDE_CONST(local_nodes_count, 30);
 OVERRIDE_CONST(local_alias_cache_size, 30);
-OVERRIDE_CONST(num_memory_spaces, 5);
+OVERRIDE_CONST(num_memory_spaces, 6);
 
 static const uint64_t EVENT_ID = 0x0501010114FF203AULL;
 const int main_priority = 2;
@@ -121,7 +122,12 @@ bracz_custom::AutomataControl automatas(stack.node(), stack.dg_service(), (const
 CanIf can1_interface(stack.service(), &can_hub1);
 bracz_custom::TrackIfSend track_send(&can_hub1);
 commandstation::UpdateProcessor cs_loop(stack.service(), &track_send);
-bracz_custom::TrackIfReceive track_recv(&can1_interface, &cs_loop);
+// Exports the latency histograms of the DCC packets if enabled.
+std::unique_ptr<commandstation::DccLatencyMonitor> latency_monitor(
+    config_dcc_latency_monitor()
+        ? new commandstation::DccLatencyMonitor(stack.memory_config_handler())
+        : nullptr);
+bracz_custom::TrackIfReceive track_recv(&can1_interface, &cs_loop, &track_send);
 static const uint64_t ON_EVENT_ID = 0x0501010114FF0004ULL;
 bracz_custom::TrackPowerOnOffBit on_off(ON_EVENT_ID, ON_EVENT_ID+1, &track_send);
 openlcb::BitEventConsumer powerbit(&on_off);
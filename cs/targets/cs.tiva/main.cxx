@@ -94,6 +94,9 @@ OVERRIDE_CONST(automata_init_backoff, 20000);
 OVERRIDE_CONST(dcc_packet_min_refresh_delay_ms, 1);
 OVERRIDE_CONST(num_datagram_registry_entries, 3);
 OVERRIDE_CONST(num_memory_spaces, 10);
+// Lets the bridged CAN frames wait up to 2 msec to share a datagram to the
+// host. Only hosts that announce HOST_CAP_PACKED get shared datagrams.
+OVERRIDE_CONST(host_bridge_latency_usec, 2000);
 
 
 namespace commandstation {
@@ -32,6 +32,7 @@
  * @date 7 Dec 2013
  */
 
+#include <signal.h>
 #include <stdio.h>
 #include <unistd.h>
 
@@ -46,6 +47,8 @@
 #include "utils/StringPrintf.hxx"
 #include "utils/HubDevice.hxx"
 #include "server/TrainControlService.hxx"
+#include "commandstation/RailcomCapture.hxx"
+#include "dcc/RailcomHub.hxx"
 
 static const openlcb::NodeID NODE_ID = 0x050101011472ULL;
 OVERRIDE_CONST(num_memory_spaces, 4);
@@ -60,6 +63,7 @@ uint64_t destination_nodeid = 0;
 uint16_t destination_alias = 0;
 const char *lokdb_path;
 string lokdb = "LokDb { }";
+const char *railcom_capture_path = nullptr;
 
 openlcb::SimpleCanStack stack(NODE_ID);
 
@@ -80,6 +84,7 @@ void usage(const char *e) {
   fprintf(stderr, R"usage(
  [-i destination_host] [-p port] [-d device_path] -l lokdb_path
             (-n nodeid | -a alias) [-f debugfd] [-R proxy_host] [-P proxy_port]
+            [-r railcom_capture_file]
 
 Host server for android train connections.
 
@@ -100,13 +105,18 @@ specified, then the two connections will be bridged.
 
         -l lokdb_path specifies the file from which to read the ascii lokdb
            from.
+
+        -r railcom_capture_file records the RailCom feedback that the RailCom
+           boards put on the bus with their debug proxy, for replaying it in
+           the RailcomCapture benchmark. The file is flushed every second and
+           when the server is stopped with SIGINT or SIGTERM.
 )usage");
   exit(1);
 }
 
 void parse_args(int argc, char *argv[]) {
   int opt;
-  while ((opt = getopt(argc, argv, "hp:i:d:n:a:R:P:l:f:")) >= 0) {
+  while ((opt = getopt(argc, argv, "hp:i:d:n:a:R:P:l:f:r:")) >= 0) {
     switch (opt) {
       case 'h':
         usage(argv[0]);
@@ -132,6 +142,9 @@ void parse_args(int argc, char *argv[]) {
       case 'l':
         lokdb_path = optarg;
         break;
+      case 'r':
+        railcom_capture_path = optarg;
+        break;
       case 'n':
         destination_nodeid = strtoll(optarg, nullptr, 16);
         break;
@@ -174,6 +187,23 @@ class CrashExitNotifiable : public Notifiable {
   const string msg_;
 };
 
+dcc::RailcomHubFlow railcom_hub(stack.service());
+commandstation::RailcomCaptureWriter *railcom_capture = nullptr;
+
+/// Waits for SIGINT or SIGTERM, then writes out the RailCom capture and
+/// exits. Runs in a thread of its own.
+void *capture_signal_thread(void *arg) {
+  sigset_t *set = static_cast<sigset_t *>(arg);
+  int sig;
+  sigwait(set, &sig);
+  // Stops recording and flushes the file.
+  delete railcom_capture;
+  LOG(INFO, "Signal %d, RailCom capture written to %s.", sig,
+      railcom_capture_path);
+  _exit(0);
+  return nullptr;
+}
+
 /** Entry point to application.
  * @param argc number of command line arguments
  * @param argv array of command line arguments
@@ -181,6 +211,20 @@ class CrashExitNotifiable : public Notifiable {
  */
 int appl_main(int argc, char *argv[]) {
   parse_args(argc, argv);
+  if (railcom_capture_path) {
+    // Before any other thread is started, so that they all inherit the mask
+    // and the signals end up in capture_signal_thread.
+    static sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGINT);
+    sigaddset(&set, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &set, nullptr);
+    new commandstation::RailcomDebugReceiver(stack.iface(), &railcom_hub);
+    railcom_capture = new commandstation::RailcomCaptureWriter(
+        &railcom_hub, railcom_capture_path);
+    os_thread_create(nullptr, "capture_signal", 0, 1024, capture_signal_thread,
+                     &set);
+  }
   if (lokdb_path) {
     LOG(INFO, "Loading lokdb from %s.", lokdb_path);
     load_lokdb(lokdb_path);
@@ -437,7 +437,7 @@ int appl_main(int argc, char *argv[])
 #ifndef SECOND
     int fd = open("/dev/canp1v0", O_RDWR);
     ASSERT(fd >= 0);
-    dcc_can_init(fd);
+    dcc_can_init(fd, &g_executor);
 #endif
 #endif
 
@@ -348,7 +348,7 @@ int appl_main(int argc, char* argv[]) {
   RailcomDefs::setup_debouncer_opts(overcurrent_debouncer_opts);
   
   static RailcomBroadcastFlow railcom_broadcast(
-      &railcom_hub, stack.node(), &occ_decoder, &over_decoder, nullptr, 6);
+      &railcom_hub, stack.node(), &occ_decoder, &over_decoder, nullptr, 6, 2);
 
   stack.add_can_port_select("/dev/can0");
   dac_thread.start("dac", 0, 600);